@@ -0,0 +1,131 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * angle_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/angles.hpp>
+#include <psst/math/polar_coord.hpp>
+#include <psst/math/vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t angle_count = 1 << 16;
+
+/** Loop based normalization the O(1) version replaced, kept for comparison */
+template <typename T>
+T
+loop_zero_to_two_pi(T angle)
+{
+    auto const two_pi = pi<T>::value * 2;
+    while (angle < 0)
+        angle += two_pi;
+    while (angle >= two_pi)
+        angle -= two_pi;
+    return angle;
+}
+
+/** Angles spread over [-turns, turns] full turns */
+template <typename T>
+std::vector<T>
+make_angles(std::int64_t turns)
+{
+    std::mt19937                      gen{42};
+    std::uniform_real_distribution<T> dist{-pi<T>::value * 2 * turns, pi<T>::value * 2 * turns};
+    std::vector<T>                    angles(angle_count);
+    for (auto& a : angles) {
+        a = dist(gen);
+    }
+    return angles;
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  Normalizing an array of angles, the argument is the magnitude in turns
+//----------------------------------------------------------------------------
+template <typename T>
+void
+AngleLoopNormalize(benchmark::State& state)
+{
+    auto const     source = make_angles<T>(state.range(0));
+    std::vector<T> data(source.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < source.size(); ++i) {
+            data[i] = loop_zero_to_two_pi(source[i]);
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+template <typename T>
+void
+AngleNormalize(benchmark::State& state)
+{
+    auto const     source = make_angles<T>(state.range(0));
+    std::vector<T> data(source.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < source.size(); ++i) {
+            data[i] = zero_to_two_pi(source[i]);
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+template <typename T>
+void
+AngleBatchNormalize(benchmark::State& state)
+{
+    auto const     source = make_angles<T>(state.range(0));
+    std::vector<T> data(source.size());
+    for (auto _ : state) {
+        data = source;
+        zero_to_two_pi(data.data(), data.size());
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+//----------------------------------------------------------------------------
+//  Accumulating rotation of polar coordinates, azimuth is clamped on write
+//----------------------------------------------------------------------------
+void
+PolarAzimuthUpdate(benchmark::State& state)
+{
+    auto const                       deltas = make_angles<double>(1);
+    std::vector<polar_coord<double>> coords(deltas.size(), polar_coord<double>{1, 0});
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < coords.size(); ++i) {
+            coords[i].azimuth() += deltas[i];
+        }
+        benchmark::DoNotOptimize(coords.data());
+    }
+    state.SetItemsProcessed(state.iterations() * coords.size());
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(AngleLoopNormalize,  float)->Arg(1)->Arg(100)->Arg(10000);
+BENCHMARK_TEMPLATE(AngleNormalize,      float)->Arg(1)->Arg(100)->Arg(10000);
+BENCHMARK_TEMPLATE(AngleBatchNormalize, float)->Arg(1)->Arg(100)->Arg(10000);
+BENCHMARK_TEMPLATE(AngleLoopNormalize,  double)->Arg(1)->Arg(100)->Arg(10000);
+BENCHMARK_TEMPLATE(AngleNormalize,      double)->Arg(1)->Arg(100)->Arg(10000);
+BENCHMARK_TEMPLATE(AngleBatchNormalize, double)->Arg(1)->Arg(100)->Arg(10000);
+BENCHMARK(PolarAzimuthUpdate);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
@@ -0,0 +1,387 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * color_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/colors.hpp>
+#include <psst/math/colors_batch.hpp>
+#include <psst/math/colors_lab.hpp>
+#include <psst/math/image.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+/** 4K UHD image */
+constexpr std::size_t image_width  = 3840;
+constexpr std::size_t image_height = 2160;
+constexpr std::size_t pixel_count  = image_width * image_height;
+
+template <typename Color>
+std::vector<typename Color::value_type>
+make_image()
+{
+    using value_type = typename Color::value_type;
+    std::vector<value_type> buffer(pixel_count * Color::size);
+    for (std::size_t y = 0; y < image_height; ++y) {
+        for (std::size_t x = 0; x < image_width; ++x) {
+            auto p = (y * image_width + x) * Color::size;
+            if constexpr (std::is_floating_point<value_type>::value) {
+                buffer[p + 0] = value_type(x) / image_width;
+                buffer[p + 1] = value_type(y) / image_height;
+                buffer[p + 2] = value_type((x + y) % 256) / 255;
+            } else {
+                buffer[p + 0] = x * 255 / image_width;
+                buffer[p + 1] = y * 255 / image_height;
+                buffer[p + 2] = (x + y) % 256;
+            }
+            for (std::size_t c = 3; c < Color::size; ++c) {
+                buffer[p + c] = std::is_floating_point<value_type>::value ? 1 : 255;
+            }
+        }
+    }
+    return buffer;
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  Colour space conversion of a 4K image
+//----------------------------------------------------------------------------
+template <typename Src, typename Dst>
+void
+ColorConvertPerPixel(benchmark::State& state)
+{
+    using dst_value = typename Dst::value_type;
+    auto                   src_buffer = make_image<Src>();
+    std::vector<dst_value> dst_buffer(pixel_count * Dst::size);
+    auto src = make_memory_vector_view<Src>(src_buffer.data(), src_buffer.size());
+    auto dst = make_memory_vector_view<Dst>(dst_buffer.data(), dst_buffer.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < pixel_count; ++i) {
+            dst[i] = convert<Dst>(Src{src[i]});
+        }
+        benchmark::DoNotOptimize(dst_buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * pixel_count);
+}
+
+template <typename Src, typename Dst>
+void
+ColorConvertBatch(benchmark::State& state)
+{
+    using dst_value = typename Dst::value_type;
+    auto                   src_buffer = make_image<Src>();
+    std::vector<dst_value> dst_buffer(pixel_count * Dst::size);
+    auto src = make_memory_vector_view<Src>(src_buffer.data(), src_buffer.size());
+    auto dst = make_memory_vector_view<Dst>(dst_buffer.data(), dst_buffer.size());
+    parallel_options opts;
+    opts.thread_count = state.range(0);
+    opts.grain        = image_width;
+    for (auto _ : state) {
+        color::convert_colors(src, dst, opts);
+        benchmark::DoNotOptimize(dst_buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * pixel_count);
+}
+
+//----------------------------------------------------------------------------
+//  Image pipeline
+//----------------------------------------------------------------------------
+void
+ImageUnpackPerPixel(benchmark::State& state)
+{
+    auto               src_buffer = make_image<color::rgba_hex>();
+    std::vector<float> dst_buffer(src_buffer.size());
+    auto src = make_memory_vector_view<color::rgba_hex>(src_buffer.data(), src_buffer.size());
+    auto dst = make_memory_vector_view<color::rgba<float>>(dst_buffer.data(), dst_buffer.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < pixel_count; ++i) {
+            dst[i] = convert<color::rgba<float>>(color::rgba_hex{src[i]});
+        }
+        benchmark::DoNotOptimize(dst_buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * pixel_count * 4);
+}
+
+void
+ImageUnpack(benchmark::State& state)
+{
+    auto               src_buffer = make_image<color::rgba_hex>();
+    std::vector<float> dst_buffer(src_buffer.size());
+    auto src = color::make_image_view<color::rgba_hex>(src_buffer.data(), image_width, image_height);
+    auto dst = color::make_image_view<color::rgba<float>>(dst_buffer.data(), image_width,
+                                                          image_height);
+    for (auto _ : state) {
+        color::unpack(src, dst, parallel_options::single_thread());
+        benchmark::DoNotOptimize(dst_buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * pixel_count * 4);
+}
+
+void
+ImagePack(benchmark::State& state)
+{
+    auto                      src_buffer = make_image<color::rgba<float>>();
+    std::vector<std::uint8_t> dst_buffer(src_buffer.size());
+    auto src = color::make_image_view<color::rgba<float>>(src_buffer.data(), image_width,
+                                                          image_height);
+    auto dst = color::make_image_view<color::rgba_hex>(dst_buffer.data(), image_width, image_height);
+    for (auto _ : state) {
+        color::pack(src, dst, parallel_options::single_thread());
+        benchmark::DoNotOptimize(dst_buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * pixel_count * 4);
+}
+
+void
+ImageSrgbToLinearPow(benchmark::State& state)
+{
+    auto               src_buffer = make_image<color::rgba_hex>();
+    std::vector<float> dst_buffer(src_buffer.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < src_buffer.size(); ++i) {
+            float c       = src_buffer[i] / 255.0f;
+            dst_buffer[i] = (i % 4 == 3)
+                                ? c
+                                : (c <= 0.04045f ? c / 12.92f
+                                                 : std::pow((c + 0.055f) / 1.055f, 2.4f));
+        }
+        benchmark::DoNotOptimize(dst_buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * pixel_count * 4);
+}
+
+void
+ImageSrgbToLinear(benchmark::State& state)
+{
+    auto               src_buffer = make_image<color::rgba_hex>();
+    std::vector<float> dst_buffer(src_buffer.size());
+    auto src = color::make_image_view<color::rgba_hex>(src_buffer.data(), image_width, image_height);
+    auto dst = color::make_image_view<color::rgba<float>>(dst_buffer.data(), image_width,
+                                                          image_height);
+    for (auto _ : state) {
+        color::srgb_to_linear(src, dst, parallel_options::single_thread());
+        benchmark::DoNotOptimize(dst_buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * pixel_count * 4);
+}
+
+void
+ImageLinearToSrgb(benchmark::State& state)
+{
+    auto                      src_buffer = make_image<color::rgba<float>>();
+    std::vector<std::uint8_t> dst_buffer(src_buffer.size());
+    auto src = color::make_image_view<color::rgba<float>>(src_buffer.data(), image_width,
+                                                          image_height);
+    auto dst = color::make_image_view<color::rgba_hex>(dst_buffer.data(), image_width, image_height);
+    for (auto _ : state) {
+        color::linear_to_srgb(src, dst, parallel_options::single_thread());
+        benchmark::DoNotOptimize(dst_buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * pixel_count * 4);
+}
+
+void
+ImagePremultiply(benchmark::State& state)
+{
+    auto buffer = make_image<color::rgba_hex>();
+    auto img    = color::make_image_view<color::rgba_hex>(buffer.data(), image_width, image_height);
+    for (auto _ : state) {
+        color::premultiply_alpha(img, parallel_options::single_thread());
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * pixel_count * 4);
+}
+
+namespace {
+
+constexpr std::size_t thumbnail_size  = 128;
+constexpr std::size_t thumbnail_count = 64;
+
+std::vector<std::uint8_t>
+make_thumbnail()
+{
+    std::vector<std::uint8_t> buffer(thumbnail_size * thumbnail_size * 4);
+    for (std::size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = static_cast<std::uint8_t>(i * 7);
+    }
+    color::premultiply_alpha(
+        color::make_image_view<color::rgba_hex>(buffer.data(), thumbnail_size, thumbnail_size));
+    return buffer;
+}
+
+}    // namespace
+
+/** Blend premultiplied thumbnails by converting each pixel to float and back */
+void
+ThumbnailBlendPerPixel(benchmark::State& state)
+{
+    auto thumb  = make_thumbnail();
+    auto canvas = make_image<color::rgba_hex>();
+    for (auto _ : state) {
+        for (std::size_t t = 0; t < thumbnail_count; ++t) {
+            auto x0 = (t * thumbnail_size) % (image_width - thumbnail_size);
+            auto y0 = (t * thumbnail_size / image_width * thumbnail_size) % image_height;
+            for (std::size_t y = 0; y < thumbnail_size; ++y) {
+                auto src = make_memory_vector_view<color::rgba_hex>(
+                    thumb.data() + y * thumbnail_size * 4, thumbnail_size * 4);
+                auto dst = make_memory_vector_view<color::rgba_hex>(
+                    canvas.data() + ((y0 + y) * image_width + x0) * 4, thumbnail_size * 4);
+                for (std::size_t x = 0; x < thumbnail_size; ++x) {
+                    auto s = convert<color::rgba<float>>(color::rgba_hex{src[x]});
+                    auto d = convert<color::rgba<float>>(color::rgba_hex{dst[x]});
+                    dst[x] = convert<color::rgba_hex>(color::rgba<float>{s + d * (1 - s.a())});
+                }
+            }
+        }
+        benchmark::DoNotOptimize(canvas.data());
+    }
+    state.SetItemsProcessed(state.iterations() * thumbnail_count);
+}
+
+void
+ThumbnailBlend(benchmark::State& state)
+{
+    auto thumb  = make_thumbnail();
+    auto canvas = make_image<color::rgba_hex>();
+    auto src = color::make_image_view<color::rgba_hex>(thumb.data(), thumbnail_size, thumbnail_size);
+    auto dst = color::make_image_view<color::rgba_hex>(canvas.data(), image_width, image_height);
+    for (auto _ : state) {
+        for (std::size_t t = 0; t < thumbnail_count; ++t) {
+            auto x0 = (t * thumbnail_size) % (image_width - thumbnail_size);
+            auto y0 = (t * thumbnail_size / image_width * thumbnail_size) % image_height;
+            color::blend_over(src, dst, x0, y0);
+        }
+        benchmark::DoNotOptimize(canvas.data());
+    }
+    state.SetItemsProcessed(state.iterations() * thumbnail_count);
+}
+
+//----------------------------------------------------------------------------
+//  Palette quantization of a 4K image in OKLab
+//----------------------------------------------------------------------------
+namespace {
+
+constexpr std::size_t palette_size = 16;
+
+std::vector<float>
+make_oklab_image()
+{
+    auto               rgb = make_image<color::rgba<float>>();
+    std::vector<float> lab(rgb.size());
+    color::convert_colors(make_memory_vector_view<color::rgba<float>>(rgb.data(), rgb.size()),
+                          make_memory_vector_view<color::oklaba<float>>(lab.data(), lab.size()));
+    return lab;
+}
+
+std::vector<float>
+make_oklab_palette()
+{
+    std::vector<float> palette;
+    for (std::size_t i = 0; i < palette_size; ++i) {
+        auto c = convert<color::oklab<float>>(
+            color::rgba<float>{(i & 1) * 1.f, (i >> 1 & 1) * 1.f, (i >> 2 & 1) * 1.f,
+                               i < 8 ? 1.f : 0.5f});
+        palette.insert(palette.end(), {c.l(), c.a(), c.b()});
+    }
+    return palette;
+}
+
+}    // namespace
+
+void
+PaletteQuantizePerPixel(benchmark::State& state)
+{
+    using oklab       = color::oklab<float>;
+    using oklaba      = color::oklaba<float>;
+    auto const image  = make_oklab_image();
+    auto const pal    = make_oklab_palette();
+    auto       pixels = make_memory_vector_view<oklaba>(image.data(), image.size());
+    auto       palette = make_memory_vector_view<oklab>(pal.data(), pal.size());
+    std::vector<std::uint32_t> indexes(pixel_count);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < pixel_count; ++i) {
+            oklaba        px   = pixels[i];
+            float         best = std::numeric_limits<float>::max();
+            std::uint32_t best_index = 0;
+            for (std::uint32_t p = 0; p < palette_size; ++p) {
+                float d = color::delta_e(oklab{px.l(), px.a(), px.b()}, oklab{palette[p]});
+                if (d < best) {
+                    best       = d;
+                    best_index = p;
+                }
+            }
+            indexes[i] = best_index;
+        }
+        benchmark::DoNotOptimize(indexes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * pixel_count);
+}
+
+void
+PaletteQuantize(benchmark::State& state)
+{
+    auto const image   = make_oklab_image();
+    auto const pal     = make_oklab_palette();
+    auto       pixels  = make_memory_vector_view<color::oklaba<float>>(image.data(), image.size());
+    auto       palette = make_memory_vector_view<color::oklab<float>>(pal.data(), pal.size());
+    std::vector<std::uint32_t> indexes(pixel_count);
+    parallel_options           opts;
+    opts.thread_count = state.range(0);
+    for (auto _ : state) {
+        color::nearest_colors(pixels, palette, indexes.data(), opts);
+        benchmark::DoNotOptimize(indexes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * pixel_count);
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(ColorConvertPerPixel,    color::rgba<float>, color::hsla<float>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ColorConvertBatch,       color::rgba<float>, color::hsla<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(ColorConvertPerPixel,    color::hsla<float>, color::rgba<float>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ColorConvertBatch,       color::hsla<float>, color::rgba<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(ColorConvertPerPixel,    color::rgba<float>, color::hsva<float>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ColorConvertBatch,       color::rgba<float>, color::hsva<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(ColorConvertPerPixel,    color::hsva<float>, color::rgba<float>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ColorConvertBatch,       color::hsva<float>, color::rgba<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(ColorConvertBatch,       color::rgba_hex,    color::hsla<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(ColorConvertBatch,       color::hsla<float>, color::rgba_hex)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(ColorConvertPerPixel,    color::rgba<float>, color::laba<float>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ColorConvertBatch,       color::rgba<float>, color::laba<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(ColorConvertPerPixel,    color::laba<float>, color::rgba<float>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ColorConvertBatch,       color::laba<float>, color::rgba<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(ColorConvertPerPixel,    color::rgba<float>, color::oklaba<float>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ColorConvertBatch,       color::rgba<float>, color::oklaba<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(ColorConvertPerPixel,    color::oklaba<float>, color::rgba<float>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(ColorConvertBatch,       color::oklaba<float>, color::rgba<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+
+BENCHMARK(ImageUnpackPerPixel)->Unit(benchmark::kMillisecond);
+BENCHMARK(ImageUnpack)->Unit(benchmark::kMillisecond);
+BENCHMARK(ImagePack)->Unit(benchmark::kMillisecond);
+BENCHMARK(ImageSrgbToLinearPow)->Unit(benchmark::kMillisecond);
+BENCHMARK(ImageSrgbToLinear)->Unit(benchmark::kMillisecond);
+BENCHMARK(ImageLinearToSrgb)->Unit(benchmark::kMillisecond);
+BENCHMARK(ImagePremultiply)->Unit(benchmark::kMillisecond);
+BENCHMARK(ThumbnailBlendPerPixel);
+BENCHMARK(ThumbnailBlend);
+
+BENCHMARK(PaletteQuantizePerPixel)->Unit(benchmark::kMillisecond);
+BENCHMARK(PaletteQuantize)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
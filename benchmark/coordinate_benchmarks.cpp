@@ -0,0 +1,144 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * coordinate_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/coordinate_batch.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t coord_count = 1 << 18;
+
+using vector2f    = vector<float, 2>;
+using vector3f    = vector<float, 3>;
+using polar_f     = polar_coord<float>;
+using spherical_f = spherical_coord<float>;
+using cylinder_f  = cylindrical_coord<float>;
+
+/** Points of a sweep around the origin, as a LIDAR produces them */
+std::vector<vector3f>
+make_points()
+{
+    std::vector<vector3f> points(coord_count);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        float t   = static_cast<float>(i);
+        points[i] = vector3f{std::cos(t * 0.01f) * (5 + i % 11), std::sin(t * 0.01f) * (5 + i % 11),
+                             std::sin(t * 0.003f) * 2};
+    }
+    return points;
+}
+
+template <typename Coord>
+std::vector<Coord>
+make_coords()
+{
+    auto const         points = make_points();
+    std::vector<Coord> coords(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        coords[i] = convert<Coord>(points[i]);
+    }
+    return coords;
+}
+
+template <typename Src>
+std::vector<Src>
+make_source()
+{
+    if constexpr (std::is_same<Src, vector3f>::value) {
+        return make_points();
+    } else if constexpr (std::is_same<Src, vector2f>::value) {
+        auto const            points = make_points();
+        std::vector<vector2f> plane(points.size());
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            plane[i] = vector2f{points[i].x(), points[i].y()};
+        }
+        return plane;
+    } else {
+        return make_coords<Src>();
+    }
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  Converting one vector at a time with conversion expressions
+//----------------------------------------------------------------------------
+template <typename Src, typename Dst>
+void
+CoordinateConvertScalar(benchmark::State& state)
+{
+    auto const       src = make_source<Src>();
+    std::vector<Dst> dst(src.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            dst[i] = convert<Dst>(src[i]);
+        }
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+//----------------------------------------------------------------------------
+//  Batch conversion, the argument is trig_accuracy
+//----------------------------------------------------------------------------
+template <typename Src, typename Dst>
+void
+CoordinateConvertBatch(benchmark::State& state)
+{
+    auto const       src      = make_source<Src>();
+    auto const       accuracy = static_cast<trig_accuracy>(state.range(0));
+    std::vector<Dst> dst(src.size());
+    for (auto _ : state) {
+        convert_coordinates(src.data(), src.size(), dst.data(), accuracy,
+                            parallel_options::single_thread());
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+template <typename Src, typename Dst>
+void
+CoordinateConvertParallel(benchmark::State& state)
+{
+    auto const       src = make_source<Src>();
+    std::vector<Dst> dst(src.size());
+    for (auto _ : state) {
+        convert_coordinates(src.data(), src.size(), dst.data());
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(CoordinateConvertScalar,   spherical_f, vector3f);
+BENCHMARK_TEMPLATE(CoordinateConvertBatch,    spherical_f, vector3f)->Arg(0)->Arg(1)->Arg(2);
+BENCHMARK_TEMPLATE(CoordinateConvertParallel, spherical_f, vector3f);
+BENCHMARK_TEMPLATE(CoordinateConvertScalar,   vector3f, spherical_f);
+BENCHMARK_TEMPLATE(CoordinateConvertBatch,    vector3f, spherical_f)->Arg(0)->Arg(1)->Arg(2);
+BENCHMARK_TEMPLATE(CoordinateConvertParallel, vector3f, spherical_f);
+BENCHMARK_TEMPLATE(CoordinateConvertScalar,   cylinder_f, vector3f);
+BENCHMARK_TEMPLATE(CoordinateConvertBatch,    cylinder_f, vector3f)->Arg(0)->Arg(1)->Arg(2);
+BENCHMARK_TEMPLATE(CoordinateConvertScalar,   vector3f, cylinder_f);
+BENCHMARK_TEMPLATE(CoordinateConvertBatch,    vector3f, cylinder_f)->Arg(0)->Arg(1)->Arg(2);
+BENCHMARK_TEMPLATE(CoordinateConvertScalar,   polar_f, vector2f);
+BENCHMARK_TEMPLATE(CoordinateConvertBatch,    polar_f, vector2f)->Arg(0)->Arg(1)->Arg(2);
+BENCHMARK_TEMPLATE(CoordinateConvertScalar,   vector2f, polar_f);
+BENCHMARK_TEMPLATE(CoordinateConvertBatch,    vector2f, polar_f)->Arg(0)->Arg(1)->Arg(2);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
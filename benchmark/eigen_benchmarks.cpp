@@ -0,0 +1,105 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * eigen_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/eigen.hpp>
+#include <psst/math/structured_matrix.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t eigen_matrix_count = 1 << 14;
+
+/** Covariance-like matrices, the packed lower triangles */
+template <typename T>
+std::vector<symmetric_matrix<T, 3>>
+make_matrices()
+{
+    std::vector<symmetric_matrix<T, 3>> res;
+    res.reserve(eigen_matrix_count);
+    for (std::size_t i = 0; i < eigen_matrix_count; ++i) {
+        vector<T, 3> const d{static_cast<T>(std::sin(i * 0.37)), static_cast<T>(std::cos(i * 1.3)),
+                             static_cast<T>(std::sin(i * 0.11) * 0.1)};
+        symmetric_matrix<T, 3> m;
+        auto*                  p = m.data();
+        for (std::size_t r = 0; r < 3; ++r) {
+            for (std::size_t c = 0; c <= r; ++c) {
+                *p++ = d[r] * d[c] + (r == c ? T(0.01) : T(0));
+            }
+        }
+        res.push_back(m);
+    }
+    return res;
+}
+
+}    // namespace
+
+template <typename T>
+void
+EigenSymmetric(benchmark::State& state)
+{
+    auto const values = make_matrices<T>();
+    for (auto _ : state) {
+        for (auto const& a : values) {
+            benchmark::DoNotOptimize(eigen_symmetric(a));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+/** The same matrices in the structure of arrays layout */
+template <typename T>
+void
+EigenSymmetricBatch(benchmark::State& state)
+{
+    auto const     matrices = make_matrices<T>();
+    std::vector<T> elements[6], values[3], vectors[9];
+    for (auto const& m : matrices) {
+        for (std::size_t k = 0; k < 6; ++k) {
+            elements[k].push_back(m.data()[k]);
+        }
+    }
+    std::array<T const*, 6> in;
+    std::array<T*, 3>       out_values;
+    std::array<T*, 9>       out_vectors;
+    for (std::size_t k = 0; k < 6; ++k) {
+        in[k] = elements[k].data();
+    }
+    for (std::size_t k = 0; k < 3; ++k) {
+        values[k].resize(matrices.size());
+        out_values[k] = values[k].data();
+    }
+    for (std::size_t k = 0; k < 9; ++k) {
+        vectors[k].resize(matrices.size());
+        out_vectors[k] = vectors[k].data();
+    }
+    parallel_options const opts{static_cast<std::size_t>(state.range(0)), 1, 1024};
+    for (auto _ : state) {
+        eigen_symmetric(in, out_values, out_vectors, matrices.size(), opts);
+        benchmark::DoNotOptimize(values[0].data());
+    }
+    state.SetItemsProcessed(state.iterations() * matrices.size());
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(EigenSymmetric,      float);
+BENCHMARK_TEMPLATE(EigenSymmetric,      double);
+BENCHMARK_TEMPLATE(EigenSymmetricBatch, float)->Arg(1)->Arg(4);
+BENCHMARK_TEMPLATE(EigenSymmetricBatch, double)->Arg(1)->Arg(4);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
@@ -0,0 +1,147 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * fixed_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/fixed.hpp>
+#include <psst/math/matrix.hpp>
+#include <psst/math/vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+using fixed16 = fixed<16, 16>;
+
+constexpr std::size_t fixed_value_count = 1 << 12;
+
+template <typename T>
+std::vector<vector<T, 3>>
+make_vectors()
+{
+    std::vector<vector<T, 3>> res(fixed_value_count);
+    for (std::size_t i = 0; i < res.size(); ++i) {
+        res[i] = vector<T, 3>{T(std::sin(i * 0.37) * 10), T(std::cos(i * 0.91) * 10), T(1 + i % 7)};
+    }
+    return res;
+}
+
+template <typename T>
+std::vector<T>
+make_angles()
+{
+    std::vector<T> res(fixed_value_count);
+    for (std::size_t i = 0; i < res.size(); ++i) {
+        res[i] = T(std::sin(i * 0.01) * 100);
+    }
+    return res;
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  The cost of determinism, the same operations on float and on fixed<16, 16>
+//----------------------------------------------------------------------------
+template <typename T, typename MathPolicy>
+void
+NormalizeVectors(benchmark::State& state)
+{
+    auto const values = make_vectors<T>();
+    for (auto _ : state) {
+        for (auto const& v : values) {
+            vector<T, 3, components::xyzw, MathPolicy> n{v};
+            n.normalize();
+            benchmark::DoNotOptimize(n);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename T>
+void
+TransformVectors(benchmark::State& state)
+{
+    auto const            values = make_vectors<T>();
+    matrix<T, 3, 3> const m{{0.5, -0.25, 1}, {0.75, 1, 0}, {-1, 0.125, 0.5}};
+    for (auto _ : state) {
+        for (auto const& v : values) {
+            matrix<T, 3, 1> r = m * v;
+            benchmark::DoNotOptimize(r);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename T>
+void
+SquareRoot(benchmark::State& state)
+{
+    auto const values = make_angles<T>();
+    for (auto _ : state) {
+        for (auto v : values) {
+            using std::abs;
+            using std::sqrt;
+            benchmark::DoNotOptimize(sqrt(abs(v)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename T>
+void
+SinCos(benchmark::State& state)
+{
+    auto const values = make_angles<T>();
+    for (auto _ : state) {
+        for (auto v : values) {
+            using std::cos;
+            using std::sin;
+            benchmark::DoNotOptimize(sin(v));
+            benchmark::DoNotOptimize(cos(v));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename T>
+void
+Atan2(benchmark::State& state)
+{
+    auto const values = make_angles<T>();
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < values.size(); ++i) {
+            using std::atan2;
+            benchmark::DoNotOptimize(atan2(values[i], values[i - 1]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (values.size() - 1));
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(NormalizeVectors, float,   precise_math);
+BENCHMARK_TEMPLATE(NormalizeVectors, fixed16, precise_math);
+BENCHMARK_TEMPLATE(NormalizeVectors, float,   fast_math);
+BENCHMARK_TEMPLATE(NormalizeVectors, fixed16, fast_math);
+BENCHMARK_TEMPLATE(TransformVectors, float);
+BENCHMARK_TEMPLATE(TransformVectors, fixed16);
+BENCHMARK_TEMPLATE(SquareRoot,       float);
+BENCHMARK_TEMPLATE(SquareRoot,       fixed16);
+BENCHMARK_TEMPLATE(SinCos,           float);
+BENCHMARK_TEMPLATE(SinCos,           fixed16);
+BENCHMARK_TEMPLATE(Atan2,            float);
+BENCHMARK_TEMPLATE(Atan2,            fixed16);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
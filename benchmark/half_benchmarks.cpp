@@ -0,0 +1,99 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * half_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/half.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t half_value_count = 1 << 16;
+
+std::vector<float>
+make_float_values()
+{
+    std::vector<float> res(half_value_count);
+    for (std::size_t i = 0; i < res.size(); ++i) {
+        res[i] = static_cast<float>(std::sin(i * 0.01) * 1000);
+    }
+    return res;
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  Buffer conversions to and from the 16 bit types in a single thread
+//----------------------------------------------------------------------------
+template <typename T>
+void
+ConvertToFloat16(benchmark::State& state)
+{
+    auto const     src = make_float_values();
+    std::vector<T> dst(src.size());
+    for (auto _ : state) {
+        convert_values(src.data(), src.size(), dst.data(), parallel_options::single_thread());
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+template <typename T>
+void
+ConvertFromFloat16(benchmark::State& state)
+{
+    auto const     values = make_float_values();
+    std::vector<T> src(values.begin(), values.end());
+    std::vector<float> dst(src.size());
+    for (auto _ : state) {
+        convert_values(src.data(), src.size(), dst.data(), parallel_options::single_thread());
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+//----------------------------------------------------------------------------
+//  Dot products of vectors stored in float and in half
+//----------------------------------------------------------------------------
+template <typename T>
+void
+BufferDot(benchmark::State& state)
+{
+    auto const     values = make_float_values();
+    std::vector<T> src(values.begin(), values.end());
+    memory_vector_view<T const*, 4> view{src.data(), src.size()};
+    vector<float, 4> const          dir{0.5, -0.25, 1, 2};
+    for (auto _ : state) {
+        float sum = 0;
+        for (auto v : view) {
+            sum += dot(v, dir);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * view.size());
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(ConvertToFloat16,   half);
+BENCHMARK_TEMPLATE(ConvertFromFloat16, half);
+BENCHMARK_TEMPLATE(ConvertToFloat16,   bfloat16);
+BENCHMARK_TEMPLATE(ConvertFromFloat16, bfloat16);
+BENCHMARK_TEMPLATE(BufferDot,          float);
+BENCHMARK_TEMPLATE(BufferDot,          half);
+BENCHMARK_TEMPLATE(BufferDot,          bfloat16);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
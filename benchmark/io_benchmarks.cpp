@@ -0,0 +1,385 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * io_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "make_test_data.hpp"
+#include <psst/math/colors_io.hpp>
+#include <psst/math/matrix_format.hpp>
+#include <psst/math/matrix_io.hpp>
+#include <psst/math/matrix_parse.hpp>
+#include <psst/math/vector_format.hpp>
+#include <psst/math/vector_io.hpp>
+#include <psst/math/vector_parse.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t io_element_count = 1024;
+
+template <typename Vector>
+std::string
+make_vectors_text(std::size_t count)
+{
+    using value_type = typename Vector::value_type;
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<value_type>::max_digits10);
+    auto v = make_test_vector<value_type>(dimension_count<Vector::size>{});
+    for (std::size_t i = 0; i < count; ++i) {
+        os << v * value_type(1.0 / (i + 1)) << "\n";
+    }
+    return os.str();
+}
+
+template <typename Matrix>
+std::string
+make_matrices_text(std::size_t count)
+{
+    using value_type = typename Matrix::value_type;
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<value_type>::max_digits10);
+    auto m = make_test_matrix<value_type>(traits::matrix_size<Matrix::rows, Matrix::cols>{});
+    for (std::size_t i = 0; i < count; ++i) {
+        os << m * value_type(1.0 / (i + 1)) << "\n";
+    }
+    return os.str();
+}
+
+template <typename Vector>
+std::vector<Vector>
+make_vectors(std::size_t count)
+{
+    using value_type = typename Vector::value_type;
+    std::vector<Vector> vectors;
+    vectors.reserve(count);
+    auto v = make_test_vector<value_type>(dimension_count<Vector::size>{});
+    for (std::size_t i = 0; i < count; ++i) {
+        vectors.push_back(v * value_type(1.0 / (i + 1)));
+    }
+    return vectors;
+}
+
+template <typename Matrix>
+std::vector<Matrix>
+make_matrices(std::size_t count)
+{
+    using value_type = typename Matrix::value_type;
+    std::vector<Matrix> matrices;
+    matrices.reserve(count);
+    auto m = make_test_matrix<value_type>(traits::matrix_size<Matrix::rows, Matrix::cols>{});
+    for (std::size_t i = 0; i < count; ++i) {
+        matrices.push_back(m * value_type(1.0 / (i + 1)));
+    }
+    return matrices;
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  Parsing
+//----------------------------------------------------------------------------
+template <typename Vector>
+void
+VectorStreamParse(benchmark::State& state)
+{
+    auto text = make_vectors_text<Vector>(io_element_count);
+    for (auto _ : state) {
+        std::istringstream  is{text};
+        std::vector<Vector> vectors;
+        vectors.reserve(io_element_count);
+        Vector v;
+        while (is >> v)
+            vectors.push_back(v);
+        benchmark::DoNotOptimize(vectors.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+template <typename Vector>
+void
+VectorCharsParse(benchmark::State& state)
+{
+    auto text = make_vectors_text<Vector>(io_element_count);
+    for (auto _ : state) {
+        std::vector<Vector> vectors;
+        vectors.reserve(io_element_count);
+        io::parse_vectors(text, vectors);
+        benchmark::DoNotOptimize(vectors.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+template <typename Vector>
+void
+VectorCharsParseToMemory(benchmark::State& state)
+{
+    using value_type = typename Vector::value_type;
+    auto                    text = make_vectors_text<Vector>(io_element_count);
+    std::vector<value_type> buffer(io_element_count * Vector::size);
+    auto view = make_memory_vector_view<Vector>(buffer.data(), buffer.size());
+    for (auto _ : state) {
+        io::parse_vectors(text, view);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+template <typename Matrix>
+void
+MatrixStreamParse(benchmark::State& state)
+{
+    auto text = make_matrices_text<Matrix>(io_element_count);
+    for (auto _ : state) {
+        std::istringstream  is{text};
+        std::vector<Matrix> matrices;
+        matrices.reserve(io_element_count);
+        Matrix m;
+        while (is >> m)
+            matrices.push_back(m);
+        benchmark::DoNotOptimize(matrices.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+template <typename Matrix>
+void
+MatrixCharsParse(benchmark::State& state)
+{
+    auto text = make_matrices_text<Matrix>(io_element_count);
+    for (auto _ : state) {
+        std::vector<Matrix> matrices;
+        matrices.reserve(io_element_count);
+        io::parse_matrices(text, matrices);
+        benchmark::DoNotOptimize(matrices.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+//----------------------------------------------------------------------------
+//  Formatting
+//----------------------------------------------------------------------------
+template <typename Vector>
+void
+VectorStreamFormat(benchmark::State& state)
+{
+    using value_type = typename Vector::value_type;
+    auto        vectors = make_vectors<Vector>(io_element_count);
+    std::size_t bytes   = 0;
+    for (auto _ : state) {
+        std::ostringstream os;
+        // The precision needed for a round-trip, as the to_chars output provides
+        os << std::setprecision(std::numeric_limits<value_type>::max_digits10);
+        for (auto const& v : vectors)
+            os << v << "\n";
+        bytes += os.str().size();
+    }
+    state.SetBytesProcessed(bytes);
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+template <typename Vector>
+void
+VectorCharsFormat(benchmark::State& state)
+{
+    auto        vectors = make_vectors<Vector>(io_element_count);
+    std::string buffer;
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        buffer.clear();
+        io::format_vectors(buffer, vectors);
+        benchmark::DoNotOptimize(buffer.data());
+        bytes += buffer.size();
+    }
+    state.SetBytesProcessed(bytes);
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+template <typename Vector>
+void
+VectorCharsFormatToBuffer(benchmark::State& state)
+{
+    auto              vectors = make_vectors<Vector>(io_element_count);
+    std::vector<char> buffer(io_element_count * 128);
+    std::size_t       bytes = 0;
+    for (auto _ : state) {
+        auto res = io::format_vectors(buffer.data(), buffer.data() + buffer.size(), vectors);
+        benchmark::DoNotOptimize(buffer.data());
+        bytes += res.ptr - buffer.data();
+    }
+    state.SetBytesProcessed(bytes);
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+template <typename Matrix>
+void
+MatrixStreamFormat(benchmark::State& state)
+{
+    using value_type = typename Matrix::value_type;
+    auto        matrices = make_matrices<Matrix>(io_element_count);
+    std::size_t bytes    = 0;
+    for (auto _ : state) {
+        std::ostringstream os;
+        os << std::setprecision(std::numeric_limits<value_type>::max_digits10);
+        for (auto const& m : matrices)
+            os << m << "\n";
+        bytes += os.str().size();
+    }
+    state.SetBytesProcessed(bytes);
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+template <typename Matrix>
+void
+MatrixCharsFormat(benchmark::State& state)
+{
+    auto        matrices = make_matrices<Matrix>(io_element_count);
+    std::string buffer;
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        buffer.clear();
+        io::format_matrices(buffer, matrices);
+        benchmark::DoNotOptimize(buffer.data());
+        bytes += buffer.size();
+    }
+    state.SetBytesProcessed(bytes);
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+//----------------------------------------------------------------------------
+//  Hex colors
+//----------------------------------------------------------------------------
+namespace {
+
+std::vector<color::rgba_hex>
+make_hex_colors(std::size_t count)
+{
+    std::vector<color::rgba_hex> colors;
+    colors.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        colors.push_back(color::rgba_hex{(std::uint8_t)i, (std::uint8_t)(i * 3),
+                                         (std::uint8_t)(i * 7), (std::uint8_t)(i * 11)});
+    }
+    return colors;
+}
+
+}    // namespace
+
+void
+HexColorStreamParse(benchmark::State& state)
+{
+    std::string text;
+    io::format_hex_colors(text, make_hex_colors(io_element_count));
+    for (auto _ : state) {
+        std::istringstream           is{text};
+        std::vector<color::rgba_hex> colors;
+        colors.reserve(io_element_count);
+        color::rgba_hex c;
+        while (is >> std::ws >> c)
+            colors.push_back(c);
+        benchmark::DoNotOptimize(colors.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+void
+HexColorCharsParse(benchmark::State& state)
+{
+    std::string text;
+    io::format_hex_colors(text, make_hex_colors(io_element_count));
+    std::vector<color::rgba_hex> colors;
+    colors.reserve(io_element_count);
+    for (auto _ : state) {
+        colors.clear();
+        io::parse_hex_colors(text, colors);
+        benchmark::DoNotOptimize(colors.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+void
+HexColorStreamFormat(benchmark::State& state)
+{
+    auto        colors = make_hex_colors(io_element_count);
+    std::size_t bytes  = 0;
+    for (auto _ : state) {
+        std::ostringstream os;
+        for (auto const& c : colors)
+            os << c << "\n";
+        bytes += os.str().size();
+    }
+    state.SetBytesProcessed(bytes);
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+void
+HexColorCharsFormat(benchmark::State& state)
+{
+    auto        colors = make_hex_colors(io_element_count);
+    std::string text;
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        text.clear();
+        io::format_hex_colors(text, colors);
+        benchmark::DoNotOptimize(text.data());
+        bytes += text.size();
+    }
+    state.SetBytesProcessed(bytes);
+    state.SetItemsProcessed(state.iterations() * io_element_count);
+}
+
+BENCHMARK(HexColorStreamParse);
+BENCHMARK(HexColorCharsParse);
+BENCHMARK(HexColorStreamFormat);
+BENCHMARK(HexColorCharsFormat);
+
+// clang-format off
+BENCHMARK_TEMPLATE(VectorStreamParse,           vector<float,   3>);
+BENCHMARK_TEMPLATE(VectorStreamParse,           vector<double,  3>);
+BENCHMARK_TEMPLATE(VectorCharsParse,            vector<float,   3>);
+BENCHMARK_TEMPLATE(VectorCharsParse,            vector<double,  3>);
+BENCHMARK_TEMPLATE(VectorCharsParseToMemory,    vector<float,   3>);
+BENCHMARK_TEMPLATE(VectorCharsParseToMemory,    vector<double,  3>);
+BENCHMARK_TEMPLATE(VectorStreamParse,           vector<float,   4>);
+BENCHMARK_TEMPLATE(VectorCharsParse,            vector<float,   4>);
+
+BENCHMARK_TEMPLATE(MatrixStreamParse,           matrix<float,   4, 4>);
+BENCHMARK_TEMPLATE(MatrixStreamParse,           matrix<double,  4, 4>);
+BENCHMARK_TEMPLATE(MatrixCharsParse,            matrix<float,   4, 4>);
+BENCHMARK_TEMPLATE(MatrixCharsParse,            matrix<double,  4, 4>);
+
+BENCHMARK_TEMPLATE(VectorStreamFormat,          vector<float,   3>);
+BENCHMARK_TEMPLATE(VectorStreamFormat,          vector<double,  3>);
+BENCHMARK_TEMPLATE(VectorCharsFormat,           vector<float,   3>);
+BENCHMARK_TEMPLATE(VectorCharsFormat,           vector<double,  3>);
+BENCHMARK_TEMPLATE(VectorCharsFormatToBuffer,   vector<float,   3>);
+BENCHMARK_TEMPLATE(VectorCharsFormatToBuffer,   vector<double,  3>);
+
+BENCHMARK_TEMPLATE(MatrixStreamFormat,          matrix<float,   4, 4>);
+BENCHMARK_TEMPLATE(MatrixStreamFormat,          matrix<double,  4, 4>);
+BENCHMARK_TEMPLATE(MatrixCharsFormat,           matrix<float,   4, 4>);
+BENCHMARK_TEMPLATE(MatrixCharsFormat,           matrix<double,  4, 4>);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
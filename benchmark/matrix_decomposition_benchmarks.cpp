@@ -0,0 +1,134 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * matrix_decomposition_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/matrix_decomposition.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t rhs_count = 4096;
+
+/** A symmetric positive definite matrix, all of the decompositions apply */
+template <std::size_t N>
+matrix<float, N, N>
+make_matrix()
+{
+    matrix<float, N, N> res;
+    for (std::size_t r = 0; r < N; ++r) {
+        for (std::size_t c = 0; c <= r; ++c) {
+            res[r][c] = res[c][r] = static_cast<float>(std::sin(r * 1.91 + c * 0.73));
+        }
+        res[r][r] += N;
+    }
+    return res;
+}
+
+template <std::size_t N>
+std::vector<vector<float, N>>
+make_vectors()
+{
+    std::vector<vector<float, N>> res(rhs_count);
+    for (std::size_t i = 0; i < res.size(); ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            res[i][j] = static_cast<float>(std::cos(i * 0.91 + j * 0.37));
+        }
+    }
+    return res;
+}
+
+}    // namespace
+
+template <typename Decomposition>
+void
+Factor(benchmark::State& state)
+{
+    auto const a = make_matrix<Decomposition::matrix_type::rows>();
+    for (auto _ : state) {
+        Decomposition d{a};
+        benchmark::DoNotOptimize(d);
+    }
+}
+
+/** One factorization for rhs_count right hand sides */
+template <typename Decomposition>
+void
+Solve(benchmark::State& state)
+{
+    constexpr std::size_t N = Decomposition::matrix_type::rows;
+    Decomposition const   d{make_matrix<N>()};
+    auto const            rhs = make_vectors<N>();
+    for (auto _ : state) {
+        for (auto const& b : rhs) {
+            benchmark::DoNotOptimize(d.solve(b));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rhs.size());
+}
+
+template <typename Decomposition>
+void
+SolveBatch(benchmark::State& state)
+{
+    constexpr std::size_t         N = Decomposition::matrix_type::rows;
+    Decomposition const           d{make_matrix<N>()};
+    auto const                    rhs = make_vectors<N>();
+    std::vector<vector<float, N>> res(rhs.size());
+    parallel_options const        opts{static_cast<std::size_t>(state.range(0)), 1, 256};
+    for (auto _ : state) {
+        d.solve(rhs.data(), res.data(), rhs.size(), opts);
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * rhs.size());
+}
+
+/** The same right hand sides multiplied by the inverse matrix */
+template <std::size_t N>
+void
+MultiplyInverse(benchmark::State& state)
+{
+    matrix<float, N, N> const inv = lu_decomposition<float, N>{make_matrix<N>()}.inverse();
+    auto const                rhs = make_vectors<N>();
+    for (auto _ : state) {
+        for (auto const& b : rhs) {
+            vector<float, N> x = as_vector(inv * b);
+            benchmark::DoNotOptimize(x);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rhs.size());
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(Factor,          lu_decomposition<float, 4>);
+BENCHMARK_TEMPLATE(Factor,          cholesky_decomposition<float, 4>);
+BENCHMARK_TEMPLATE(Factor,          householder_qr<float, 4>);
+BENCHMARK_TEMPLATE(Factor,          lu_decomposition<float, 8>);
+BENCHMARK_TEMPLATE(Factor,          cholesky_decomposition<float, 8>);
+BENCHMARK_TEMPLATE(Factor,          householder_qr<float, 8>);
+BENCHMARK_TEMPLATE(Solve,           lu_decomposition<float, 4>);
+BENCHMARK_TEMPLATE(Solve,           cholesky_decomposition<float, 4>);
+BENCHMARK_TEMPLATE(Solve,           householder_qr<float, 4>);
+BENCHMARK_TEMPLATE(Solve,           lu_decomposition<float, 8>);
+BENCHMARK_TEMPLATE(Solve,           cholesky_decomposition<float, 8>);
+BENCHMARK_TEMPLATE(Solve,           householder_qr<float, 8>);
+BENCHMARK_TEMPLATE(MultiplyInverse, 4);
+BENCHMARK_TEMPLATE(MultiplyInverse, 8);
+BENCHMARK_TEMPLATE(SolveBatch,      lu_decomposition<float, 4>)->Arg(1)->Arg(4);
+BENCHMARK_TEMPLATE(SolveBatch,      cholesky_decomposition<float, 8>)->Arg(1)->Arg(4);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
@@ -0,0 +1,95 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * quantized_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/quantized.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t packed_vector_count = 1 << 14;
+
+/** Unit vectors, or unit quaternions for four components */
+template <std::size_t Size>
+std::vector<float>
+make_unit_vectors()
+{
+    std::vector<float> res(packed_vector_count * Size);
+    for (std::size_t i = 0; i < packed_vector_count; ++i) {
+        vector<float, Size, components::none> v;
+        for (std::size_t j = 0; j < Size; ++j) {
+            v[j] = static_cast<float>(std::sin(i * 0.37 + j * 1.91));
+        }
+        v.normalize();
+        std::copy(v.data(), v.data() + Size, res.data() + i * Size);
+    }
+    return res;
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  Buffer encoding and decoding of unit vectors in a single thread
+//----------------------------------------------------------------------------
+template <typename Packed, std::size_t Size>
+void
+EncodeUnitVectors(benchmark::State& state)
+{
+    auto const          src = make_unit_vectors<Size>();
+    std::vector<Packed> dst(packed_vector_count);
+    for (auto _ : state) {
+        encode_values(memory_vector_view<float const*, Size>{src.data(), src.size()}, dst.data(),
+                      parallel_options::single_thread());
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * packed_vector_count);
+}
+
+template <typename Packed, std::size_t Size>
+void
+DecodeUnitVectors(benchmark::State& state)
+{
+    auto const          values = make_unit_vectors<Size>();
+    std::vector<Packed> src(packed_vector_count);
+    std::vector<float>  dst(values.size());
+    encode_values(memory_vector_view<float const*, Size>{values.data(), values.size()},
+                  src.data());
+    for (auto _ : state) {
+        decode_values(src.data(), src.size(),
+                      memory_vector_view<float*, Size>{dst.data(), dst.size()},
+                      parallel_options::single_thread());
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * packed_vector_count);
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(EncodeUnitVectors, octahedral<std::int8_t>,        3);
+BENCHMARK_TEMPLATE(DecodeUnitVectors, octahedral<std::int8_t>,        3);
+BENCHMARK_TEMPLATE(EncodeUnitVectors, octahedral<std::int16_t>,       3);
+BENCHMARK_TEMPLATE(DecodeUnitVectors, octahedral<std::int16_t>,       3);
+BENCHMARK_TEMPLATE(EncodeUnitVectors, snorm_vector<std::int16_t, 3>,  3);
+BENCHMARK_TEMPLATE(DecodeUnitVectors, snorm_vector<std::int16_t, 3>,  3);
+BENCHMARK_TEMPLATE(EncodeUnitVectors, snorm_10_10_10_2,               3);
+BENCHMARK_TEMPLATE(DecodeUnitVectors, snorm_10_10_10_2,               3);
+BENCHMARK_TEMPLATE(EncodeUnitVectors, smallest_three<>,               4);
+BENCHMARK_TEMPLATE(DecodeUnitVectors, smallest_three<>,               4);
+BENCHMARK_TEMPLATE(EncodeUnitVectors, smallest_three<std::uint64_t>,  4);
+BENCHMARK_TEMPLATE(DecodeUnitVectors, smallest_three<std::uint64_t>,  4);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
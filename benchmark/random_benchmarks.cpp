@@ -0,0 +1,155 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * random_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/random.hpp>
+#include <psst/math/random_samplers.hpp>
+#include <psst/math/vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t sample_count = 1 << 22;
+
+using vector3f = vector<float, 3>;
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  Constructing a generator
+//----------------------------------------------------------------------------
+void
+RandomGeneratorConstruct(benchmark::State& state)
+{
+    for (auto _ : state) {
+        vector3f v = random_vector_data<float>(std::uniform_real_distribution<float>{0, 1});
+        benchmark::DoNotOptimize(v);
+    }
+}
+
+void
+RandomCounterGeneratorConstruct(benchmark::State& state)
+{
+    std::uint64_t index = 0;
+    for (auto _ : state) {
+        vector3f v
+            = random_vector_data<float>(counter_uniform_distribution<float>{0, 1}, {42}, index);
+        index += 3;
+        benchmark::DoNotOptimize(v);
+    }
+}
+
+//----------------------------------------------------------------------------
+//  Filling an array of vectors
+//----------------------------------------------------------------------------
+template <typename Distribution>
+void
+RandomFillMt(benchmark::State& state)
+{
+    std::vector<vector3f> data(sample_count);
+    auto                  gen = random_vector_data<float>(Distribution{0, 1});
+    for (auto _ : state) {
+        for (auto& v : data) {
+            v = gen;
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * sample_count * 3);
+}
+
+template <typename Distribution>
+void
+RandomFillCounter(benchmark::State& state)
+{
+    std::vector<vector3f> data(sample_count);
+    parallel_options      opts;
+    opts.thread_count = state.range(0);
+    for (auto _ : state) {
+        fill_random(data.data(), data.size(), Distribution{0, 1}, {42, 1}, 0, opts);
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * sample_count * 3);
+}
+
+//----------------------------------------------------------------------------
+//  Directions on the unit sphere
+//----------------------------------------------------------------------------
+void
+SphereRejection(benchmark::State& state)
+{
+    std::vector<vector3f>                 data(sample_count);
+    std::mt19937_64                       gen{42};
+    std::uniform_real_distribution<float> dist{-1, 1};
+    for (auto _ : state) {
+        for (auto& v : data) {
+            float mag_sq;
+            do {
+                v      = vector3f{dist(gen), dist(gen), dist(gen)};
+                mag_sq = magnitude_square(v);
+            } while (mag_sq > 1 || mag_sq == 0);
+            v = v / std::sqrt(mag_sq);
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * sample_count);
+}
+
+template <typename Sampler>
+void
+FillSamples(benchmark::State& state)
+{
+    std::vector<typename Sampler::result_type> data(sample_count);
+    parallel_options                           opts;
+    opts.thread_count = state.range(0);
+    for (auto _ : state) {
+        fill_samples(data.data(), data.size(), Sampler{}, {42, 1}, 0, opts);
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * sample_count);
+}
+
+template <typename Sequence>
+void
+FillSequence(benchmark::State& state)
+{
+    std::vector<typename Sequence::result_type> data(sample_count);
+    for (auto _ : state) {
+        fill_sequence(data.data(), data.size(), Sequence{});
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * sample_count);
+}
+
+// clang-format off
+BENCHMARK(RandomGeneratorConstruct);
+BENCHMARK(RandomCounterGeneratorConstruct);
+
+BENCHMARK_TEMPLATE(RandomFillMt,        std::uniform_real_distribution<float>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(RandomFillCounter,   counter_uniform_distribution<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(RandomFillMt,        std::normal_distribution<float>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(RandomFillCounter,   counter_normal_distribution<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+
+BENCHMARK(SphereRejection)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(FillSamples,         unit_sphere_sampler<float>)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(0);
+BENCHMARK_TEMPLATE(FillSamples,         unit_ball_sampler<float>)->Unit(benchmark::kMillisecond)->Arg(1);
+BENCHMARK_TEMPLATE(FillSamples,         rotation_sampler<float>)->Unit(benchmark::kMillisecond)->Arg(1);
+BENCHMARK_TEMPLATE(FillSequence,        sobol_sequence<float, 3>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(FillSequence,        halton_sequence<float, 3>)->Unit(benchmark::kMillisecond);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
@@ -0,0 +1,193 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * simd_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/matrix.hpp>
+#include <psst/math/simd.hpp>
+#include <psst/math/vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t simd_vector_count = 1 << 14;
+
+using vector3f = vector<float, 3>;
+using matrix3f = matrix<float, 3, 3>;
+
+std::vector<vector3f>
+make_vectors(float seed)
+{
+    std::vector<vector3f> res(simd_vector_count);
+    for (std::size_t i = 0; i < res.size(); ++i) {
+        float t = static_cast<float>(i) + seed;
+        res[i]  = vector3f{std::sin(t * 1.3f) * 2, std::cos(t * 0.7f) + 1.5f, std::sin(t)};
+    }
+    return res;
+}
+
+/** Vectors of T, either scalars or packs holding several vectors each */
+template <typename T>
+std::vector<vector<T, 3>>
+make_packs(float seed)
+{
+    auto const source = make_vectors(seed);
+    if constexpr (traits::is_simd_pack_v<T>) {
+        std::vector<vector<T, 3>> res(source.size() / T::lanes);
+        for (std::size_t i = 0; i < res.size(); ++i) {
+            res[i] = load_lanes<T::lanes>(source.data() + i * T::lanes);
+        }
+        return res;
+    } else {
+        return source;
+    }
+}
+
+template <typename T>
+matrix<T, 3, 3>
+make_rotation()
+{
+    float const c = std::cos(0.3f), s = std::sin(0.3f);
+    // clang-format off
+    return {
+        { T{c}, T{-s}, T{0} },
+        { T{s}, T{c},  T{0} },
+        { T{0}, T{0},  T{1} }
+    };
+    // clang-format on
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  The same expressions over arrays of vectors of floats and of packs of
+//  floats, items are vectors in both cases
+//----------------------------------------------------------------------------
+template <typename T>
+void
+SimdNormalize(benchmark::State& state)
+{
+    auto const                source = make_packs<T>(0);
+    std::vector<vector<T, 3>> res(source.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < source.size(); ++i) {
+            res[i] = normalize(source[i]);
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * simd_vector_count);
+}
+
+template <typename T>
+void
+SimdNormalizeFast(benchmark::State& state)
+{
+    auto const                source = make_packs<T>(0);
+    std::vector<vector<T, 3>> res(source.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < source.size(); ++i) {
+            res[i] = normalize(expr::with_policy<fast_math>(source[i]));
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * simd_vector_count);
+}
+
+template <typename T>
+void
+SimdCross(benchmark::State& state)
+{
+    auto const                lhs = make_packs<T>(0);
+    auto const                rhs = make_packs<T>(0.5f);
+    std::vector<vector<T, 3>> res(lhs.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            res[i] = lhs[i] * rhs[i];
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * simd_vector_count);
+}
+
+template <typename T>
+void
+SimdDot(benchmark::State& state)
+{
+    auto const     lhs = make_packs<T>(0);
+    auto const     rhs = make_packs<T>(0.5f);
+    std::vector<T> res(lhs.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            res[i] = dot(lhs[i], rhs[i]);
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * simd_vector_count);
+}
+
+template <typename T>
+void
+SimdMatrixMultiply(benchmark::State& state)
+{
+    auto const                   source   = make_packs<T>(0);
+    auto const                   rotation = make_rotation<T>();
+    std::vector<matrix<T, 3, 1>> res(source.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < source.size(); ++i) {
+            res[i] = rotation * source[i];
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * simd_vector_count);
+}
+
+template <typename T>
+void
+SimdSlerp(benchmark::State& state)
+{
+    auto const                lhs = make_packs<T>(0);
+    auto const                rhs = make_packs<T>(0.5f);
+    std::vector<vector<T, 3>> res(lhs.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            res[i] = slerp(lhs[i], rhs[i], 0.3f);
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * simd_vector_count);
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(SimdNormalize,      float);
+BENCHMARK_TEMPLATE(SimdNormalize,      simd<float, 4>);
+BENCHMARK_TEMPLATE(SimdNormalize,      simd<float, 8>);
+BENCHMARK_TEMPLATE(SimdNormalizeFast,  float);
+BENCHMARK_TEMPLATE(SimdNormalizeFast,  simd<float, 4>);
+BENCHMARK_TEMPLATE(SimdNormalizeFast,  simd<float, 8>);
+BENCHMARK_TEMPLATE(SimdCross,          float);
+BENCHMARK_TEMPLATE(SimdCross,          simd<float, 4>);
+BENCHMARK_TEMPLATE(SimdCross,          simd<float, 8>);
+BENCHMARK_TEMPLATE(SimdDot,            float);
+BENCHMARK_TEMPLATE(SimdDot,            simd<float, 4>);
+BENCHMARK_TEMPLATE(SimdDot,            simd<float, 8>);
+BENCHMARK_TEMPLATE(SimdMatrixMultiply, float);
+BENCHMARK_TEMPLATE(SimdMatrixMultiply, simd<float, 4>);
+BENCHMARK_TEMPLATE(SimdMatrixMultiply, simd<float, 8>);
+BENCHMARK_TEMPLATE(SimdSlerp,          float);
+BENCHMARK_TEMPLATE(SimdSlerp,          simd<float, 8>);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
@@ -0,0 +1,162 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * sparse_matrix_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/sparse_matrix.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t grid_size = 256;
+
+using block3 = matrix<float, 3, 3>;
+
+/** 5-point Laplacian of a grid_size x grid_size grid, shifted to be positive definite */
+template <typename Value>
+sparse_matrix<Value>
+make_laplacian(Value diagonal, Value neighbour)
+{
+    auto const                   n = grid_size * grid_size;
+    sparse_matrix_builder<Value> builder{n, n};
+    builder.reserve(n * 5);
+    for (std::size_t y = 0; y < grid_size; ++y) {
+        for (std::size_t x = 0; x < grid_size; ++x) {
+            auto const i = y * grid_size + x;
+            builder.add(i, i, diagonal);
+            if (x > 0)
+                builder.add(i, i - 1, neighbour);
+            if (x + 1 < grid_size)
+                builder.add(i, i + 1, neighbour);
+            if (y > 0)
+                builder.add(i, i - grid_size, neighbour);
+            if (y + 1 < grid_size)
+                builder.add(i, i + grid_size, neighbour);
+        }
+    }
+    return builder.build();
+}
+
+sparse_matrix<float>
+make_scalar_matrix()
+{
+    return make_laplacian<float>(4.5f, -1.f);
+}
+
+sparse_matrix<block3>
+make_block_matrix()
+{
+    return make_laplacian<block3>(block3::identity() * 4.5f, block3::identity() * -1.f);
+}
+
+template <typename Vector>
+std::vector<Vector>
+make_vectors()
+{
+    std::vector<Vector> res(grid_size * grid_size);
+    for (std::size_t i = 0; i < res.size(); ++i) {
+        res[i] = Vector(static_cast<float>(std::sin(i * 0.37)));
+    }
+    return res;
+}
+
+parallel_options
+make_options(benchmark::State const& state)
+{
+    return {static_cast<std::size_t>(state.range(0)), 1024, 1};
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  y = a * x for a 65536x65536 matrix with 5 non-zeros per row
+//----------------------------------------------------------------------------
+void
+SparseMultiply(benchmark::State& state)
+{
+    auto const         a = make_scalar_matrix();
+    auto const         x = make_vectors<float>();
+    std::vector<float> y(a.rows());
+    auto const         opts = make_options(state);
+    for (auto _ : state) {
+        multiply(a, x.data(), y.data(), opts);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.nonzero_count());
+}
+
+void
+SparseMultiplyBlocks(benchmark::State& state)
+{
+    using vector3 = block_sparse_matrix<float, 3>::vector_type;
+
+    auto const           a = make_block_matrix();
+    auto const           x = make_vectors<vector3>();
+    std::vector<vector3> y(a.rows());
+    auto const           opts = make_options(state);
+    for (auto _ : state) {
+        multiply(a, x.data(), y.data(), opts);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.nonzero_count());
+}
+
+void
+SparseMultiplyTransposed(benchmark::State& state)
+{
+    auto const         a    = make_scalar_matrix();
+    auto const         cols = columns(a);
+    auto const         x    = make_vectors<float>();
+    std::vector<float> y(a.cols());
+    auto const         opts = make_options(state);
+    for (auto _ : state) {
+        multiply_transposed(cols, x.data(), y.data(), opts);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.nonzero_count());
+}
+
+void
+ConjugateGradient(benchmark::State& state)
+{
+    auto const         a = make_scalar_matrix();
+    auto const         b = make_vectors<float>();
+    std::vector<float> x(a.cols());
+    solver_options     opts{0, 1e-5, make_options(state)};
+    for (auto _ : state) {
+        std::fill(x.begin(), x.end(), 0.f);
+        benchmark::DoNotOptimize(conjugate_gradient(a, b.data(), x.data(), opts));
+    }
+}
+
+void
+BuildSparseMatrix(benchmark::State& state)
+{
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(make_scalar_matrix());
+    }
+    state.SetItemsProcessed(state.iterations() * grid_size * grid_size * 5);
+}
+
+// clang-format off
+BENCHMARK(SparseMultiply)->Arg(1)->Arg(4);
+BENCHMARK(SparseMultiplyBlocks)->Arg(1)->Arg(4);
+BENCHMARK(SparseMultiplyTransposed)->Arg(1)->Arg(4);
+BENCHMARK(ConjugateGradient)->Arg(1)->Arg(4);
+BENCHMARK(BuildSparseMatrix);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
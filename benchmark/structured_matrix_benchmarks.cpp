@@ -0,0 +1,154 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * structured_matrix_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/structured_matrix.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t structured_size         = 8;
+constexpr std::size_t structured_matrix_count = 64;
+
+using dense_matrix = matrix<float, structured_size, structured_size>;
+using dense_vector = vector<float, structured_size>;
+
+using diagonal    = diagonal_matrix<float, structured_size>;
+using lower       = lower_triangular_matrix<float, structured_size>;
+using symmetric   = symmetric_matrix<float, structured_size>;
+using tridiagonal = banded_matrix<float, structured_size, 1, 1>;
+using bidiagonal  = banded_matrix<float, structured_size, 1, 0>;
+
+dense_matrix
+make_dense_matrix(std::size_t seed)
+{
+    dense_matrix res;
+    for (std::size_t r = 0; r < structured_size; ++r) {
+        for (std::size_t c = 0; c < structured_size; ++c) {
+            res[r][c] = static_cast<float>(std::sin(seed * 0.37 + r * 1.91 + c * 0.73));
+        }
+        // Diagonally dominant, the triangular systems are well conditioned
+        res[r][r] += structured_size;
+    }
+    return res;
+}
+
+/** The dense matrices, stored in the structure of the Matrix */
+template <typename Matrix>
+std::vector<Matrix>
+make_matrices()
+{
+    std::vector<Matrix> res;
+    for (std::size_t i = 0; i < structured_matrix_count; ++i) {
+        res.emplace_back(make_dense_matrix(i));
+    }
+    return res;
+}
+
+std::vector<dense_vector>
+make_vectors()
+{
+    std::vector<dense_vector> res(structured_matrix_count);
+    for (std::size_t i = 0; i < res.size(); ++i) {
+        for (std::size_t j = 0; j < structured_size; ++j) {
+            res[i][j] = static_cast<float>(std::cos(i * 0.91 + j * 0.37));
+        }
+    }
+    return res;
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  Products of 8x8 float matrices, the zeros of the structure are skipped
+//----------------------------------------------------------------------------
+template <typename Matrix>
+void
+MultiplyMatrices(benchmark::State& state)
+{
+    auto const lhs = make_matrices<Matrix>();
+    auto const rhs = make_matrices<dense_matrix>();
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            dense_matrix res = lhs[i] * rhs[i];
+            benchmark::DoNotOptimize(res);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lhs.size());
+}
+
+template <typename Matrix>
+void
+MultiplyVector(benchmark::State& state)
+{
+    auto const lhs = make_matrices<Matrix>();
+    auto const rhs = make_vectors();
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            matrix<float, structured_size, 1> res = lhs[i] * rhs[i];
+            benchmark::DoNotOptimize(res);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lhs.size());
+}
+
+/** a * transpose(a), the symmetric result evaluates one triangle */
+template <typename Result>
+void
+GramMatrix(benchmark::State& state)
+{
+    auto const values = make_matrices<dense_matrix>();
+    for (auto _ : state) {
+        for (auto const& a : values) {
+            Result res = a * transpose(a);
+            benchmark::DoNotOptimize(res);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename Matrix>
+void
+SolveTriangular(benchmark::State& state)
+{
+    auto const lhs = make_matrices<Matrix>();
+    auto const rhs = make_vectors();
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            benchmark::DoNotOptimize(solve(lhs[i], rhs[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lhs.size());
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(MultiplyMatrices, dense_matrix);
+BENCHMARK_TEMPLATE(MultiplyMatrices, symmetric);
+BENCHMARK_TEMPLATE(MultiplyMatrices, lower);
+BENCHMARK_TEMPLATE(MultiplyMatrices, tridiagonal);
+BENCHMARK_TEMPLATE(MultiplyMatrices, diagonal);
+BENCHMARK_TEMPLATE(MultiplyVector,   dense_matrix);
+BENCHMARK_TEMPLATE(MultiplyVector,   lower);
+BENCHMARK_TEMPLATE(MultiplyVector,   tridiagonal);
+BENCHMARK_TEMPLATE(MultiplyVector,   diagonal);
+BENCHMARK_TEMPLATE(GramMatrix,       dense_matrix);
+BENCHMARK_TEMPLATE(GramMatrix,       symmetric);
+BENCHMARK_TEMPLATE(SolveTriangular,  lower);
+BENCHMARK_TEMPLATE(SolveTriangular,  bidiagonal);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
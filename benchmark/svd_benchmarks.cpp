@@ -0,0 +1,115 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * svd_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/svd.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t svd_matrix_count = 1 << 14;
+
+/** Deformation gradients, small perturbations of the identity */
+template <typename T>
+std::vector<matrix<T, 3, 3>>
+make_matrices()
+{
+    std::vector<matrix<T, 3, 3>> res;
+    res.reserve(svd_matrix_count);
+    for (std::size_t i = 0; i < svd_matrix_count; ++i) {
+        matrix<T, 3, 3> m;
+        for (std::size_t k = 0; k < 9; ++k) {
+            m[k / 3][k % 3]
+                = static_cast<T>(std::sin(i * 0.37 + k * 1.3) * 0.3 + (k % 4 == 0 ? 1 : 0));
+        }
+        res.push_back(m);
+    }
+    return res;
+}
+
+}    // namespace
+
+template <typename T>
+void
+SVD(benchmark::State& state)
+{
+    auto const matrices = make_matrices<T>();
+    for (auto _ : state) {
+        for (auto const& a : matrices) {
+            benchmark::DoNotOptimize(svd_quaternions(a));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * matrices.size());
+}
+
+template <typename T>
+void
+Polar(benchmark::State& state)
+{
+    auto const matrices = make_matrices<T>();
+    for (auto _ : state) {
+        for (auto const& a : matrices) {
+            benchmark::DoNotOptimize(polar(a));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * matrices.size());
+}
+
+/** The same matrices in the structure of arrays layout */
+template <typename T>
+void
+PolarBatch(benchmark::State& state)
+{
+    auto const     matrices = make_matrices<T>();
+    std::vector<T> elements[9], rotation[4], stretch[6];
+    for (auto const& m : matrices) {
+        for (std::size_t k = 0; k < 9; ++k) {
+            elements[k].push_back(m[k / 3][k % 3]);
+        }
+    }
+    std::array<T const*, 9> in;
+    std::array<T*, 4>       out_rotation;
+    std::array<T*, 6>       out_stretch;
+    for (std::size_t k = 0; k < 9; ++k) {
+        in[k] = elements[k].data();
+    }
+    for (std::size_t k = 0; k < 4; ++k) {
+        rotation[k].resize(matrices.size());
+        out_rotation[k] = rotation[k].data();
+    }
+    for (std::size_t k = 0; k < 6; ++k) {
+        stretch[k].resize(matrices.size());
+        out_stretch[k] = stretch[k].data();
+    }
+    svd_options opts;
+    opts.parallel = parallel_options{static_cast<std::size_t>(state.range(0)), 1, 1024};
+    for (auto _ : state) {
+        polar(in, out_rotation, out_stretch, matrices.size(), opts);
+        benchmark::DoNotOptimize(rotation[0].data());
+    }
+    state.SetItemsProcessed(state.iterations() * matrices.size());
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(SVD,        float);
+BENCHMARK_TEMPLATE(SVD,        double);
+BENCHMARK_TEMPLATE(Polar,      float);
+BENCHMARK_TEMPLATE(PolarBatch, float)->Arg(1)->Arg(4);
+BENCHMARK_TEMPLATE(PolarBatch, double)->Arg(1)->Arg(4);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
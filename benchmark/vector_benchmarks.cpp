@@ -8,6 +8,7 @@
 #include "make_test_data.hpp"
 #include <psst/math/matrix.hpp>
 #include <psst/math/matrix_io.hpp>
+#include <psst/math/summation.hpp>
 #include <psst/math/vector.hpp>
 #include <psst/math/vector_io.hpp>
 
@@ -127,7 +128,7 @@ void
 VectorScalarDiv(benchmark::State& state)
 {
     while (state.KeepRunning()) {
-        auto v1 = make_test_vector<typename Vector::value_type>(dimension_count<Vector::size>{});
+        Vector v1 = make_test_vector<typename Vector::value_type>(dimension_count<Vector::size>{});
         benchmark::DoNotOptimize(v1 /= 100500);
     }
 }
@@ -142,6 +143,26 @@ VectorDot(benchmark::State& state)
         benchmark::DoNotOptimize(dot_product(v1, v2));
     }
 }
+//----------------------------------------------------------------------------
+//  Summation strategies over a long vector
+//----------------------------------------------------------------------------
+template <typename MathPolicy>
+void
+LongVectorDot(benchmark::State& state)
+{
+    using long_vector = vector<float, 256, components::none>;
+    long_vector v1;
+    long_vector v2;
+    for (std::size_t i = 0; i < long_vector::size; ++i) {
+        v1[i] = static_cast<float>(i % 13) * 0.1f;
+        v2[i] = static_cast<float>(i % 7) * 0.3f - 1;
+    }
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(v1);
+        benchmark::DoNotOptimize(dot_product(expr::with_policy<MathPolicy>(v1), v2).value());
+    }
+}
 template <typename Vector>
 void
 VectorCross(benchmark::State& state)
@@ -177,11 +198,10 @@ void
 VectorNorm(benchmark::State& state)
 {
     while (state.KeepRunning()) {
-        auto v1 = make_test_vector<typename Vector::value_type>(dimension_count<Vector::size>{});
+        Vector v1 = make_test_vector<typename Vector::value_type>(dimension_count<Vector::size>{});
         benchmark::DoNotOptimize(v1.normalize());
     }
 }
-
 template <typename Vector>
 void
 VectorLerp(benchmark::State& state)
@@ -238,6 +258,10 @@ BENCHMARK_TEMPLATE(VectorMag,           vector<float,   3>);
 BENCHMARK_TEMPLATE(VectorMag,           vector<double,  3>);
 BENCHMARK_TEMPLATE(VectorNorm,          vector<float,   3>);
 BENCHMARK_TEMPLATE(VectorNorm,          vector<double,  3>);
+BENCHMARK_TEMPLATE(VectorScalarDiv,     vector<float,   3, components::xyzw, fast_math>);
+BENCHMARK_TEMPLATE(VectorScalarDiv,     vector<double,  3, components::xyzw, fast_math>);
+BENCHMARK_TEMPLATE(VectorNorm,          vector<float,   3, components::xyzw, fast_math>);
+BENCHMARK_TEMPLATE(VectorNorm,          vector<double,  3, components::xyzw, fast_math>);
 BENCHMARK_TEMPLATE(VectorLerp,          vector<float,   3>);
 BENCHMARK_TEMPLATE(VectorLerp,          vector<double,  3>);
 BENCHMARK_TEMPLATE(VectorSlerp,         vector<float,   3>);
@@ -287,6 +311,15 @@ BENCHMARK_TEMPLATE(VectorDot,           vector<float,   10>);
 BENCHMARK_TEMPLATE(VectorMagSQ,         vector<float,   10>);
 BENCHMARK_TEMPLATE(VectorMag,           vector<float,   10>);
 BENCHMARK_TEMPLATE(VectorNorm,          vector<float,   10>);
+
+BENCHMARK_TEMPLATE(LongVectorDot,       precise_math);
+BENCHMARK_TEMPLATE(LongVectorDot,       fast_math);
+BENCHMARK_TEMPLATE(LongVectorDot,       summation::accumulators<4>);
+BENCHMARK_TEMPLATE(LongVectorDot,       summation::accumulators<8, fast_math>);
+BENCHMARK_TEMPLATE(LongVectorDot,       summation::pairwise<>);
+BENCHMARK_TEMPLATE(LongVectorDot,       summation::compensated<>);
+BENCHMARK_TEMPLATE(LongVectorDot,       wide_accumulation<>);
+BENCHMARK_TEMPLATE(LongVectorDot,       wide_accumulation<summation::accumulators<8>>);
 // clang-format on
 
 } /* namespace bench */
@@ -0,0 +1,175 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * vmath_benchmarks.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include <psst/math/vmath.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace bench {
+
+namespace {
+
+constexpr std::size_t vmath_value_count = 1 << 16;
+
+template <typename T>
+std::vector<T>
+make_values(T min, T max)
+{
+    std::vector<T> res(vmath_value_count);
+    for (std::size_t i = 0; i < res.size(); ++i) {
+        res[i] = min + (max - min) * static_cast<T>(i) / static_cast<T>(res.size());
+    }
+    return res;
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+//  A standard library call per value against the vmath kernels over buffers
+//----------------------------------------------------------------------------
+template <typename T>
+void
+StdSin(benchmark::State& state)
+{
+    auto const     src = make_values<T>(-10, 10);
+    std::vector<T> res(src.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            res[i] = std::sin(src[i]);
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+template <typename T>
+void
+VmathSin(benchmark::State& state)
+{
+    auto const     src = make_values<T>(-10, 10);
+    std::vector<T> res(src.size());
+    for (auto _ : state) {
+        vmath::sin(src.data(), src.size(), res.data());
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+template <typename T>
+void
+StdExp(benchmark::State& state)
+{
+    auto const     src = make_values<T>(-20, 20);
+    std::vector<T> res(src.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            res[i] = std::exp(src[i]);
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+template <typename T>
+void
+VmathExp(benchmark::State& state)
+{
+    auto const     src = make_values<T>(-20, 20);
+    std::vector<T> res(src.size());
+    for (auto _ : state) {
+        vmath::exp(src.data(), src.size(), res.data());
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+template <typename T>
+void
+StdLog(benchmark::State& state)
+{
+    auto const     src = make_values<T>(0.01, 100);
+    std::vector<T> res(src.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            res[i] = std::log(src[i]);
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+template <typename T>
+void
+VmathLog(benchmark::State& state)
+{
+    auto const     src = make_values<T>(0.01, 100);
+    std::vector<T> res(src.size());
+    for (auto _ : state) {
+        vmath::log(src.data(), src.size(), res.data());
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+template <typename T>
+void
+StdAtan2(benchmark::State& state)
+{
+    auto const     y = make_values<T>(-10, 10);
+    auto const     x = make_values<T>(5, -3);
+    std::vector<T> res(y.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < y.size(); ++i) {
+            res[i] = std::atan2(y[i], x[i]);
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * y.size());
+}
+
+template <typename T>
+void
+VmathAtan2(benchmark::State& state)
+{
+    auto const     y = make_values<T>(-10, 10);
+    auto const     x = make_values<T>(5, -3);
+    std::vector<T> res(y.size());
+    for (auto _ : state) {
+        vmath::atan2(y.data(), x.data(), y.size(), res.data());
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * y.size());
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(StdSin,     float);
+BENCHMARK_TEMPLATE(VmathSin,   float);
+BENCHMARK_TEMPLATE(StdSin,     double);
+BENCHMARK_TEMPLATE(VmathSin,   double);
+BENCHMARK_TEMPLATE(StdExp,     float);
+BENCHMARK_TEMPLATE(VmathExp,   float);
+BENCHMARK_TEMPLATE(StdExp,     double);
+BENCHMARK_TEMPLATE(VmathExp,   double);
+BENCHMARK_TEMPLATE(StdLog,     float);
+BENCHMARK_TEMPLATE(VmathLog,   float);
+BENCHMARK_TEMPLATE(StdLog,     double);
+BENCHMARK_TEMPLATE(VmathLog,   double);
+BENCHMARK_TEMPLATE(StdAtan2,   float);
+BENCHMARK_TEMPLATE(VmathAtan2, float);
+BENCHMARK_TEMPLATE(StdAtan2,   double);
+BENCHMARK_TEMPLATE(VmathAtan2, double);
+// clang-format on
+
+} /* namespace bench */
+} /* namespace math */
+} /* namespace psst */
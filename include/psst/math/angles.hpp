@@ -8,23 +8,142 @@
 #ifndef PSST_MATH_ANGLES_HPP_
 #define PSST_MATH_ANGLES_HPP_
 
+#include <psst/math/constexpr_math.hpp>
+#include <psst/math/detail/block_loop.hpp>
 #include <psst/math/detail/value_policy.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 namespace psst {
 namespace math {
 
+//@{
+/**
+ * @name Constants
+ * Long double values rounded to T at compile time, so they can be used in constant expressions
+ * and fold into the code that uses them.
+ */
 template <typename T>
 struct pi {
-    static const T value;
+    static constexpr T value = T(3.14159265358979323846264338327950288L);
+};
+
+/** 2π, a full turn */
+template <typename T>
+struct tau {
+    static constexpr T value = T(6.28318530717958647692528676655900577L);
+};
+
+template <typename T>
+struct half_pi {
+    static constexpr T value = T(1.57079632679489661923132169163975144L);
 };
 
 template <typename T>
-const T pi<T>::value = std::atan((T)1) * 4;
+constexpr T pi_v = pi<T>::value;
+template <typename T>
+constexpr T tau_v = tau<T>::value;
+template <typename T>
+constexpr T half_pi_v = half_pi<T>::value;
+//@}
+
+namespace detail {
+
+/**
+ * 2π rounded to T and split for Cody-Waite reduction: the high part has the lower half of the
+ * mantissa bits cleared so that k * hi is exact for integral k up to 2^(digits/2), the low part is
+ * the rest of 2π. The differences from 2π are taken from its double-double value, as long double
+ * is the same as double on some targets.
+ */
+template <typename T>
+struct two_pi_parts {
+    static constexpr long double precise = tau_v<long double>;
+    //@{
+    /** 2π = tau_hi + tau_lo to 106 bits */
+    static constexpr long double tau_hi = 0x1.921fb54442d18p+2;
+    static constexpr long double tau_lo = 0x1.1a62633145c07p-52;
+    //@}
+    /** Bits of the high part after the binary point, 2π takes 3 bits before it */
+    static constexpr int  split_bits  = std::numeric_limits<T>::digits / 2 - 3;
+    static constexpr auto split_scale = static_cast<long double>(std::uint64_t{1} << split_bits);
+
+    static constexpr T value = T(precise);
+    static constexpr T inv   = T(1 / precise);
+    static constexpr T hi    = T(static_cast<std::uint64_t>(tau_hi * split_scale) / split_scale);
+    static constexpr T lo    = T((tau_hi - static_cast<long double>(hi)) + tau_lo);
+    /** Difference between 2π and the rounded value */
+    static constexpr T error = T((tau_hi - static_cast<long double>(value)) + tau_lo);
+    /** Multiples of 2π that are reduced exactly by the high part */
+    static constexpr T max_turns = T(std::uint64_t{1} << (std::numeric_limits<T>::digits / 2));
+};
+
+/**
+ * Angle minus turns times 2π without iteration, usable in constant expressions. A single turn is
+ * subtracted the same way as plain arithmetic would do, moderate counts use the two part 2π and
+ * the huge ones use fmod, which is exact for the rounded 2π, corrected by the rounding error. The
+ * result of the latter is in (-2π, 2π) and the turns value is not used.
+ */
+template <typename T>
+constexpr T
+subtract_turns(T angle, T turns)
+{
+    using parts = two_pi_parts<T>;
+
+    if (cx::abs(turns) <= 1)
+        return angle - turns * parts::value;
+    if (cx::abs(turns) < parts::max_turns)
+        return (angle - turns * parts::hi) - turns * parts::lo;
+
+    T const rem = cx::fmod(angle, parts::value);
+    T const k   = cx::nearbyint((angle - rem) * parts::inv);
+    // The quotient is exact as long as it fits the mantissa
+    constexpr T max_quotient = T(std::uint64_t{1} << (std::numeric_limits<T>::digits - 2));
+    return cx::abs(k) < max_quotient ? rem - k * parts::error : rem;
+}
+
+/** Number of angles reduced at once by the batch functions, see block_loop.hpp */
+constexpr std::size_t angle_block_size = 8;
+
+/**
+ * Branchless reduction for batches: Cody-Waite with a floor computed by 32-bit integer
+ * conversion. The result is in [0, 2π).
+ */
+template <typename T>
+inline T
+zero_to_two_pi_fast(T angle)
+{
+    using parts = two_pi_parts<T>;
+    T const q   = std::min(std::max(angle * parts::inv, T(-2147483648.0)), T(2147483520.0));
+    T       k   = T(static_cast<std::int32_t>(q));
+    k -= q < k ? T{1} : T{0};
+    T res = (angle - k * parts::hi) - k * parts::lo;
+    res += res < 0 ? parts::value : T{0};
+    res -= res >= parts::value ? parts::value : T{0};
+    return res;
+}
+
+/** Branchless reduction to [-π, π) for batches */
+template <typename T>
+inline T
+minus_plus_pi_fast(T angle)
+{
+    using parts = two_pi_parts<T>;
+    T const res = zero_to_two_pi_fast(angle);
+    return res >= parts::value / 2 ? res - parts::value : res;
+}
+
+}    // namespace detail
 
 /**
  * Clamp angle in the range of [0, π*2)
+ *
+ * Takes constant time regardless of the magnitude of the angle, angles already in range are
+ * returned as is.
  * @param angle
  * @return
  */
@@ -32,59 +151,91 @@ template <typename T>
 constexpr T
 zero_to_two_pi(T const& val)
 {
-    const auto double_pi = math::pi<std::decay_t<T>>::value * 2;
-    T          angle     = val;
-    while (angle >= double_pi) {
-        angle -= double_pi;
-    }
-    while (angle < 0) {
-        angle += double_pi;
-    }
-    return angle;
+    using value_type            = std::decay_t<T>;
+    constexpr value_type two_pi = detail::two_pi_parts<value_type>::value;
+    if (val >= 0 && val < two_pi)
+        return val;
+
+    auto angle = detail::subtract_turns<value_type>(
+        val, cx::floor(val * detail::two_pi_parts<value_type>::inv));
+    angle += angle < 0 ? two_pi : value_type{0};
+    // A tiny negative angle rounds to 2π
+    return angle < two_pi ? angle : value_type{0};
 }
 
 template <typename T>
 constexpr T
 minus_plus_half_pi(T const& angle)
 {
-    const auto half_pi = math::pi<std::decay_t<T>>::value / 2;
-    if (angle < -half_pi)
-        return -half_pi;
-    if (angle > half_pi)
-        return half_pi;
+    constexpr auto limit = half_pi_v<std::decay_t<T>>;
+    if (angle < -limit)
+        return -limit;
+    if (angle > limit)
+        return limit;
     return angle;
 }
 
+/**
+ * Clamp angle in the range of [-π, π] in constant time
+ * @param angle
+ * @return
+ */
 template <typename T>
 constexpr T
 minus_plus_pi(T const& val)
 {
-    const auto pi        = math::pi<std::decay_t<T>>::value * 2;
-    const auto double_pi = pi * 2;
-
-    T angle = val;
-    while (angle > pi) {
-        angle -= double_pi;
-    }
-    while (angle < -pi) {
-        angle += double_pi;
-    }
+    using value_type            = std::decay_t<T>;
+    constexpr value_type two_pi = detail::two_pi_parts<value_type>::value;
+    constexpr value_type pi     = pi_v<value_type>;
+    if (val >= -pi && val <= pi)
+        return val;
 
+    auto angle = detail::subtract_turns<value_type>(
+        val, cx::nearbyint(val * detail::two_pi_parts<value_type>::inv));
+    if (angle > pi)
+        angle -= two_pi;
+    else if (angle < -pi)
+        angle += two_pi;
     return angle;
 }
 
+//@{
+/**
+ * @name Batch angle normalization
+ * Normalize a buffer of angles in place by blocks of the branchless kernels, the results are
+ * valid for angles up to 2^31 turns.
+ */
+/** Normalize angles to [0, π*2) */
+template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value>>
+void
+zero_to_two_pi(T* data, std::size_t count)
+{
+    detail::transform_blocks<detail::angle_block_size>(data, count, data,
+                                                       detail::zero_to_two_pi_fast<T>);
+}
+
+/** Normalize angles to [-π, π) */
+template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value>>
+void
+minus_plus_pi(T* data, std::size_t count)
+{
+    detail::transform_blocks<detail::angle_block_size>(data, count, data,
+                                                       detail::minus_plus_pi_fast<T>);
+}
+//@}
+
 template <typename T>
 constexpr T
 degrees_to_radians(T degrees)
 {
-    return degrees / 180 * pi<std::decay_t<T>>::value;
+    return degrees / 180 * pi_v<std::decay_t<T>>;
 }
 
 template <typename T>
 constexpr T
 radians_to_degrees(T radians)
 {
-    return radians / pi<std::decay_t<T>>::value * 180;
+    return radians / pi_v<std::decay_t<T>> * 180;
 }
 
 inline constexpr double operator"" _deg(long double deg)
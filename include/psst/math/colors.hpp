@@ -9,6 +9,7 @@
 #ifndef PSST_MATH_COLORS_HPP_
 #define PSST_MATH_COLORS_HPP_
 
+#include <psst/math/constexpr_math.hpp>
 #include <psst/math/vector.hpp>
 
 namespace psst {
@@ -449,6 +450,15 @@ get_hex_color_component(std::uint8_t hex)
     return hex / T{255};
 }
 
+/** Clamp a colour component to [0, 1] and round it to the nearest hex value */
+template <typename T>
+constexpr std::uint8_t
+to_hex_color_component(T val)
+{
+    val = val < 0 ? T{0} : (val > 1 ? T{1} : val);
+    return static_cast<std::uint8_t>(static_cast<int>(val * 0xff + T{0.5}));
+}
+
 inline constexpr rgba_hex operator"" _rgba(unsigned long long val)
 {
     // clang-format off
@@ -531,8 +541,7 @@ struct color_chroma<components::hsla, Expr>
     constexpr auto
     value() const
     {
-        using std::abs;
-        return (1 - abs(2 * this->arg_.l() - 1)) * this->arg_.s();
+        return (1 - cx::abs(2 * this->arg_.l() - 1)) * this->arg_.s();
     }
 };
 
@@ -546,7 +555,6 @@ struct color_chroma<components::hsva, Expr>
     constexpr auto
     value() const
     {
-        using std::abs;
         return this->arg_.v() * this->arg_.s();
     }
 };
@@ -616,7 +624,10 @@ struct conversion<color::rgb<T>, color::rgb_hex, Expression> : unary_expression<
     constexpr auto
     result() const
     {
-        return color::rgba_hex{this->arg_.r() * 0xff, this->arg_.g() * 0xff, this->arg_.b() * 0xff};
+        using color::to_hex_color_component;
+        return color::rgb_hex{to_hex_color_component(this->arg_.r()),
+                              to_hex_color_component(this->arg_.g()),
+                              to_hex_color_component(this->arg_.b())};
     }
 };
 
@@ -628,8 +639,11 @@ struct conversion<color::rgba<T>, color::rgba_hex, Expression> : unary_expressio
     constexpr auto
     result() const
     {
-        return color::rgba_hex{this->arg_.r() * 0xff, this->arg_.g() * 0xff, this->arg_.b() * 0xff,
-                               this->arg_.a() * 0xff};
+        using color::to_hex_color_component;
+        return color::rgba_hex{to_hex_color_component(this->arg_.r()),
+                               to_hex_color_component(this->arg_.g()),
+                               to_hex_color_component(this->arg_.b()),
+                               to_hex_color_component(this->arg_.a())};
     }
 };
 
@@ -641,8 +655,11 @@ struct conversion<color::argb<T>, color::argb_hex, Expression> : unary_expressio
     constexpr auto
     result() const
     {
-        return color::argb_hex{this->arg_.r() * 0xff, this->arg_.g() * 0xff, this->arg_.b() * 0xff,
-                               this->arg_.a() * 0xff};
+        using color::to_hex_color_component;
+        return color::argb_hex{to_hex_color_component(this->arg_.r()),
+                               to_hex_color_component(this->arg_.g()),
+                               to_hex_color_component(this->arg_.b()),
+                               to_hex_color_component(this->arg_.a())};
     }
 };
 //@}
@@ -660,12 +677,10 @@ struct conversion<vector<T, Size, components::hsla>, vector<U, Size, components:
     {
         using value_type  = U;
         using result_type = vector<U, Size, components::rgba>;
-        using std::abs;
-        using std::fmod;
 
         value_type c       = chroma(this->arg_);
         value_type segment = this->arg_.hue() * 3 / pi<value_type>::value;
-        value_type x       = c * (1 - abs(fmod(segment, 2) - 1));
+        value_type x       = c * (1 - cx::abs(cx::fmod(segment, 2) - 1));
         value_type m       = this->arg_.l() - c / 2;
         if (0 <= segment && segment < 1) {
             if constexpr (Size >= 4) {
@@ -722,8 +737,6 @@ struct conversion<vector<T, Size, components::rgba>, vector<U, Size, components:
     {
         using value_type  = U;
         using result_type = vector<U, Size, components::hsla>;
-        using std::abs;
-        using std::fmod;
         using std::max;
         using std::min;
 
@@ -733,7 +746,7 @@ struct conversion<vector<T, Size, components::rgba>, vector<U, Size, components:
         value_type l    = (cmax + cmin) / 2;
         value_type s    = 0;
         if (l != 0 && l != 1) {
-            s = d / (1 - abs(2 * l - 1));
+            s = d / (1 - cx::abs(2 * l - 1));
         }
         if (d == 0) {
             if constexpr (Size >= 4) {
@@ -743,13 +756,15 @@ struct conversion<vector<T, Size, components::rgba>, vector<U, Size, components:
             }
         } else if (cmax == this->arg_.r()) {
             if constexpr (Size >= 4) {
-                return result_type{pi<value_type>::value / 3
-                                       * (value_type)fmod((this->arg_.g() - this->arg_.b()) / d, 6),
-                                   s, l, this->arg_.a()};
+                return result_type{
+                    pi<value_type>::value / 3
+                        * (value_type)cx::fmod((this->arg_.g() - this->arg_.b()) / d, 6),
+                    s, l, this->arg_.a()};
             } else {
-                return result_type{pi<value_type>::value / 3
-                                       * (value_type)fmod((this->arg_.g() - this->arg_.b()) / d, 6),
-                                   s, l};
+                return result_type{
+                    pi<value_type>::value / 3
+                        * (value_type)cx::fmod((this->arg_.g() - this->arg_.b()) / d, 6),
+                    s, l};
             }
         } else if (cmax == this->arg_.g()) {
             if constexpr (Size >= 4) {
@@ -793,12 +808,10 @@ struct conversion<vector<T, Size, components::hsva>, vector<U, Size, components:
     {
         using value_type  = U;
         using result_type = vector<U, Size, components::rgba>;
-        using std::abs;
-        using std::fmod;
 
         value_type c       = chroma(this->arg_);
         value_type segment = this->arg_.hue() * 3 / pi<value_type>::value;
-        value_type x       = c * (1 - abs(fmod(segment, 2) - 1));
+        value_type x       = c * (1 - cx::abs(cx::fmod(segment, 2) - 1));
         value_type m       = this->arg_.v() - c;
 
         if (0 <= segment && segment < 1) {
@@ -832,8 +845,6 @@ struct conversion<vector<T, Size, components::rgba>, vector<U, Size, components:
     {
         using value_type  = U;
         using result_type = vector<U, Size, components::hsva>;
-        using std::abs;
-        using std::fmod;
         using std::max;
         using std::min;
 
@@ -847,9 +858,10 @@ struct conversion<vector<T, Size, components::rgba>, vector<U, Size, components:
         if (d == 0) {
             return result_type{0, s, cmax, this->arg_.a()};
         } else if (cmax == this->arg_.r()) {
-            return result_type{pi<value_type>::value / 3
-                                   * (value_type)fmod((this->arg_.g() - this->arg_.b()) / d, 6),
-                               s, cmax, this->arg_.a()};
+            return result_type{
+                pi<value_type>::value / 3
+                    * (value_type)cx::fmod((this->arg_.g() - this->arg_.b()) / d, 6),
+                s, cmax, this->arg_.a()};
         } else if (cmax == this->arg_.g()) {
             return result_type{pi<value_type>::value / 3
                                    * ((this->arg_.b() - this->arg_.r()) / d + 2),
@@ -0,0 +1,426 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * colors_batch.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_COLORS_BATCH_HPP_
+#define PSST_MATH_COLORS_BATCH_HPP_
+
+#include <psst/math/colors.hpp>
+#include <psst/math/detail/block_loop.hpp>
+#include <psst/math/parallel.hpp>
+#include <psst/math/vector_view.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace psst {
+namespace math {
+namespace color {
+
+namespace detail {
+
+/** Number of pixels converted at once, see block_loop.hpp */
+constexpr std::size_t color_block_size = 8;
+
+/**
+ * A block of pixels with deinterleaved channels. The kernels convert the block in place, all
+ * channels being members of one object lets the compiler prove they don't alias.
+ */
+template <typename F>
+struct pixel_block {
+    F c0[color_block_size];
+    F c1[color_block_size];
+    F c2[color_block_size];
+    F alpha[color_block_size];
+};
+
+template <typename Src, typename Dst>
+using batch_value_t = std::conditional_t<
+    std::is_floating_point<Dst>::value, std::remove_const_t<Dst>,
+    std::conditional_t<std::is_floating_point<Src>::value, std::remove_const_t<Src>, float>>;
+
+template <typename F, typename T>
+constexpr F
+load_channel(T val)
+{
+    if constexpr (std::is_floating_point<T>::value) {
+        return val;
+    } else {
+        return val * (F{1} / 255);
+    }
+}
+
+template <typename T, typename F>
+constexpr T
+store_channel(F val)
+{
+    if constexpr (std::is_floating_point<T>::value) {
+        return val;
+    } else {
+        val = val < 0 ? F{0} : (val > 1 ? F{1} : val);
+        return static_cast<T>(static_cast<int>(val * 255 + F{0.5}));
+    }
+}
+
+/**
+ * Branchless floor, vectorises without SSE4.1 round instructions. Values beyond the integers of
+ * the mantissa, which are integral, infinities and NaN are returned as they are, the others are
+ * truncated by an integer conversion that cannot overflow.
+ */
+template <typename F>
+constexpr F
+floor_value(F val)
+{
+    using int_type    = std::conditional_t<sizeof(F) <= 4, std::int32_t, std::int64_t>;
+    constexpr F limit = F(std::uint64_t{1} << (std::numeric_limits<F>::digits - 1));
+
+    bool const in_range = val > -limit && val < limit;
+    F const    v        = in_range ? val : F{0};
+    F const    t        = static_cast<F>(static_cast<int_type>(v));
+    return in_range ? t - (t > v ? F{1} : F{0}) : val;
+}
+
+/** Branchless val mod period, the result is in [0, period) */
+template <typename F>
+constexpr F
+wrap_value(F val, F period)
+{
+    return val - period * floor_value(val / period);
+}
+
+template <typename F>
+constexpr F
+min_value(F a, F b)
+{
+    return a < b ? a : b;
+}
+
+template <typename F>
+constexpr F
+max_value(F a, F b)
+{
+    return a > b ? a : b;
+}
+
+template <typename F>
+constexpr F
+abs_value(F a)
+{
+    return a < 0 ? -a : a;
+}
+
+//@{
+/** @name Block loads and stores */
+template <std::size_t Size, typename T, typename F>
+void
+load_block(T const* src, std::size_t n, pixel_block<F>& px)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        px.c0[i] = load_channel<F>(src[i * Size + 0]);
+        px.c1[i] = load_channel<F>(src[i * Size + 1]);
+        px.c2[i] = load_channel<F>(src[i * Size + 2]);
+        if constexpr (Size >= 4) {
+            px.alpha[i] = load_channel<F>(src[i * Size + 3]);
+        } else {
+            px.alpha[i] = 1;
+        }
+    }
+    for (std::size_t i = n; i < color_block_size; ++i) {
+        px.c0[i] = px.c1[i] = px.c2[i] = px.alpha[i] = 0;
+    }
+}
+
+template <std::size_t Size, typename T, typename F>
+void
+store_block(T* dst, std::size_t n, pixel_block<F> const& px)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i * Size + 0] = store_channel<T>(px.c0[i]);
+        dst[i * Size + 1] = store_channel<T>(px.c1[i]);
+        dst[i * Size + 2] = store_channel<T>(px.c2[i]);
+        if constexpr (Size >= 4) {
+            dst[i * Size + 3] = store_channel<T>(px.alpha[i]);
+        }
+    }
+}
+//@}
+
+//@{
+/** @name Branchless conversion kernels, hue is in radians */
+/**
+ * Hue of an RGB colour in radians, zero for greys
+ */
+template <typename F>
+constexpr F
+rgb_hue(F r, F g, F b, F max_c, F delta)
+{
+    constexpr F hue_scale = pi_v<F> / 3;
+
+    F inv_d = 1 / (delta > 0 ? delta : F{1});
+    F hr    = (g - b) * inv_d;
+    hr      = hr < 0 ? hr + 6 : hr;
+    F hg    = (b - r) * inv_d + 2;
+    F hb    = (r - g) * inv_d + 4;
+    F hue   = max_c == r ? hr : (max_c == g ? hg : hb);
+    return delta > 0 ? hue * hue_scale : F{0};
+}
+
+template <typename F>
+void
+rgb_to_hsl_block(pixel_block<F>& px)
+{
+    for (std::size_t i = 0; i < color_block_size; ++i) {
+        F r     = px.c0[i];
+        F g     = px.c1[i];
+        F b     = px.c2[i];
+        F max_c = max_value(r, max_value(g, b));
+        F min_c = min_value(r, min_value(g, b));
+        F delta = max_c - min_c;
+        F light = (max_c + min_c) / 2;
+        F den   = 1 - abs_value(2 * light - 1);
+        px.c0[i] = rgb_hue(r, g, b, max_c, delta);
+        px.c1[i] = den > 0 ? min_value(delta / (den > 0 ? den : F{1}), F{1}) : F{0};
+        px.c2[i] = light;
+    }
+}
+
+template <typename F>
+void
+rgb_to_hsv_block(pixel_block<F>& px)
+{
+    for (std::size_t i = 0; i < color_block_size; ++i) {
+        F r      = px.c0[i];
+        F g      = px.c1[i];
+        F b      = px.c2[i];
+        F max_c  = max_value(r, max_value(g, b));
+        F min_c  = min_value(r, min_value(g, b));
+        F delta  = max_c - min_c;
+        px.c0[i] = rgb_hue(r, g, b, max_c, delta);
+        px.c1[i] = max_c > 0 ? delta / (max_c > 0 ? max_c : F{1}) : F{0};
+        px.c2[i] = max_c;
+    }
+}
+
+/**
+ * f(n) = l - a * max(-1, min(k - 3, 9 - k, 1)), k = (n + H / 30°) mod 12, a = s * min(l, 1 - l)
+ */
+template <typename F>
+void
+hsl_to_rgb_block(pixel_block<F>& px)
+{
+    constexpr F sector_scale = 6 / pi_v<F>;
+    for (std::size_t i = 0; i < color_block_size; ++i) {
+        F hue    = wrap_value(px.c0[i] * sector_scale, F{12});
+        F l      = px.c2[i];
+        F a      = px.c1[i] * min_value(l, 1 - l);
+        F kr     = hue;
+        F kg     = wrap_value(hue + 8, F{12});
+        F kb     = wrap_value(hue + 4, F{12});
+        px.c0[i] = l - a * max_value(F{-1}, min_value(min_value(kr - 3, 9 - kr), F{1}));
+        px.c1[i] = l - a * max_value(F{-1}, min_value(min_value(kg - 3, 9 - kg), F{1}));
+        px.c2[i] = l - a * max_value(F{-1}, min_value(min_value(kb - 3, 9 - kb), F{1}));
+    }
+}
+
+/**
+ * f(n) = v - v * s * max(0, min(k, 4 - k, 1)), k = (n + H / 60°) mod 6
+ */
+template <typename F>
+void
+hsv_to_rgb_block(pixel_block<F>& px)
+{
+    constexpr F sector_scale = 3 / pi_v<F>;
+    for (std::size_t i = 0; i < color_block_size; ++i) {
+        F hue    = wrap_value(px.c0[i] * sector_scale, F{6});
+        F v      = px.c2[i];
+        F c      = v * px.c1[i];
+        F kr     = wrap_value(hue + 5, F{6});
+        F kg     = wrap_value(hue + 3, F{6});
+        F kb     = wrap_value(hue + 1, F{6});
+        px.c0[i] = v - c * max_value(F{0}, min_value(min_value(kr, 4 - kr), F{1}));
+        px.c1[i] = v - c * max_value(F{0}, min_value(min_value(kg, 4 - kg), F{1}));
+        px.c2[i] = v - c * max_value(F{0}, min_value(min_value(kb, 4 - kb), F{1}));
+    }
+}
+//@}
+
+template <typename SrcComponents, typename DstComponents>
+struct batch_conversion;
+
+template <>
+struct batch_conversion<components::rgba, components::hsla> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        rgb_to_hsl_block(px);
+    }
+};
+
+template <>
+struct batch_conversion<components::rgba, components::hsva> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        rgb_to_hsv_block(px);
+    }
+};
+
+template <>
+struct batch_conversion<components::hsla, components::rgba> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        hsl_to_rgb_block(px);
+    }
+};
+
+template <>
+struct batch_conversion<components::hsva, components::rgba> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        hsv_to_rgb_block(px);
+    }
+};
+
+/**
+ * rgba_hex is converted with the same kernels, the channels are scaled on load and store.
+ * There is no sRGB transfer function, hex values are taken as they are.
+ */
+template <typename Components>
+struct batch_components {
+    using type = Components;
+};
+template <>
+struct batch_components<components::rgba_hex> {
+    using type = components::rgba;
+};
+template <typename Components>
+using batch_components_t = typename batch_components<Components>::type;
+
+template <typename SrcComponents, typename DstComponents, std::size_t SrcSize,
+          std::size_t DstSize, typename T, typename U>
+void
+convert_color_range(T const* src, U* dst, std::size_t count)
+{
+    using value_type = batch_value_t<T, U>;
+    using conversion = batch_conversion<batch_components_t<SrcComponents>,
+                                        batch_components_t<DstComponents>>;
+
+    math::detail::for_each_block<color_block_size>(count, [&](std::size_t first, std::size_t n) {
+        pixel_block<value_type> px;
+        load_block<SrcSize>(src + first * SrcSize, n, px);
+        conversion::convert(px);
+        store_block<DstSize>(dst + first * DstSize, n, px);
+    });
+}
+
+}    // namespace detail
+
+/**
+ * Convert a buffer of colours to another colour space.
+ *
+ * Supported conversions are RGB(A) <-> HSL(A) and RGB(A) <-> HSV(A), RGB(A) colours can be either
+ * floating point or hex (`rgba_hex`). colors_lab.hpp adds RGB(A) <-> XYZ, Lab and OKLab, where
+ * RGB is linear. Hex channels are only scaled to [0, 1] and are not sRGB decoded, so hex input
+ * to the Lab and OKLab conversions is linear too; decode sRGB images with srgb_to_linear from
+ * image.hpp first. The alpha channel is copied if both colour types have it, and set to 1 if the
+ * source has none.
+ *
+ * The conversion is branchless and processes blocks of pixels, large buffers are split between
+ * threads, use parallel_options::grain to keep image rows in one thread.
+ *
+ * @param src Source colours
+ * @param dst Destination buffer, must have at least the same number of colours as the source
+ * @param opts Threading options
+ */
+template <typename T, std::size_t SrcSize, typename SrcComponents, component_order SrcOrder,
+          typename U, std::size_t DstSize, typename DstComponents, component_order DstOrder>
+void
+convert_colors(memory_vector_view<T*, SrcSize, SrcComponents, SrcOrder> src,
+               memory_vector_view<U*, DstSize, DstComponents, DstOrder>  dst,
+               parallel_options const&                                   opts = {})
+{
+    static_assert((SrcOrder == component_order::forward && DstOrder == component_order::forward),
+                  "Batch colour conversion requires forward component order");
+    static_assert(!std::is_const<U>::value, "Destination buffer must be mutable");
+    static_assert(SrcSize >= 3 && SrcSize <= 4 && DstSize >= 3 && DstSize <= 4,
+                  "Batch colour conversion requires three or four components");
+
+    if (dst.size() < src.size())
+        throw std::runtime_error{"Destination buffer is too small"};
+
+    T const* src_data = src.data();
+    U*       dst_data = dst.data();
+    math::detail::parallel_for(src.size(), opts, [&](std::size_t first, std::size_t last) {
+        detail::convert_color_range<SrcComponents, DstComponents, SrcSize, DstSize>(
+            src_data + first * SrcSize, dst_data + first * DstSize, last - first);
+    });
+}
+
+//@{
+/** @name Named batch conversions */
+template <typename SrcView, typename DstView>
+void
+rgb_to_hsl(SrcView src, DstView dst, parallel_options const& opts = {})
+{
+    static_assert(traits::has_components_v<typename SrcView::view_type, components::rgba,
+                                           components::rgba_hex>,
+                  "Source must be RGB");
+    static_assert(traits::has_components_v<typename DstView::view_type, components::hsla>,
+                  "Destination must be HSL");
+    convert_colors(src, dst, opts);
+}
+
+template <typename SrcView, typename DstView>
+void
+rgb_to_hsv(SrcView src, DstView dst, parallel_options const& opts = {})
+{
+    static_assert(traits::has_components_v<typename SrcView::view_type, components::rgba,
+                                           components::rgba_hex>,
+                  "Source must be RGB");
+    static_assert(traits::has_components_v<typename DstView::view_type, components::hsva>,
+                  "Destination must be HSV");
+    convert_colors(src, dst, opts);
+}
+
+template <typename SrcView, typename DstView>
+void
+hsl_to_rgb(SrcView src, DstView dst, parallel_options const& opts = {})
+{
+    static_assert(traits::has_components_v<typename SrcView::view_type, components::hsla>,
+                  "Source must be HSL");
+    static_assert(traits::has_components_v<typename DstView::view_type, components::rgba,
+                                           components::rgba_hex>,
+                  "Destination must be RGB");
+    convert_colors(src, dst, opts);
+}
+
+template <typename SrcView, typename DstView>
+void
+hsv_to_rgb(SrcView src, DstView dst, parallel_options const& opts = {})
+{
+    static_assert(traits::has_components_v<typename SrcView::view_type, components::hsva>,
+                  "Source must be HSV");
+    static_assert(traits::has_components_v<typename DstView::view_type, components::rgba,
+                                           components::rgba_hex>,
+                  "Destination must be RGB");
+    convert_colors(src, dst, opts);
+}
+//@}
+
+}    // namespace color
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_COLORS_BATCH_HPP_ */
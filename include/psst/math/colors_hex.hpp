@@ -0,0 +1,404 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * colors_hex.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_COLORS_HEX_HPP_
+#define PSST_MATH_COLORS_HEX_HPP_
+
+#include <psst/math/colors.hpp>
+#include <psst/math/vector_format.hpp>
+#include <psst/math/vector_parse.hpp>
+
+#ifdef __SSE2__
+#    include <emmintrin.h>
+#endif
+
+#include <array>
+#include <cstring>
+
+namespace psst {
+namespace math {
+namespace io {
+
+namespace detail {
+
+//----------------------------------------------------------------------------
+//  Hex digits encoding and decoding
+//----------------------------------------------------------------------------
+constexpr std::uint8_t invalid_hex_digit = 0xff;
+
+constexpr std::array<std::uint8_t, 256>
+make_hex_digit_values()
+{
+    std::array<std::uint8_t, 256> values{};
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = invalid_hex_digit;
+    }
+    for (std::uint8_t i = 0; i < 10; ++i) {
+        values['0' + i] = i;
+    }
+    for (std::uint8_t i = 0; i < 6; ++i) {
+        values['a' + i] = 10 + i;
+        values['A' + i] = 10 + i;
+    }
+    return values;
+}
+
+/** Lookup table of hex digit values, invalid_hex_digit for characters that are not hex digits */
+constexpr std::array<std::uint8_t, 256> hex_digit_values = make_hex_digit_values();
+constexpr char                          hex_digits[]     = "0123456789abcdef";
+
+/**
+ * Decode pairs of hex digits to bytes using the lookup table.
+ * @return Index of the first invalid digit or 2 * n if all digits are valid
+ */
+inline std::size_t
+hex_decode_scalar(char const* in, std::uint8_t* out, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        auto hi = hex_digit_values[static_cast<unsigned char>(in[i * 2])];
+        auto lo = hex_digit_values[static_cast<unsigned char>(in[i * 2 + 1])];
+        if (hi == invalid_hex_digit)
+            return i * 2;
+        if (lo == invalid_hex_digit)
+            return i * 2 + 1;
+        out[i] = (hi << 4) | lo;
+    }
+    return n * 2;
+}
+
+inline void
+hex_encode_scalar(std::uint8_t const* in, char* out, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i * 2]     = hex_digits[in[i] >> 4];
+        out[i * 2 + 1] = hex_digits[in[i] & 0x0f];
+    }
+}
+
+#ifdef __SSE2__
+/**
+ * Convert 16 hex digits to nibble values.
+ * Sets the bits of the valid mask for the characters that are hex digits.
+ */
+inline __m128i
+hex_nibbles_sse2(__m128i c, int& valid)
+{
+    // Characters above 0x7f are negative and fail both range checks
+    __m128i digit    = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                                     _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    __m128i lower    = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    __m128i alpha    = _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10));
+    __m128i is_alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                     _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+    valid            = _mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha));
+    return _mm_or_si128(_mm_and_si128(is_digit, digit), _mm_and_si128(is_alpha, alpha));
+}
+
+/**
+ * Combine pairs of nibbles [hi, lo] to bytes in the 16-bit lanes
+ */
+inline __m128i
+hex_combine_sse2(__m128i nibbles)
+{
+    __m128i hi = _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00ff)), 4);
+    __m128i lo = _mm_srli_epi16(nibbles, 8);
+    return _mm_or_si128(hi, lo);
+}
+
+inline __m128i
+hex_ascii_sse2(__m128i nibbles)
+{
+    __m128i gt9 = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')),
+                        _mm_and_si128(gt9, _mm_set1_epi8('a' - '0' - 10)));
+}
+#endif
+
+/**
+ * Decode pairs of hex digits to bytes, 16 bytes per iteration when SSE2 is available.
+ * @return Index of the first invalid digit or 2 * n if all digits are valid
+ */
+inline std::size_t
+hex_decode(char const* in, std::uint8_t* out, std::size_t n)
+{
+    std::size_t i = 0;
+#ifdef __SSE2__
+    for (; i + 16 <= n; i += 16) {
+        int     valid0, valid1;
+        __m128i n0 = hex_nibbles_sse2(
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i * 2)), valid0);
+        __m128i n1 = hex_nibbles_sse2(
+            _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i * 2 + 16)), valid1);
+        if ((valid0 & valid1) != 0xffff)
+            break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         _mm_packus_epi16(hex_combine_sse2(n0), hex_combine_sse2(n1)));
+    }
+#endif
+    return i * 2 + hex_decode_scalar(in + i * 2, out + i, n - i);
+}
+
+/**
+ * Encode bytes to pairs of lower case hex digits, 16 bytes per iteration when SSE2 is available.
+ */
+inline void
+hex_encode(std::uint8_t const* in, char* out, std::size_t n)
+{
+    std::size_t i = 0;
+#ifdef __SSE2__
+    for (; i + 16 <= n; i += 16) {
+        __m128i b  = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(b, 4), _mm_set1_epi8(0x0f));
+        __m128i lo = _mm_and_si128(b, _mm_set1_epi8(0x0f));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2),
+                         hex_ascii_sse2(_mm_unpacklo_epi8(hi, lo)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2 + 16),
+                         hex_ascii_sse2(_mm_unpackhi_epi8(hi, lo)));
+    }
+#endif
+    hex_encode_scalar(in + i, out + i * 2, n - i);
+}
+
+//----------------------------------------------------------------------------
+//  Color sequences
+//----------------------------------------------------------------------------
+/** Number of colors decoded or encoded at once in bulk operations */
+constexpr std::size_t hex_color_block_size = 16;
+
+/**
+ * Parse a sequence of hex colors separated by whitespace and/or delimiters.
+ * The hex digits of a block of colors are gathered to a contiguous buffer and decoded at once,
+ * the decoded bytes of each block are passed to the sink.
+ */
+template <std::size_t Size, typename Sink>
+parse_result
+parse_hex_sequence(char const* first, char const* last, std::size_t max_count,
+                   text_format const& fmt, Sink sink)
+{
+    constexpr std::size_t digit_count = Size * 2;
+
+    char         digits[hex_color_block_size * digit_count];
+    std::uint8_t bytes[hex_color_block_size * Size];
+    char const*  starts[hex_color_block_size];
+
+    std::size_t count = 0;
+    auto        p     = skip_space(first, last);
+    while (p != last && count < max_count) {
+        std::size_t n     = 0;
+        char const* error = nullptr;
+        for (; n < hex_color_block_size && p != last && count + n < max_count; ++n) {
+            if (*p != '#' || static_cast<std::size_t>(last - p) <= digit_count) {
+                error = p;
+                break;
+            }
+            starts[n] = p + 1;
+            std::memcpy(digits + n * digit_count, p + 1, digit_count);
+            p = skip_object_delim(p + 1 + digit_count, last, fmt);
+        }
+        auto decoded = hex_decode(digits, bytes, n * Size);
+        auto valid   = decoded / digit_count;
+        sink(bytes, count, valid);
+        count += valid;
+        if (decoded != n * digit_count)
+            return {starts[valid] + decoded % digit_count, std::errc::invalid_argument, count};
+        if (error) {
+            if (*error == '#') {
+                // The color is truncated, find the position of the first invalid or missing digit
+                std::uint8_t tmp[Size];
+                ++error;
+                error += hex_decode_scalar(error, tmp, (last - error) / 2);
+            }
+            return {error, std::errc::invalid_argument, count};
+        }
+    }
+    return {p, std::errc{}, count};
+}
+
+}    // namespace detail
+
+//@{
+/** @name Single hex color */
+/**
+ * Parse a color in the #rrggbb or #rrggbbaa notation (depending on the size of the color vector)
+ * from a character buffer. Leading whitespace is skipped.
+ * The color is not modified if the parsing fails.
+ */
+template <std::size_t Size, typename Components>
+parse_result
+parse_hex_color(char const* first, char const* last, vector<std::uint8_t, Size, Components>& c,
+                text_format const& = {})
+{
+    constexpr std::size_t digit_count = Size * 2;
+
+    auto p = detail::skip_space(first, last);
+    if (p == last || *p != '#')
+        return {p, std::errc::invalid_argument, 0};
+    ++p;
+    std::uint8_t bytes[Size];
+    auto         available = static_cast<std::size_t>(last - p);
+    auto         decoded   = detail::hex_decode_scalar(p, bytes, std::min(Size, available / 2));
+    if (decoded != digit_count)
+        return {p + decoded, std::errc::invalid_argument, 0};
+    c = vector<std::uint8_t, Size, Components>{bytes};
+    return {p + digit_count, std::errc{}, 1};
+}
+
+template <typename Color>
+parse_result
+parse_hex_color(std::string_view str, Color& c, text_format const& fmt = {})
+{
+    return parse_hex_color(str.data(), str.data() + str.size(), c, fmt);
+}
+
+/**
+ * Format a color in #rrggbb or #rrggbbaa notation with lower case hex digits
+ */
+template <std::size_t Size, typename Components>
+format_result
+format_hex_color(char* first, char* last, vector<std::uint8_t, Size, Components> const& c)
+{
+    constexpr std::size_t char_count = Size * 2 + 1;
+    if (static_cast<std::size_t>(last - first) < char_count)
+        return {last, std::errc::value_too_large};
+    *first = '#';
+    detail::hex_encode_scalar(c.data(), first + 1, Size);
+    return {first + char_count, std::errc{}};
+}
+
+template <std::size_t Size, typename Components>
+std::string
+to_hex_string(vector<std::uint8_t, Size, Components> const& c)
+{
+    char buffer[Size * 2 + 1];
+    auto res = format_hex_color(buffer, buffer + sizeof(buffer), c);
+    return std::string(buffer, res.ptr);
+}
+//@}
+
+//@{
+/** @name Bulk hex colors */
+/**
+ * Parse all hex colors from a character buffer and append them to a container.
+ * Colors can be separated by whitespace and/or by the delimiter of the text format.
+ */
+template <typename Container,
+          typename = std::enable_if_t<std::is_same<
+              typename Container::value_type::value_type, std::uint8_t>::value>>
+parse_result
+parse_hex_colors(char const* first, char const* last, Container& out, text_format const& fmt = {})
+{
+    using color_type    = typename Container::value_type;
+    constexpr auto size = color_type::size;
+    return detail::parse_hex_sequence<size>(
+        first, last, std::numeric_limits<std::size_t>::max(), fmt,
+        [&out](std::uint8_t const* bytes, std::size_t, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                out.push_back(color_type{bytes + i * size});
+            }
+        });
+}
+
+/**
+ * Parse hex colors from a character buffer directly to a memory buffer.
+ * Parsing stops when the view is full or the end of input is reached.
+ */
+template <std::size_t Size, typename Components, component_order Order>
+parse_result
+parse_hex_colors(char const* first, char const* last,
+                 memory_vector_view<std::uint8_t*, Size, Components, Order> view,
+                 text_format const& fmt = {})
+{
+    static_assert(Order == component_order::forward,
+                  "Reverse component order is not supported for hex colors");
+    return detail::parse_hex_sequence<Size>(
+        first, last, view.size(), fmt,
+        [&view](std::uint8_t const* bytes, std::size_t offset, std::size_t n) {
+            std::memcpy(view.data() + offset * Size, bytes, n * Size);
+        });
+}
+
+template <typename Output>
+parse_result
+parse_hex_colors(std::string_view str, Output&& out, text_format const& fmt = {})
+{
+    return parse_hex_colors(str.data(), str.data() + str.size(), std::forward<Output>(out), fmt);
+}
+
+/**
+ * Format a contiguous array of colors to a character buffer.
+ * Each color is followed by the row separator of the format.
+ */
+template <std::size_t Size, typename Components>
+format_result
+format_hex_colors(char* first, char* last, vector<std::uint8_t, Size, Components> const* colors,
+                  std::size_t count, text_format const& fmt = {})
+{
+    constexpr std::size_t digit_count = Size * 2;
+    static_assert(sizeof(vector<std::uint8_t, Size, Components>) == Size,
+                  "Hex colors must be tightly packed");
+
+    auto const color_chars = 1 + digit_count + fmt.row_sep.size();
+    if (static_cast<std::size_t>(last - first) < count * color_chars)
+        return {last, std::errc::value_too_large};
+
+    char digits[detail::hex_color_block_size * digit_count];
+    auto bytes = reinterpret_cast<std::uint8_t const*>(colors);
+    auto p     = first;
+    for (std::size_t i = 0; i < count; i += detail::hex_color_block_size) {
+        auto n = std::min(detail::hex_color_block_size, count - i);
+        detail::hex_encode(bytes + i * Size, digits, n * Size);
+        for (std::size_t c = 0; c < n; ++c) {
+            *p++ = '#';
+            p    = std::copy(digits + c * digit_count, digits + (c + 1) * digit_count, p);
+            p    = std::copy(fmt.row_sep.begin(), fmt.row_sep.end(), p);
+        }
+    }
+    return {p, std::errc{}};
+}
+
+/**
+ * Format colors from a memory buffer to a character buffer
+ */
+template <typename T, std::size_t Size, typename Components, component_order Order,
+          typename = std::enable_if_t<std::is_same<std::decay_t<T>, std::uint8_t>::value>>
+format_result
+format_hex_colors(char* first, char* last, memory_vector_view<T*, Size, Components, Order> view,
+                  text_format const& fmt = {})
+{
+    static_assert(Order == component_order::forward,
+                  "Reverse component order is not supported for hex colors");
+    return format_hex_colors(
+        first, last, reinterpret_cast<vector<std::uint8_t, Size, Components> const*>(view.data()),
+        view.size(), fmt);
+}
+
+/**
+ * Append hex colors from a contiguous container to a string.
+ * Each color is followed by the row separator of the format.
+ */
+template <typename Container,
+          typename = std::enable_if_t<std::is_same<
+              typename Container::value_type::value_type, std::uint8_t>::value>>
+void
+format_hex_colors(std::string& out, Container const& colors, text_format const& fmt = {})
+{
+    constexpr auto size = Container::value_type::size;
+    auto           pos  = out.size();
+    out.resize(pos + colors.size() * (1 + size * 2 + fmt.row_sep.size()));
+    auto res = format_hex_colors(&out[pos], &out[0] + out.size(), colors.data(), colors.size(),
+                                 fmt);
+    out.resize(res.ptr - out.data());
+}
+//@}
+
+}    // namespace io
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_COLORS_HEX_HPP_ */
@@ -10,6 +10,7 @@
 #define PSST_MATH_INCLUDE_PSST_MATH_COLORS_IO_HPP_
 
 #include <psst/math/colors.hpp>
+#include <psst/math/colors_hex.hpp>
 #include <psst/math/vector_io.hpp>
 
 namespace psst::math {
@@ -17,30 +18,17 @@ namespace psst::math {
 inline std::ostream&
 operator<<(std::ostream& os, color::rgba_hex const& val)
 {
-    // clang-format off
-        os << '#' << std::hex << std::setfill('0')
-           << std::setw(2) << (unsigned int)val.red()
-           << std::setw(2) << (unsigned int)val.green()
-           << std::setw(2) << (unsigned int)val.blue()
-           << std::setw(2) << (unsigned int)val.alpha()
-           << std::dec
-        ;
-    // clang-format on
-    return os;
+    char buffer[color::rgba_hex::size * 2 + 1];
+    auto res = io::format_hex_color(buffer, buffer + sizeof(buffer), val);
+    return os.write(buffer, res.ptr - buffer);
 }
 
 inline std::ostream&
 operator<<(std::ostream& os, color::rgb_hex const& val)
 {
-    // clang-format off
-        os << '#' << std::hex << std::setfill('0')
-           << std::setw(2) << (unsigned int)val.red()
-           << std::setw(2) << (unsigned int)val.green()
-           << std::setw(2) << (unsigned int)val.blue()
-           << std::dec
-        ;
-    // clang-format on
-    return os;
+    char buffer[color::rgb_hex::size * 2 + 1];
+    auto res = io::format_hex_color(buffer, buffer + sizeof(buffer), val);
+    return os.write(buffer, res.ptr - buffer);
 }
 
 // TODO Generalize input for colors
@@ -54,7 +42,7 @@ operator>>(std::istream& is, color::rgba_hex& val)
     char c;
     is.get(c);
     color::rgba_hex tmp;
-    for (auto i = 0; i < color::rgba_hex::size; ++i) {
+    for (std::size_t i = 0; i < color::rgba_hex::size; ++i) {
         char hi, lo;
         if (is.get(hi) && is.get(lo)) {
             if (!std::isxdigit(hi) || !std::isxdigit(lo)) {
@@ -80,7 +68,7 @@ operator>>(std::istream& is, color::rgb_hex& val)
     char c;
     is.get(c);
     color::rgb_hex tmp;
-    for (auto i = 0; i < color::rgb_hex::size; ++i) {
+    for (std::size_t i = 0; i < color::rgb_hex::size; ++i) {
         char hi, lo;
         if (is.get(hi) && is.get(lo)) {
             if (!std::isxdigit(hi) || !std::isxdigit(lo)) {
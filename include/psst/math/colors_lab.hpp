@@ -0,0 +1,853 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * colors_lab.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_COLORS_LAB_HPP_
+#define PSST_MATH_COLORS_LAB_HPP_
+
+#include <psst/math/colors.hpp>
+#include <psst/math/colors_batch.hpp>
+#include <psst/math/matrix.hpp>
+#include <psst/math/vmath.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace psst {
+namespace math {
+namespace components {
+
+/**
+ * CIE 1931 XYZ, D65 white point with Y = 1 for the white
+ */
+struct xyza {
+    static constexpr std::size_t min_components = 3;
+    static constexpr std::size_t max_components = 4;
+    static constexpr std::size_t x              = 0;
+    static constexpr std::size_t y              = 1;
+    static constexpr std::size_t z              = 2;
+    static constexpr std::size_t alpha          = 3;
+
+    // clang-format off
+    using value_policies = utils::template_tuple<
+                math::value_policy::no_change,          // x
+                math::value_policy::no_change,          // y
+                math::value_policy::no_change,          // z
+                math::value_policy::clamp_zero_to_one   // alpha
+            >;
+    // clang-format on
+};
+
+/**
+ * CIE L*a*b*, D65 white point, L is in [0, 100]
+ */
+struct laba {
+    static constexpr std::size_t min_components = 3;
+    static constexpr std::size_t max_components = 4;
+    static constexpr std::size_t l              = 0;
+    static constexpr std::size_t a              = 1;
+    static constexpr std::size_t b              = 2;
+    static constexpr std::size_t alpha          = 3;
+    static constexpr std::size_t lightness      = l;
+
+    // clang-format off
+    using value_policies = utils::template_tuple<
+                math::value_policy::no_change,          // lightness
+                math::value_policy::no_change,          // a
+                math::value_policy::no_change,          // b
+                math::value_policy::clamp_zero_to_one   // alpha
+            >;
+    // clang-format on
+};
+
+/**
+ * OKLab perceptual colour space, L is in [0, 1]
+ */
+struct oklaba {
+    static constexpr std::size_t min_components = 3;
+    static constexpr std::size_t max_components = 4;
+    static constexpr std::size_t l              = 0;
+    static constexpr std::size_t a              = 1;
+    static constexpr std::size_t b              = 2;
+    static constexpr std::size_t alpha          = 3;
+    static constexpr std::size_t lightness      = l;
+
+    // clang-format off
+    using value_policies = utils::template_tuple<
+                math::value_policy::no_change,          // lightness
+                math::value_policy::no_change,          // a
+                math::value_policy::no_change,          // b
+                math::value_policy::clamp_zero_to_one   // alpha
+            >;
+    // clang-format on
+};
+
+}    // namespace components
+
+namespace component_access {
+
+//@{
+/** @name components::xyza component names */
+template <typename VectorType, typename T>
+struct component_access<3, components::xyza, VectorType, T>
+    : basic_component_access<VectorType, T, components::xyza> {
+
+    using base_type = basic_component_access<VectorType, T, components::xyza>;
+
+    PSST_MATH_COMPONENT_ACCESS(x)
+    PSST_MATH_COMPONENT_ACCESS(y)
+    PSST_MATH_COMPONENT_ACCESS(z)
+};
+
+template <typename VectorType, typename T>
+struct component_access<4, components::xyza, VectorType, T>
+    : component_access<3, components::xyza, VectorType, T> {
+
+    using base_type = component_access<3, components::xyza, VectorType, T>;
+
+    using base_type::x;
+    using base_type::y;
+    using base_type::z;
+
+    PSST_MATH_COMPONENT_ACCESS(alpha)
+};
+//@}
+
+//@{
+/** @name components::laba and components::oklaba component names */
+template <typename VectorType, typename T>
+struct component_access<3, components::laba, VectorType, T>
+    : basic_component_access<VectorType, T, components::laba> {
+
+    using base_type = basic_component_access<VectorType, T, components::laba>;
+
+    PSST_MATH_COMPONENT_ACCESS(l)
+    PSST_MATH_COMPONENT_ACCESS(lightness)
+    PSST_MATH_COMPONENT_ACCESS(a)
+    PSST_MATH_COMPONENT_ACCESS(b)
+};
+
+template <typename VectorType, typename T>
+struct component_access<4, components::laba, VectorType, T>
+    : component_access<3, components::laba, VectorType, T> {
+
+    using base_type = component_access<3, components::laba, VectorType, T>;
+
+    using base_type::a;
+    using base_type::b;
+    using base_type::l;
+    using base_type::lightness;
+
+    PSST_MATH_COMPONENT_ACCESS(alpha)
+};
+
+template <typename VectorType, typename T>
+struct component_access<3, components::oklaba, VectorType, T>
+    : basic_component_access<VectorType, T, components::oklaba> {
+
+    using base_type = basic_component_access<VectorType, T, components::oklaba>;
+
+    PSST_MATH_COMPONENT_ACCESS(l)
+    PSST_MATH_COMPONENT_ACCESS(lightness)
+    PSST_MATH_COMPONENT_ACCESS(a)
+    PSST_MATH_COMPONENT_ACCESS(b)
+};
+
+template <typename VectorType, typename T>
+struct component_access<4, components::oklaba, VectorType, T>
+    : component_access<3, components::oklaba, VectorType, T> {
+
+    using base_type = component_access<3, components::oklaba, VectorType, T>;
+
+    using base_type::a;
+    using base_type::b;
+    using base_type::l;
+    using base_type::lightness;
+
+    PSST_MATH_COMPONENT_ACCESS(alpha)
+};
+//@}
+
+}    // namespace component_access
+
+namespace color {
+
+template <typename T>
+using xyz = vector<T, 3, components::xyza>;
+template <typename T>
+using xyza = vector<T, 4, components::xyza>;
+
+template <typename T>
+using lab = vector<T, 3, components::laba>;
+template <typename T>
+using laba = vector<T, 4, components::laba>;
+
+template <typename T>
+using oklab = vector<T, 3, components::oklaba>;
+template <typename T>
+using oklaba = vector<T, 4, components::oklaba>;
+
+namespace detail {
+
+//@{
+/**
+ * @name Colour space constants
+ * RGB is linear with sRGB primaries, decode sRGB encoded values with srgb_to_linear first.
+ * This includes `rgba_hex` colours passed to the batch conversions, they are only scaled.
+ */
+template <typename T>
+constexpr matrix<T, 3, 3> linear_rgb_to_xyz{{T(0.4124564), T(0.3575761), T(0.1804375)},
+                                            {T(0.2126729), T(0.7151522), T(0.0721750)},
+                                            {T(0.0193339), T(0.1191920), T(0.9503041)}};
+template <typename T>
+constexpr matrix<T, 3, 3> xyz_to_linear_rgb{{T(3.2404542), T(-1.5371385), T(-0.4985314)},
+                                            {T(-0.9692660), T(1.8760108), T(0.0415560)},
+                                            {T(0.0556434), T(-0.2040259), T(1.0572252)}};
+
+/** D65 reference white */
+template <typename T>
+constexpr vector<T, 3> xyz_white{T(0.95047), T(1.0), T(1.08883)};
+
+/** Linear RGB to LMS cone response, M1 of OKLab */
+template <typename T>
+constexpr matrix<T, 3, 3> linear_rgb_to_lms{{T(0.4122214708), T(0.5363325363), T(0.0514459929)},
+                                            {T(0.2119034982), T(0.6806995451), T(0.1073969566)},
+                                            {T(0.0883024619), T(0.2817188376), T(0.6299787005)}};
+/** Non-linear LMS to OKLab, M2 of OKLab */
+template <typename T>
+constexpr matrix<T, 3, 3> lms_to_oklab{{T(0.2104542553), T(0.7936177850), T(-0.0040720468)},
+                                       {T(1.9779984951), T(-2.4285922050), T(0.4505937099)},
+                                       {T(0.0259040371), T(0.7827717662), T(-0.8086757660)}};
+template <typename T>
+constexpr matrix<T, 3, 3> oklab_to_lms{{T(1), T(0.3963377774), T(0.2158037573)},
+                                       {T(1), T(-0.1055613458), T(-0.0638541728)},
+                                       {T(1), T(-0.0894841775), T(-1.2914855480)}};
+template <typename T>
+constexpr matrix<T, 3, 3> lms_to_linear_rgb{{T(4.0767416621), T(-3.3077115913), T(0.2309699292)},
+                                            {T(-1.2684380046), T(2.6097574011), T(-0.3413193965)},
+                                            {T(-0.0041960863), T(-0.7034186147), T(1.7076127010)}};
+//@}
+
+//@{
+/** @name CIE Lab companding */
+template <typename T>
+constexpr T lab_epsilon = T(216) / T(24389);    // (6/29)^3
+template <typename T>
+constexpr T lab_kappa = T(24389) / T(27);    // (29/3)^3
+
+template <typename T>
+T
+lab_f(T t)
+{
+    using std::cbrt;
+    return t > lab_epsilon<T> ? cbrt(t) : (lab_kappa<T> * t + 16) / 116;
+}
+
+template <typename T>
+constexpr T
+lab_f_inv(T t)
+{
+    T t3 = t * t * t;
+    return t3 > lab_epsilon<T> ? t3 : (116 * t - 16) / lab_kappa<T>;
+}
+//@}
+
+/**
+ * Multiply a 3x3 matrix by the first three components of a vector expression
+ */
+template <typename T, typename Expr>
+constexpr vector<T, 3>
+transform3(matrix<T, 3, 3> const& m, Expr const& v)
+{
+    return expr::col<0>(
+        m * vector<T, 3>{v.template at<0>(), v.template at<1>(), v.template at<2>()});
+}
+
+/**
+ * Build a colour from three components, copying alpha from the source if both have it
+ */
+template <typename Result, typename Source, typename T>
+constexpr Result
+make_color(T c0, T c1, T c2, Source const& src)
+{
+    if constexpr (Result::size >= 4) {
+        if constexpr (traits::vector_expression_size_v<Source> >= 4) {
+            return Result{c0, c1, c2, src.template at<3>()};
+        } else {
+            return Result{c0, c1, c2, 1};
+        }
+    } else {
+        return Result{c0, c1, c2};
+    }
+}
+
+template <typename Result, typename Source, typename T>
+constexpr Result
+make_color(vector<T, 3> const& c, Source const& src)
+{
+    return make_color<Result>(c.template at<0>(), c.template at<1>(), c.template at<2>(), src);
+}
+
+template <typename T, typename Expr>
+vector<T, 3>
+xyz_to_lab(Expr const& xyz)
+{
+    T fx = lab_f<T>(xyz.template at<0>() / xyz_white<T>.template at<0>());
+    T fy = lab_f<T>(xyz.template at<1>() / xyz_white<T>.template at<1>());
+    T fz = lab_f<T>(xyz.template at<2>() / xyz_white<T>.template at<2>());
+    return {116 * fy - 16, 500 * (fx - fy), 200 * (fy - fz)};
+}
+
+template <typename T, typename Expr>
+constexpr vector<T, 3>
+lab_to_xyz(Expr const& lab)
+{
+    T fy = (lab.template at<0>() + 16) / 116;
+    T fx = fy + lab.template at<1>() / 500;
+    T fz = fy - lab.template at<2>() / 200;
+    return {lab_f_inv(fx) * xyz_white<T>.template at<0>(),
+            lab_f_inv(fy) * xyz_white<T>.template at<1>(),
+            lab_f_inv(fz) * xyz_white<T>.template at<2>()};
+}
+
+template <typename T, typename Expr>
+vector<T, 3>
+linear_rgb_to_oklab(Expr const& rgb)
+{
+    using std::cbrt;
+    auto lms = transform3(linear_rgb_to_lms<T>, rgb);
+    return transform3(lms_to_oklab<T>, vector<T, 3>{cbrt(lms.template at<0>()),
+                                                    cbrt(lms.template at<1>()),
+                                                    cbrt(lms.template at<2>())});
+}
+
+template <typename T, typename Expr>
+constexpr vector<T, 3>
+oklab_to_linear_rgb(Expr const& lab)
+{
+    auto lms = transform3(oklab_to_lms<T>, lab);
+    T    l   = lms.template at<0>();
+    T    m   = lms.template at<1>();
+    T    s   = lms.template at<2>();
+    return transform3(lms_to_linear_rgb<T>, vector<T, 3>{l * l * l, m * m * m, s * s * s});
+}
+
+}    // namespace detail
+
+}    // namespace color
+
+namespace expr {
+inline namespace v {
+
+//@{
+/** @name Linear RGB <-> XYZ conversion */
+template <typename T, typename U, std::size_t SSize, std::size_t DSize, typename Expression>
+struct conversion<vector<T, SSize, components::rgba>, vector<U, DSize, components::xyza>,
+                  Expression> : unary_expression<Expression> {
+    using expression_base = unary_expression<Expression>;
+    using expression_base::expression_base;
+
+    constexpr auto
+    result() const
+    {
+        using result_type = vector<U, DSize, components::xyza>;
+        return color::detail::make_color<result_type>(
+            color::detail::transform3(color::detail::linear_rgb_to_xyz<U>, this->arg_), this->arg_);
+    }
+};
+
+template <typename T, typename U, std::size_t SSize, std::size_t DSize, typename Expression>
+struct conversion<vector<T, SSize, components::xyza>, vector<U, DSize, components::rgba>,
+                  Expression> : unary_expression<Expression> {
+    using expression_base = unary_expression<Expression>;
+    using expression_base::expression_base;
+
+    constexpr auto
+    result() const
+    {
+        using result_type = vector<U, DSize, components::rgba>;
+        return color::detail::make_color<result_type>(
+            color::detail::transform3(color::detail::xyz_to_linear_rgb<U>, this->arg_), this->arg_);
+    }
+};
+//@}
+
+//@{
+/** @name XYZ <-> Lab conversion */
+template <typename T, typename U, std::size_t SSize, std::size_t DSize, typename Expression>
+struct conversion<vector<T, SSize, components::xyza>, vector<U, DSize, components::laba>,
+                  Expression> : unary_expression<Expression> {
+    using expression_base = unary_expression<Expression>;
+    using expression_base::expression_base;
+
+    auto
+    result() const
+    {
+        using result_type = vector<U, DSize, components::laba>;
+        return color::detail::make_color<result_type>(color::detail::xyz_to_lab<U>(this->arg_),
+                                                      this->arg_);
+    }
+};
+
+template <typename T, typename U, std::size_t SSize, std::size_t DSize, typename Expression>
+struct conversion<vector<T, SSize, components::laba>, vector<U, DSize, components::xyza>,
+                  Expression> : unary_expression<Expression> {
+    using expression_base = unary_expression<Expression>;
+    using expression_base::expression_base;
+
+    constexpr auto
+    result() const
+    {
+        using result_type = vector<U, DSize, components::xyza>;
+        return color::detail::make_color<result_type>(color::detail::lab_to_xyz<U>(this->arg_),
+                                                      this->arg_);
+    }
+};
+//@}
+
+//@{
+/** @name Linear RGB <-> Lab conversion through XYZ */
+template <typename T, typename U, std::size_t SSize, std::size_t DSize, typename Expression>
+struct conversion<vector<T, SSize, components::rgba>, vector<U, DSize, components::laba>,
+                  Expression> : unary_expression<Expression> {
+    using expression_base = unary_expression<Expression>;
+    using expression_base::expression_base;
+
+    auto
+    result() const
+    {
+        using result_type = vector<U, DSize, components::laba>;
+        auto xyz = color::detail::transform3(color::detail::linear_rgb_to_xyz<U>, this->arg_);
+        return color::detail::make_color<result_type>(color::detail::xyz_to_lab<U>(xyz),
+                                                      this->arg_);
+    }
+};
+
+template <typename T, typename U, std::size_t SSize, std::size_t DSize, typename Expression>
+struct conversion<vector<T, SSize, components::laba>, vector<U, DSize, components::rgba>,
+                  Expression> : unary_expression<Expression> {
+    using expression_base = unary_expression<Expression>;
+    using expression_base::expression_base;
+
+    constexpr auto
+    result() const
+    {
+        using result_type = vector<U, DSize, components::rgba>;
+        auto xyz          = color::detail::lab_to_xyz<U>(this->arg_);
+        return color::detail::make_color<result_type>(
+            color::detail::transform3(color::detail::xyz_to_linear_rgb<U>, xyz), this->arg_);
+    }
+};
+//@}
+
+//@{
+/** @name Linear RGB <-> OKLab conversion */
+template <typename T, typename U, std::size_t SSize, std::size_t DSize, typename Expression>
+struct conversion<vector<T, SSize, components::rgba>, vector<U, DSize, components::oklaba>,
+                  Expression> : unary_expression<Expression> {
+    using expression_base = unary_expression<Expression>;
+    using expression_base::expression_base;
+
+    auto
+    result() const
+    {
+        using result_type = vector<U, DSize, components::oklaba>;
+        return color::detail::make_color<result_type>(
+            color::detail::linear_rgb_to_oklab<U>(this->arg_), this->arg_);
+    }
+};
+
+template <typename T, typename U, std::size_t SSize, std::size_t DSize, typename Expression>
+struct conversion<vector<T, SSize, components::oklaba>, vector<U, DSize, components::rgba>,
+                  Expression> : unary_expression<Expression> {
+    using expression_base = unary_expression<Expression>;
+    using expression_base::expression_base;
+
+    constexpr auto
+    result() const
+    {
+        using result_type = vector<U, DSize, components::rgba>;
+        return color::detail::make_color<result_type>(
+            color::detail::oklab_to_linear_rgb<U>(this->arg_), this->arg_);
+    }
+};
+//@}
+
+}    // namespace v
+}    // namespace expr
+
+namespace color {
+
+//----------------------------------------------------------------------------
+//  Colour difference
+//----------------------------------------------------------------------------
+/**
+ * Euclidean colour difference, CIE76 ΔE*ab for Lab colours and ΔEok for OKLab colours.
+ * Alpha is ignored.
+ */
+template <typename LHS, typename RHS,
+          typename = traits::enable_for_components<LHS, components::laba, components::oklaba>,
+          typename = std::enable_if_t<traits::same_components_v<LHS, RHS>>>
+auto
+delta_e(LHS const& lhs, RHS const& rhs)
+{
+    using std::sqrt;
+    auto dl = lhs.template at<0>() - rhs.template at<0>();
+    auto da = lhs.template at<1>() - rhs.template at<1>();
+    auto db = lhs.template at<2>() - rhs.template at<2>();
+    return sqrt(dl * dl + da * da + db * db);
+}
+
+/**
+ * CIEDE2000 colour difference of two Lab colours
+ */
+template <typename LHS, typename RHS,
+          typename = traits::enable_for_components<LHS, components::laba>,
+          typename = traits::enable_for_components<RHS, components::laba>>
+auto
+delta_e_2000(LHS const& lhs, RHS const& rhs)
+{
+    using value_type = std::common_type_t<traits::scalar_expression_result_t<LHS>,
+                                          traits::scalar_expression_result_t<RHS>>;
+    using std::abs;
+    using std::atan2;
+    using std::cos;
+    using std::exp;
+    using std::pow;
+    using std::sin;
+    using std::sqrt;
+
+    constexpr value_type two_pi = tau_v<value_type>;
+    constexpr value_type deg    = pi_v<value_type> / 180;
+    constexpr value_type pow25_7 = 6103515625;    // 25^7
+
+    value_type l1 = lhs.template at<0>(), a1 = lhs.template at<1>(), b1 = lhs.template at<2>();
+    value_type l2 = rhs.template at<0>(), a2 = rhs.template at<1>(), b2 = rhs.template at<2>();
+
+    value_type c_mean = (sqrt(a1 * a1 + b1 * b1) + sqrt(a2 * a2 + b2 * b2)) / 2;
+    value_type c7     = pow(c_mean, 7);
+    value_type g      = (1 - sqrt(c7 / (c7 + pow25_7))) / 2;
+    value_type a1p    = a1 * (1 + g);
+    value_type a2p    = a2 * (1 + g);
+    value_type c1p    = sqrt(a1p * a1p + b1 * b1);
+    value_type c2p    = sqrt(a2p * a2p + b2 * b2);
+    value_type h1p    = (a1p == 0 && b1 == 0) ? 0 : atan2(b1, a1p);
+    value_type h2p    = (a2p == 0 && b2 == 0) ? 0 : atan2(b2, a2p);
+    if (h1p < 0)
+        h1p += two_pi;
+    if (h2p < 0)
+        h2p += two_pi;
+
+    value_type dlp = l2 - l1;
+    value_type dcp = c2p - c1p;
+    value_type dhp = 0;
+    if (c1p * c2p != 0) {
+        dhp = h2p - h1p;
+        if (dhp > pi_v<value_type>)
+            dhp -= two_pi;
+        else if (dhp < -pi_v<value_type>)
+            dhp += two_pi;
+    }
+    value_type d_hp = 2 * sqrt(c1p * c2p) * sin(dhp / 2);
+
+    value_type lp_mean = (l1 + l2) / 2;
+    value_type cp_mean = (c1p + c2p) / 2;
+    value_type hp_mean = h1p + h2p;
+    if (c1p * c2p != 0) {
+        if (abs(h1p - h2p) > pi_v<value_type>)
+            hp_mean += hp_mean < two_pi ? two_pi : -two_pi;
+        hp_mean /= 2;
+    }
+
+    value_type t = 1 - value_type(0.17) * cos(hp_mean - 30 * deg)
+                   + value_type(0.24) * cos(2 * hp_mean)
+                   + value_type(0.32) * cos(3 * hp_mean + 6 * deg)
+                   - value_type(0.20) * cos(4 * hp_mean - 63 * deg);
+    value_type d_theta = 30 * deg * exp(-pow((hp_mean / deg - 275) / 25, 2));
+    value_type cp7     = pow(cp_mean, 7);
+    value_type r_c     = 2 * sqrt(cp7 / (cp7 + pow25_7));
+    value_type l50     = (lp_mean - 50) * (lp_mean - 50);
+    value_type s_l     = 1 + value_type(0.015) * l50 / sqrt(20 + l50);
+    value_type s_c     = 1 + value_type(0.045) * cp_mean;
+    value_type s_h     = 1 + value_type(0.015) * cp_mean * t;
+    value_type r_t     = -sin(2 * d_theta) * r_c;
+
+    value_type tl = dlp / s_l;
+    value_type tc = dcp / s_c;
+    value_type th = d_hp / s_h;
+    return sqrt(tl * tl + tc * tc + th * th + r_t * tc * th);
+}
+
+//----------------------------------------------------------------------------
+//  Batch conversion kernels
+//----------------------------------------------------------------------------
+namespace detail {
+
+template <typename F>
+constexpr void
+transform_block(matrix<F, 3, 3> const& m, pixel_block<F>& px)
+{
+    for (std::size_t i = 0; i < color_block_size; ++i) {
+        F c0     = px.c0[i];
+        F c1     = px.c1[i];
+        F c2     = px.c2[i];
+        px.c0[i] = m.template element<0, 0>() * c0 + m.template element<0, 1>() * c1
+                   + m.template element<0, 2>() * c2;
+        px.c1[i] = m.template element<1, 0>() * c0 + m.template element<1, 1>() * c1
+                   + m.template element<1, 2>() * c2;
+        px.c2[i] = m.template element<2, 0>() * c0 + m.template element<2, 1>() * c1
+                   + m.template element<2, 2>() * c2;
+    }
+}
+
+template <typename F>
+void
+xyz_to_lab_block(pixel_block<F>& px)
+{
+    constexpr F inv_xn = 1 / xyz_white<F>.template at<0>();
+    constexpr F inv_zn = 1 / xyz_white<F>.template at<2>();
+    auto        f      = [](F t) {
+        return t > lab_epsilon<F> ? vmath::detail::cbrt(t) : (lab_kappa<F> * t + 16) * (F{1} / 116);
+    };
+    for (std::size_t i = 0; i < color_block_size; ++i) {
+        F fx     = f(px.c0[i] * inv_xn);
+        F fy     = f(px.c1[i]);
+        F fz     = f(px.c2[i] * inv_zn);
+        px.c0[i] = 116 * fy - 16;
+        px.c1[i] = 500 * (fx - fy);
+        px.c2[i] = 200 * (fy - fz);
+    }
+}
+
+template <typename F>
+void
+lab_to_xyz_block(pixel_block<F>& px)
+{
+    for (std::size_t i = 0; i < color_block_size; ++i) {
+        F fy     = (px.c0[i] + 16) * (F{1} / 116);
+        F fx     = fy + px.c1[i] * (F{1} / 500);
+        F fz     = fy - px.c2[i] * (F{1} / 200);
+        px.c0[i] = lab_f_inv(fx) * xyz_white<F>.template at<0>();
+        px.c1[i] = lab_f_inv(fy);
+        px.c2[i] = lab_f_inv(fz) * xyz_white<F>.template at<2>();
+    }
+}
+
+template <typename F>
+void
+cbrt_block(pixel_block<F>& px)
+{
+    for (std::size_t i = 0; i < color_block_size; ++i) {
+        px.c0[i] = vmath::detail::cbrt(px.c0[i]);
+        px.c1[i] = vmath::detail::cbrt(px.c1[i]);
+        px.c2[i] = vmath::detail::cbrt(px.c2[i]);
+    }
+}
+
+template <typename F>
+void
+cube_block(pixel_block<F>& px)
+{
+    for (std::size_t i = 0; i < color_block_size; ++i) {
+        px.c0[i] = px.c0[i] * px.c0[i] * px.c0[i];
+        px.c1[i] = px.c1[i] * px.c1[i] * px.c1[i];
+        px.c2[i] = px.c2[i] * px.c2[i] * px.c2[i];
+    }
+}
+
+template <>
+struct batch_conversion<components::rgba, components::xyza> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        transform_block(linear_rgb_to_xyz<F>, px);
+    }
+};
+
+template <>
+struct batch_conversion<components::xyza, components::rgba> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        transform_block(xyz_to_linear_rgb<F>, px);
+    }
+};
+
+template <>
+struct batch_conversion<components::xyza, components::laba> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        xyz_to_lab_block(px);
+    }
+};
+
+template <>
+struct batch_conversion<components::laba, components::xyza> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        lab_to_xyz_block(px);
+    }
+};
+
+template <>
+struct batch_conversion<components::rgba, components::laba> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        transform_block(linear_rgb_to_xyz<F>, px);
+        xyz_to_lab_block(px);
+    }
+};
+
+template <>
+struct batch_conversion<components::laba, components::rgba> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        lab_to_xyz_block(px);
+        transform_block(xyz_to_linear_rgb<F>, px);
+    }
+};
+
+template <>
+struct batch_conversion<components::rgba, components::oklaba> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        transform_block(linear_rgb_to_lms<F>, px);
+        cbrt_block(px);
+        transform_block(lms_to_oklab<F>, px);
+    }
+};
+
+template <>
+struct batch_conversion<components::oklaba, components::rgba> {
+    template <typename F>
+    static void
+    convert(pixel_block<F>& px)
+    {
+        transform_block(oklab_to_lms<F>, px);
+        cube_block(px);
+        transform_block(lms_to_linear_rgb<F>, px);
+    }
+};
+
+}    // namespace detail
+
+//----------------------------------------------------------------------------
+//  Batch colour difference and palette quantization
+//----------------------------------------------------------------------------
+/**
+ * Euclidean colour differences of two buffers of Lab or OKLab colours, the views can be of
+ * const or of mutable values
+ * @param lhs First buffer of colours
+ * @param rhs Second buffer of colours, must have the same number of colours
+ * @param out Output of differences, must have room for lhs.size() values
+ */
+template <typename T, typename U, std::size_t LSize, std::size_t RSize, typename Components,
+          typename = std::enable_if_t<std::is_same<Components, components::laba>::value
+                                      || std::is_same<Components, components::oklaba>::value>>
+void
+delta_e(memory_vector_view<T*, LSize, Components> lhs,
+        memory_vector_view<U*, RSize, Components> rhs, std::remove_const_t<T>* out,
+        parallel_options const& opts = {})
+{
+    static_assert(std::is_same<std::remove_const_t<T>, std::remove_const_t<U>>::value,
+                  "Colour buffers must have the same value type");
+    if (lhs.size() != rhs.size())
+        throw std::runtime_error{"Colour buffers have different sizes"};
+    T const* l = lhs.data();
+    U const* r = rhs.data();
+    math::detail::parallel_for(lhs.size(), opts, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            auto dl = l[i * LSize] - r[i * RSize];
+            auto da = l[i * LSize + 1] - r[i * RSize + 1];
+            auto db = l[i * LSize + 2] - r[i * RSize + 2];
+            out[i]  = std::sqrt(dl * dl + da * da + db * db);
+        }
+    });
+}
+
+/**
+ * Find the nearest palette entry for each colour by Euclidean distance, which is ΔE*ab for Lab
+ * and ΔEok for OKLab colours. The views can be of const or of mutable values.
+ *
+ * @param colors Colours to quantize
+ * @param palette Palette colours in the same colour space
+ * @param indexes Output of palette indexes, must have room for colors.size() values
+ */
+template <typename T, typename U, std::size_t Size, std::size_t PSize, typename Components,
+          typename = std::enable_if_t<std::is_same<Components, components::laba>::value
+                                      || std::is_same<Components, components::oklaba>::value>>
+void
+nearest_colors(memory_vector_view<T*, Size, Components>  colors,
+               memory_vector_view<U*, PSize, Components> palette, std::uint32_t* indexes,
+               parallel_options const& opts = {})
+{
+    static_assert(std::is_same<std::remove_const_t<T>, std::remove_const_t<U>>::value,
+                  "Colours and palette must have the same value type");
+    using value_type      = std::remove_const_t<T>;
+    using block           = detail::pixel_block<value_type>;
+    constexpr auto blk_sz = detail::color_block_size;
+    if (palette.empty())
+        throw std::runtime_error{"Palette is empty"};
+
+    // Palette in structure of arrays layout
+    std::vector<value_type> pal(palette.size() * 3);
+    for (std::size_t p = 0; p < palette.size(); ++p) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            pal[c * palette.size() + p] = palette.data()[p * PSize + c];
+        }
+    }
+    value_type const* pl = pal.data();
+    value_type const* pa = pl + palette.size();
+    value_type const* pb = pa + palette.size();
+
+    T const* src = colors.data();
+    math::detail::parallel_for(colors.size(), opts, [&](std::size_t first, std::size_t last) {
+        for (std::size_t b = first; b < last; b += blk_sz) {
+            auto const n = std::min(blk_sz, last - b);
+            block      px;
+            detail::load_block<Size>(src + b * Size, n, px);
+            value_type    best[blk_sz];
+            std::uint32_t best_index[blk_sz];
+            for (std::size_t i = 0; i < blk_sz; ++i) {
+                best[i]       = std::numeric_limits<value_type>::max();
+                best_index[i] = 0;
+            }
+            for (std::uint32_t p = 0; p < palette.size(); ++p) {
+                for (std::size_t i = 0; i < blk_sz; ++i) {
+                    value_type dl = px.c0[i] - pl[p];
+                    value_type da = px.c1[i] - pa[p];
+                    value_type db = px.c2[i] - pb[p];
+                    value_type d  = dl * dl + da * da + db * db;
+                    best_index[i] = d < best[i] ? p : best_index[i];
+                    best[i]       = d < best[i] ? d : best[i];
+                }
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                indexes[b + i] = best_index[i];
+            }
+        }
+    });
+}
+
+}    // namespace color
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_COLORS_LAB_HPP_ */
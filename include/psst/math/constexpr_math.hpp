@@ -0,0 +1,476 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * constexpr_math.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_CONSTEXPR_MATH_HPP_
+#define PSST_MATH_CONSTEXPR_MATH_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/**
+ * Elementary functions usable in constant expressions. At run time the functions of the cx
+ * namespace call the std ones, in a constant evaluation they compute the value in long double
+ * and round it to the argument type, so that tables of rotations, coordinates or colors are
+ * built by the compiler. Non-arithmetic arguments, e.g. SIMD packs, go to the functions found by
+ * argument-dependent lookup.
+ *
+ * Detecting a constant evaluation takes std::is_constant_evaluated or the builtin of GCC and
+ * Clang, which is available in C++17 mode. Without either of them the std functions are always
+ * called.
+ */
+#if defined(__cpp_lib_is_constant_evaluated)
+#define PSST_MATH_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define PSST_MATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+
+#if !defined(PSST_MATH_IS_CONSTANT_EVALUATED) && defined(__GNUC__) && __GNUC__ >= 9
+#define PSST_MATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+#if !defined(PSST_MATH_IS_CONSTANT_EVALUATED)
+#define PSST_MATH_IS_CONSTANT_EVALUATED() false
+#endif
+
+namespace psst {
+namespace math {
+namespace cx {
+
+namespace detail {
+
+using real = long double;
+
+/**
+ * π/2 split in four doubles, the first three have the lower bits cleared, so that k times them is
+ * exact in long double for k up to 2^31
+ */
+constexpr real pio2_1  = 0x1.921fb544p+0;
+constexpr real pio2_2  = 0x1.0b4611a6p-34;
+constexpr real pio2_3  = 0x1.3198a2ep-69;
+constexpr real pio2_3t = 0x1.b839a252049c1p-104;
+
+constexpr real pi           = 3.14159265358979323846264338327950288L;
+constexpr real half_pi      = 1.57079632679489661923132169163975144L;
+constexpr real two_over_pi  = 0.63661977236758134307553505349005744813783858296182579L;
+constexpr real tan_pi_8     = 0.41421356237309504880168872420969807856967187537694807L;
+constexpr real quarter_pi_v = 0.78539816339744830961566084581987572104929234984377645L;
+
+/** Integers and values beyond the integers of the mantissa, infinities and NaN as they are */
+constexpr bool
+is_integral_value(real v)
+{
+    return !(v > -9223372036854775808.0L && v < 9223372036854775808.0L)
+           || static_cast<real>(static_cast<std::int64_t>(v)) == v;
+}
+
+constexpr real
+floor(real v)
+{
+    if (is_integral_value(v))
+        return v;
+    real const t = static_cast<real>(static_cast<std::int64_t>(v));
+    return t > v ? t - 1 : t;
+}
+
+/** Rounded to the nearest integer, halfway cases to even as in the default rounding mode */
+constexpr real
+nearbyint(real v)
+{
+    if (is_integral_value(v))
+        return v;
+    real const f    = floor(v);
+    real const frac = v - f;
+    if (frac != 0.5L)
+        return frac < 0.5L ? f : f + 1;
+    return static_cast<std::int64_t>(f) % 2 == 0 ? f : f + 1;
+}
+
+/**
+ * Remainder of x / y with the sign of x, exact as std::fmod: the doubled divisor is subtracted
+ * as in long division, each subtraction is exact as the operands are within a factor of two.
+ */
+constexpr real
+fmod(real x, real y)
+{
+    if (y == 0 || x != x || y != y || x - x != 0)
+        return std::numeric_limits<real>::quiet_NaN();
+    real const d = y < 0 ? -y : y;
+    real       r = x < 0 ? -x : x;
+    if (r < d)
+        return x;
+    real m = d;
+    while (m <= r / 2) {
+        m *= 2;
+    }
+    for (; m >= d; m /= 2) {
+        r = r >= m ? r - m : r;
+    }
+    return x < 0 ? -r : r;
+}
+
+/** Rounded to the nearest integer, halfway cases away from zero */
+constexpr std::int64_t
+round_to_int(real v)
+{
+    return static_cast<std::int64_t>(v < 0 ? v - 0.5L : v + 0.5L);
+}
+
+/**
+ * Argument minus k * π/2, in [-π/4, π/4]. Accurate for |x| < 2^31 * π/2, larger arguments lose
+ * the bits of k * π/2 beyond the long double mantissa.
+ */
+constexpr real
+reduce_half_pi(real x, std::int64_t& k)
+{
+    k             = round_to_int(x * two_over_pi);
+    real const kr = static_cast<real>(k);
+    return (((x - kr * pio2_1) - kr * pio2_2) - kr * pio2_3) - kr * pio2_3t;
+}
+
+/** Taylor series of sin on [-π/4, π/4], summed until the terms vanish */
+constexpr real
+sin_kernel(real r)
+{
+    real const r2   = r * r;
+    real       term = r;
+    real       sum  = r;
+    for (int n = 2; sum + term != sum; n += 2) {
+        term *= -r2 / (n * (n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+/** Taylor series of cos on [-π/4, π/4], summed until the terms vanish */
+constexpr real
+cos_kernel(real r)
+{
+    real const r2   = r * r;
+    real       term = 1;
+    real       sum  = 1;
+    for (int n = 1; sum + term != sum; n += 2) {
+        term *= -r2 / (n * (n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr real
+sin(real x)
+{
+    std::int64_t k = 0;
+    real const   r = reduce_half_pi(x, k);
+    switch (k & 3) {
+    case 0:
+        return sin_kernel(r);
+    case 1:
+        return cos_kernel(r);
+    case 2:
+        return -sin_kernel(r);
+    default:
+        return -cos_kernel(r);
+    }
+}
+
+constexpr real
+cos(real x)
+{
+    std::int64_t k = 0;
+    real const   r = reduce_half_pi(x, k);
+    switch (k & 3) {
+    case 0:
+        return cos_kernel(r);
+    case 1:
+        return -sin_kernel(r);
+    case 2:
+        return -cos_kernel(r);
+    default:
+        return sin_kernel(r);
+    }
+}
+
+constexpr real
+tan(real x)
+{
+    std::int64_t k = 0;
+    real const   r = reduce_half_pi(x, k);
+    return k & 1 ? -cos_kernel(r) / sin_kernel(r) : sin_kernel(r) / cos_kernel(r);
+}
+
+/**
+ * atan(x) = π/2 - atan(1/x) takes the argument to [0, 1], atan(x) = π/4 + atan((x-1)/(x+1))
+ * further to [-tan(π/8), tan(π/8)] where the series converges fast.
+ */
+constexpr real
+atan(real x)
+{
+    bool const negative = x < 0;
+    x                   = negative ? -x : x;
+    bool const inverted = x > 1;
+    x                   = inverted ? 1 / x : x;
+    real base           = 0;
+    if (x > tan_pi_8) {
+        base = quarter_pi_v;
+        x    = (x - 1) / (x + 1);
+    }
+    real const x2   = x * x;
+    real       term = x;
+    real       sum  = x;
+    for (int n = 3;; n += 2) {
+        term *= -x2;
+        real const next = sum + term / n;
+        if (next == sum)
+            break;
+        sum = next;
+    }
+    real res = base + sum;
+    res      = inverted ? half_pi - res : res;
+    return negative ? -res : res;
+}
+
+/** Signed zeros are not told apart, atan2(0, 0) is 0 and atan2(0, x) is π for a negative x */
+constexpr real
+atan2(real y, real x)
+{
+    if (x > 0)
+        return atan(y / x);
+    if (x < 0)
+        return y < 0 ? atan(y / x) - pi : atan(y / x) + pi;
+    if (y > 0)
+        return half_pi;
+    if (y < 0)
+        return -half_pi;
+    return 0;
+}
+
+/** Newton iterations for the argument scaled to [1, 4) by powers of 4 */
+constexpr real
+sqrt(real x)
+{
+    if (x < 0)
+        return std::numeric_limits<real>::quiet_NaN();
+    if (x == 0 || x > std::numeric_limits<real>::max())
+        return x;
+    constexpr real big   = 18446744073709551616.0L;    // 2^64
+    real           scale = 1;
+    while (x >= big) {
+        x /= big;
+        scale *= 4294967296.0L;    // 2^32
+    }
+    while (x < 1 / big) {
+        x *= big;
+        scale /= 4294967296.0L;
+    }
+    while (x >= 4) {
+        x /= 4;
+        scale *= 2;
+    }
+    while (x < 1) {
+        x *= 4;
+        scale /= 2;
+    }
+    real r = (x + 1) / 2;
+    for (real next = (r + x / r) / 2; next < r; next = (r + x / r) / 2) {
+        r = next;
+    }
+    return r * scale;
+}
+
+constexpr real
+asin(real x)
+{
+    return atan2(x, sqrt((1 - x) * (1 + x)));
+}
+
+constexpr real
+acos(real x)
+{
+    return atan2(sqrt((1 - x) * (1 + x)), x);
+}
+
+}    // namespace detail
+
+//@{
+/**
+ * @name Trigonometric functions
+ * The compile time values are within an ulp of the correctly rounded ones for float and double
+ * arguments of magnitude up to 2^31 * π/2.
+ */
+template <typename T>
+constexpr auto
+sin(T const& v)
+{
+    using std::sin;
+    if constexpr (std::is_arithmetic<T>::value) {
+        using result_type = decltype(sin(v));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(detail::sin(v));
+    }
+    return sin(v);
+}
+
+template <typename T>
+constexpr auto
+cos(T const& v)
+{
+    using std::cos;
+    if constexpr (std::is_arithmetic<T>::value) {
+        using result_type = decltype(cos(v));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(detail::cos(v));
+    }
+    return cos(v);
+}
+
+template <typename T>
+constexpr auto
+tan(T const& v)
+{
+    using std::tan;
+    if constexpr (std::is_arithmetic<T>::value) {
+        using result_type = decltype(tan(v));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(detail::tan(v));
+    }
+    return tan(v);
+}
+
+template <typename T>
+constexpr auto
+atan(T const& v)
+{
+    using std::atan;
+    if constexpr (std::is_arithmetic<T>::value) {
+        using result_type = decltype(atan(v));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(detail::atan(v));
+    }
+    return atan(v);
+}
+
+template <typename T, typename U>
+constexpr auto
+atan2(T const& y, U const& x)
+{
+    using std::atan2;
+    if constexpr (std::is_arithmetic<T>::value && std::is_arithmetic<U>::value) {
+        using result_type = decltype(atan2(y, x));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(detail::atan2(y, x));
+    }
+    return atan2(y, x);
+}
+
+template <typename T>
+constexpr auto
+asin(T const& v)
+{
+    using std::asin;
+    if constexpr (std::is_arithmetic<T>::value) {
+        using result_type = decltype(asin(v));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(detail::asin(v));
+    }
+    return asin(v);
+}
+
+template <typename T>
+constexpr auto
+acos(T const& v)
+{
+    using std::acos;
+    if constexpr (std::is_arithmetic<T>::value) {
+        using result_type = decltype(acos(v));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(detail::acos(v));
+    }
+    return acos(v);
+}
+//@}
+
+/** Square root, within an ulp of the correctly rounded value at compile time */
+template <typename T>
+constexpr auto
+sqrt(T const& v)
+{
+    using std::sqrt;
+    if constexpr (std::is_arithmetic<T>::value) {
+        using result_type = decltype(sqrt(v));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(detail::sqrt(v));
+    }
+    return sqrt(v);
+}
+
+//@{
+/**
+ * @name Rounding and remainders
+ * The compile time values are exact as the run time ones are.
+ */
+template <typename T>
+constexpr auto
+abs(T const& v)
+{
+    using std::abs;
+    if constexpr (std::is_arithmetic<T>::value) {
+        using result_type = decltype(abs(v));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(v < 0 ? -v : v);
+    }
+    return abs(v);
+}
+
+template <typename T>
+constexpr auto
+floor(T const& v)
+{
+    using std::floor;
+    if constexpr (std::is_arithmetic<T>::value) {
+        using result_type = decltype(floor(v));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(detail::floor(v));
+    }
+    return floor(v);
+}
+
+template <typename T>
+constexpr auto
+nearbyint(T const& v)
+{
+    using std::nearbyint;
+    if constexpr (std::is_arithmetic<T>::value) {
+        using result_type = decltype(nearbyint(v));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(detail::nearbyint(v));
+    }
+    return nearbyint(v);
+}
+
+template <typename T, typename U>
+constexpr auto
+fmod(T const& x, U const& y)
+{
+    using std::fmod;
+    if constexpr (std::is_arithmetic<T>::value && std::is_arithmetic<U>::value) {
+        using result_type = decltype(fmod(x, y));
+        if (PSST_MATH_IS_CONSTANT_EVALUATED())
+            return static_cast<result_type>(detail::fmod(x, y));
+    }
+    return fmod(x, y);
+}
+//@}
+
+}    // namespace cx
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_CONSTEXPR_MATH_HPP_ */
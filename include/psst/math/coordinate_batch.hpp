@@ -0,0 +1,535 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * coordinate_batch.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_COORDINATE_BATCH_HPP_
+#define PSST_MATH_COORDINATE_BATCH_HPP_
+
+#include <psst/math/coordinate_conversion.hpp>
+#include <psst/math/detail/block_loop.hpp>
+#include <psst/math/parallel.hpp>
+#include <psst/math/vector_view.hpp>
+#include <psst/math/vmath.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace psst::math {
+
+/**
+ * Accuracy of trigonometric functions in batch coordinate conversion.
+ *
+ * The error bounds are absolute errors of angles in radians and of Cartesian coordinates
+ * relative to the radius.
+ */
+enum class trig_accuracy {
+    /** Standard library functions */
+    standard,
+    /**
+     * Functions of vmath, within a few ulp of the value type, i.e. error within 6e-7 for float
+     * and 1e-15 for double
+     */
+    precise,
+    /** Low degree polynomials evaluated in the value type, error within 1e-4 */
+    fast,
+};
+
+namespace detail {
+
+/** Number of coordinates converted at once, see block_loop.hpp */
+constexpr std::size_t coordinate_block_size = 8;
+
+/** A block of coordinates with deinterleaved components, converted in place */
+template <typename F>
+struct coordinate_block {
+    F c0[coordinate_block_size];
+    F c1[coordinate_block_size];
+    F c2[coordinate_block_size];
+};
+
+//@{
+/** @name Trigonometric functions for the kernels */
+/** Standard library functions */
+struct standard_trig {
+    template <typename F>
+    static void
+    sincos(F x, F& s, F& c)
+    {
+        using std::cos;
+        using std::sin;
+        s = sin(x);
+        c = cos(x);
+    }
+
+    /** The standard functions cover all arguments */
+    template <typename F>
+    static void
+    sincos_fallback(F, F&, F&)
+    {}
+
+    template <typename F>
+    static F
+    atan2(F y, F x)
+    {
+        using std::atan2;
+        return atan2(y, x);
+    }
+};
+
+/** Polynomial kernels of vmath, standard functions for the types it has no kernels for */
+struct vmath_trig {
+    template <typename F>
+    static void
+    sincos(F x, F& s, F& c)
+    {
+        if constexpr (vmath::detail::has_kernels<F>) {
+            vmath::detail::sincos(x, s, c);
+        } else {
+            standard_trig::sincos(x, s, c);
+        }
+    }
+
+    /** Standard sin and cos for the arguments vmath does not reduce, NaN and infinities included */
+    template <typename F>
+    static void
+    sincos_fallback(F x, F& s, F& c)
+    {
+        if constexpr (vmath::detail::has_kernels<F>) {
+            vmath::detail::sincos_fallback(x, s, c);
+        }
+    }
+
+    template <typename F>
+    static F
+    atan2(F y, F x)
+    {
+        if constexpr (vmath::detail::has_kernels<F>) {
+            return vmath::detail::atan2(y, x);
+        } else {
+            return standard_trig::atan2(y, x);
+        }
+    }
+};
+
+/**
+ * Low degree minimax polynomials. sin and cos are on [-π/4, π/4] as functions of y and z = y²,
+ * atan is on [0, 1].
+ */
+struct fast_polynomials {
+    template <typename F>
+    static constexpr F
+    sin(F y, F z)
+    {
+        return y + y * z * (F(8.1529913664e-3) * z + F(-1.6662833765e-1));
+    }
+
+    template <typename F>
+    static constexpr F
+    cos(F z)
+    {
+        return 1 + z * (F(4.0488928764e-2) * z + F(-4.9977630434e-1));
+    }
+
+    template <typename F>
+    static constexpr F
+    atan(F a)
+    {
+        F const z = a * a;
+        return a
+               * (((F(-3.8986402418e-2) * z + F(1.4626430066e-1)) * z + F(-3.2117490460e-1)) * z
+                  + F(9.9921380672e-1));
+    }
+};
+
+/** Branchless sin, cos and atan2 built on polynomials */
+template <typename Polynomials>
+struct polynomial_trig {
+    /**
+     * The argument is reduced to [-π/4, π/4] by subtracting the nearest multiple of π/2, which
+     * is split in three parts so that the products of the high parts are exact. Accurate for
+     * |x| < 2^13 π.
+     */
+    template <typename F>
+    static void
+    sincos(F x, F& s, F& c)
+    {
+        constexpr F pio2_1 = F(1.5703125);
+        constexpr F pio2_2 = F(4.837512969970703125e-4);
+        constexpr F pio2_3 = F(7.54978995489188216e-8);
+
+        F const    q  = x * F(0.636619772367581343075535053490057448L);
+        auto const j  = static_cast<std::int32_t>(q + (q < 0 ? F{-0.5} : F{0.5}));
+        F const    fj = static_cast<F>(j);
+        F const    y  = ((x - fj * pio2_1) - fj * pio2_2) - fj * pio2_3;
+        F const    z  = y * y;
+        F const    ps = Polynomials::sin(y, z);
+        F const    pc = Polynomials::cos(z);
+        F const    sv = (j & 1) ? pc : ps;
+        F const    cv = (j & 1) ? ps : pc;
+        s             = (j & 2) ? -sv : sv;
+        c             = ((j + 1) & 2) ? -cv : cv;
+    }
+
+    /** Arguments beyond 2^13 π lose accuracy and are not recomputed */
+    template <typename F>
+    static void
+    sincos_fallback(F, F&, F&)
+    {}
+
+    /** atan of the smaller to the larger absolute value, then mapped to the octant */
+    template <typename F>
+    static F
+    atan2(F y, F x)
+    {
+        F const ax = x < 0 ? -x : x;
+        F const ay = y < 0 ? -y : y;
+        F const mx = ax > ay ? ax : ay;
+        F const mn = ax > ay ? ay : ax;
+        F       r  = Polynomials::atan(mn / (mx > 0 ? mx : F{1}));
+        r          = ay > ax ? half_pi_v<F> - r : r;
+        r          = x < 0 ? pi_v<F> - r : r;
+        return y < 0 ? -r : r;
+    }
+};
+//@}
+
+template <trig_accuracy Accuracy>
+struct trig_functions {
+    using type = standard_trig;
+};
+template <>
+struct trig_functions<trig_accuracy::precise> {
+    using type = vmath_trig;
+};
+template <>
+struct trig_functions<trig_accuracy::fast> {
+    using type = polynomial_trig<fast_polynomials>;
+};
+
+/** Azimuth from atan2 result, in [0, 2π) as the coordinate types keep it */
+template <typename F>
+constexpr F
+wrap_azimuth(F angle)
+{
+    constexpr F two_pi = tau_v<F>;
+    angle              = angle < 0 ? angle + two_pi : angle;
+    return angle < two_pi ? angle : F{0};
+}
+
+//@{
+/**
+ * @name Block loads and stores
+ * Full blocks are (de)interleaved by loops of the constant trip count as well.
+ */
+template <std::size_t Size, typename T, typename F>
+void
+load_block(T const* src, std::size_t n, coordinate_block<F>& b)
+{
+    auto load = [&](std::size_t i) {
+        b.c0[i] = src[i * Size + 0];
+        b.c1[i] = src[i * Size + 1];
+        if constexpr (Size > 2) {
+            b.c2[i] = src[i * Size + 2];
+        } else {
+            b.c2[i] = 0;
+        }
+    };
+    if (n == coordinate_block_size) {
+        for (std::size_t i = 0; i < coordinate_block_size; ++i) {
+            load(i);
+        }
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            load(i);
+        }
+        for (std::size_t i = n; i < coordinate_block_size; ++i) {
+            b.c0[i] = b.c1[i] = b.c2[i] = 0;
+        }
+    }
+}
+
+template <std::size_t Size, typename T, typename F>
+void
+store_block(T* dst, std::size_t n, coordinate_block<F> const& b)
+{
+    auto store = [&](std::size_t i) {
+        dst[i * Size + 0] = b.c0[i];
+        dst[i * Size + 1] = b.c1[i];
+        if constexpr (Size > 2) {
+            dst[i * Size + 2] = b.c2[i];
+        }
+        if constexpr (Size > 3) {
+            dst[i * Size + 3] = 0;
+        }
+    };
+    if (n == coordinate_block_size) {
+        for (std::size_t i = 0; i < coordinate_block_size; ++i) {
+            store(i);
+        }
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            store(i);
+        }
+    }
+}
+//@}
+
+/**
+ * sin and cos of a block of angles. The kernel loop is branchless, the arguments it does not
+ * cover are recomputed in a separate loop, where the branch is rarely taken.
+ */
+template <typename Trig, typename F>
+void
+sincos_block(F const (&x)[coordinate_block_size], F (&s)[coordinate_block_size],
+             F (&c)[coordinate_block_size])
+{
+    for (std::size_t i = 0; i < coordinate_block_size; ++i) {
+        Trig::sincos(x[i], s[i], c[i]);
+    }
+    for (std::size_t i = 0; i < coordinate_block_size; ++i) {
+        Trig::sincos_fallback(x[i], s[i], c[i]);
+    }
+}
+
+//@{
+/** @name Branchless conversion kernels */
+/** (rho, phi, z) -> (x, y, z), z is zero for polar coordinates */
+template <typename Trig, typename F>
+void
+cylindrical_to_cartesian_block(coordinate_block<F>& b)
+{
+    F s[coordinate_block_size], c[coordinate_block_size];
+    sincos_block<Trig>(b.c1, s, c);
+    for (std::size_t i = 0; i < coordinate_block_size; ++i) {
+        F const rho = b.c0[i];
+        b.c0[i]     = rho * c[i];
+        b.c1[i]     = rho * s[i];
+    }
+}
+
+/** (x, y, z) -> (rho, phi, z) */
+template <typename Trig, typename F>
+void
+cartesian_to_cylindrical_block(coordinate_block<F>& b)
+{
+    using std::sqrt;
+    for (std::size_t i = 0; i < coordinate_block_size; ++i) {
+        F const x = b.c0[i];
+        F const y = b.c1[i];
+        b.c0[i]   = sqrt(x * x + y * y);
+        b.c1[i]   = wrap_azimuth(Trig::atan2(y, x));
+    }
+}
+
+/** (rho, inclination, azimuth) -> (x, y, z) */
+template <typename Trig, typename F>
+void
+spherical_to_cartesian_block(coordinate_block<F>& b)
+{
+    F si[coordinate_block_size], ci[coordinate_block_size];
+    F sa[coordinate_block_size], ca[coordinate_block_size];
+    sincos_block<Trig>(b.c1, si, ci);
+    sincos_block<Trig>(b.c2, sa, ca);
+    for (std::size_t i = 0; i < coordinate_block_size; ++i) {
+        F const rho        = b.c0[i];
+        F const projection = rho * ci[i];
+        b.c0[i]            = projection * ca[i];
+        b.c1[i]            = projection * sa[i];
+        b.c2[i]            = rho * si[i];
+    }
+}
+
+/**
+ * (x, y, z) -> (rho, inclination, azimuth), the inclination is computed as
+ * atan2(z, sqrt(x² + y²)) that equals asin(z / rho) and is well conditioned near the poles.
+ */
+template <typename Trig, typename F>
+void
+cartesian_to_spherical_block(coordinate_block<F>& b)
+{
+    using std::sqrt;
+    for (std::size_t i = 0; i < coordinate_block_size; ++i) {
+        F const x        = b.c0[i];
+        F const y        = b.c1[i];
+        F const z        = b.c2[i];
+        F const plane_sq = x * x + y * y;
+        b.c0[i]          = sqrt(plane_sq + z * z);
+        b.c1[i]          = Trig::atan2(z, sqrt(plane_sq));
+        b.c2[i]          = wrap_azimuth(Trig::atan2(y, x));
+    }
+}
+//@}
+
+template <typename SrcComponents, typename DstComponents>
+struct batch_coordinate_conversion {
+    static constexpr bool supported = false;
+};
+
+template <>
+struct batch_coordinate_conversion<components::polar, components::xyzw> {
+    static constexpr bool supported = true;
+    template <typename Trig, typename F>
+    static void
+    convert(coordinate_block<F>& b)
+    {
+        cylindrical_to_cartesian_block<Trig>(b);
+    }
+};
+
+template <>
+struct batch_coordinate_conversion<components::cylindrical, components::xyzw>
+    : batch_coordinate_conversion<components::polar, components::xyzw> {};
+
+template <>
+struct batch_coordinate_conversion<components::xyzw, components::cylindrical> {
+    static constexpr bool supported = true;
+    template <typename Trig, typename F>
+    static void
+    convert(coordinate_block<F>& b)
+    {
+        cartesian_to_cylindrical_block<Trig>(b);
+    }
+};
+
+template <>
+struct batch_coordinate_conversion<components::xyzw, components::polar>
+    : batch_coordinate_conversion<components::xyzw, components::cylindrical> {};
+
+template <>
+struct batch_coordinate_conversion<components::spherical, components::xyzw> {
+    static constexpr bool supported = true;
+    template <typename Trig, typename F>
+    static void
+    convert(coordinate_block<F>& b)
+    {
+        spherical_to_cartesian_block<Trig>(b);
+    }
+};
+
+template <>
+struct batch_coordinate_conversion<components::xyzw, components::spherical> {
+    static constexpr bool supported = true;
+    template <typename Trig, typename F>
+    static void
+    convert(coordinate_block<F>& b)
+    {
+        cartesian_to_spherical_block<Trig>(b);
+    }
+};
+
+template <typename Conversion, typename Trig, std::size_t SrcSize, std::size_t DstSize,
+          typename T, typename U>
+void
+convert_coordinate_range(T const* src, U* dst, std::size_t count)
+{
+    for_each_block<coordinate_block_size>(count, [&](std::size_t first, std::size_t n) {
+        coordinate_block<U> b;
+        load_block<SrcSize>(src + first * SrcSize, n, b);
+        Conversion::template convert<Trig>(b);
+        store_block<DstSize>(dst + first * DstSize, n, b);
+    });
+}
+
+/** Select the kernel instantiation once per range */
+template <typename SrcComponents, typename DstComponents, std::size_t SrcSize,
+          std::size_t DstSize, typename T, typename U>
+void
+convert_coordinate_range(T const* src, U* dst, std::size_t count, trig_accuracy accuracy)
+{
+    using conversion = batch_coordinate_conversion<SrcComponents, DstComponents>;
+    switch (accuracy) {
+    case trig_accuracy::precise:
+        convert_coordinate_range<conversion,
+                                 trig_functions<trig_accuracy::precise>::type, SrcSize, DstSize>(
+            src, dst, count);
+        break;
+    case trig_accuracy::fast:
+        convert_coordinate_range<conversion, trig_functions<trig_accuracy::fast>::type, SrcSize,
+                                 DstSize>(src, dst, count);
+        break;
+    default:
+        convert_coordinate_range<conversion,
+                                 trig_functions<trig_accuracy::standard>::type, SrcSize, DstSize>(
+            src, dst, count);
+        break;
+    }
+}
+
+}    // namespace detail
+
+/**
+ * Convert a buffer of coordinates to another coordinate system.
+ *
+ * Supported conversions are Cartesian (xyzw, 2 to 4 components) <-> polar, spherical and
+ * cylindrical. A missing z is zero, w of the destination is set to zero. Azimuths are in
+ * [0, 2π) as the coordinate types keep them.
+ *
+ * The conversion is branchless and processes blocks of coordinates, large buffers are split
+ * between threads.
+ *
+ * @param src Source coordinates
+ * @param dst Destination buffer, must have at least the same number of coordinates as the source
+ * @param accuracy Accuracy of the trigonometric functions
+ * @param opts Threading options
+ */
+template <typename T, std::size_t SrcSize, typename SrcComponents, component_order SrcOrder,
+          typename U, std::size_t DstSize, typename DstComponents, component_order DstOrder>
+void
+convert_coordinates(memory_vector_view<T*, SrcSize, SrcComponents, SrcOrder> src,
+                    memory_vector_view<U*, DstSize, DstComponents, DstOrder>  dst,
+                    trig_accuracy           accuracy = trig_accuracy::precise,
+                    parallel_options const& opts     = {})
+{
+    static_assert((SrcOrder == component_order::forward && DstOrder == component_order::forward),
+                  "Batch coordinate conversion requires forward component order");
+    static_assert(!std::is_const<U>::value, "Destination buffer must be mutable");
+    static_assert(std::is_floating_point<std::remove_const_t<T>>::value
+                      && std::is_floating_point<U>::value,
+                  "Batch coordinate conversion requires floating point values");
+    static_assert(detail::batch_coordinate_conversion<SrcComponents, DstComponents>::supported,
+                  "Unsupported batch coordinate conversion");
+
+    if (dst.size() < src.size())
+        throw std::runtime_error{"Destination buffer is too small"};
+
+    T const* src_data = src.data();
+    U*       dst_data = dst.data();
+    detail::parallel_for(src.size(), opts, [&](std::size_t first, std::size_t last) {
+        detail::convert_coordinate_range<SrcComponents, DstComponents, SrcSize, DstSize>(
+            src_data + first * SrcSize, dst_data + first * DstSize, last - first, accuracy);
+    });
+}
+
+/**
+ * Convert an array of coordinates to another coordinate system, the same as converting
+ * memory_vector_views over them
+ */
+template <typename T, std::size_t SrcSize, typename SrcComponents, typename U,
+          std::size_t DstSize, typename DstComponents>
+void
+convert_coordinates(vector<T, SrcSize, SrcComponents> const* src, std::size_t count,
+                    vector<U, DstSize, DstComponents>* dst,
+                    trig_accuracy                      accuracy = trig_accuracy::precise,
+                    parallel_options const&            opts     = {})
+{
+    static_assert(sizeof(vector<T, SrcSize, SrcComponents>) == sizeof(T) * SrcSize
+                      && sizeof(vector<U, DstSize, DstComponents>) == sizeof(U) * DstSize,
+                  "Vector type is not tightly packed");
+    if (count == 0)
+        return;
+    convert_coordinates(
+        memory_vector_view<T const*, SrcSize, SrcComponents>{src->data(), count * SrcSize},
+        memory_vector_view<U*, DstSize, DstComponents>{dst->data(), count * DstSize}, accuracy,
+        opts);
+}
+
+}    // namespace psst::math
+
+#endif /* PSST_MATH_COORDINATE_BATCH_HPP_ */
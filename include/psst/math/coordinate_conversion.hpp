@@ -9,6 +9,7 @@
 #ifndef PSST_MATH_COORDINATE_CONVERSION_HPP_
 #define PSST_MATH_COORDINATE_CONVERSION_HPP_
 
+#include <psst/math/constexpr_math.hpp>
 #include <psst/math/cylindrical_coord.hpp>
 #include <psst/math/detail/conversion.hpp>
 #include <psst/math/polar_coord.hpp>
@@ -31,10 +32,8 @@ struct conversion<vector<T, 2, components::polar>, vector<U, Cartesian, componen
     constexpr auto
     result() const
     {
-        using std::cos;
-        using std::sin;
-        return vector<U, Cartesian, components::xyzw>{this->arg_.rho() * cos(this->arg_.phi()),
-                                                      this->arg_.rho() * sin(this->arg_.phi())};
+        return vector<U, Cartesian, components::xyzw>{this->arg_.rho() * cx::cos(this->arg_.phi()),
+                                                      this->arg_.rho() * cx::sin(this->arg_.phi())};
     }
 };
 //@}
@@ -50,10 +49,8 @@ struct conversion<vector<U, Cartesian, components::xyzw>, vector<T, 2, component
     constexpr auto
     result() const
     {
-        using std::atan2;
-        using std::sqrt;
-        auto mgt = sqrt(sum_of_squares(this->arg_.x(), this->arg_.y()));
-        return vector<T, 2, components::polar>{mgt, atan2(this->arg_.y(), this->arg_.x())};
+        auto mgt = cx::sqrt(sum_of_squares(this->arg_.x(), this->arg_.y()));
+        return vector<T, 2, components::polar>{mgt, cx::atan2(this->arg_.y(), this->arg_.x())};
     }
 };
 //@}
@@ -69,12 +66,10 @@ struct conversion<vector<T, 3, components::spherical>, vector<U, Cartesian, comp
     constexpr auto
     result() const
     {
-        using std::cos;
-        using std::sin;
-        auto projection_len = this->arg_.rho() * cos(this->arg_.phi());
-        return vector<U, Cartesian, components::xyzw>{projection_len * cos(this->arg_.theta()),
-                                                      projection_len * sin(this->arg_.theta()),
-                                                      this->arg_.rho() * sin(this->arg_.phi())};
+        auto projection_len = this->arg_.rho() * cx::cos(this->arg_.phi());
+        return vector<U, Cartesian, components::xyzw>{projection_len * cx::cos(this->arg_.theta()),
+                                                      projection_len * cx::sin(this->arg_.theta()),
+                                                      this->arg_.rho() * cx::sin(this->arg_.phi())};
     }
 };
 //@}
@@ -90,16 +85,13 @@ struct conversion<vector<U, Cartesian, components::xyzw>, vector<T, 3, component
     constexpr auto
     result() const
     {
-        using std::asin;
-        using std::atan2;
-        using std::sqrt;
-        auto mgt = sqrt(sum_of_squares(this->arg_.x(), this->arg_.y(), this->arg_.z()));
+        auto mgt = cx::sqrt(sum_of_squares(this->arg_.x(), this->arg_.y(), this->arg_.z()));
         T    inclination{0};
         if (this->arg_.z() != 0) {
-            inclination = asin(this->arg_.z() / mgt);
+            inclination = cx::asin(this->arg_.z() / mgt);
         }
         return vector<T, 3, components::spherical>{mgt, inclination,
-                                                   atan2(this->arg_.y(), this->arg_.x())};
+                                                   cx::atan2(this->arg_.y(), this->arg_.x())};
     }
 };
 //@}
@@ -115,8 +107,7 @@ struct conversion<vector<T, 3, components::spherical>, vector<U, 2, components::
     constexpr auto
     result() const
     {
-        using std::cos;
-        return vector<U, 2, components::polar>{this->arg_.rho() * cos(this->arg_.phi()),
+        return vector<U, 2, components::polar>{this->arg_.rho() * cx::cos(this->arg_.phi()),
                                                this->arg_.azimuth()};
     }
 };
@@ -150,11 +141,9 @@ struct conversion<vector<T, 3, components::cylindrical>, vector<U, Cartesian, co
     constexpr auto
     result() const
     {
-        using std::cos;
-        using std::sin;
 
-        return vector<U, Cartesian, components::xyzw>{this->arg_.rho() * cos(this->arg_.phi()),
-                                                      this->arg_.rho() * sin(this->arg_.phi()),
+        return vector<U, Cartesian, components::xyzw>{this->arg_.rho() * cx::cos(this->arg_.phi()),
+                                                      this->arg_.rho() * cx::sin(this->arg_.phi()),
                                                       this->arg_.z()};
     }
 };
@@ -171,11 +160,9 @@ struct conversion<vector<U, Cartesian, components::xyzw>, vector<T, 3, component
     constexpr auto
     result() const
     {
-        using std::atan2;
-        using std::sqrt;
         return vector<T, 3, components::cylindrical>{
-            sqrt(sum_of_squares(this->arg_.x(), this->arg_.y())),
-            atan2(this->arg_.y(), this->arg_.x()), this->arg_.z()};
+            cx::sqrt(sum_of_squares(this->arg_.x(), this->arg_.y())),
+            cx::atan2(this->arg_.y(), this->arg_.x()), this->arg_.z()};
     }
 };
 //@}
@@ -223,12 +210,10 @@ struct conversion<vector<U, 3, components::cylindrical>, vector<T, 3, components
     constexpr auto
     result() const
     {
-        using std::asin;
-        using std::atan2;
         T mgt = magnitude(this->arg_);
         T inclination{0};
         if (mgt != 0) {
-            inclination = asin(this->arg_.z() / mgt);
+            inclination = cx::asin(this->arg_.z() / mgt);
         }
         return vector<T, 3, components::spherical>{mgt, inclination, this->arg_.azimuth()};
     }
@@ -246,11 +231,9 @@ struct conversion<vector<T, 3, components::spherical>, vector<U, 3, components::
     constexpr auto
     result() const
     {
-        using std::cos;
-        using std::sin;
-        return vector<U, 3, components::cylindrical>{this->arg_.rho() * cos(this->arg_.phi()),
+        return vector<U, 3, components::cylindrical>{this->arg_.rho() * cx::cos(this->arg_.phi()),
                                                      this->arg_.azimuth(),
-                                                     this->arg_.rho() * sin(this->arg_.phi())};
+                                                     this->arg_.rho() * cx::sin(this->arg_.phi())};
     }
 };
 //@}
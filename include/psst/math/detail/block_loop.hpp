@@ -0,0 +1,89 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * block_loop.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_DETAIL_BLOCK_LOOP_HPP_
+#define PSST_MATH_DETAIL_BLOCK_LOOP_HPP_
+
+#include <cstddef>
+
+/**
+ * Block loops of the batch functions. A buffer is processed in blocks of a constant number of
+ * values: the values of a block are copied to local arrays, deinterleaved when they are the
+ * components of vectors, a branchless kernel runs over the arrays and the results are copied
+ * back. The loops over the arrays have constant trip counts and the arrays alias neither the
+ * buffers nor each other, so the compiler vectorises the kernels without runtime overlap checks.
+ * The last block is padded and only the values within the buffer are stored.
+ */
+namespace psst {
+namespace math {
+namespace detail {
+
+/** Call block(first, n) for the blocks of count values, n is BlockSize but for the last block */
+template <std::size_t BlockSize, typename Function>
+void
+for_each_block(std::size_t count, Function&& block)
+{
+    for (std::size_t first = 0; first < count; first += BlockSize) {
+        block(first, count - first < BlockSize ? count - first : BlockSize);
+    }
+}
+
+/** Copy n values of a buffer to a block, filling the rest with the padding value */
+template <typename T, typename U, std::size_t BlockSize>
+void
+load_block_values(T const* src, std::size_t n, U (&block)[BlockSize], U pad = U{})
+{
+    if (n == BlockSize) {
+        for (std::size_t i = 0; i < BlockSize; ++i) {
+            block[i] = static_cast<U>(src[i]);
+        }
+    } else {
+        for (std::size_t i = 0; i < BlockSize; ++i) {
+            block[i] = i < n ? static_cast<U>(src[i]) : pad;
+        }
+    }
+}
+
+/** Copy the first n values of a block to a buffer */
+template <typename T, typename U, std::size_t BlockSize>
+void
+store_block_values(T const (&block)[BlockSize], std::size_t n, U* dst)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<U>(block[i]);
+    }
+}
+
+/**
+ * dst[i] = f(src[i]) by whole blocks, the values after the last whole block one at a time. src
+ * and dst can be the same buffer.
+ */
+template <std::size_t BlockSize, typename T, typename U, typename Function>
+void
+transform_blocks(T const* src, std::size_t count, U* dst, Function&& f)
+{
+    std::size_t const whole = count - count % BlockSize;
+    for_each_block<BlockSize>(whole, [&](std::size_t first, std::size_t) {
+        T in[BlockSize];
+        U out[BlockSize];
+        load_block_values(src + first, BlockSize, in);
+        for (std::size_t i = 0; i < BlockSize; ++i) {
+            out[i] = f(in[i]);
+        }
+        store_block_values(out, BlockSize, dst + first);
+    });
+    for (std::size_t i = whole; i < count; ++i) {
+        dst[i] = f(src[i]);
+    }
+}
+
+}    // namespace detail
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_DETAIL_BLOCK_LOOP_HPP_ */
@@ -0,0 +1,230 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * charconv.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_DETAIL_CHARCONV_HPP_
+#define PSST_MATH_DETAIL_CHARCONV_HPP_
+
+#if __has_include(<charconv>)
+#    include <charconv>
+#    define PSST_MATH_HAS_INTEGRAL_CHARCONV 1
+#endif
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace psst {
+namespace math {
+namespace io {
+namespace detail {
+
+constexpr bool
+is_space(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+inline char const*
+skip_space(char const* first, char const* last)
+{
+    while (first != last && is_space(*first))
+        ++first;
+    return first;
+}
+
+/**
+ * Characters that can be a part of a textual representation of a number,
+ * including "inf" and "nan"
+ */
+constexpr bool
+is_number_char(char c)
+{
+    return (c >= '0' && c <= '9') || c == '.' || c == '+' || c == '-' || c == 'e' || c == 'E'
+           || c == 'x' || c == 'X' || c == 'i' || c == 'I' || c == 'n' || c == 'N' || c == 'f'
+           || c == 'F' || c == 'a' || c == 'A' || c == 't' || c == 'T' || c == 'y' || c == 'Y';
+}
+
+struct chars_result {
+    char const* ptr;
+    std::errc   ec;
+};
+
+/**
+ * Fallback for standard libraries not implementing std::from_chars for the type.
+ * Copies the token to a zero-terminated buffer, so that the strto* functions never read past the
+ * end of the input.
+ */
+template <typename T>
+chars_result
+strto_chars(char const* first, char const* last, T& value)
+{
+    constexpr std::size_t max_token = 64;
+
+    char        buffer[max_token + 1];
+    std::size_t n = 0;
+    for (auto p = first; p != last && n < max_token && is_number_char(*p); ++p, ++n)
+        buffer[n] = *p;
+    buffer[n] = '\0';
+
+    char* end = nullptr;
+    errno     = 0;
+    if constexpr (std::is_floating_point<T>{}) {
+        if constexpr (std::is_same<T, float>{}) {
+            value = std::strtof(buffer, &end);
+        } else if constexpr (std::is_same<T, double>{}) {
+            value = std::strtod(buffer, &end);
+        } else {
+            value = std::strtold(buffer, &end);
+        }
+        if (end == buffer)
+            return {first, std::errc::invalid_argument};
+        if (errno == ERANGE)
+            return {first + (end - buffer), std::errc::result_out_of_range};
+    } else if constexpr (std::is_signed<T>{}) {
+        auto v = std::strtoll(buffer, &end, 10);
+        if (end == buffer)
+            return {first, std::errc::invalid_argument};
+        if (errno == ERANGE || v < std::numeric_limits<T>::min()
+            || v > std::numeric_limits<T>::max())
+            return {first + (end - buffer), std::errc::result_out_of_range};
+        value = static_cast<T>(v);
+    } else {
+        if (buffer[0] == '-')
+            return {first, std::errc::invalid_argument};
+        auto v = std::strtoull(buffer, &end, 10);
+        if (end == buffer)
+            return {first, std::errc::invalid_argument};
+        if (errno == ERANGE || v > std::numeric_limits<T>::max())
+            return {first + (end - buffer), std::errc::result_out_of_range};
+        value = static_cast<T>(v);
+    }
+    return {first + (end - buffer), std::errc{}};
+}
+
+/**
+ * Parse a single arithmetic value from a character buffer. Uses std::from_chars when the standard
+ * library provides it for the type and falls back to strto* functions otherwise.
+ * Unlike std::from_chars a leading plus sign is accepted before a digit or a decimal point, as
+ * operator>> does.
+ */
+template <typename T>
+chars_result
+from_chars(char const* first, char const* last, T& value)
+{
+    static_assert((std::is_arithmetic<T>{}), "Only arithmetic types can be parsed");
+    auto start = first;
+    // Only a sign followed by a number, "+-5" must not be parsed as -5
+    if (last - first > 1 && *first == '+'
+        && ((first[1] >= '0' && first[1] <= '9') || first[1] == '.'))
+        ++first;
+    chars_result res;
+    if constexpr (std::is_floating_point<T>{}) {
+#if __cpp_lib_to_chars >= 201611
+        auto r = std::from_chars(first, last, value);
+        res    = {r.ptr, r.ec};
+#else
+        res = strto_chars(first, last, value);
+#endif
+    } else {
+#ifdef PSST_MATH_HAS_INTEGRAL_CHARCONV
+        auto r = std::from_chars(first, last, value);
+        res    = {r.ptr, r.ec};
+#else
+        res = strto_chars(first, last, value);
+#endif
+    }
+    if (res.ec == std::errc::invalid_argument)
+        res.ptr = start;
+    return res;
+}
+
+struct to_chars_result {
+    char*     ptr;
+    std::errc ec;
+};
+
+/**
+ * Upper bound of characters needed for a textual representation of a value
+ */
+template <typename T>
+constexpr std::size_t max_value_chars
+    = std::is_floating_point<T>{}
+          // sign, point, digits, exponent
+          ? 3 + std::numeric_limits<T>::max_digits10 + 7
+          // sign and digits
+          : 2 + std::numeric_limits<T>::digits10;
+
+/**
+ * Fallback for standard libraries not implementing std::to_chars for the type.
+ * Floating point values are printed with enough digits for a round-trip, when the precision is
+ * not specified.
+ */
+template <typename T>
+to_chars_result
+snprintf_chars(char* first, char* last, T value, int precision = -1)
+{
+    char buffer[max_value_chars<T> + 1];
+    int  n = 0;
+    if constexpr (std::is_floating_point<T>{}) {
+        if (precision < 0)
+            precision = std::numeric_limits<T>::max_digits10;
+        if constexpr (std::is_same<T, long double>{}) {
+            n = std::snprintf(buffer, sizeof(buffer), "%.*Lg", precision, value);
+        } else {
+            n = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, (double)value);
+        }
+    } else if constexpr (std::is_signed<T>{}) {
+        n = std::snprintf(buffer, sizeof(buffer), "%lld", (long long)value);
+    } else {
+        n = std::snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)value);
+    }
+    if (n < 0 || n >= static_cast<int>(sizeof(buffer)) || n > last - first)
+        return {last, std::errc::value_too_large};
+    return {std::copy(buffer, buffer + n, first), std::errc{}};
+}
+
+/**
+ * Format an arithmetic value to a character buffer. Floating point values are formatted in the
+ * shortest representation that round-trips, unless a precision is specified.
+ */
+template <typename T>
+to_chars_result
+to_chars(char* first, char* last, T value, int precision = -1)
+{
+    static_assert((std::is_arithmetic<T>{}), "Only arithmetic types can be formatted");
+    if constexpr (std::is_floating_point<T>{}) {
+#if __cpp_lib_to_chars >= 201611
+        auto r = precision < 0
+                     ? std::to_chars(first, last, value)
+                     : std::to_chars(first, last, value, std::chars_format::general, precision);
+        return {r.ptr, r.ec};
+#else
+        return snprintf_chars(first, last, value, precision);
+#endif
+    } else {
+#ifdef PSST_MATH_HAS_INTEGRAL_CHARCONV
+        auto r = std::to_chars(first, last, value);
+        return {r.ptr, r.ec};
+#else
+        return snprintf_chars(first, last, value);
+#endif
+    }
+}
+
+}    // namespace detail
+}    // namespace io
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_DETAIL_CHARCONV_HPP_ */
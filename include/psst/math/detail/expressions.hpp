@@ -3,6 +3,7 @@
 
 #include <psst/math/detail/utils.hpp>
 #include <psst/math/detail/value_traits.hpp>
+#include <psst/math/math_policy.hpp>
 #include <psst/math/vector_fwd.hpp>
 
 #include <cmath>
@@ -67,6 +68,7 @@ struct unary_expression {
     using by_value         = arg_by_value_t<Expression>;
     using arg_storage_type = expression_argument_storage_t<Expression>;
     using arg_ref = std::add_lvalue_reference_t<std::add_const_t<std::decay_t<Expression>>>;
+    using math_policy = traits::math_policy_t<Expression>;
 
     explicit constexpr unary_expression(arg_type arg) : arg_{std::forward<arg_type>(arg)} {}
 
@@ -129,6 +131,7 @@ struct binary_expression {
     using rhs_by_value     = arg_by_value_t<RHS>;
     using lhs_ref          = std::add_lvalue_reference_t<std::add_const_t<std::decay_t<LHS>>>;
     using rhs_ref          = std::add_lvalue_reference_t<std::add_const_t<std::decay_t<RHS>>>;
+    using math_policy      = traits::common_math_policy_t<LHS, RHS>;
 
     constexpr binary_expression(lhs_type lhs, rhs_type rhs)
         : lhs_{std::forward<lhs_type>(lhs)}, rhs_{std::forward<rhs_type>(rhs)}
@@ -186,6 +189,7 @@ struct n_ary_expression {
     using args_storage_type = std::tuple<expression_argument_storage_t<T>...>;
     using by_value          = std::integer_sequence<bool, arg_by_value_v<T>...>;
     using arg_indexes_type  = std::index_sequence_for<T...>;
+    using math_policy       = traits::common_math_policy_t<T...>;
 
     constexpr n_ary_expression(expression_argument_t<T>... args)
         : args_{std::forward<expression_argument_t<T>>(args)...}
@@ -10,6 +10,8 @@
 
 #include <psst/math/detail/vector_expressions.hpp>
 
+#include <algorithm>
+
 // Undefine minor macro that comes with some libc libraries
 #ifdef minor
 #    undef minor
@@ -41,10 +43,61 @@ struct matrix_expression {
     static constexpr auto rows = traits::rows;
     static constexpr auto cols = traits::cols;
     static constexpr auto size = traits::size;
+
+    /**
+     * Elements below the lower and above the upper bandwidth are zero. The expressions of
+     * structured matrices, and of the operations on them, narrow the band of a dense matrix.
+     */
+    static constexpr std::size_t lower_bandwidth = rows > 0 ? rows - 1 : 0;
+    static constexpr std::size_t upper_bandwidth = cols > 0 ? cols - 1 : 0;
 };
 
 namespace detail {
 
+/** The element R, C of the expression is inside its band, it is not known to be zero */
+template <typename Expr>
+constexpr bool
+in_band(std::size_t r, std::size_t c)
+{
+    using expression_type = std::decay_t<Expr>;
+    return c <= r + expression_type::upper_bandwidth && r <= c + expression_type::lower_bandwidth;
+}
+
+/** The element R, C of the expression, zero outside of its band */
+template <typename T, std::size_t R, std::size_t C, typename Expr>
+constexpr T
+band_element(Expr const& expr)
+{
+    if constexpr (in_band<Expr>(R, C)) {
+        return expr.template element<R, C>();
+    } else {
+        return T{};
+    }
+}
+
+/**
+ * Terms of the sum of products of the row R of the left and the column C of the right matrix,
+ * see sum_of_products in math_policy.hpp
+ */
+template <typename T, typename LHS, typename RHS, std::size_t R, std::size_t C>
+struct matrix_product_terms {
+    LHS const& lhs_expr;
+    RHS const& rhs_expr;
+
+    template <std::size_t K>
+    constexpr T
+    lhs() const
+    {
+        return T(lhs_expr.template element<R, K>());
+    }
+    template <std::size_t K>
+    constexpr T
+    rhs() const
+    {
+        return T(rhs_expr.template element<K, C>());
+    }
+};
+
 template <typename T>
 constexpr std::size_t
 matrix_row_count()
@@ -595,6 +648,9 @@ struct matrix_transpose
     using expression_base = unary_expression<Expr>;
     using expression_base::expression_base;
 
+    static constexpr std::size_t lower_bandwidth = std::decay_t<Expr>::upper_bandwidth;
+    static constexpr std::size_t upper_bandwidth = std::decay_t<Expr>::lower_bandwidth;
+
     template <std::size_t R, std::size_t C>
     constexpr value_type
     element() const
@@ -613,6 +669,39 @@ transpose(Expr&& expr)
 }
 //@}
 
+//@{
+/** @name Matrix expression with a math policy, see math_policy.hpp */
+template <typename Expr, typename MathPolicy>
+struct matrix_with_policy
+    : matrix_expression<matrix_with_policy<Expr, MathPolicy>,
+                        typename std::decay_t<Expr>::result_type>,
+      unary_expression<Expr> {
+    using base_type       = matrix_expression<matrix_with_policy<Expr, MathPolicy>,
+                                        typename std::decay_t<Expr>::result_type>;
+    using value_type      = typename base_type::value_type;
+    using expression_base = unary_expression<Expr>;
+    using math_policy     = MathPolicy;
+    using expression_base::expression_base;
+
+    static constexpr std::size_t lower_bandwidth = std::decay_t<Expr>::lower_bandwidth;
+    static constexpr std::size_t upper_bandwidth = std::decay_t<Expr>::upper_bandwidth;
+
+    template <std::size_t R, std::size_t C>
+    constexpr value_type
+    element() const
+    {
+        return this->arg_.template element<R, C>();
+    }
+};
+
+template <typename MathPolicy, typename Expr, typename = traits::enable_if_matrix_expression<Expr>>
+constexpr auto
+with_policy(Expr&& expr)
+{
+    return make_unary_expression<matrix_with_policy, MathPolicy>(std::forward<Expr>(expr));
+}
+//@}
+
 //@{
 /** @name Flip matrix around the secondary diagonal */
 template <typename Expr>
@@ -822,13 +911,24 @@ struct matrix_sum : matrix_expression<matrix_sum<LHS, RHS>, matrix_sum_result_t<
     using expression_base = binary_expression<LHS, RHS>;
     using expression_base::expression_base;
 
+    static constexpr std::size_t lower_bandwidth
+        = std::max(std::decay_t<LHS>::lower_bandwidth, std::decay_t<RHS>::lower_bandwidth);
+    static constexpr std::size_t upper_bandwidth
+        = std::max(std::decay_t<LHS>::upper_bandwidth, std::decay_t<RHS>::upper_bandwidth);
+
     template <std::size_t R, std::size_t C>
     constexpr value_type
     element() const
     {
         static_assert(R < base_type::rows, "Invalid matrix expression row index");
         static_assert(C < base_type::cols, "Invalid matrix expression col index");
-        return this->lhs_.template element<R, C>() + this->rhs_.template element<R, C>();
+        if constexpr (!detail::in_band<RHS>(R, C)) {
+            return detail::band_element<value_type, R, C>(this->lhs_);
+        } else if constexpr (!detail::in_band<LHS>(R, C)) {
+            return this->rhs_.template element<R, C>();
+        } else {
+            return this->lhs_.template element<R, C>() + this->rhs_.template element<R, C>();
+        }
     }
 };
 
@@ -852,13 +952,24 @@ struct matrix_diff : matrix_expression<matrix_diff<LHS, RHS>, matrix_sum_result_
     using expression_base = binary_expression<LHS, RHS>;
     using expression_base::expression_base;
 
+    static constexpr std::size_t lower_bandwidth
+        = std::max(std::decay_t<LHS>::lower_bandwidth, std::decay_t<RHS>::lower_bandwidth);
+    static constexpr std::size_t upper_bandwidth
+        = std::max(std::decay_t<LHS>::upper_bandwidth, std::decay_t<RHS>::upper_bandwidth);
+
     template <std::size_t R, std::size_t C>
     constexpr value_type
     element() const
     {
         static_assert(R < base_type::rows, "Invalid matrix expression row index");
         static_assert(C < base_type::cols, "Invalid matrix expression col index");
-        return this->lhs_.template element<R, C>() - this->rhs_.template element<R, C>();
+        if constexpr (!detail::in_band<RHS>(R, C)) {
+            return detail::band_element<value_type, R, C>(this->lhs_);
+        } else if constexpr (!detail::in_band<LHS>(R, C)) {
+            return -this->rhs_.template element<R, C>();
+        } else {
+            return this->lhs_.template element<R, C>() - this->rhs_.template element<R, C>();
+        }
     }
 };
 
@@ -899,6 +1010,9 @@ struct matrix_scalar_multiply
     using expression_base = binary_expression<LHS, RHS>;
     using expression_base::expression_base;
 
+    static constexpr std::size_t lower_bandwidth = std::decay_t<LHS>::lower_bandwidth;
+    static constexpr std::size_t upper_bandwidth = std::decay_t<LHS>::upper_bandwidth;
+
     template <std::size_t R, std::size_t C>
     constexpr value_type
     element() const
@@ -924,13 +1038,17 @@ struct matrix_scalar_divide
     using expression_base = binary_expression<LHS, RHS>;
     using expression_base::expression_base;
 
+    static constexpr std::size_t lower_bandwidth = std::decay_t<LHS>::lower_bandwidth;
+    static constexpr std::size_t upper_bandwidth = std::decay_t<LHS>::upper_bandwidth;
+
     template <std::size_t R, std::size_t C>
     constexpr value_type
     element() const
     {
         static_assert(R < base_type::rows, "Invalid matrix expression row index");
         static_assert(C < base_type::cols, "Invalid matrix expression col index");
-        return this->lhs_.template element<R, C>() / this->rhs_;
+        using math_policy = typename expression_base::math_policy;
+        return math_policy::divide(this->lhs_.template element<R, C>(), this->rhs_.value());
     }
 };
 
@@ -977,13 +1095,40 @@ struct matrix_matrix_multiply
     using expression_base = binary_expression<LHS, RHS>;
     using expression_base::expression_base;
 
+    using lhs_type = std::decay_t<LHS>;
+    using rhs_type = std::decay_t<RHS>;
+
+    static constexpr std::size_t lower_bandwidth
+        = std::min(lhs_type::lower_bandwidth + rhs_type::lower_bandwidth, base_type::rows - 1);
+    static constexpr std::size_t upper_bandwidth
+        = std::min(lhs_type::upper_bandwidth + rhs_type::upper_bandwidth, base_type::cols - 1);
+
+    /**
+     * The sum runs over the indexes K where both the element R, K of the left and the element
+     * K, C of the right side are inside their bands, the zeros of structured matrices are
+     * neither read nor multiplied.
+     */
     template <std::size_t R, std::size_t C>
     constexpr value_type
     element() const
     {
         static_assert(R < base_type::rows, "Invalid matrix expression row index");
         static_assert(C < base_type::cols, "Invalid matrix expression col index");
-        return dot_product(row<R>(this->lhs_), col<C>(this->rhs_));
+        constexpr std::size_t first
+            = std::max({R > lhs_type::lower_bandwidth ? R - lhs_type::lower_bandwidth : 0,
+                        C > rhs_type::upper_bandwidth ? C - rhs_type::upper_bandwidth : 0});
+        constexpr std::size_t last = std::min(
+            {R + lhs_type::upper_bandwidth, C + rhs_type::lower_bandwidth, lhs_type::cols - 1});
+        if constexpr (first > last) {
+            return value_type{};
+        } else {
+            using math_policy = typename expression_base::math_policy;
+            using accumulator = traits::accumulator_t<LHS, RHS>;
+            using terms_type  = detail::matrix_product_terms<accumulator, lhs_type, rhs_type, R, C>;
+            return static_cast<value_type>(math_policy::template sum_of_products<accumulator>(
+                terms_type{this->lhs_, this->rhs_},
+                utils::make_offset_index_sequence<first, last - first + 1>{}));
+        }
     }
 };
 
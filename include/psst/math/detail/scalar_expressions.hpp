@@ -11,6 +11,7 @@
 #include <psst/math/detail/expressions.hpp>
 
 #include <cmath>
+#include <optional>
 
 namespace psst {
 namespace math {
@@ -378,7 +379,8 @@ struct scalar_div : binary_scalar_expression<scalar_div, LHS, RHS>, binary_expre
     constexpr value_type
     value() const
     {
-        return this->lhs_.value() / this->rhs_.value();
+        using math_policy = typename expression_base::math_policy;
+        return math_policy::divide(this->lhs_.value(), this->rhs_.value());
     }
 };
 
@@ -438,19 +440,18 @@ struct square_root : unary_scalar_expression<square_root, Expression>,
     value() const
     {
         using std::sqrt;
-        if (value_cache_ == nval) {
+        if (!value_cache_) {
             value_cache_ = sqrt(this->arg_.value());
         }
-        return value_cache_;
+        return *value_cache_;
     }
 
 private:
-    // TODO Optional
-    static constexpr value_type nval         = std::numeric_limits<value_type>::min();
-    mutable value_type          value_cache_ = nval;
+    mutable std::optional<value_type> value_cache_;
 };
 
-template <typename Expression, typename = traits::enable_if_scalar_value<Expression>>
+template <typename Expression, typename = traits::enable_if_scalar_value<Expression>,
+          typename = std::enable_if_t<!traits::is_simd_pack_v<Expression>>>
 constexpr auto
 sqrt(Expression&& ex)
 {
@@ -458,6 +459,43 @@ sqrt(Expression&& ex)
 }
 //@}
 
+//----------------------------------------------------------------------------
+//@{
+/** @name Reciprocal square root expression, computed by the math policy of the argument */
+template <typename Expression>
+struct inverse_square_root : unary_scalar_expression<inverse_square_root, Expression>,
+                             unary_expression<Expression> {
+    static_assert(traits::is_scalar_v<Expression>,
+                  "Can apply inverse_square_root only to scalar expressions");
+    using base_type       = unary_scalar_expression<inverse_square_root, Expression>;
+    using value_type      = typename base_type::value_type;
+    using expression_base = unary_expression<Expression>;
+    using math_policy     = typename expression_base::math_policy;
+
+    using expression_base::expression_base;
+
+    constexpr value_type
+    value() const
+    {
+        if (!value_cache_) {
+            value_cache_ = math_policy::rsqrt(value_type{this->arg_.value()});
+        }
+        return *value_cache_;
+    }
+
+private:
+    mutable std::optional<value_type> value_cache_;
+};
+
+template <typename Expression, typename = traits::enable_if_scalar_value<Expression>,
+          typename = std::enable_if_t<!traits::is_simd_pack_v<Expression>>>
+constexpr auto
+rsqrt(Expression&& ex)
+{
+    return detail::wrap_non_expression_args<inverse_square_root>(std::forward<Expression>(ex));
+}
+//@}
+
 //----------------------------------------------------------------------------
 //@{
 template <typename Expression>
@@ -476,7 +514,8 @@ struct scalar_abs : unary_scalar_expression<scalar_abs, Expression>, unary_expre
         return abs(this->arg_.value());
     }
 };
-template <typename Expression, typename = traits::enable_if_scalar_value<Expression>>
+template <typename Expression, typename = traits::enable_if_scalar_value<Expression>,
+          typename = std::enable_if_t<!traits::is_simd_pack_v<Expression>>>
 constexpr auto
 abs(Expression&& ex)
 {
@@ -484,9 +523,41 @@ abs(Expression&& ex)
 }
 //@}
 
+//----------------------------------------------------------------------------
+//@{
+/** @name Scalar expression with a math policy, see math_policy.hpp */
+template <typename Expression, typename MathPolicy>
+struct scalar_with_policy
+    : scalar_expression<scalar_with_policy<Expression, MathPolicy>,
+                        traits::scalar_expression_result_t<Expression>>,
+      unary_expression<Expression> {
+    using base_type       = scalar_expression<scalar_with_policy<Expression, MathPolicy>,
+                                        traits::scalar_expression_result_t<Expression>>;
+    using value_type      = typename base_type::value_type;
+    using expression_base = unary_expression<Expression>;
+    using math_policy     = MathPolicy;
+
+    using expression_base::expression_base;
+
+    constexpr value_type
+    value() const
+    {
+        return this->arg_.value();
+    }
+};
+
+template <typename MathPolicy, typename Expression,
+          typename = traits::enable_if_scalar_expression<Expression>>
+constexpr auto
+with_policy(Expression&& ex)
+{
+    return make_unary_expression<scalar_with_policy, MathPolicy>(std::forward<Expression>(ex));
+}
+//@}
+
 // TODO Make it an expression
 template <typename... T>
-auto
+constexpr auto
 sum_of_squares(T&&... v)
 {
     return ((v * v) + ...);
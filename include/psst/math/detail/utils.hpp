@@ -79,6 +79,17 @@ constexpr std::size_t min_v = min<V...>::value;
 template <std::size_t... V>
 using make_min_index_sequence = std::make_index_sequence<min_v<V...>>;
 
+template <std::size_t Offset, std::size_t... Indexes>
+constexpr std::index_sequence<(Offset + Indexes)...>
+offset_index_sequence(std::index_sequence<Indexes...>)
+{
+    return {};
+}
+/** Index sequence Offset, Offset + 1, ..., Offset + Count - 1 */
+template <std::size_t Offset, std::size_t Count>
+using make_offset_index_sequence
+    = decltype(offset_index_sequence<Offset>(std::make_index_sequence<Count>{}));
+
 using npos                   = size_constant<std::numeric_limits<std::size_t>::max()>;
 constexpr std::size_t npos_v = npos::value;
 
@@ -45,8 +45,8 @@ struct value_tag : detail::value_tag_impl<T> {};
 template <typename T>
 using value_tag_t = typename value_tag<T>::type;
 
-template <typename T, std::size_t Size, typename Components>
-struct value_tag<vector<T, Size, Components>> {
+template <typename T, std::size_t Size, typename Components, typename MathPolicy>
+struct value_tag<vector<T, Size, Components, MathPolicy>> {
     using type = tag::vector;
 };
 template <typename T, std::size_t RC, std::size_t CC, typename Components>
@@ -54,6 +54,19 @@ struct value_tag<matrix<T, RC, CC, Components>> {
     using type = tag::matrix;
 };
 
+//@{
+/**
+ * @name Type the arithmetic on values of a type is done in, the type itself unless specialised,
+ * e.g. float for the half precision storage types
+ */
+template <typename T>
+struct arithmetic_type {
+    using type = T;
+};
+template <typename T>
+using arithmetic_type_t = typename arithmetic_type<std::decay_t<T>>::type;
+//@}
+
 namespace detail {
 
 template <typename T>
@@ -91,7 +104,7 @@ struct iota<long double> {
 template <typename T, bool>
 struct magnitude_traits_impl {
     using value_type     = typename std::decay<T>::type;
-    using magnitude_type = value_type;
+    using magnitude_type = arithmetic_type_t<value_type>;
 };
 
 /**
@@ -171,9 +184,9 @@ struct scalar_value_traits : detail::compare_traits<std::decay_t<T>> {
 template <typename VectorType>
 struct vector_traits;
 
-template <typename T, std::size_t Size, typename Components>
-struct vector_traits<vector<T, Size, Components>> {
-    using vector_type      = vector<T, Size, Components>;
+template <typename T, std::size_t Size, typename Components, typename MathPolicy>
+struct vector_traits<vector<T, Size, Components, MathPolicy>> {
+    using vector_type      = vector<T, Size, Components, MathPolicy>;
     using component_names  = Components;
     using element_type     = T;
     using type             = vector_type;
@@ -236,6 +249,16 @@ struct matrix_traits<matrix<T, RC, CC, Components>> {
     using col_indexes_type = std::make_index_sequence<cols>;
 };
 
+//@{
+/** @name is_simd_pack trait, a pack holds a scalar per lane and compares lane-wise */
+template <typename T>
+struct is_simd_pack : std::false_type {};
+template <typename T>
+using is_simd_pack_t = typename is_simd_pack<std::decay_t<T>>::type;
+template <typename T>
+constexpr bool is_simd_pack_v = is_simd_pack_t<T>::value;
+//@}
+
 //@{
 template <typename T, typename = utils::void_t<>>
 struct is_scalar : std::false_type {};
@@ -258,8 +281,8 @@ using enable_if_scalar_values = std::enable_if_t<(is_scalar_v<T> && ...)>;
 /** @name is_vector trait */
 template <typename T>
 struct is_vector : std::false_type {};
-template <typename T, std::size_t S, typename Components>
-struct is_vector<vector<T, S, Components>> : std::true_type {};
+template <typename T, std::size_t S, typename Components, typename MathPolicy>
+struct is_vector<vector<T, S, Components, MathPolicy>> : std::true_type {};
 template <typename T, std::size_t S, typename Components>
 struct is_vector<vector_view<T, S, Components>> : std::true_type {};
 template <typename T>
@@ -281,8 +304,8 @@ using is_mutable_vector_t = typename is_mutable_vector<T>::type;
 template <typename T>
 constexpr bool is_mutable_vector_v = is_mutable_vector_t<T>::value;
 
-template <typename T, std::size_t S, typename Components>
-struct is_mutable_vector<vector<T, S, Components>> : std::true_type {};
+template <typename T, std::size_t S, typename Components, typename MathPolicy>
+struct is_mutable_vector<vector<T, S, Components, MathPolicy>> : std::true_type {};
 template <typename T, std::size_t S, typename Components, component_order Order>
 struct is_mutable_vector<vector_view<T*, S, Components, Order>> : std::true_type {};
 template <typename T, std::size_t S, typename Components, component_order Order>
@@ -765,6 +788,25 @@ using enable_if_dot_product_defined = std::enable_if_t<dot_product_defined_v<T,
 //@}
 
 }    // namespace traits
+
+//@{
+/**
+ * @name Reductions of comparison results
+ * Comparing SIMD packs gives a mask with a bool per lane, the masks overload these functions,
+ * so the same code tests both scalars and packs.
+ */
+constexpr bool
+all_lanes(bool v)
+{
+    return v;
+}
+constexpr bool
+any_lane(bool v)
+{
+    return v;
+}
+//@}
+
 }    // namespace math
 }    // namespace psst
 
@@ -447,7 +447,8 @@ struct vector_scalar_divide
     at() const
     {
         static_assert(N < base_type::size, "Vector divide component index is out of range");
-        return this->lhs_.template at<N>() / this->rhs_;
+        using math_policy = typename expression_base::math_policy;
+        return math_policy::divide(this->lhs_.template at<N>(), this->rhs_.value());
     }
 };
 
@@ -466,43 +467,100 @@ operator/(LHS&& lhs, RHS&& rhs)
 
 //----------------------------------------------------------------------------
 //@{
+namespace detail {
+
+//@{
+/**
+ * Terms of the sums computed by the math policies, the products of the components of two vectors
+ * and the components of one vector multiplied by one.
+ */
+template <typename T, typename LHS, typename RHS>
+struct product_terms {
+    LHS const& lhs_expr;
+    RHS const& rhs_expr;
+
+    template <std::size_t N>
+    constexpr T
+    lhs() const
+    {
+        return T(get<N>(lhs_expr));
+    }
+    template <std::size_t N>
+    constexpr T
+    rhs() const
+    {
+        return T(get<N>(rhs_expr));
+    }
+};
+
+template <typename T, typename Expr>
+struct element_terms {
+    Expr const& expr;
+
+    template <std::size_t N>
+    constexpr T
+    lhs() const
+    {
+        return T(get<N>(expr));
+    }
+    template <std::size_t N>
+    constexpr T
+    rhs() const
+    {
+        return T{1};
+    }
+};
+//@}
+
+}    // namespace detail
+
+//@{
+/** @name Sum of the components of a vector */
 template <typename LHS>
-struct vector_element_sum : unary_scalar_expression<vector_element_sum, LHS>,
-                            unary_expression<LHS> {
-    using base_type  = unary_scalar_expression<vector_element_sum, LHS>;
+struct vector_element_sum
+    : unary_scalar_expression<vector_element_sum, LHS, traits::accumulator_t<LHS>>,
+      unary_expression<LHS> {
+    using base_type  = unary_scalar_expression<vector_element_sum, LHS, traits::accumulator_t<LHS>>;
     using value_type = typename base_type::value_type;
 
     using expression_base   = unary_expression<LHS>;
-    using source_index_type = typename expression_base::arg_type::index_sequence_type;
+    using source_index_type = typename std::decay_t<LHS>::index_sequence_type;
 
     using expression_base::expression_base;
 
     constexpr value_type
     value() const
     {
-        return sum(source_index_type{});
+        if (!value_cache_) {
+            using math_policy = typename expression_base::math_policy;
+            using terms_type  = detail::element_terms<value_type, std::decay_t<LHS>>;
+            value_cache_      = math_policy::template sum_of_products<value_type>(
+                terms_type{this->arg_}, source_index_type{});
+        }
+        return *value_cache_;
     }
 
 private:
-    template <std::size_t... Indexes>
-    constexpr value_type
-    sum(std::index_sequence<Indexes...>) const
-    {
-        return s::sum(get<Indexes>(this->arg_)...);
-    }
+    mutable std::optional<value_type> value_cache_;
 };
+
+template <typename Expr, typename = traits::enable_if_vector_expression<Expr>>
+constexpr auto
+element_sum(Expr&& expr)
+{
+    return make_unary_expression<vector_element_sum>(std::forward<Expr>(expr));
+}
 //@}
 
-//----------------------------------------------------------------------------
 //@{
 /** @name Magnitude (squared and not) */
 template <typename Components, typename Vector>
 struct vector_magnitude_squared : scalar_expression<vector_magnitude_squared<Components, Vector>,
-                                                    traits::scalar_expression_result_t<Vector>>,
+                                                    traits::accumulator_t<Vector>>,
                                   unary_expression<Vector> {
     static_assert(traits::is_vector_expression_v<Vector>, "Argument to magnitude must be a vector");
     using base_type  = scalar_expression<vector_magnitude_squared<Components, Vector>,
-                                        traits::scalar_expression_result_t<Vector>>;
+                                        traits::accumulator_t<Vector>>;
     using value_type = typename base_type::value_type;
 
     using expression_base   = unary_expression<Vector>;
@@ -513,23 +571,18 @@ struct vector_magnitude_squared : scalar_expression<vector_magnitude_squared<Com
     constexpr value_type
     value() const
     {
-        if (value_cache_ == nval) {
-            value_cache_ = sum(source_index_type{});
+        if (!value_cache_) {
+            using math_policy = typename expression_base::math_policy;
+            using arg_type    = std::decay_t<Vector>;
+            using terms_type  = detail::product_terms<value_type, arg_type, arg_type>;
+            value_cache_      = math_policy::template sum_of_products<value_type>(
+                terms_type{this->arg_, this->arg_}, source_index_type{});
         }
-        return value_cache_;
+        return *value_cache_;
     }
 
 private:
-    template <std::size_t... Indexes>
-    constexpr value_type
-    sum(std::index_sequence<Indexes...>) const
-    {
-        return s::detail::unchecked_scalar_sum(
-            (get<Indexes>(this->arg_) * get<Indexes>(this->arg_))...);
-    }
-    // TODO Optional
-    static constexpr value_type nval         = std::numeric_limits<value_type>::min();
-    mutable value_type          value_cache_ = nval;
+    mutable std::optional<value_type> value_cache_;
 };
 
 template <typename Expr, typename = traits::enable_if_vector_expression<Expr>>
@@ -589,6 +642,8 @@ normalize(Expr&& expr)
         return make_unary_expression<
             select_unary_impl<component_names, vector_normalize>::template type>(
             std::forward<Expr>(expr));
+    } else if constexpr (traits::math_policy_t<Expr>::multiply_by_reciprocal) {
+        return expr * rsqrt(magnitude_square(expr));
     } else {
         return expr / magnitude(expr);
     }
@@ -622,19 +677,52 @@ apply(Expr&& expr, Predicate&& pred)
     return make_binary_expression<vector_apply>(std::forward<Expr>(expr),
                                                 std::forward<Predicate>(pred));
 }
+//----------------------------------------------------------------------------
+//@{
+/** @name Vector expression with a math policy, see math_policy.hpp */
+template <typename Expr, typename MathPolicy>
+struct vector_with_policy
+    : vector_expression<vector_with_policy<Expr, MathPolicy>,
+                        traits::vector_expression_result_t<Expr>>,
+      unary_expression<Expr> {
+    using base_type       = vector_expression<vector_with_policy<Expr, MathPolicy>,
+                                        traits::vector_expression_result_t<Expr>>;
+    using value_type      = typename base_type::value_type;
+    using expression_base = unary_expression<Expr>;
+    using math_policy     = MathPolicy;
+    using expression_base::expression_base;
+
+    template <std::size_t N>
+    constexpr value_type
+    at() const
+    {
+        return this->arg_.template at<N>();
+    }
+};
+
+template <typename MathPolicy, typename Expr, typename = traits::enable_if_vector_expression<Expr>>
+constexpr auto
+with_policy(Expr&& expr)
+{
+    return make_unary_expression<vector_with_policy, MathPolicy>(std::forward<Expr>(expr));
+}
+//@}
+
 //----------------------------------------------------------------------------
 //@{
 /** @name Dot product of two vectors */
 template <typename LHS, typename RHS>
-struct vector_dot_product : binary_scalar_expression<vector_dot_product, LHS, RHS>,
-                            binary_expression<LHS, RHS> {
+struct vector_dot_product
+    : binary_scalar_expression<vector_dot_product, LHS, RHS, traits::accumulator_t<LHS, RHS>>,
+      binary_expression<LHS, RHS> {
     static_assert((traits::is_vector_expression_v<LHS> && traits::is_vector_expression_v<RHS>),
                   "Both sides to the dot product must be vector expressions");
     // TODO Replace with trait
     static_assert(std::decay_t<LHS>::size == std::decay_t<RHS>::size,
                   "Vector expressions must be of the same size");
 
-    using base_type  = binary_scalar_expression<vector_dot_product, LHS, RHS>;
+    using base_type
+        = binary_scalar_expression<vector_dot_product, LHS, RHS, traits::accumulator_t<LHS, RHS>>;
     using value_type = typename base_type::value_type;
 
     using expression_base   = binary_expression<LHS, RHS>;
@@ -645,23 +733,18 @@ struct vector_dot_product : binary_scalar_expression<vector_dot_product, LHS, RH
     constexpr value_type
     value() const
     {
-        if (value_cache_ == nval) {
-            value_cache_ = sum(source_index_type{});
+        if (!value_cache_) {
+            using math_policy = typename expression_base::math_policy;
+            using terms_type
+                = detail::product_terms<value_type, std::decay_t<LHS>, std::decay_t<RHS>>;
+            value_cache_ = math_policy::template sum_of_products<value_type>(
+                terms_type{this->lhs_, this->rhs_}, source_index_type{});
         }
-        return value_cache_;
+        return *value_cache_;
     }
 
 private:
-    template <std::size_t... Indexes>
-    constexpr value_type
-    sum(std::index_sequence<Indexes...>) const
-    {
-        return s::detail::unchecked_scalar_sum(
-            (get<Indexes>(this->lhs_) * get<Indexes>(this->rhs_))...);
-    }
-    // TODO Optional
-    static constexpr value_type nval         = std::numeric_limits<value_type>::min();
-    mutable value_type          value_cache_ = nval;
+    mutable std::optional<value_type> value_cache_;
 };
 
 template <typename LHS, typename RHS, typename = traits::enable_if_vector_expressions<LHS, RHS>,
@@ -725,7 +808,19 @@ slerp(Start&& start, End&& end, U&& percent)
     auto res_mag = s_mag + (e_mag - s_mag) * percent;
 
     auto dot = dot_product(s_n, e_n);
-    if (value_traits::eq(dot, 0)) {
+    if constexpr (traits::is_simd_pack_v<typename value_traits::value_type>) {
+        // Lanes cannot branch, collinear lanes take the weights of lerp instead
+        auto cos_o = dot.value();
+        if (any_lane(value_traits::eq_lanes(cos_o, -1))) {
+            throw std::runtime_error("Slerp for opposite vectors is undefined");
+        }
+        auto collinear = value_traits::eq_lanes(cos_o, 1);
+        auto omega     = acos(cos_o);
+        auto sin_o     = select(collinear, 1, sin(omega));
+        auto s_w       = select(collinear, 1 - percent, sin((1 - percent) * omega) / sin_o);
+        auto e_w       = select(collinear, percent, sin(percent * omega) / sin_o);
+        return (s_n * s_w + e_n * e_w) * res_mag;
+    } else if (value_traits::eq(dot, 0)) {
         // Perpendicular vectors
         auto theta = acos(dot) * percent;
         auto res   = s_n * cos(theta) + e_n * sin(theta);
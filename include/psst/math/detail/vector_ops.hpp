@@ -15,9 +15,9 @@ namespace psst {
 namespace math {
 namespace detail {
 
-template <typename T, std::size_t Size, typename Components>
+template <typename T, std::size_t Size, typename Components, typename MathPolicy>
 struct vector_ops {
-    using vector_type      = vector<T, Size, Components>;
+    using vector_type      = vector<T, Size, Components, MathPolicy>;
     using value_traits     = traits::scalar_value_traits<T>;
     using value_type       = typename value_traits::value_type;
     using lvalue_reference = typename value_traits::lvalue_reference;
@@ -106,13 +106,20 @@ struct vector_ops {
     vector_type&
     normalize()
     {
-        value_type m = magnitude();
-        if (m != 0) {
-            if (m != 1) {
-                rebind() /= m;
+        if constexpr (MathPolicy::multiply_by_reciprocal) {
+            magnitude_type m = magnitude_square();
+            if (any_lane(m == 0)) {
+                throw std::runtime_error("Cannot normalize a zero vector");
             }
+            rebind() *= MathPolicy::rsqrt(m);
         } else {
-            throw std::runtime_error("Cannot normalize a zero vector");
+            magnitude_type m = magnitude();
+            if (any_lane(m == 0)) {
+                throw std::runtime_error("Cannot normalize a zero vector");
+            }
+            if (!all_lanes(m == 1)) {
+                rebind() /= m;
+            }
         }
         return rebind();
     }
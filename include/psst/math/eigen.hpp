@@ -0,0 +1,383 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * eigen.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_EIGEN_HPP_
+#define PSST_MATH_EIGEN_HPP_
+
+#include <psst/math/matrix.hpp>
+#include <psst/math/parallel.hpp>
+#include <psst/math/simd.hpp>
+#include <psst/math/vector.hpp>
+#include <psst/math/vmath.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+/**
+ * Eigen-decomposition of symmetric 3x3 matrices, e.g. covariance matrices of point
+ * neighbourhoods or inertia tensors.
+ *
+ * The eigenvalue farthest from the other two and its eigenvector are found in closed form: the
+ * eigenvalues are the roots of the characteristic polynomial by the trigonometric formula, with
+ * the atan2 and sincos kernels of vmath, the eigenvector is the longest cross product of two rows
+ * of a - lambda * I. A Jacobi rotation diagonalizes the rest of the matrix in the plane
+ * orthogonal to that vector, a repeated eigenvalue gets an arbitrary orthonormal pair of vectors
+ * in its plane. One more Jacobi sweep of transpose(V) * a * V polishes the result and restores
+ * the accuracy of the small eigenvalues that the closed form loses.
+ *
+ * There are no branches, the same code runs on scalars and on SIMD packs. The batch function
+ * takes matrices in the structure of arrays layout and computes simd<T, 32 / sizeof(T)> packs of
+ * them at once.
+ */
+namespace psst {
+namespace math {
+
+/**
+ * Eigenvalues in ascending order and the eigenvectors in the columns of an orthonormal matrix,
+ * a = vectors * diag(values) * transpose(vectors). The vectors make a right-handed basis, the
+ * matrix is a rotation.
+ */
+template <typename T, std::size_t N>
+struct eigen_decomposition {
+    vector<T, N>    values;
+    matrix<T, N, N> vectors;
+};
+
+namespace detail {
+
+template <typename T>
+struct eigen_lane {
+    using type = T;
+};
+
+template <typename T, std::size_t N>
+struct eigen_lane<simd<T, N>> {
+    using type = T;
+};
+
+//@{
+/** @name Select by a bool or by a mask of lanes */
+template <typename T>
+T
+eigen_select(bool m, T const& lhs, T const& rhs)
+{
+    return m ? lhs : rhs;
+}
+
+template <typename T, std::size_t N>
+simd<T, N>
+eigen_select(simd_mask<T, N> const& m, simd<T, N> const& lhs, simd<T, N> const& rhs)
+{
+    return select(m, lhs, rhs);
+}
+//@}
+
+/**
+ * Factors that scale a matrix with the largest absolute element scale to the largest element 1,
+ * a * pre * inv. The reciprocal of a subnormal scale overflows, such a matrix is brought to normal
+ * numbers by the power of two pre first. A zero scale is replaced by one.
+ */
+template <typename S>
+void
+eigen_scale_factors(S& scale, S& pre, S& inv)
+{
+    using T         = typename eigen_lane<S>::type;
+    scale           = eigen_select(scale == S(0), S(1), scale);
+    auto const tiny = scale < S(std::numeric_limits<T>::min());
+    pre             = eigen_select(tiny, S(T(1) / std::numeric_limits<T>::epsilon()), S(1));
+    inv             = S(1) / (scale * pre);
+}
+
+/**
+ * Jacobi rotation annihilating d[P][Q] of a symmetric matrix d, the columns P and Q of v are
+ * rotated along
+ */
+template <std::size_t P, std::size_t Q, typename S>
+void
+eigen_rotate(S (&d)[3][3], S (&v)[3][3])
+{
+    using std::abs;
+    using std::sqrt;
+    constexpr std::size_t R = 3 - P - Q;
+
+    S const apq     = d[P][Q];
+    auto const zero = apq == S(0);
+    // The smaller root of t^2 + 2 theta t - 1 = 0 is the tangent of the angle
+    S const theta = (d[Q][Q] - d[P][P]) / (S(2) * eigen_select(zero, S(1), apq));
+    S t = eigen_select(theta < S(0), S(-1), S(1)) / (abs(theta) + sqrt(theta * theta + S(1)));
+    t   = eigen_select(zero, S(0), t);
+    S const c = S(1) / sqrt(t * t + S(1));
+    S const s = t * c;
+
+    d[P][P] -= t * apq;
+    d[Q][Q] += t * apq;
+    d[P][Q] = d[Q][P] = S(0);
+    S const drp       = d[R][P];
+    S const drq       = d[R][Q];
+    d[R][P] = d[P][R] = c * drp - s * drq;
+    d[R][Q] = d[Q][R] = s * drp + c * drq;
+    for (std::size_t i = 0; i < 3; ++i) {
+        S const vp = v[i][P];
+        S const vq = v[i][Q];
+        v[i][P]    = c * vp - s * vq;
+        v[i][Q]    = s * vp + c * vq;
+    }
+}
+
+template <typename S>
+void
+eigen_cross(S const (&a)[3], S const (&b)[3], S (&res)[3])
+{
+    res[0] = a[1] * b[2] - a[2] * b[1];
+    res[1] = a[2] * b[0] - a[0] * b[2];
+    res[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+template <typename S>
+S
+eigen_dot(S const (&a)[3], S const (&b)[3])
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+/** Swap the eigenvalues P and Q with their vectors if they are out of order */
+template <std::size_t P, std::size_t Q, typename S>
+void
+eigen_sort(S (&values)[3], S (&v)[3][3])
+{
+    auto const swap = values[Q] < values[P];
+    S const    vp   = values[P];
+    values[P]       = eigen_select(swap, values[Q], vp);
+    values[Q]       = eigen_select(swap, vp, values[Q]);
+    for (std::size_t i = 0; i < 3; ++i) {
+        S const p = v[i][P];
+        v[i][P]   = eigen_select(swap, v[i][Q], p);
+        v[i][Q]   = eigen_select(swap, p, v[i][Q]);
+    }
+}
+
+/**
+ * Eigen-decomposition of a symmetric matrix given by the packed lower triangle
+ * a00, a10, a11, a20, a21, a22. S is a scalar or a SIMD pack.
+ */
+template <typename S>
+void
+eigen_symmetric3(S const (&a)[6], S (&values)[3], S (&v)[3][3])
+{
+    using T = typename eigen_lane<S>::type;
+    using std::abs;
+    using std::max;
+    using std::min;
+    using std::sqrt;
+
+    // Scaled to the largest element 1, the cubes below neither overflow nor underflow
+    S scale = abs(a[0]);
+    for (std::size_t i = 1; i < 6; ++i) {
+        scale = max(scale, abs(a[i]));
+    }
+    S pre, inv;
+    eigen_scale_factors(scale, pre, inv);
+    S x[6];
+    for (std::size_t i = 0; i < 6; ++i) {
+        x[i] = a[i] * pre * inv;
+    }
+    S const m[3][3] = {{x[0], x[1], x[3]}, {x[1], x[2], x[4]}, {x[3], x[4], x[5]}};
+
+    // Eigenvalues l0 >= l1 >= l2 of m = q * I + p * B, det(B) = 2 * cos(3 * phi)
+    S const q   = (m[0][0] + m[1][1] + m[2][2]) * S(T(1) / 3);
+    S const b00 = m[0][0] - q;
+    S const b11 = m[1][1] - q;
+    S const b22 = m[2][2] - q;
+    S const p2  = (b00 * b00 + b11 * b11 + b22 * b22
+                  + S(2) * (m[0][1] * m[0][1] + m[0][2] * m[0][2] + m[1][2] * m[1][2]))
+                 * S(T(1) / 6);
+    S const p   = sqrt(p2);
+    S const det = b00 * (b11 * b22 - m[1][2] * m[1][2])
+                  - m[0][1] * (m[0][1] * b22 - m[1][2] * m[0][2])
+                  + m[0][2] * (m[0][1] * m[1][2] - b11 * m[0][2]);
+    S const p3  = eigen_select(p2 > S(0), p2 * p, S(1));
+    S const r   = min(max(det / (S(2) * p3), S(-1)), S(1));
+    // phi = acos(r) / 3, cos(phi + 2 * pi / 3) = -cos(phi) / 2 - sin(phi) * sqrt(3) / 2
+    S const phi = vmath::atan2(sqrt(S(1) - r * r), r) * S(T(1) / 3);
+    S       sin_phi, cos_phi;
+    vmath::sincos(phi, sin_phi, cos_phi);
+    S const l0 = q + S(2) * p * cos_phi;
+    S const l2 = q - p * (cos_phi + S(T(1.7320508075688772935)) * sin_phi);
+    S const l1 = S(3) * q - l0 - l2;
+
+    // The eigenvector of the eigenvalue farthest from the others
+    S const l = eigen_select(l1 - l2 <= l0 - l1, l0, l2);
+    S const rows[3][3]
+        = {{m[0][0] - l, m[0][1], m[0][2]}, {m[0][1], m[1][1] - l, m[1][2]},
+           {m[0][2], m[1][2], m[2][2] - l}};
+    S e[3], c[3];
+    eigen_cross(rows[0], rows[1], e);
+    S          len2    = eigen_dot(e, e);
+    auto const longest = [&](S const(&lhs)[3], S const(&rhs)[3]) {
+        eigen_cross(lhs, rhs, c);
+        S const    c2     = eigen_dot(c, c);
+        auto const longer = len2 < c2;
+        for (std::size_t k = 0; k < 3; ++k) {
+            e[k] = eigen_select(longer, c[k], e[k]);
+        }
+        len2 = max(len2, c2);
+    };
+    longest(rows[0], rows[2]);
+    longest(rows[1], rows[2]);
+    // m is a multiple of I when all of the products are zero
+    auto const found   = len2 > S(0);
+    S const    inv_len = S(1) / sqrt(eigen_select(found, len2, S(1)));
+    e[0]               = eigen_select(found, e[0] * inv_len, S(1));
+    e[1]               = eigen_select(found, e[1] * inv_len, S(0));
+    e[2]               = eigen_select(found, e[2] * inv_len, S(0));
+
+    // An orthonormal basis u, w of the plane orthogonal to e, |u| >= 1 / sqrt(2) before scaling
+    auto const x_major = abs(e[1]) < abs(e[0]);
+    S          u[3]    = {eigen_select(x_major, -e[2], S(0)), eigen_select(x_major, S(0), e[2]),
+                         eigen_select(x_major, e[0], -e[1])};
+    S const    u_inv   = S(1) / sqrt(eigen_dot(u, u));
+    for (auto& x : u) {
+        x *= u_inv;
+    }
+    S w[3];
+    eigen_cross(e, u, w);
+
+    // d = transpose(v) * m * v for v = [e, u, w]. The first rotation diagonalizes the block of the
+    // plane, the other two remove the error of e
+    for (std::size_t i = 0; i < 3; ++i) {
+        v[i][0] = e[i];
+        v[i][1] = u[i];
+        v[i][2] = w[i];
+    }
+    S mv[3][3];
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            mv[i][j] = m[i][0] * v[0][j] + m[i][1] * v[1][j] + m[i][2] * v[2][j];
+        }
+    }
+    S d[3][3];
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = i; j < 3; ++j) {
+            d[i][j] = d[j][i] = v[0][i] * mv[0][j] + v[1][i] * mv[1][j] + v[2][i] * mv[2][j];
+        }
+    }
+    eigen_rotate<1, 2>(d, v);
+    eigen_rotate<0, 1>(d, v);
+    eigen_rotate<0, 2>(d, v);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        values[i] = d[i][i] * scale;
+    }
+    eigen_sort<0, 1>(values, v);
+    eigen_sort<1, 2>(values, v);
+    eigen_sort<0, 1>(values, v);
+    // A right-handed basis
+    S const c0[3] = {v[0][0], v[1][0], v[2][0]};
+    S const c1[3] = {v[0][1], v[1][1], v[2][1]};
+    eigen_cross(c0, c1, c);
+    for (std::size_t i = 0; i < 3; ++i) {
+        v[i][2] = c[i];
+    }
+}
+
+template <typename T>
+constexpr std::size_t eigen_lanes = 32 / sizeof(T);
+
+}    // namespace detail
+
+/**
+ * Eigen-decomposition of a symmetric 3x3 matrix expression, only the lower triangle is read.
+ * The value type may be a SIMD pack, then every lane is decomposed.
+ */
+template <typename Matrix, typename = traits::enable_if_matrix_expression<Matrix>>
+auto
+eigen_symmetric(Matrix const& a)
+{
+    static_assert(Matrix::rows == 3 && Matrix::cols == 3,
+                  "The eigen-decomposition is implemented for 3x3 matrices");
+    using value_type = typename Matrix::value_type;
+
+    value_type const packed[6]
+        = {value_type(a.template element<0, 0>()), value_type(a.template element<1, 0>()),
+           value_type(a.template element<1, 1>()), value_type(a.template element<2, 0>()),
+           value_type(a.template element<2, 1>()), value_type(a.template element<2, 2>())};
+    value_type values[3];
+    value_type vectors[3][3];
+    detail::eigen_symmetric3(packed, values, vectors);
+
+    eigen_decomposition<value_type, 3> res;
+    for (std::size_t i = 0; i < 3; ++i) {
+        res.values[i] = values[i];
+        for (std::size_t j = 0; j < 3; ++j) {
+            res.vectors[i][j] = vectors[i][j];
+        }
+    }
+    return res;
+}
+
+/**
+ * Eigen-decomposition of count symmetric matrices in the structure of arrays layout.
+ * a holds arrays of the elements a00, a10, a11, a20, a21, a22, the packing order of
+ * symmetric_matrix<T, 3>. values receives arrays of the eigenvalues in ascending order, vectors
+ * the arrays of the elements of the eigenvector matrices by rows: vectors[r * 3 + c][i] is the
+ * component r of the eigenvector c of the matrix i. The matrices are split between threads, the
+ * results do not depend on the number of threads.
+ */
+template <typename T>
+void
+eigen_symmetric(std::array<T const*, 6> const& a, std::array<T*, 3> const& values,
+                std::array<T*, 9> const& vectors, std::size_t count,
+                parallel_options const& opts = {})
+{
+    constexpr std::size_t lanes = detail::eigen_lanes<T>;
+    using pack_type             = simd<T, lanes>;
+
+    auto const compute = [&](std::size_t first, std::size_t n) {
+        pack_type in[6];
+        pack_type out_values[3];
+        pack_type out_vectors[3][3];
+        if (n == lanes) {
+            for (std::size_t k = 0; k < 6; ++k) {
+                in[k] = pack_type::load(a[k] + first);
+            }
+        } else {
+            // The tail is padded with zero matrices
+            for (std::size_t k = 0; k < 6; ++k) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    in[k][i] = a[k][first + i];
+                }
+            }
+        }
+        detail::eigen_symmetric3(in, out_values, out_vectors);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t k = 0; k < 3; ++k) {
+                values[k][first + i] = out_values[k][i];
+            }
+            for (std::size_t k = 0; k < 9; ++k) {
+                vectors[k][first + i] = out_vectors[k / 3][k % 3][i];
+            }
+        }
+    };
+
+    parallel_options chunks = opts;
+    chunks.grain            = (std::max<std::size_t>(opts.grain, 1) + lanes - 1) / lanes * lanes;
+    math::detail::parallel_for(count, chunks, [&](std::size_t first, std::size_t last) {
+        for (; first < last; first += lanes) {
+            compute(first, std::min(lanes, last - first));
+        }
+    });
+}
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_EIGEN_HPP_ */
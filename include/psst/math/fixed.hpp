@@ -0,0 +1,675 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * fixed.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_FIXED_HPP_
+#define PSST_MATH_FIXED_HPP_
+
+#include <psst/math/detail/value_traits.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+/**
+ * Fixed point scalar type for computations that must give the same bits on every machine, e.g.
+ * lockstep simulations. fixed<IntBits, FracBits> stores a value as an integer of IntBits +
+ * FracBits bits, 16 or 32, with FracBits of them after the binary point, the integer bits
+ * include the sign. fixed<16, 16> holds values in [-32768, 32768) with a step of 1.5e-5.
+ *
+ * All of the arithmetic and the functions are done on integers: products and quotients are
+ * rounded to nearest, sums wrap around on overflow as the storage integer does. sqrt is rounded
+ * to nearest, rsqrt of fixed<16, 16> is within 0.51 units of the last place. sin, cos, acos and
+ * atan2 are computed by polynomial kernels with 30 fraction bits, within 1e-8 plus the rounding
+ * of the result. Division by zero gives the largest or the lowest value by the sign of the
+ * dividend.
+ *
+ * The type plugs into the vector and matrix expressions, so vector<fixed<16, 16>, 3> is
+ * normalized, multiplied by matrices etc. as a float vector is, the math policies take the
+ * integer rsqrt. Dot products, squared magnitudes and magnitudes are fixed_accumulator values, 64
+ * bit integers with the same fraction bits, so the magnitude of fixed<16, 16>{300, 0, 0} is 300
+ * rather than the wrapped around sum of squares. Values convert implicitly from the arithmetic
+ * types, which are rounded to nearest, and explicitly to them. Comparisons in the value traits,
+ * e.g. is_unit, tolerate a difference of four units of the last place.
+ */
+namespace psst {
+namespace math {
+
+namespace detail {
+
+//@{
+/**
+ * @name Integer kernels of the fixed point functions, the arguments and the results have 30
+ * fraction bits
+ */
+constexpr int          fixed_kernel_bits = 30;
+constexpr std::int64_t fixed_kernel_one  = std::int64_t{1} << fixed_kernel_bits;
+
+constexpr std::int64_t
+kernel_multiply(std::int64_t a, std::int64_t b)
+{
+    return (a * b + (fixed_kernel_one >> 1)) >> fixed_kernel_bits;
+}
+
+/** Number of leading zero bits of a non-zero integer */
+constexpr int
+leading_zeros(std::uint64_t n)
+{
+#if defined(__GNUC__)
+    return __builtin_clzll(n);
+#else
+    int res = 0;
+    for (std::uint64_t bit = std::uint64_t{1} << 63; (n & bit) == 0; bit >>= 1) {
+        ++res;
+    }
+    return res;
+#endif
+}
+
+/**
+ * Square root of an integer up to 2^62 rounded to nearest. The integer is scaled to m in [1, 4),
+ * the quadratic estimate of 1 / sqrt(m), within 2.5e-2, is refined by three Newton steps of
+ * multiplications only, then sqrt(m) = m / sqrt(m) is corrected to the exact integer root.
+ */
+constexpr std::uint64_t
+integer_sqrt(std::uint64_t n)
+{
+    if (n == 0)
+        return 0;
+    int const          shift = leading_zeros(n) & ~1;
+    std::int64_t const m     = static_cast<std::int64_t>((n << shift) >> 32);
+    std::int64_t       y     = 54935602;
+    y                        = -440606973 + kernel_multiply(y, m);
+    y                        = 1433346674 + kernel_multiply(y, m);
+    for (int i = 0; i < 3; ++i) {
+        std::int64_t const m_y_sq = (m * ((y * y) >> fixed_kernel_bits)) >> fixed_kernel_bits;
+        y = (y * (3 * fixed_kernel_one - m_y_sq)) >> (fixed_kernel_bits + 1);
+    }
+    std::uint64_t res = static_cast<std::uint64_t>(m * y) >> (29 + shift / 2);
+    while (res * res > n) {
+        --res;
+    }
+    while ((res + 1) * (res + 1) <= n) {
+        ++res;
+    }
+    return n - res * res > res ? res + 1 : res;
+}
+
+/** sin(π/2 u) for u in [0, 1], minimax polynomial within 3.4e-9 */
+constexpr std::int64_t
+sin_quarter_turn(std::int64_t u)
+{
+    std::int64_t const z = kernel_multiply(u, u);
+    std::int64_t       p = 161943;
+    p                    = -5016768 + kernel_multiply(p, z);
+    p                    = 85564856 + kernel_multiply(p, z);
+    p                    = -693597877 + kernel_multiply(p, z);
+    p                    = 1686629674 + kernel_multiply(p, z);
+    return kernel_multiply(p, u);
+}
+
+/** Sine of an angle of quadrant + u quarter turns, u in [0, 1) */
+constexpr std::int64_t
+sin_quadrant(std::int64_t quadrant, std::int64_t u)
+{
+    std::int64_t const s = sin_quarter_turn((quadrant & 1) ? fixed_kernel_one - u : u);
+    return (quadrant & 2) ? -s : s;
+}
+
+/** atan(r) for r in [0, 1], minimax polynomial within 3.8e-8 */
+constexpr std::int64_t
+atan_unit(std::int64_t r)
+{
+    std::int64_t const z = kernel_multiply(r, r);
+    std::int64_t       p = -4353513;
+    p                    = 23475070 + kernel_multiply(p, z);
+    p                    = -60035376 + kernel_multiply(p, z);
+    p                    = 103532406 + kernel_multiply(p, z);
+    p                    = -149342880 + kernel_multiply(p, z);
+    p                    = 214174660 + kernel_multiply(p, z);
+    p                    = -357876662 + kernel_multiply(p, z);
+    p                    = 1073741111 + kernel_multiply(p, z);
+    return kernel_multiply(p, r);
+}
+
+/**
+ * atan of the smaller to the larger absolute value, then mapped to the octant. The arguments
+ * are of any common scale below 2^32.
+ */
+constexpr std::int64_t
+atan2_kernel(std::int64_t y, std::int64_t x)
+{
+    constexpr std::int64_t pi      = 3373259426;
+    constexpr std::int64_t half_pi = 1686629713;
+
+    std::int64_t const ax = x < 0 ? -x : x;
+    std::int64_t const ay = y < 0 ? -y : y;
+    std::int64_t const mx = ax > ay ? ax : ay;
+    std::int64_t const mn = ax > ay ? ay : ax;
+    if (mx == 0)
+        return 0;
+    std::int64_t r = atan_unit(mn * fixed_kernel_one / mx);
+    r              = ay > ax ? half_pi - r : r;
+    r              = x < 0 ? pi - r : r;
+    return y < 0 ? -r : r;
+}
+//@}
+
+}    // namespace detail
+
+template <std::size_t IntBits, std::size_t FracBits>
+class fixed;
+
+/**
+ * Sum of products of fixed point values with FracBits fraction bits, the type dot products,
+ * squared magnitudes and matrix products of fixed point values are accumulated in. The value is
+ * stored in a 64 bit integer with the same fraction bits, so the products of two 32 bit values
+ * are exact before the rounding and their sums don't wrap around. Converts implicitly to the
+ * fixed point types with the same fraction bits, with the wrap around of the storage integer.
+ */
+template <std::size_t FracBits>
+class fixed_accumulator {
+public:
+    using raw_type = std::int64_t;
+
+    static constexpr std::size_t fraction_bits = FracBits;
+
+    constexpr fixed_accumulator() noexcept = default;
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+    constexpr fixed_accumulator(T v) noexcept : raw_{from_arithmetic(v)}
+    {}
+    template <std::size_t IntBits>
+    explicit constexpr fixed_accumulator(fixed<IntBits, FracBits> v) noexcept : raw_{v.raw()}
+    {}
+
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+    explicit constexpr operator T() const noexcept
+    {
+        if constexpr (std::is_floating_point<T>::value) {
+            return static_cast<T>(static_cast<double>(raw_) / one_raw);
+        } else {
+            return static_cast<T>(raw_ / one_raw);
+        }
+    }
+
+    static constexpr fixed_accumulator
+    from_raw(raw_type raw) noexcept
+    {
+        fixed_accumulator res;
+        res.raw_ = raw;
+        return res;
+    }
+    constexpr raw_type
+    raw() const noexcept
+    {
+        return raw_;
+    }
+
+    static constexpr fixed_accumulator
+    max() noexcept
+    {
+        return from_raw(std::numeric_limits<raw_type>::max());
+    }
+
+    //@{
+    /** @name Arithmetic */
+    constexpr fixed_accumulator
+    operator-() const noexcept
+    {
+        return from_raw(-raw_);
+    }
+
+    friend constexpr fixed_accumulator
+    operator+(fixed_accumulator lhs, fixed_accumulator rhs) noexcept
+    {
+        return from_raw(lhs.raw_ + rhs.raw_);
+    }
+    friend constexpr fixed_accumulator
+    operator-(fixed_accumulator lhs, fixed_accumulator rhs) noexcept
+    {
+        return from_raw(lhs.raw_ - rhs.raw_);
+    }
+    /** The product is rounded half up */
+    friend constexpr fixed_accumulator
+    operator*(fixed_accumulator lhs, fixed_accumulator rhs) noexcept
+    {
+        if constexpr (FracBits > 0) {
+            return from_raw((lhs.raw_ * rhs.raw_ + (raw_type{1} << (FracBits - 1))) >> FracBits);
+        } else {
+            return from_raw(lhs.raw_ * rhs.raw_);
+        }
+    }
+
+    constexpr fixed_accumulator&
+    operator+=(fixed_accumulator rhs) noexcept
+    {
+        return *this = *this + rhs;
+    }
+    constexpr fixed_accumulator&
+    operator-=(fixed_accumulator rhs) noexcept
+    {
+        return *this = *this - rhs;
+    }
+    constexpr fixed_accumulator&
+    operator*=(fixed_accumulator rhs) noexcept
+    {
+        return *this = *this * rhs;
+    }
+    //@}
+
+    //@{
+    /** @name Comparison */
+    friend constexpr bool
+    operator==(fixed_accumulator lhs, fixed_accumulator rhs) noexcept
+    {
+        return lhs.raw_ == rhs.raw_;
+    }
+    friend constexpr bool
+    operator!=(fixed_accumulator lhs, fixed_accumulator rhs) noexcept
+    {
+        return lhs.raw_ != rhs.raw_;
+    }
+    friend constexpr bool
+    operator<(fixed_accumulator lhs, fixed_accumulator rhs) noexcept
+    {
+        return lhs.raw_ < rhs.raw_;
+    }
+    friend constexpr bool
+    operator<=(fixed_accumulator lhs, fixed_accumulator rhs) noexcept
+    {
+        return lhs.raw_ <= rhs.raw_;
+    }
+    friend constexpr bool
+    operator>(fixed_accumulator lhs, fixed_accumulator rhs) noexcept
+    {
+        return lhs.raw_ > rhs.raw_;
+    }
+    friend constexpr bool
+    operator>=(fixed_accumulator lhs, fixed_accumulator rhs) noexcept
+    {
+        return lhs.raw_ >= rhs.raw_;
+    }
+    //@}
+
+    //@{
+    /** @name Functions */
+    friend constexpr fixed_accumulator
+    abs(fixed_accumulator v) noexcept
+    {
+        return v.raw_ < 0 ? -v : v;
+    }
+    /**
+     * The root is rounded to nearest while raw values are below 2^(62 - FracBits), the larger
+     * ones are scaled down by a power of four and lose the last bits of the root. The square
+     * root of a negative value is zero.
+     */
+    friend constexpr fixed_accumulator
+    sqrt(fixed_accumulator v) noexcept
+    {
+        if (v.raw_ <= 0)
+            return fixed_accumulator{};
+        auto const n     = static_cast<std::uint64_t>(v.raw_);
+        int const  bits  = 64 - detail::leading_zeros(n) + static_cast<int>(FracBits);
+        int const  scale = bits > 62 ? (bits - 61) / 2 : 0;
+        int const  shift = static_cast<int>(FracBits) - 2 * scale;
+        auto const root  = detail::integer_sqrt(shift >= 0 ? n << shift : n >> -shift);
+        return from_raw(static_cast<raw_type>(root << scale));
+    }
+    /** The reciprocal of the rounded root, zero and negative values give the largest value */
+    friend constexpr fixed_accumulator
+    rsqrt(fixed_accumulator v) noexcept
+    {
+        static_assert(2 * FracBits < 63, "The reciprocal of one must fit the raw value");
+        raw_type const root = sqrt(v).raw_;
+        if (root == 0)
+            return max();
+        return from_raw(((raw_type{1} << (2 * FracBits)) + root / 2) / root);
+    }
+    //@}
+
+    friend std::ostream&
+    operator<<(std::ostream& os, fixed_accumulator v)
+    {
+        return os << static_cast<double>(v);
+    }
+
+private:
+    static constexpr raw_type one_raw = raw_type{1} << FracBits;
+
+    template <typename T>
+    static constexpr raw_type
+    from_arithmetic(T v) noexcept
+    {
+        if constexpr (std::is_floating_point<T>::value) {
+            double const s = static_cast<double>(v) * one_raw;
+            return static_cast<raw_type>(s < 0 ? s - 0.5 : s + 0.5);
+        } else {
+            return static_cast<raw_type>(static_cast<std::uint64_t>(v) << FracBits);
+        }
+    }
+
+    raw_type raw_ = 0;
+};
+
+/**
+ * Fixed point number with IntBits integer bits, including the sign, and FracBits fraction bits
+ */
+template <std::size_t IntBits, std::size_t FracBits>
+class fixed {
+    static_assert(IntBits > 0 && (IntBits + FracBits == 16 || IntBits + FracBits == 32),
+                  "Fixed point storage must be a 16 or 32 bit integer with the sign bit");
+
+public:
+    using raw_type  = std::conditional_t<IntBits + FracBits == 16, std::int16_t, std::int32_t>;
+    using wide_type = std::int64_t;
+
+    static constexpr std::size_t integer_bits  = IntBits;
+    static constexpr std::size_t fraction_bits = FracBits;
+
+    constexpr fixed() noexcept = default;
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+    constexpr fixed(T v) noexcept : raw_{from_arithmetic(v)}
+    {}
+    template <std::size_t I, std::size_t F>
+    explicit constexpr fixed(fixed<I, F> v) noexcept
+        : raw_{static_cast<raw_type>(rescale<F, FracBits>(wide_type{v.raw()}))}
+    {}
+    /** From the sums and the scalar expressions of them, wraps around as the storage does */
+    template <typename T,
+              typename = std::enable_if_t<!std::is_arithmetic<T>::value
+                                          && std::is_convertible<
+                                              T const&, fixed_accumulator<FracBits>>::value>>
+    constexpr fixed(T const& v) noexcept
+        : raw_{static_cast<raw_type>(fixed_accumulator<FracBits>(v).raw())}
+    {}
+
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+    explicit constexpr operator T() const noexcept
+    {
+        if constexpr (std::is_floating_point<T>::value) {
+            return static_cast<T>(static_cast<double>(raw_) / one_raw);
+        } else {
+            return static_cast<T>(raw_ / one_raw);
+        }
+    }
+
+    static constexpr fixed
+    from_raw(raw_type raw) noexcept
+    {
+        fixed res;
+        res.raw_ = raw;
+        return res;
+    }
+    constexpr raw_type
+    raw() const noexcept
+    {
+        return raw_;
+    }
+
+    //@{
+    /** @name Limits */
+    static constexpr fixed
+    max() noexcept
+    {
+        return from_raw(std::numeric_limits<raw_type>::max());
+    }
+    static constexpr fixed
+    lowest() noexcept
+    {
+        return from_raw(std::numeric_limits<raw_type>::min());
+    }
+    /** The step between adjacent values */
+    static constexpr fixed
+    epsilon() noexcept
+    {
+        return from_raw(1);
+    }
+    //@}
+
+    //@{
+    /** @name Arithmetic */
+    constexpr fixed
+    operator-() const noexcept
+    {
+        return from_raw(static_cast<raw_type>(-wide_type{raw_}));
+    }
+
+    friend constexpr fixed
+    operator+(fixed lhs, fixed rhs) noexcept
+    {
+        return from_raw(static_cast<raw_type>(wide_type{lhs.raw_} + rhs.raw_));
+    }
+    friend constexpr fixed
+    operator-(fixed lhs, fixed rhs) noexcept
+    {
+        return from_raw(static_cast<raw_type>(wide_type{lhs.raw_} - rhs.raw_));
+    }
+    friend constexpr fixed
+    operator*(fixed lhs, fixed rhs) noexcept
+    {
+        return from_raw(static_cast<raw_type>(
+            rescale<2 * FracBits, FracBits>(wide_type{lhs.raw_} * rhs.raw_)));
+    }
+    /** The quotient is rounded half away from zero */
+    friend constexpr fixed
+    operator/(fixed lhs, fixed rhs) noexcept
+    {
+        if (rhs.raw_ == 0)
+            return lhs.raw_ > 0 ? max() : lhs.raw_ < 0 ? lowest() : fixed{};
+        wide_type const n    = wide_type{lhs.raw_} * one_raw;
+        wide_type const half = (rhs.raw_ < 0 ? -wide_type{rhs.raw_} : rhs.raw_) / 2;
+        return from_raw(static_cast<raw_type>((n < 0 ? n - half : n + half) / rhs.raw_));
+    }
+
+    constexpr fixed&
+    operator+=(fixed rhs) noexcept
+    {
+        return *this = *this + rhs;
+    }
+    constexpr fixed&
+    operator-=(fixed rhs) noexcept
+    {
+        return *this = *this - rhs;
+    }
+    constexpr fixed&
+    operator*=(fixed rhs) noexcept
+    {
+        return *this = *this * rhs;
+    }
+    constexpr fixed&
+    operator/=(fixed rhs) noexcept
+    {
+        return *this = *this / rhs;
+    }
+    //@}
+
+    //@{
+    /** @name Comparison */
+    friend constexpr bool
+    operator==(fixed lhs, fixed rhs) noexcept
+    {
+        return lhs.raw_ == rhs.raw_;
+    }
+    friend constexpr bool
+    operator!=(fixed lhs, fixed rhs) noexcept
+    {
+        return lhs.raw_ != rhs.raw_;
+    }
+    friend constexpr bool
+    operator<(fixed lhs, fixed rhs) noexcept
+    {
+        return lhs.raw_ < rhs.raw_;
+    }
+    friend constexpr bool
+    operator<=(fixed lhs, fixed rhs) noexcept
+    {
+        return lhs.raw_ <= rhs.raw_;
+    }
+    friend constexpr bool
+    operator>(fixed lhs, fixed rhs) noexcept
+    {
+        return lhs.raw_ > rhs.raw_;
+    }
+    friend constexpr bool
+    operator>=(fixed lhs, fixed rhs) noexcept
+    {
+        return lhs.raw_ >= rhs.raw_;
+    }
+    //@}
+
+    //@{
+    /** @name Functions */
+    friend constexpr fixed
+    abs(fixed v) noexcept
+    {
+        return v.raw_ < 0 ? -v : v;
+    }
+    /** The square root of a negative value is zero */
+    friend constexpr fixed
+    sqrt(fixed v) noexcept
+    {
+        if (v.raw_ <= 0)
+            return fixed{};
+        return from_raw(static_cast<raw_type>(
+            detail::integer_sqrt(static_cast<std::uint64_t>(v.raw_) << FracBits)));
+    }
+    /**
+     * sqrt(2^(3 FracBits) / raw), with extra bits of the quotient and of the root rounded off.
+     * Zero and negative values give the largest value.
+     */
+    friend constexpr fixed
+    rsqrt(fixed v) noexcept
+    {
+        if (v.raw_ <= 0)
+            return max();
+        if constexpr (3 * FracBits <= 62) {
+            constexpr std::size_t extra = (62 - 3 * FracBits) / 2;
+            auto const            n     = (std::uint64_t{1} << (3 * FracBits + 2 * extra))
+                             / static_cast<std::uint64_t>(v.raw_);
+            return from_raw(static_cast<raw_type>(rescale<extra, 0>(
+                static_cast<wide_type>(detail::integer_sqrt(n)))));
+        } else {
+            return fixed{1} / sqrt(v);
+        }
+    }
+    friend constexpr fixed
+    sin(fixed v) noexcept
+    {
+        return from_kernel(sin_turns(v, 0));
+    }
+    friend constexpr fixed
+    cos(fixed v) noexcept
+    {
+        return from_kernel(sin_turns(v, 1));
+    }
+    /** Arguments out of [-1, 1] are clamped */
+    friend constexpr fixed
+    acos(fixed v) noexcept
+    {
+        constexpr wide_type one = detail::fixed_kernel_one;
+
+        wide_type x      = to_kernel(v);
+        x                = x > one ? one : x < -one ? -one : x;
+        auto const sin_a = detail::integer_sqrt(static_cast<std::uint64_t>((one - x) * (one + x)));
+        return from_kernel(detail::atan2_kernel(static_cast<wide_type>(sin_a), x));
+    }
+    friend constexpr fixed
+    atan2(fixed y, fixed x) noexcept
+    {
+        return from_kernel(detail::atan2_kernel(y.raw_, x.raw_));
+    }
+    //@}
+
+    friend std::ostream&
+    operator<<(std::ostream& os, fixed v)
+    {
+        return os << static_cast<double>(v);
+    }
+
+private:
+    static constexpr wide_type one_raw = wide_type{1} << FracBits;
+
+    /** Raw value with From fraction bits to To ones, rounded half up */
+    template <std::size_t From, std::size_t To>
+    static constexpr wide_type
+    rescale(wide_type v) noexcept
+    {
+        if constexpr (From > To) {
+            return (v + (wide_type{1} << (From - To - 1))) >> (From - To);
+        } else {
+            return v * (wide_type{1} << (To - From));
+        }
+    }
+
+    static constexpr wide_type
+    to_kernel(fixed v) noexcept
+    {
+        return rescale<FracBits, detail::fixed_kernel_bits>(v.raw_);
+    }
+    static constexpr fixed
+    from_kernel(wide_type v) noexcept
+    {
+        return from_raw(static_cast<raw_type>(rescale<detail::fixed_kernel_bits, FracBits>(v)));
+    }
+
+    /** sin(v + quadrants π/2) with the kernel fraction bits, 2/π has 63 bits in two parts */
+    static constexpr wide_type
+    sin_turns(fixed v, wide_type quadrants) noexcept
+    {
+        constexpr wide_type two_over_pi_hi = 1367130551;
+        constexpr wide_type two_over_pi_lo = 656542356;
+        constexpr int       shift          = FracBits + 31;
+
+        wide_type const t = v.raw_ * two_over_pi_hi + ((v.raw_ * two_over_pi_lo) >> 32);
+        wide_type const u
+            = (t >> (shift - detail::fixed_kernel_bits)) & (detail::fixed_kernel_one - 1);
+        return detail::sin_quadrant((t >> shift) + quadrants, u);
+    }
+
+    template <typename T>
+    static constexpr raw_type
+    from_arithmetic(T v) noexcept
+    {
+        if constexpr (std::is_floating_point<T>::value) {
+            // Scaling of a double by a power of two is exact
+            double const s = static_cast<double>(v) * one_raw;
+            return static_cast<raw_type>(static_cast<wide_type>(s < 0 ? s - 0.5 : s + 0.5));
+        } else {
+            return static_cast<raw_type>(static_cast<std::uint64_t>(v) << FracBits);
+        }
+    }
+
+    raw_type raw_ = 0;
+};
+
+namespace traits {
+
+/** Sums of products, and so the magnitudes, of fixed point values are wide */
+template <std::size_t IntBits, std::size_t FracBits>
+struct arithmetic_type<fixed<IntBits, FracBits>> {
+    using type = fixed_accumulator<FracBits>;
+};
+
+namespace detail {
+
+template <std::size_t IntBits, std::size_t FracBits>
+struct iota<fixed<IntBits, FracBits>> {
+    static constexpr fixed<IntBits, FracBits> value = fixed<IntBits, FracBits>::from_raw(4);
+};
+
+template <std::size_t IntBits, std::size_t FracBits>
+struct compare_traits<fixed<IntBits, FracBits>>
+    : compare_traits_impl<fixed<IntBits, FracBits>, true> {};
+
+}    // namespace detail
+}    // namespace traits
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_FIXED_HPP_ */
@@ -0,0 +1,324 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * half.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_HALF_HPP_
+#define PSST_MATH_HALF_HPP_
+
+#include <psst/math/detail/block_loop.hpp>
+#include <psst/math/math_policy.hpp>
+#include <psst/math/parallel.hpp>
+#include <psst/math/vector.hpp>
+#include <psst/math/vector_view.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__F16C__) || defined(__AVX512BF16__)
+#include <immintrin.h>
+#endif
+
+/**
+ * 16 bit floating point storage types. half is IEEE 754 binary16, 11 bits of precision and
+ * values up to 65504, bfloat16 is the upper half of a float, 8 bits of precision and the range of
+ * float. Values convert implicitly to and from float and the arithmetic is done in float, so an
+ * expression of vector<half, 3> values is of vector<float, 3> and is rounded to half when assigned
+ * to a vector<half, 3>. Sums of products are accumulated in float.
+ *
+ * Conversions round to nearest even, a double is rounded to float first. convert_values converts
+ * whole buffers, with F16C or AVX-512 BF16 instructions when the target has them.
+ */
+namespace psst {
+namespace math {
+
+namespace detail {
+
+inline std::uint32_t
+float_bits(float v)
+{
+    std::uint32_t res;
+    std::memcpy(&res, &v, sizeof(res));
+    return res;
+}
+
+inline float
+bits_float(std::uint32_t v)
+{
+    float res;
+    std::memcpy(&res, &v, sizeof(res));
+    return res;
+}
+
+/**
+ * Branchless rounding of a float to binary16, the cases are selected by masks so that the
+ * conversion of a buffer vectorises. Values out of range become infinities, the NaNs stay NaNs,
+ * values below the normal range are rounded to subnormals by the float addition of a constant.
+ */
+inline std::uint16_t
+float_to_half_bits(float v)
+{
+    constexpr std::uint32_t f32_infinity = 255u << 23;
+    constexpr std::uint32_t f16_max      = (127u + 16) << 23;
+    constexpr std::uint32_t f16_min      = 113u << 23;
+    constexpr std::uint32_t denorm_magic = ((127u - 15) + (23 - 10) + 1) << 23;
+
+    std::uint32_t       bits = float_bits(v);
+    std::uint32_t const sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    std::uint32_t const overflow = 0x7c00u | (std::uint32_t{bits > f32_infinity} << 9);
+    std::uint32_t const subnormal
+        = float_bits(bits_float(bits) + bits_float(denorm_magic)) - denorm_magic;
+    std::uint32_t const normal
+        = (bits + ((15u - 127) << 23) + 0xfff + ((bits >> 13) & 1)) >> 13;
+
+    std::uint32_t const is_large = 0u - std::uint32_t{bits >= f16_max};
+    std::uint32_t const is_small = ~is_large & (0u - std::uint32_t{bits < f16_min});
+    std::uint32_t const res
+        = (overflow & is_large) | (subnormal & is_small) | (normal & ~(is_large | is_small));
+    return static_cast<std::uint16_t>(res | (sign >> 16));
+}
+
+/** Exact conversion of binary16 to float */
+inline float
+half_bits_to_float(std::uint16_t v)
+{
+    constexpr std::uint32_t exponent_mask = 0x7c00u << 13;
+    constexpr std::uint32_t magic         = 113u << 23;
+
+    std::uint32_t       bits     = (v & 0x7fffu) << 13;
+    std::uint32_t const exponent = bits & exponent_mask;
+    bits += (127u - 15) << 23;
+
+    std::uint32_t const special   = bits + ((128u - 16) << 23);
+    std::uint32_t const subnormal = float_bits(bits_float(bits + (1u << 23)) - bits_float(magic));
+    std::uint32_t const is_special   = 0u - std::uint32_t{exponent == exponent_mask};
+    std::uint32_t const is_subnormal = 0u - std::uint32_t{exponent == 0};
+    bits = (special & is_special) | (subnormal & is_subnormal)
+           | (bits & ~(is_special | is_subnormal));
+    return bits_float(bits | (std::uint32_t(v & 0x8000u) << 16));
+}
+
+/** Rounding of a float to bfloat16, the NaNs stay NaNs */
+inline std::uint16_t
+float_to_bfloat16_bits(float v)
+{
+    std::uint32_t const bits    = float_bits(v);
+    std::uint32_t const rounded = (bits + 0x7fffu + ((bits >> 16) & 1)) >> 16;
+    std::uint32_t const is_nan  = 0u - std::uint32_t{(bits & 0x7fffffffu) > 0x7f800000u};
+    return static_cast<std::uint16_t>((((bits >> 16) | 0x40u) & is_nan) | (rounded & ~is_nan));
+}
+
+/** Exact conversion of bfloat16 to float */
+inline float
+bfloat16_bits_to_float(std::uint16_t v)
+{
+    return bits_float(std::uint32_t(v) << 16);
+}
+
+/**
+ * Common part of the 16 bit storage types, the bits and the arithmetic through float
+ */
+template <typename Derived, std::uint16_t (*ToBits)(float), float (*FromBits)(std::uint16_t)>
+class float16_storage {
+public:
+    constexpr float16_storage() noexcept = default;
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+    float16_storage(T v) noexcept : bits_{ToBits(static_cast<float>(v))}
+    {}
+
+    operator float() const noexcept { return FromBits(bits_); }
+
+    static constexpr Derived
+    from_bits(std::uint16_t bits) noexcept
+    {
+        Derived res;
+        res.bits_ = bits;
+        return res;
+    }
+    constexpr std::uint16_t
+    bits() const noexcept
+    {
+        return bits_;
+    }
+
+    //@{
+    /** @name Arithmetic through float */
+    template <typename T>
+    Derived&
+    operator+=(T const& rhs) noexcept
+    {
+        return rebind() = Derived(float(*this) + rhs);
+    }
+    template <typename T>
+    Derived&
+    operator-=(T const& rhs) noexcept
+    {
+        return rebind() = Derived(float(*this) - rhs);
+    }
+    template <typename T>
+    Derived&
+    operator*=(T const& rhs) noexcept
+    {
+        return rebind() = Derived(float(*this) * rhs);
+    }
+    template <typename T>
+    Derived&
+    operator/=(T const& rhs) noexcept
+    {
+        return rebind() = Derived(float(*this) / rhs);
+    }
+    //@}
+
+private:
+    Derived&
+    rebind() noexcept
+    {
+        return static_cast<Derived&>(*this);
+    }
+
+    std::uint16_t bits_ = 0;
+};
+
+}    // namespace detail
+
+/** IEEE 754 binary16 storage type */
+struct half
+    : detail::float16_storage<half, detail::float_to_half_bits, detail::half_bits_to_float> {
+    using float16_storage::float16_storage;
+};
+
+/** bfloat16 storage type, a float with the lower 16 bits of the mantissa dropped */
+struct bfloat16 : detail::float16_storage<bfloat16, detail::float_to_bfloat16_bits,
+                                          detail::bfloat16_bits_to_float> {
+    using float16_storage::float16_storage;
+};
+
+static_assert(sizeof(half) == 2 && sizeof(bfloat16) == 2, "16 bit types must be tightly packed");
+
+namespace traits {
+
+template <>
+struct arithmetic_type<half> {
+    using type = float;
+};
+template <>
+struct arithmetic_type<bfloat16> {
+    using type = float;
+};
+template <>
+struct wide_accumulator<half> {
+    using type = float;
+};
+template <>
+struct wide_accumulator<bfloat16> {
+    using type = float;
+};
+
+}    // namespace traits
+
+namespace detail {
+
+/** Number of values converted at a time by the software conversions, see block_loop.hpp */
+constexpr std::size_t conversion_block_size = 16;
+
+inline void
+convert_range(half const* src, float* dst, std::size_t n)
+{
+    std::size_t i = 0;
+#ifdef __F16C__
+    for (; i + 8 <= n; i += 8) {
+        __m128i const h = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+#endif
+    transform_blocks<conversion_block_size>(
+        src + i, n - i, dst + i, [](half v) { return half_bits_to_float(v.bits()); });
+}
+
+inline void
+convert_range(float const* src, half* dst, std::size_t n)
+{
+    std::size_t i = 0;
+#ifdef __F16C__
+    for (; i + 8 <= n; i += 8) {
+        __m128i const h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+    }
+#endif
+    transform_blocks<conversion_block_size>(
+        src + i, n - i, dst + i, [](float v) { return half::from_bits(float_to_half_bits(v)); });
+}
+
+inline void
+convert_range(bfloat16 const* src, float* dst, std::size_t n)
+{
+    transform_blocks<conversion_block_size>(
+        src, n, dst, [](bfloat16 v) { return bfloat16_bits_to_float(v.bits()); });
+}
+
+/** The AVX-512 BF16 instruction flushes subnormal floats to zero */
+inline void
+convert_range(float const* src, bfloat16* dst, std::size_t n)
+{
+    std::size_t i = 0;
+#ifdef __AVX512BF16__
+    for (; i + 16 <= n; i += 16) {
+        auto const h = _mm512_cvtneps_pbh(_mm512_loadu_ps(src + i));
+        std::memcpy(static_cast<void*>(dst + i), &h, sizeof(h));
+    }
+#endif
+    transform_blocks<conversion_block_size>(src + i, n - i, dst + i, [](float v) {
+        return bfloat16::from_bits(float_to_bfloat16_bits(v));
+    });
+}
+
+}    // namespace detail
+
+/**
+ * Convert a buffer of values to or from a 16 bit storage type, one of the value types must be
+ * float. Large buffers are split between threads.
+ *
+ * @param src Source buffer
+ * @param count Number of values
+ * @param dst Destination buffer
+ */
+template <typename T, typename U>
+void
+convert_values(T const* src, std::size_t count, U* dst, parallel_options const& opts = {})
+{
+    detail::parallel_for(count, opts, [&](std::size_t first, std::size_t last) {
+        detail::convert_range(src + first, dst + first, last - first);
+    });
+}
+
+/**
+ * Convert a memory_vector_view of values to or from a 16 bit storage type, e.g. a buffer of
+ * vector<half, 3> normals to vector<float, 3> ones.
+ *
+ * @param src Source vectors
+ * @param dst Destination buffer, must have at least the same number of vectors as the source
+ * @param opts Threading options
+ */
+template <typename T, typename U, std::size_t Size, typename Components, component_order Order>
+void
+convert_values(memory_vector_view<T*, Size, Components, Order> src,
+               memory_vector_view<U*, Size, Components, Order> dst,
+               parallel_options const&                         opts = {})
+{
+    static_assert(!std::is_const<U>::value, "Destination buffer must be mutable");
+    if (dst.size() < src.size())
+        throw std::runtime_error{"Destination buffer is too small"};
+    convert_values(src.data(), src.size() * Size, dst.data(), opts);
+}
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_HALF_HPP_ */
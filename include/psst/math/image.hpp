@@ -0,0 +1,662 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * image.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_IMAGE_HPP_
+#define PSST_MATH_IMAGE_HPP_
+
+#include <psst/math/colors.hpp>
+#include <psst/math/parallel.hpp>
+#include <psst/math/vector_view.hpp>
+
+#ifdef __SSE2__
+#    include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace psst {
+namespace math {
+namespace color {
+
+/**
+ * 2D view over a buffer of pixels stored row by row.
+ *
+ * Rows can be padded, the stride is the distance between the starts of rows in pixels.
+ */
+template <typename T, std::size_t Size, typename Components>
+struct image_view {
+    using value_type   = std::remove_const_t<T>;
+    using pointer_type = T*;
+    using row_type     = memory_vector_view<T*, Size, Components>;
+    using pixel_type   = vector_view<T*, Size, Components>;
+
+    static constexpr std::size_t component_count = Size;
+
+    constexpr image_view(pointer_type buffer, std::size_t width, std::size_t height,
+                         std::size_t stride = 0)
+        : data_{buffer}, width_{width}, height_{height}, stride_{stride == 0 ? width : stride}
+    {
+        if (stride_ < width_)
+            throw std::runtime_error{"Image stride is less than width"};
+    }
+    /**
+     * Construct an image view over a contiguous buffer of pixels
+     * @param pixels Pixel buffer, the number of pixels must be a multiple of width
+     * @param width Width of the image
+     */
+    constexpr image_view(row_type pixels, std::size_t width)
+        : image_view{pixels.data(), width, width == 0 ? 0 : pixels.size() / width}
+    {
+        if (width != 0 && pixels.size() % width != 0)
+            throw std::runtime_error{"The number of pixels is not a multiple of image width"};
+    }
+
+    template <typename U, typename = std::enable_if_t<std::is_same<U const, T>::value
+                                                      && !std::is_same<U, T>::value>>
+    constexpr image_view(image_view<U, Size, Components> const& rhs)
+        : data_{rhs.data()}, width_{rhs.width()}, height_{rhs.height()}, stride_{rhs.stride()}
+    {}
+
+    constexpr std::size_t
+    width() const
+    {
+        return width_;
+    }
+    constexpr std::size_t
+    height() const
+    {
+        return height_;
+    }
+    /** Distance between rows in pixels */
+    constexpr std::size_t
+    stride() const
+    {
+        return stride_;
+    }
+    constexpr pointer_type
+    data() const
+    {
+        return data_;
+    }
+    constexpr bool
+    empty() const
+    {
+        return width_ == 0 || height_ == 0;
+    }
+    /** There is no padding between rows */
+    constexpr bool
+    contiguous() const
+    {
+        return width_ == stride_;
+    }
+
+    constexpr pointer_type
+    row_data(std::size_t y) const
+    {
+        return data_ + y * stride_ * Size;
+    }
+    constexpr row_type
+    row(std::size_t y) const
+    {
+        return row_type{row_data(y), width_ * Size};
+    }
+    constexpr pixel_type
+    operator()(std::size_t x, std::size_t y) const
+    {
+        return pixel_type{row_data(y) + x * Size};
+    }
+
+    /**
+     * View of a rectangular region of the image, the region is clipped to the image bounds
+     */
+    constexpr image_view
+    subview(std::size_t x, std::size_t y, std::size_t width, std::size_t height) const
+    {
+        x      = std::min(x, width_);
+        y      = std::min(y, height_);
+        width  = std::min(width, width_ - x);
+        height = std::min(height, height_ - y);
+        return image_view{row_data(y) + x * Size, width, height, stride_};
+    }
+
+private:
+    pointer_type data_;
+    std::size_t  width_;
+    std::size_t  height_;
+    std::size_t  stride_;
+};
+
+/**
+ * Image of 8-bit RGBA pixels
+ */
+using rgba_hex_image      = image_view<std::uint8_t, 4, components::rgba_hex>;
+using rgba_hex_image_cref = image_view<std::uint8_t const, 4, components::rgba_hex>;
+/**
+ * Image of floating point RGBA pixels
+ */
+using rgba_float_image      = image_view<float, 4, components::rgba>;
+using rgba_float_image_cref = image_view<float const, 4, components::rgba>;
+
+/**
+ * Create an image view over a buffer of values
+ * @param buffer Pointer to the first pixel
+ * @param width Width of the image in pixels
+ * @param height Height of the image in pixels
+ * @param stride Distance between the rows in pixels, 0 means no padding
+ */
+template <typename Color, typename T, typename = traits::enable_if_vector<Color>>
+constexpr auto
+make_image_view(T* buffer, std::size_t width, std::size_t height, std::size_t stride = 0)
+{
+    using value_type      = traits::scalar_expression_result_t<Color>;
+    using components_type = traits::component_names_t<Color>;
+    constexpr auto size   = traits::vector_expression_size_v<Color>;
+    static_assert((std::is_same<std::remove_const_t<T>, value_type>{}),
+                  "Incompatible pointer type");
+    return image_view<T, size, components_type>{buffer, width, height, stride};
+}
+
+//----------------------------------------------------------------------------
+//  sRGB transfer function
+//----------------------------------------------------------------------------
+namespace detail {
+
+/** Number of intervals in the linear -> sRGB lookup table */
+constexpr std::size_t linear_to_srgb_table_size = 4096;
+
+inline float
+srgb_to_linear_value(float c)
+{
+    return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+}
+
+inline float
+linear_to_srgb_value(float c)
+{
+    return c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1 / 2.4f) - 0.055f;
+}
+
+struct srgb_tables {
+    std::array<float, 256>                                  to_linear;
+    std::array<std::uint8_t, linear_to_srgb_table_size + 1> to_srgb;
+
+    srgb_tables()
+    {
+        for (std::size_t i = 0; i < to_linear.size(); ++i) {
+            to_linear[i] = srgb_to_linear_value(i / 255.0f);
+        }
+        for (std::size_t i = 0; i < to_srgb.size(); ++i) {
+            float v    = linear_to_srgb_value(float(i) / linear_to_srgb_table_size);
+            to_srgb[i] = static_cast<std::uint8_t>(v * 255 + 0.5f);
+        }
+    }
+};
+
+inline srgb_tables const&
+get_srgb_tables()
+{
+    static srgb_tables const tables;
+    return tables;
+}
+
+inline std::uint8_t
+linear_to_srgb_lookup(srgb_tables const& tables, float c)
+{
+    c = c < 0 ? 0.0f : (c > 1 ? 1.0f : c);
+    return tables.to_srgb[static_cast<std::size_t>(c * linear_to_srgb_table_size + 0.5f)];
+}
+
+}    // namespace detail
+
+/**
+ * Convert an 8-bit sRGB encoded channel to linear intensity using a lookup table
+ */
+inline float
+srgb_to_linear(std::uint8_t c)
+{
+    return detail::get_srgb_tables().to_linear[c];
+}
+
+/**
+ * Convert linear intensity to an 8-bit sRGB encoded channel using a lookup table.
+ * The result is within one step of the exact value.
+ */
+inline std::uint8_t
+linear_to_srgb(float c)
+{
+    return detail::linear_to_srgb_lookup(detail::get_srgb_tables(), c);
+}
+
+//----------------------------------------------------------------------------
+//  Row kernels, a row is n RGBA pixels
+//----------------------------------------------------------------------------
+namespace detail {
+
+/** a * b / 255 rounded to nearest, exact for all 8-bit inputs */
+constexpr std::uint8_t
+mul_div_255(unsigned a, unsigned b)
+{
+    unsigned t = a * b + 128;
+    return static_cast<std::uint8_t>((t + (t >> 8)) >> 8);
+}
+
+#ifdef __SSE2__
+/** mul_div_255 for 16-bit lanes holding 8-bit values */
+inline __m128i
+mul_div_255_sse2(__m128i a, __m128i b)
+{
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+/** Broadcast the alpha of two pixels in 16-bit lanes to all of their channels */
+inline __m128i
+broadcast_alpha_sse2(__m128i px)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3)),
+                               _MM_SHUFFLE(3, 3, 3, 3));
+}
+#endif
+
+inline void
+unpack_row(std::uint8_t const* src, float* dst, std::size_t n)
+{
+    std::size_t i = 0;
+    n *= 4;
+#ifdef __SSE2__
+    __m128i const zero  = _mm_setzero_si128();
+    __m128 const  scale = _mm_set1_ps(1.0f / 255);
+    for (; i + 16 <= n; i += 16) {
+        __m128i b  = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+        __m128i lo = _mm_unpacklo_epi8(b, zero);
+        __m128i hi = _mm_unpackhi_epi8(b, zero);
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+        _mm_storeu_ps(dst + i + 4,
+                      _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+        _mm_storeu_ps(dst + i + 8,
+                      _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+        _mm_storeu_ps(dst + i + 12,
+                      _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = src[i] * (1.0f / 255);
+    }
+}
+
+inline void
+pack_row(float const* src, std::uint8_t* dst, std::size_t n)
+{
+    std::size_t i = 0;
+    n *= 4;
+#ifdef __SSE2__
+    __m128 const zero  = _mm_setzero_ps();
+    __m128 const one   = _mm_set1_ps(1.0f);
+    __m128 const scale = _mm_set1_ps(255.0f);
+    __m128 const half  = _mm_set1_ps(0.5f);
+    auto         to_int = [&](float const* p) {
+        __m128 v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(p), zero), one);
+        return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(v, scale), half));
+    };
+    for (; i + 16 <= n; i += 16) {
+        __m128i lo = _mm_packs_epi32(to_int(src + i), to_int(src + i + 4));
+        __m128i hi = _mm_packs_epi32(to_int(src + i + 8), to_int(src + i + 12));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; i < n; ++i) {
+        float v = src[i] < 0 ? 0.0f : (src[i] > 1 ? 1.0f : src[i]);
+        dst[i]  = static_cast<std::uint8_t>(v * 255 + 0.5f);
+    }
+}
+
+inline void
+srgb_to_linear_row(srgb_tables const& tables, std::uint8_t const* src, float* dst, std::size_t n)
+{
+    for (std::size_t i = 0; i < n * 4; i += 4) {
+        dst[i + 0] = tables.to_linear[src[i + 0]];
+        dst[i + 1] = tables.to_linear[src[i + 1]];
+        dst[i + 2] = tables.to_linear[src[i + 2]];
+        dst[i + 3] = src[i + 3] * (1.0f / 255);
+    }
+}
+
+inline void
+linear_to_srgb_row(srgb_tables const& tables, float const* src, std::uint8_t* dst, std::size_t n)
+{
+    for (std::size_t i = 0; i < n * 4; i += 4) {
+        dst[i + 0] = linear_to_srgb_lookup(tables, src[i + 0]);
+        dst[i + 1] = linear_to_srgb_lookup(tables, src[i + 1]);
+        dst[i + 2] = linear_to_srgb_lookup(tables, src[i + 2]);
+        float a    = src[i + 3] < 0 ? 0.0f : (src[i + 3] > 1 ? 1.0f : src[i + 3]);
+        dst[i + 3] = static_cast<std::uint8_t>(a * 255 + 0.5f);
+    }
+}
+
+inline void
+premultiply_row(std::uint8_t* px, std::size_t n)
+{
+    std::size_t i = 0;
+#ifdef __SSE2__
+    __m128i const zero = _mm_setzero_si128();
+    // Keep alpha itself by multiplying it with 255
+    __m128i const color_mask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    __m128i const alpha_one  = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    auto          mul_alpha  = [&](__m128i c) {
+        __m128i a = _mm_or_si128(_mm_and_si128(broadcast_alpha_sse2(c), color_mask), alpha_one);
+        return mul_div_255_sse2(c, a);
+    };
+    for (; i + 4 <= n; i += 4) {
+        __m128i b  = _mm_loadu_si128(reinterpret_cast<__m128i const*>(px + i * 4));
+        __m128i lo = mul_alpha(_mm_unpacklo_epi8(b, zero));
+        __m128i hi = mul_alpha(_mm_unpackhi_epi8(b, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(px + i * 4), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; i < n; ++i) {
+        std::uint8_t* p = px + i * 4;
+        p[0]            = mul_div_255(p[0], p[3]);
+        p[1]            = mul_div_255(p[1], p[3]);
+        p[2]            = mul_div_255(p[2], p[3]);
+    }
+}
+
+inline void
+premultiply_row(float* px, std::size_t n)
+{
+    for (std::size_t i = 0; i < n * 4; i += 4) {
+        px[i + 0] *= px[i + 3];
+        px[i + 1] *= px[i + 3];
+        px[i + 2] *= px[i + 3];
+    }
+}
+
+inline void
+unpremultiply_row(std::uint8_t* px, std::size_t n)
+{
+    for (std::size_t i = 0; i < n * 4; i += 4) {
+        unsigned a = px[i + 3];
+        if (a == 0 || a == 255)
+            continue;
+        for (std::size_t c = 0; c < 3; ++c) {
+            px[i + c] = static_cast<std::uint8_t>(std::min(255u, (px[i + c] * 255u + a / 2) / a));
+        }
+    }
+}
+
+inline void
+unpremultiply_row(float* px, std::size_t n)
+{
+    for (std::size_t i = 0; i < n * 4; i += 4) {
+        float a   = px[i + 3];
+        float inv = a > 0 ? 1 / (a > 0 ? a : 1.0f) : 0.0f;
+        px[i + 0] *= inv;
+        px[i + 1] *= inv;
+        px[i + 2] *= inv;
+    }
+}
+
+/** dst = src + dst * (1 - src alpha), both premultiplied */
+inline void
+blend_over_row(std::uint8_t const* src, std::uint8_t* dst, std::size_t n)
+{
+    std::size_t i = 0;
+#ifdef __SSE2__
+    __m128i const zero  = _mm_setzero_si128();
+    __m128i const alpha = _mm_set1_epi16(255);
+    auto          blend = [&](__m128i s, __m128i d) {
+        __m128i inv = _mm_sub_epi16(alpha, broadcast_alpha_sse2(s));
+        return _mm_add_epi16(s, mul_div_255_sse2(d, inv));
+    };
+    for (; i + 4 <= n; i += 4) {
+        __m128i s  = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i * 4));
+        __m128i d  = _mm_loadu_si128(reinterpret_cast<__m128i const*>(dst + i * 4));
+        __m128i lo = blend(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+        __m128i hi = blend(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; i < n; ++i) {
+        std::uint8_t const* s   = src + i * 4;
+        std::uint8_t*       d   = dst + i * 4;
+        unsigned            inv = 255u - s[3];
+        for (std::size_t c = 0; c < 4; ++c) {
+            unsigned v = s[c] + mul_div_255(d[c], inv);
+            d[c]       = static_cast<std::uint8_t>(std::min(v, 255u));
+        }
+    }
+}
+
+inline void
+blend_over_row(float const* src, float* dst, std::size_t n)
+{
+    for (std::size_t i = 0; i < n * 4; i += 4) {
+        float inv  = 1 - src[i + 3];
+        dst[i + 0] = src[i + 0] + dst[i + 0] * inv;
+        dst[i + 1] = src[i + 1] + dst[i + 1] * inv;
+        dst[i + 2] = src[i + 2] + dst[i + 2] * inv;
+        dst[i + 3] = src[i + 3] + dst[i + 3] * inv;
+    }
+}
+
+/**
+ * Call f(first_row, last_row) for ranges of image rows, the rows are split between threads
+ */
+template <typename Function>
+void
+for_each_rows(std::size_t width, std::size_t height, parallel_options opts, Function&& f)
+{
+    if (width == 0 || height == 0)
+        return;
+    opts.grain = width;
+    math::detail::parallel_for(width * height, opts, [&](std::size_t first, std::size_t last) {
+        f(first / width, last / width);
+    });
+}
+
+template <typename Src, typename Dst>
+void
+check_same_size(Src const& src, Dst const& dst)
+{
+    if (src.width() != dst.width() || src.height() != dst.height())
+        throw std::runtime_error{"Image sizes don't match"};
+}
+
+/**
+ * Apply a row kernel to a source and a destination image of the same size
+ */
+template <typename Src, typename Dst, typename Kernel>
+void
+transform_rows(Src const& src, Dst const& dst, parallel_options const& opts, Kernel&& kernel)
+{
+    check_same_size(src, dst);
+    if (src.contiguous() && dst.contiguous()) {
+        // Process the whole image as one row
+        math::detail::parallel_for(
+            src.width() * src.height(), opts, [&](std::size_t first, std::size_t last) {
+                kernel(src.data() + first * 4, dst.data() + first * 4, last - first);
+            });
+    } else {
+        for_each_rows(src.width(), src.height(), opts, [&](std::size_t first, std::size_t last) {
+            for (auto y = first; y < last; ++y) {
+                kernel(src.row_data(y), dst.row_data(y), src.width());
+            }
+        });
+    }
+}
+
+template <typename Image, typename Kernel>
+void
+transform_rows(Image const& img, parallel_options const& opts, Kernel&& kernel)
+{
+    for_each_rows(img.width(), img.height(), opts, [&](std::size_t first, std::size_t last) {
+        for (auto y = first; y < last; ++y) {
+            kernel(img.row_data(y), img.width());
+        }
+    });
+}
+
+}    // namespace detail
+
+//----------------------------------------------------------------------------
+//  Image operations
+//----------------------------------------------------------------------------
+//@{
+/** @name Conversion between 8-bit and floating point pixels */
+/**
+ * Convert 8-bit pixels to floating point, all channels are scaled to [0, 1]
+ */
+inline void
+unpack(rgba_hex_image_cref src, rgba_float_image dst, parallel_options const& opts = {})
+{
+    detail::transform_rows(src, dst, opts, &detail::unpack_row);
+}
+
+/**
+ * Convert floating point pixels to 8-bit, values are clamped to [0, 1] and rounded
+ */
+inline void
+pack(rgba_float_image_cref src, rgba_hex_image dst, parallel_options const& opts = {})
+{
+    detail::transform_rows(src, dst, opts, &detail::pack_row);
+}
+//@}
+
+//@{
+/** @name sRGB transfer with lookup tables, alpha is linear and is only scaled */
+/**
+ * Decode 8-bit sRGB pixels to linear floating point
+ */
+inline void
+srgb_to_linear(rgba_hex_image_cref src, rgba_float_image dst, parallel_options const& opts = {})
+{
+    auto const& tables = detail::get_srgb_tables();
+    detail::transform_rows(src, dst, opts,
+                           [&tables](std::uint8_t const* s, float* d, std::size_t n) {
+                               detail::srgb_to_linear_row(tables, s, d, n);
+                           });
+}
+
+/**
+ * Encode linear floating point pixels to 8-bit sRGB
+ */
+inline void
+linear_to_srgb(rgba_float_image_cref src, rgba_hex_image dst, parallel_options const& opts = {})
+{
+    auto const& tables = detail::get_srgb_tables();
+    detail::transform_rows(src, dst, opts,
+                           [&tables](float const* s, std::uint8_t* d, std::size_t n) {
+                               detail::linear_to_srgb_row(tables, s, d, n);
+                           });
+}
+//@}
+
+//@{
+/** @name Premultiplied alpha */
+inline void
+premultiply_alpha(rgba_hex_image img, parallel_options const& opts = {})
+{
+    detail::transform_rows(img, opts, [](std::uint8_t* p, std::size_t n) {
+        detail::premultiply_row(p, n);
+    });
+}
+
+inline void
+premultiply_alpha(rgba_float_image img, parallel_options const& opts = {})
+{
+    detail::transform_rows(img, opts, [](float* p, std::size_t n) {
+        detail::premultiply_row(p, n);
+    });
+}
+
+inline void
+unpremultiply_alpha(rgba_hex_image img, parallel_options const& opts = {})
+{
+    detail::transform_rows(img, opts, [](std::uint8_t* p, std::size_t n) {
+        detail::unpremultiply_row(p, n);
+    });
+}
+
+inline void
+unpremultiply_alpha(rgba_float_image img, parallel_options const& opts = {})
+{
+    detail::transform_rows(img, opts, [](float* p, std::size_t n) {
+        detail::unpremultiply_row(p, n);
+    });
+}
+//@}
+
+namespace detail {
+
+template <typename T, std::size_t Size, typename Components>
+void
+blend_over_at(image_view<T const, Size, Components> src, image_view<T, Size, Components> dst,
+              std::ptrdiff_t x, std::ptrdiff_t y, parallel_options const& opts)
+{
+    auto const src_x = static_cast<std::size_t>(std::max<std::ptrdiff_t>(0, -x));
+    auto const src_y = static_cast<std::size_t>(std::max<std::ptrdiff_t>(0, -y));
+    auto const dst_x = static_cast<std::size_t>(std::max<std::ptrdiff_t>(0, x));
+    auto const dst_y = static_cast<std::size_t>(std::max<std::ptrdiff_t>(0, y));
+    if (src_x >= src.width() || src_y >= src.height() || dst_x >= dst.width()
+        || dst_y >= dst.height())
+        return;
+    auto const width  = std::min(src.width() - src_x, dst.width() - dst_x);
+    auto const height = std::min(src.height() - src_y, dst.height() - dst_y);
+    transform_rows(src.subview(src_x, src_y, width, height),
+                   dst.subview(dst_x, dst_y, width, height), opts,
+                   [](T const* s, T* d, std::size_t n) { blend_over_row(s, d, n); });
+}
+
+}    // namespace detail
+
+//@{
+/**
+ * @name Source-over compositing of premultiplied images
+ *
+ * Draw the source image over the destination with the top left corner at (x, y), the source is
+ * clipped to the destination bounds.
+ */
+inline void
+blend_over(rgba_hex_image_cref src, rgba_hex_image dst, std::ptrdiff_t x, std::ptrdiff_t y,
+           parallel_options const& opts = {})
+{
+    detail::blend_over_at(src, dst, x, y, opts);
+}
+
+inline void
+blend_over(rgba_float_image_cref src, rgba_float_image dst, std::ptrdiff_t x, std::ptrdiff_t y,
+           parallel_options const& opts = {})
+{
+    detail::blend_over_at(src, dst, x, y, opts);
+}
+
+inline void
+blend_over(rgba_hex_image_cref src, rgba_hex_image dst, parallel_options const& opts = {})
+{
+    detail::check_same_size(src, dst);
+    detail::blend_over_at(src, dst, 0, 0, opts);
+}
+
+inline void
+blend_over(rgba_float_image_cref src, rgba_float_image dst, parallel_options const& opts = {})
+{
+    detail::check_same_size(src, dst);
+    detail::blend_over_at(src, dst, 0, 0, opts);
+}
+//@}
+
+}    // namespace color
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_IMAGE_HPP_ */
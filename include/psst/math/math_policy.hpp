@@ -0,0 +1,325 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * math_policy.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_MATH_POLICY_HPP_
+#define PSST_MATH_MATH_POLICY_HPP_
+
+#include <psst/math/detail/value_traits.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#endif
+
+/**
+ * Math policies choose how the expressions compute divisions by a scalar, normalization and
+ * sums of products. A policy is attached to a vector type, e.g. vector<float, 3, components::xyzw,
+ * fast_math>, or to a vector, matrix or scalar expression by expr::with_policy, and applies to the
+ * operations taking the vector or the expression as an argument:
+ *
+ *     auto n = normalize(expr::with_policy<fast_math>(v));
+ *     auto h = expr::with_policy<fast_math>(m) / w;
+ *
+ * An operation with arguments of different policies takes the first one that is not
+ * precise_math. Both policies can be used in one binary, e.g. fast ones for rendering and precise
+ * ones for physics, with the project compiled without -ffast-math, which would relax all of the
+ * floating point operations in the translation unit. The summation strategies in summation.hpp
+ * are policies as well.
+ */
+namespace psst {
+namespace math {
+
+namespace detail {
+
+//@{
+/** @name Real scalars and packs of real lanes, which divisions can be replaced for */
+template <typename T, typename = utils::void_t<>>
+struct has_real_values : std::is_floating_point<T> {};
+template <typename T>
+struct has_real_values<T, std::enable_if_t<traits::is_simd_pack_v<T>>>
+    : std::is_floating_point<typename T::value_type> {};
+template <typename T>
+constexpr bool has_real_values_v = has_real_values<std::decay_t<T>>::value;
+//@}
+
+//@{
+/**
+ * @name Types with a reciprocal square root function of their own, found by argument dependent
+ * lookup, e.g. fixed
+ */
+template <typename T, typename = utils::void_t<>>
+struct has_own_rsqrt : std::false_type {};
+template <typename T>
+struct has_own_rsqrt<T, utils::void_t<decltype(rsqrt(std::declval<T const&>()))>>
+    : std::true_type {};
+template <typename T>
+constexpr bool has_own_rsqrt_v = has_own_rsqrt<T>::value;
+
+template <typename T>
+T
+own_rsqrt(T const& v)
+{
+    return rsqrt(v);
+}
+//@}
+
+/**
+ * Reciprocal square root of a positive float. On x86 the estimate instruction, within 4e-4,
+ * refined by a Newton step gives the relative error within 3e-7, elsewhere it is 1 / sqrt(x).
+ */
+inline float
+approximate_rsqrt(float x)
+{
+#if defined(__SSE__) || defined(_M_X64)
+    float const y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+    return y * (1.5f - 0.5f * x * y * y);
+#else
+    using std::sqrt;
+    return 1 / sqrt(x);
+#endif
+}
+
+/**
+ * Sum of the terms as the right fold t0 + (t1 + (... + tn)) of the expressions, the last terms are
+ * added first. Terms are pairs of factors, the lhs<N>() and rhs<N>() members of the terms object,
+ * accumulated by the multiply-add of the math policy.
+ */
+template <typename MathPolicy, typename T, typename Terms, std::size_t First,
+          std::size_t... Indexes>
+constexpr T
+sequential_sum(Terms const& terms, std::index_sequence<First, Indexes...>)
+{
+    if constexpr (sizeof...(Indexes) == 0) {
+        return terms.template lhs<First>() * terms.template rhs<First>();
+    } else {
+        return MathPolicy::multiply_add(
+            terms.template lhs<First>(), terms.template rhs<First>(),
+            sequential_sum<MathPolicy, T>(terms, std::index_sequence<Indexes...>{}));
+    }
+}
+
+}    // namespace detail
+
+/**
+ * The operations as written, a division by a scalar divides each component and normalization
+ * divides by the magnitude. Contraction of multiplications and additions is left to the
+ * compiler, GCC and Clang don't contract in the ISO C++ modes. Sums are accumulated in the type
+ * of the values.
+ */
+struct precise_math {
+    static constexpr bool multiply_by_reciprocal = false;
+
+    template <typename T>
+    using accumulator_type = T;
+
+    template <typename T, typename U>
+    static constexpr auto
+    divide(T const& lhs, U const& rhs)
+    {
+        return lhs / rhs;
+    }
+
+    /** 1 / sqrt(v), or the rsqrt function of the type */
+    template <typename T>
+    static T
+    rsqrt(T const& v)
+    {
+        if constexpr (detail::has_own_rsqrt_v<T>) {
+            return detail::own_rsqrt(v);
+        } else {
+            using std::sqrt;
+            return T{1} / sqrt(v);
+        }
+    }
+
+    template <typename T>
+    static constexpr T
+    multiply_add(T const& a, T const& b, T const& c)
+    {
+        return a * b + c;
+    }
+
+    template <typename T, typename Terms, std::size_t... Indexes>
+    static constexpr T
+    sum_of_products(Terms const& terms, std::index_sequence<Indexes...> indexes)
+    {
+        return detail::sequential_sum<precise_math, T>(terms, indexes);
+    }
+};
+
+/**
+ * Divisions of real values by a scalar multiply by its reciprocal and normalization multiplies by
+ * the reciprocal square root of the squared magnitude, approximate for float. Sums of products
+ * are fused when the target has an FMA instruction. The results differ from the precise ones in
+ * the last bits, normalized float vectors are within 5e-7 of the unit length.
+ */
+struct fast_math {
+    static constexpr bool multiply_by_reciprocal = true;
+
+    template <typename T>
+    using accumulator_type = T;
+
+    template <typename T, typename U>
+    static constexpr auto
+    divide(T const& lhs, U const& rhs)
+    {
+        if constexpr (detail::has_real_values_v<U>) {
+            return lhs * (U{1} / rhs);
+        } else {
+            return lhs / rhs;
+        }
+    }
+
+    template <typename T>
+    static T
+    rsqrt(T const& v)
+    {
+        if constexpr (std::is_same<T, float>{}) {
+            return detail::approximate_rsqrt(v);
+        } else {
+            return precise_math::rsqrt(v);
+        }
+    }
+
+    template <typename T>
+    static constexpr T
+    multiply_add(T const& a, T const& b, T const& c)
+    {
+#if defined(FP_FAST_FMAF)
+        if constexpr (std::is_same<T, float>{}) {
+            return std::fma(a, b, c);
+        }
+#endif
+#if defined(FP_FAST_FMA)
+        if constexpr (std::is_same<T, double>{}) {
+            return std::fma(a, b, c);
+        }
+#endif
+        return a * b + c;
+    }
+
+    template <typename T, typename Terms, std::size_t... Indexes>
+    static constexpr T
+    sum_of_products(Terms const& terms, std::index_sequence<Indexes...> indexes)
+    {
+        return detail::sequential_sum<fast_math, T>(terms, indexes);
+    }
+};
+
+//@{
+/**
+ * @name Accumulator for sums of values of a type in wide_accumulation, the type itself unless
+ * specialised
+ */
+namespace traits {
+
+template <typename T>
+struct wide_accumulator {
+    using type = T;
+};
+template <>
+struct wide_accumulator<float> {
+    using type = double;
+};
+template <>
+struct wide_accumulator<std::int8_t> {
+    using type = std::int32_t;
+};
+template <>
+struct wide_accumulator<std::uint8_t> {
+    using type = std::uint32_t;
+};
+template <>
+struct wide_accumulator<std::int16_t> {
+    using type = std::int32_t;
+};
+template <>
+struct wide_accumulator<std::uint16_t> {
+    using type = std::uint32_t;
+};
+template <>
+struct wide_accumulator<std::int32_t> {
+    using type = std::int64_t;
+};
+template <>
+struct wide_accumulator<std::uint32_t> {
+    using type = std::uint64_t;
+};
+template <typename T>
+using wide_accumulator_t = typename wide_accumulator<T>::type;
+
+}    // namespace traits
+//@}
+
+/**
+ * Dot products, magnitudes, element sums and matrix products of the values stored in a narrow
+ * type are accumulated in a wider one, e.g. float in double and 8 bit integers in 32 bit ones, the
+ * other operations are of the underlying policy. The dot products and magnitudes are of the
+ * accumulator type, the elements of matrix products are rounded to the type of the matrix.
+ *
+ *     double d = dot(expr::with_policy<wide_accumulation<>>(a), b);
+ */
+template <typename MathPolicy = precise_math>
+struct wide_accumulation : MathPolicy {
+    template <typename T>
+    using accumulator_type = traits::wide_accumulator_t<T>;
+};
+
+//@{
+/** @name Math policy of a type, the nested math_policy or precise_math */
+namespace traits {
+
+template <typename T, typename = utils::void_t<>>
+struct math_policy {
+    using type = precise_math;
+};
+template <typename T>
+struct math_policy<T, utils::void_t<typename std::decay_t<T>::math_policy>> {
+    using type = typename std::decay_t<T>::math_policy;
+};
+template <typename T>
+using math_policy_t = typename math_policy<T>::type;
+
+/** The first policy of the arguments that is not precise_math */
+template <typename... T>
+struct common_math_policy {
+    using type = precise_math;
+};
+template <typename T, typename... Y>
+struct common_math_policy<T, Y...> {
+    using type = std::conditional_t<std::is_same<math_policy_t<T>, precise_math>{},
+                                    typename common_math_policy<Y...>::type, math_policy_t<T>>;
+};
+template <typename... T>
+using common_math_policy_t = typename common_math_policy<T...>::type;
+
+namespace detail {
+template <typename MathPolicy, typename T>
+using policy_accumulator_t = arithmetic_type_t<
+    typename MathPolicy::template accumulator_type<scalar_expression_result_t<T>>>;
+}    // namespace detail
+
+/**
+ * Type of the sums of the products of the values of the arguments accumulated by their math
+ * policy, at least the type the arithmetic on the values is done in
+ */
+template <typename... T>
+using accumulator_t
+    = utils::most_precise_type_t<detail::policy_accumulator_t<common_math_policy_t<T...>, T>...>;
+
+}    // namespace traits
+//@}
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_MATH_POLICY_HPP_ */
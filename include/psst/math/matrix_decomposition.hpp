@@ -0,0 +1,560 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * matrix_decomposition.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_MATRIX_DECOMPOSITION_HPP_
+#define PSST_MATH_MATRIX_DECOMPOSITION_HPP_
+
+#include <psst/math/matrix.hpp>
+#include <psst/math/parallel.hpp>
+#include <psst/math/structured_matrix.hpp>
+#include <psst/math/vector.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Factorizations of fixed size matrices, computed once and reused to solve systems with any
+ * number of right hand sides:
+ *   - lu_decomposition<T, N>, P * a = L * U with partial pivoting, for any non-singular matrix;
+ *   - cholesky_decomposition<T, N>, a = L * transpose(L), for a symmetric positive definite
+ *     matrix, half the work of LU;
+ *   - householder_qr<T, R, C>, a = Q * R by Householder reflections, for R >= C. solve gives
+ *     the least squares solution of an overdetermined system.
+ *
+ * The sizes are known at compile time, the loops of the kernels have constant bounds and are
+ * unrolled by the compiler for small matrices. The reciprocals of the diagonal are stored with
+ * the factors, a solution takes no divisions.
+ *
+ *     lu_decomposition lu{a};
+ *     vector<float, 4> x = lu.solve(b);
+ *     matrix<float, 4, 3> y = lu.solve(c);    // three right hand sides
+ *     lu.solve(rhs.data(), res.data(), rhs.size());    // a batch, split between threads
+ *
+ * The constructors throw std::runtime_error if the matrix cannot be factored: a singular matrix
+ * for LU, a matrix that is not positive definite for Cholesky, a matrix of a lower rank for QR.
+ * Only exact zeros are detected, a nearly singular matrix gives an inaccurate solution.
+ */
+namespace psst {
+namespace math {
+
+namespace detail {
+
+//@{
+/** @name Right hand sides of a system, a vector is a single column */
+template <typename T>
+struct rhs_traits;
+
+template <typename T, std::size_t N, typename Components>
+struct rhs_traits<vector<T, N, Components>> {
+    static constexpr std::size_t rows = N;
+    static constexpr std::size_t cols = 1;
+
+    static T&
+    element(vector<T, N, Components>& v, std::size_t r, std::size_t)
+    {
+        return v[r];
+    }
+};
+
+template <typename T, std::size_t R, std::size_t C, typename Components>
+struct rhs_traits<matrix<T, R, C, Components>> {
+    static constexpr std::size_t rows = R;
+    static constexpr std::size_t cols = C;
+
+    static T&
+    element(matrix<T, R, C, Components>& m, std::size_t r, std::size_t c)
+    {
+        return m[r][c];
+    }
+};
+//@}
+
+template <typename Decomposition, typename Vector, typename Result>
+void
+solve_batch(Decomposition const& d, Vector const* b, Result* x, std::size_t count,
+            parallel_options const& opts)
+{
+    parallel_for(count, opts, [&](std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            x[i] = d.solve(b[i]);
+        }
+    });
+}
+
+}    // namespace detail
+
+/**
+ * LU decomposition with partial pivoting, P * a = L * U. L has a unit diagonal and is stored
+ * below the diagonal of U.
+ */
+template <typename T, std::size_t N>
+struct lu_decomposition {
+    using value_type  = T;
+    using matrix_type = matrix<T, N, N>;
+    using vector_type = vector<T, N>;
+
+    static constexpr std::size_t size = N;
+
+    template <typename Expr, typename = traits::enable_if_matrix_expression<Expr>>
+    explicit lu_decomposition(Expr&& a) : lu_(std::forward<Expr>(a))
+    {
+        static_assert(std::decay_t<Expr>::rows == N && std::decay_t<Expr>::cols == N,
+                      "The matrix must be of the decomposition size");
+        using std::abs;
+        for (std::size_t i = 0; i < N; ++i) {
+            permutation_[i] = i;
+        }
+        for (std::size_t k = 0; k < N; ++k) {
+            auto pivot = k;
+            for (auto i = k + 1; i < N; ++i) {
+                if (abs(lu_[i][k]) > abs(lu_[pivot][k]))
+                    pivot = i;
+            }
+            if (lu_[pivot][k] == value_type{})
+                throw std::runtime_error{"The matrix is singular"};
+            if (pivot != k) {
+                std::swap(lu_[pivot], lu_[k]);
+                std::swap(permutation_[pivot], permutation_[k]);
+                odd_permutation_ = !odd_permutation_;
+            }
+            inv_diagonal_[k] = value_type{1} / lu_[k][k];
+            for (auto i = k + 1; i < N; ++i) {
+                auto const l = lu_[i][k] * inv_diagonal_[k];
+                lu_[i][k]    = l;
+                for (auto j = k + 1; j < N; ++j) {
+                    lu_[i][j] -= l * lu_[k][j];
+                }
+            }
+        }
+    }
+
+    //@{
+    /** @name Solutions of a * x = b */
+    template <typename Vector, typename = traits::enable_if_vector_expression<Vector>>
+    vector_type
+    solve(Vector const& b) const
+    {
+        static_assert(std::decay_t<Vector>::size == N, "The vector must be of the matrix size");
+        vector_type x;
+        permute(vector_type{b}, x);
+        solve_in_place(x);
+        return x;
+    }
+    /** A column of the result for a column of b */
+    template <typename Matrix, typename = traits::enable_if_matrix_expression<Matrix>,
+              typename = void>
+    matrix<T, N, std::decay_t<Matrix>::cols>
+    solve(Matrix const& b) const
+    {
+        using result_type = matrix<T, N, std::decay_t<Matrix>::cols>;
+        static_assert(std::decay_t<Matrix>::rows == N, "The matrix must be of the matrix size");
+        result_type x;
+        permute(result_type{b}, x);
+        solve_in_place(x);
+        return x;
+    }
+    /** Solutions for count right hand sides, split between threads */
+    void
+    solve(vector_type const* b, vector_type* x, std::size_t count,
+          parallel_options const& opts = {}) const
+    {
+        detail::solve_batch(*this, b, x, count, opts);
+    }
+    //@}
+
+    value_type
+    determinant() const
+    {
+        value_type res{1};
+        for (std::size_t i = 0; i < N; ++i) {
+            res *= lu_[i][i];
+        }
+        return odd_permutation_ ? -res : res;
+    }
+    matrix_type
+    inverse() const
+    {
+        return solve(matrix_type::identity());
+    }
+
+    //@{
+    /** @name The factors */
+    lower_triangular_matrix<T, N>
+    lower() const
+    {
+        lower_triangular_matrix<T, N> res{lu_};
+        for (std::size_t i = 0; i < N; ++i) {
+            res.data()[i * (i + 3) / 2] = value_type{1};
+        }
+        return res;
+    }
+    upper_triangular_matrix<T, N>
+    upper() const
+    {
+        return lu_;
+    }
+    /** Row i of P * a is the row permutation()[i] of a */
+    std::array<std::size_t, N> const&
+    permutation() const
+    {
+        return permutation_;
+    }
+    //@}
+private:
+    template <typename Rhs>
+    void
+    permute(Rhs const& b, Rhs& x) const
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            x[i] = b[permutation_[i]];
+        }
+    }
+
+    template <typename Rhs>
+    void
+    solve_in_place(Rhs& x) const
+    {
+        using rhs = detail::rhs_traits<Rhs>;
+        for (std::size_t c = 0; c < rhs::cols; ++c) {
+            // L * y = P * b
+            for (std::size_t i = 1; i < N; ++i) {
+                auto s = rhs::element(x, i, c);
+                for (std::size_t j = 0; j < i; ++j) {
+                    s -= lu_[i][j] * rhs::element(x, j, c);
+                }
+                rhs::element(x, i, c) = s;
+            }
+            // U * x = y
+            for (auto i = N; i-- > 0;) {
+                auto s = rhs::element(x, i, c);
+                for (auto j = i + 1; j < N; ++j) {
+                    s -= lu_[i][j] * rhs::element(x, j, c);
+                }
+                rhs::element(x, i, c) = s * inv_diagonal_[i];
+            }
+        }
+    }
+
+    matrix_type                lu_;
+    std::array<value_type, N>  inv_diagonal_;
+    std::array<std::size_t, N> permutation_;
+    bool                       odd_permutation_ = false;
+};
+
+/**
+ * Cholesky decomposition a = L * transpose(L) of a symmetric positive definite matrix. Only the
+ * lower triangle of a is read.
+ */
+template <typename T, std::size_t N>
+struct cholesky_decomposition {
+    using value_type  = T;
+    using matrix_type = matrix<T, N, N>;
+    using vector_type = vector<T, N>;
+    using lower_type  = lower_triangular_matrix<T, N>;
+
+    static constexpr std::size_t size = N;
+
+    template <typename Expr, typename = traits::enable_if_matrix_expression<Expr>>
+    explicit cholesky_decomposition(Expr&& a) : l_(std::forward<Expr>(a))
+    {
+        static_assert(std::decay_t<Expr>::rows == N && std::decay_t<Expr>::cols == N,
+                      "The matrix must be of the decomposition size");
+        using std::sqrt;
+        for (std::size_t j = 0; j < N; ++j) {
+            auto d = element(j, j);
+            for (std::size_t k = 0; k < j; ++k) {
+                d -= element(j, k) * element(j, k);
+            }
+            if (!(d > value_type{}))
+                throw std::runtime_error{"The matrix is not positive definite"};
+            element(j, j)    = sqrt(d);
+            inv_diagonal_[j] = value_type{1} / element(j, j);
+            for (auto i = j + 1; i < N; ++i) {
+                auto s = element(i, j);
+                for (std::size_t k = 0; k < j; ++k) {
+                    s -= element(i, k) * element(j, k);
+                }
+                element(i, j) = s * inv_diagonal_[j];
+            }
+        }
+    }
+
+    //@{
+    /** @name Solutions of a * x = b */
+    template <typename Vector, typename = traits::enable_if_vector_expression<Vector>>
+    vector_type
+    solve(Vector const& b) const
+    {
+        static_assert(std::decay_t<Vector>::size == N, "The vector must be of the matrix size");
+        vector_type x{b};
+        solve_in_place(x);
+        return x;
+    }
+    /** A column of the result for a column of b */
+    template <typename Matrix, typename = traits::enable_if_matrix_expression<Matrix>,
+              typename = void>
+    matrix<T, N, std::decay_t<Matrix>::cols>
+    solve(Matrix const& b) const
+    {
+        static_assert(std::decay_t<Matrix>::rows == N, "The matrix must be of the matrix size");
+        matrix<T, N, std::decay_t<Matrix>::cols> x{b};
+        solve_in_place(x);
+        return x;
+    }
+    /** Solutions for count right hand sides, split between threads */
+    void
+    solve(vector_type const* b, vector_type* x, std::size_t count,
+          parallel_options const& opts = {}) const
+    {
+        detail::solve_batch(*this, b, x, count, opts);
+    }
+    //@}
+
+    value_type
+    determinant() const
+    {
+        value_type res{1};
+        for (std::size_t i = 0; i < N; ++i) {
+            res *= element(i, i);
+        }
+        return res * res;
+    }
+    matrix_type
+    inverse() const
+    {
+        return solve(matrix_type::identity());
+    }
+
+    lower_type const&
+    lower() const
+    {
+        return l_;
+    }
+
+private:
+    // The packed elements of L, j <= i
+    value_type&
+    element(std::size_t i, std::size_t j)
+    {
+        return l_.data()[i * (i + 1) / 2 + j];
+    }
+    value_type const&
+    element(std::size_t i, std::size_t j) const
+    {
+        return l_.data()[i * (i + 1) / 2 + j];
+    }
+
+    template <typename Rhs>
+    void
+    solve_in_place(Rhs& x) const
+    {
+        using rhs = detail::rhs_traits<Rhs>;
+        for (std::size_t c = 0; c < rhs::cols; ++c) {
+            // L * y = b
+            for (std::size_t i = 0; i < N; ++i) {
+                auto s = rhs::element(x, i, c);
+                for (std::size_t j = 0; j < i; ++j) {
+                    s -= element(i, j) * rhs::element(x, j, c);
+                }
+                rhs::element(x, i, c) = s * inv_diagonal_[i];
+            }
+            // transpose(L) * x = y
+            for (auto i = N; i-- > 0;) {
+                auto s = rhs::element(x, i, c);
+                for (auto j = i + 1; j < N; ++j) {
+                    s -= element(j, i) * rhs::element(x, j, c);
+                }
+                rhs::element(x, i, c) = s * inv_diagonal_[i];
+            }
+        }
+    }
+
+    lower_type                l_;
+    std::array<value_type, N> inv_diagonal_;
+};
+
+/**
+ * QR decomposition a = Q * R of an R x C matrix, R >= C, by C Householder reflections. The
+ * reflection vectors are stored below the diagonal of R. solve gives the x minimizing
+ * |a * x - b|, the exact solution for a square matrix.
+ */
+template <typename T, std::size_t Rows, std::size_t Cols = Rows>
+struct householder_qr {
+    static_assert(Rows >= Cols, "QR decomposition requires at least as many rows as columns");
+
+    using value_type  = T;
+    using matrix_type = matrix<T, Rows, Cols>;
+    using vector_type = vector<T, Rows>;
+    using result_type = vector<T, Cols>;
+
+    static constexpr std::size_t rows = Rows;
+    static constexpr std::size_t cols = Cols;
+
+    template <typename Expr, typename = traits::enable_if_matrix_expression<Expr>>
+    explicit householder_qr(Expr&& a) : qr_(std::forward<Expr>(a))
+    {
+        static_assert(std::decay_t<Expr>::rows == Rows && std::decay_t<Expr>::cols == Cols,
+                      "The matrix must be of the decomposition size");
+        using std::sqrt;
+        for (std::size_t k = 0; k < Cols; ++k) {
+            value_type norm{};
+            for (auto i = k; i < Rows; ++i) {
+                norm += qr_[i][k] * qr_[i][k];
+            }
+            if (norm == value_type{})
+                throw std::runtime_error{"The matrix is rank deficient"};
+            norm = sqrt(norm);
+            // Reflect the column to beta * e_k, the sign avoids cancellation
+            auto const x0   = qr_[k][k];
+            auto const beta = x0 > value_type{} ? -norm : norm;
+            tau_[k]         = (beta - x0) / beta;
+            auto const inv  = value_type{1} / (x0 - beta);
+            for (auto i = k + 1; i < Rows; ++i) {
+                qr_[i][k] *= inv;
+            }
+            qr_[k][k]        = beta;
+            inv_diagonal_[k] = value_type{1} / beta;
+            for (auto j = k + 1; j < Cols; ++j) {
+                auto s = qr_[k][j];
+                for (auto i = k + 1; i < Rows; ++i) {
+                    s += qr_[i][k] * qr_[i][j];
+                }
+                s *= tau_[k];
+                qr_[k][j] -= s;
+                for (auto i = k + 1; i < Rows; ++i) {
+                    qr_[i][j] -= s * qr_[i][k];
+                }
+            }
+        }
+    }
+
+    //@{
+    /** @name Least squares solutions of a * x = b */
+    template <typename Vector, typename = traits::enable_if_vector_expression<Vector>>
+    result_type
+    solve(Vector const& b) const
+    {
+        static_assert(std::decay_t<Vector>::size == Rows, "The vector must have a row count size");
+        vector_type y{b};
+        solve_in_place(y);
+        return result_type{y};
+    }
+    /** A column of the result for a column of b */
+    template <typename Matrix, typename = traits::enable_if_matrix_expression<Matrix>,
+              typename = void>
+    matrix<T, Cols, std::decay_t<Matrix>::cols>
+    solve(Matrix const& b) const
+    {
+        static_assert(std::decay_t<Matrix>::rows == Rows, "The matrix must have the row count");
+        matrix<T, Rows, std::decay_t<Matrix>::cols> y{b};
+        solve_in_place(y);
+        return y;
+    }
+    /** Solutions for count right hand sides, split between threads */
+    void
+    solve(vector_type const* b, result_type* x, std::size_t count,
+          parallel_options const& opts = {}) const
+    {
+        detail::solve_batch(*this, b, x, count, opts);
+    }
+    //@}
+
+    //@{
+    /** @name The factors */
+    /** The first Cols columns of the orthogonal matrix Q */
+    matrix_type
+    q() const
+    {
+        matrix_type res;
+        for (std::size_t i = 0; i < Cols; ++i) {
+            res[i][i] = value_type{1};
+        }
+        for (auto k = Cols; k-- > 0;) {
+            for (auto j = k; j < Cols; ++j) {
+                auto s = res[k][j];
+                for (auto i = k + 1; i < Rows; ++i) {
+                    s += qr_[i][k] * res[i][j];
+                }
+                s *= tau_[k];
+                res[k][j] -= s;
+                for (auto i = k + 1; i < Rows; ++i) {
+                    res[i][j] -= s * qr_[i][k];
+                }
+            }
+        }
+        return res;
+    }
+    upper_triangular_matrix<T, Cols>
+    r() const
+    {
+        upper_triangular_matrix<T, Cols> res;
+        auto*                            p = res.data();
+        for (std::size_t i = 0; i < Cols; ++i) {
+            for (auto j = i; j < Cols; ++j) {
+                *p++ = qr_[i][j];
+            }
+        }
+        return res;
+    }
+    //@}
+private:
+    template <typename Rhs>
+    void
+    solve_in_place(Rhs& x) const
+    {
+        using rhs = detail::rhs_traits<Rhs>;
+        for (std::size_t c = 0; c < rhs::cols; ++c) {
+            // transpose(Q) * b
+            for (std::size_t k = 0; k < Cols; ++k) {
+                auto s = rhs::element(x, k, c);
+                for (auto i = k + 1; i < Rows; ++i) {
+                    s += qr_[i][k] * rhs::element(x, i, c);
+                }
+                s *= tau_[k];
+                rhs::element(x, k, c) -= s;
+                for (auto i = k + 1; i < Rows; ++i) {
+                    rhs::element(x, i, c) -= s * qr_[i][k];
+                }
+            }
+            // R * x = transpose(Q) * b
+            for (auto i = Cols; i-- > 0;) {
+                auto s = rhs::element(x, i, c);
+                for (auto j = i + 1; j < Cols; ++j) {
+                    s -= qr_[i][j] * rhs::element(x, j, c);
+                }
+                rhs::element(x, i, c) = s * inv_diagonal_[i];
+            }
+        }
+    }
+
+    matrix_type                  qr_;
+    std::array<value_type, Cols> tau_;
+    std::array<value_type, Cols> inv_diagonal_;
+};
+
+//@{
+/** @name Deduction of the decomposition types from a matrix expression */
+template <typename Expr, typename = traits::enable_if_matrix_expression<Expr>>
+lu_decomposition(Expr&&)
+    -> lu_decomposition<typename std::decay_t<Expr>::value_type, std::decay_t<Expr>::rows>;
+template <typename Expr, typename = traits::enable_if_matrix_expression<Expr>>
+cholesky_decomposition(Expr&&)
+    -> cholesky_decomposition<typename std::decay_t<Expr>::value_type, std::decay_t<Expr>::rows>;
+template <typename Expr, typename = traits::enable_if_matrix_expression<Expr>>
+householder_qr(Expr&&) -> householder_qr<typename std::decay_t<Expr>::value_type,
+                                         std::decay_t<Expr>::rows, std::decay_t<Expr>::cols>;
+//@}
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_MATRIX_DECOMPOSITION_HPP_ */
@@ -0,0 +1,150 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * matrix_format.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_MATRIX_FORMAT_HPP_
+#define PSST_MATH_MATRIX_FORMAT_HPP_
+
+#include <psst/math/matrix.hpp>
+#include <psst/math/vector_format.hpp>
+
+namespace psst {
+namespace math {
+namespace io {
+
+namespace detail {
+
+template <typename Row>
+char*
+put_row(char* p, char* last, Row const& r, text_format const& fmt, bool delim)
+{
+    if (delim)
+        p = put_char(p, last, fmt.delim);
+    if (fmt.pretty)
+        p = put_string(put_string(p, last, fmt.row_sep), last, fmt.offset);
+    return put_vector(p, last, r, fmt);
+}
+
+/**
+ * Write the matrix with the same layout as operator<< produces
+ */
+template <typename Matrix, std::size_t... RI>
+char*
+put_matrix(char* p, char* last, Matrix const& m, text_format const& fmt, std::index_sequence<RI...>)
+{
+    p = put_char(p, last, fmt.start);
+    if (fmt.pretty)
+        p = put_string(put_string(p, last, fmt.row_sep), last, fmt.offset);
+    ((p = put_row(p, last, expr::row<RI>(m), fmt, RI > 0)), ...);
+    if (fmt.pretty)
+        p = put_string(p, last, fmt.row_sep);
+    return put_char(p, last, fmt.end);
+}
+
+template <typename Matrix>
+char*
+put_matrix(char* p, char* last, Matrix const& m, text_format const& fmt)
+{
+    return put_matrix(p, last, m, fmt, typename Matrix::row_indexes_type{});
+}
+
+/**
+ * Upper bound of characters needed to format a matrix
+ */
+template <typename Matrix>
+std::size_t
+max_matrix_chars(text_format const& fmt)
+{
+    using row_type = typename Matrix::row_type;
+    return 2 + fmt.row_sep.size() * 2 + fmt.offset.size()
+           + Matrix::rows
+                 * (1 + fmt.row_sep.size() + fmt.offset.size()
+                    + max_vector_chars<row_type>(fmt));
+}
+
+}    // namespace detail
+
+/**
+ * Format a matrix to a character buffer without using iostreams.
+ * The layout is the same as operator<< produces for the same settings, the values are formatted
+ * as in format_vector.
+ */
+template <typename Matrix, typename = traits::enable_if_matrix_expression<Matrix>>
+format_result
+format_matrix(char* first, char* last, Matrix const& m, text_format const& fmt = {})
+{
+    auto p = detail::put_matrix(first, last, m, fmt);
+    if (!p)
+        return {last, std::errc::value_too_large};
+    return {p, std::errc{}};
+}
+
+/**
+ * Append a formatted matrix to a string
+ */
+template <typename Matrix, typename = traits::enable_if_matrix_expression<Matrix>>
+void
+format_matrix(std::string& out, Matrix const& m, text_format const& fmt = {})
+{
+    auto pos = out.size();
+    out.resize(pos + detail::max_matrix_chars<Matrix>(fmt));
+    auto p = detail::put_matrix(&out[pos], &out[0] + out.size(), m, fmt);
+    assert(p && "Formatted text exceeds the estimated size");
+    out.resize(p - out.data());
+}
+
+template <typename Matrix, typename = traits::enable_if_matrix_expression<Matrix>,
+          typename = void>
+std::string
+to_string(Matrix const& m, text_format const& fmt = {})
+{
+    std::string str;
+    format_matrix(str, m, fmt);
+    return str;
+}
+
+/**
+ * Format a range of matrices to a character buffer.
+ * Each matrix is followed by the row separator of the format.
+ */
+template <typename Range,
+          typename = traits::enable_if_matrix_expression<detail::range_value_t<Range>>>
+format_result
+format_matrices(char* first, char* last, Range const& matrices, text_format const& fmt = {})
+{
+    auto p = first;
+    for (auto const& m : matrices) {
+        p = detail::put_string(detail::put_matrix(p, last, m, fmt), last, fmt.row_sep);
+        if (!p)
+            return {last, std::errc::value_too_large};
+    }
+    return {p, std::errc{}};
+}
+
+/**
+ * Append a range of matrices to a string.
+ * Each matrix is followed by the row separator of the format.
+ */
+template <typename Range,
+          typename = traits::enable_if_matrix_expression<detail::range_value_t<Range>>>
+void
+format_matrices(std::string& out, Range const& matrices, text_format const& fmt = {})
+{
+    using matrix_type = detail::range_value_t<Range>;
+    detail::append_formatted(
+        out, std::begin(matrices), std::end(matrices),
+        detail::max_matrix_chars<matrix_type>(fmt) + fmt.row_sep.size(),
+        [&fmt](char* p, char* last, auto const& m) {
+            return detail::put_string(detail::put_matrix(p, last, m, fmt), last, fmt.row_sep);
+        });
+}
+
+}    // namespace io
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_MATRIX_FORMAT_HPP_ */
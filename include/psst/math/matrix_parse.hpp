@@ -0,0 +1,124 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * matrix_parse.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_MATRIX_PARSE_HPP_
+#define PSST_MATH_MATRIX_PARSE_HPP_
+
+#include <psst/math/matrix.hpp>
+#include <psst/math/vector_parse.hpp>
+
+namespace psst {
+namespace math {
+namespace io {
+
+namespace detail {
+
+/**
+ * Parse RC rows of CC values each, the rows are enclosed in braces and separated by the
+ * delimiter, the same way as operator<< outputs a matrix.
+ */
+template <std::size_t RC, std::size_t CC, typename T>
+parse_result
+parse_matrix_values(char const* first, char const* last, T* values, text_format const& fmt)
+{
+    auto p = expect_char(first, last, fmt.start);
+    if (!p)
+        return {skip_space(first, last), std::errc::invalid_argument, 0};
+    for (std::size_t r = 0; r < RC; ++r) {
+        if (r > 0) {
+            auto d = expect_char(p, last, fmt.delim);
+            if (!d)
+                return {skip_space(p, last), std::errc::invalid_argument, 0};
+            p = d;
+        }
+        auto res = parse_values<CC>(p, last, values + r * CC, fmt);
+        if (!res)
+            return res;
+        p = res.ptr;
+    }
+    auto e = expect_char(p, last, fmt.end);
+    if (!e)
+        return {skip_space(p, last), std::errc::invalid_argument, 0};
+    return {e, std::errc{}, 1};
+}
+
+}    // namespace detail
+
+/**
+ * Parse a matrix from a character buffer without using iostreams.
+ * The matrix is not modified if the parsing fails.
+ */
+template <typename T, std::size_t RC, std::size_t CC, typename Components>
+parse_result
+parse_matrix(char const* first, char const* last, matrix<T, RC, CC, Components>& m,
+             text_format const& fmt = {})
+{
+    using matrix_type = matrix<T, RC, CC, Components>;
+    T    values[RC * CC];
+    auto res = detail::parse_matrix_values<RC, CC>(first, last, values, fmt);
+    if (res)
+        m = matrix_type{values};
+    return res;
+}
+
+template <typename Matrix>
+parse_result
+parse_matrix(std::string_view str, Matrix& m, text_format const& fmt = {})
+{
+    return parse_matrix(str.data(), str.data() + str.size(), m, fmt);
+}
+
+/**
+ * Parse all matrices from a character buffer and append them to a container.
+ * Matrices can be separated by whitespace and/or by the delimiter.
+ */
+template <typename Container, typename = traits::enable_if_matrix<typename Container::value_type>>
+parse_result
+parse_matrices(char const* first, char const* last, Container& out, text_format const& fmt = {})
+{
+    using matrix_type = typename Container::value_type;
+    using value_type  = typename matrix_type::value_type;
+    constexpr auto rows = matrix_type::rows;
+    constexpr auto cols = matrix_type::cols;
+
+    struct sink {
+        Container&  out;
+        value_type* values;
+        bool
+        want_more(std::size_t) const
+        {
+            return true;
+        }
+        void
+        put(std::size_t)
+        {
+            out.push_back(matrix_type{values});
+        }
+    };
+
+    value_type values[rows * cols];
+    return detail::parse_sequence(first, last, fmt,
+                                  [&](char const* f, char const* l) {
+                                      return detail::parse_matrix_values<rows, cols>(f, l, values,
+                                                                                     fmt);
+                                  },
+                                  sink{out, values});
+}
+
+template <typename Container>
+parse_result
+parse_matrices(std::string_view str, Container& out, text_format const& fmt = {})
+{
+    return parse_matrices(str.data(), str.data() + str.size(), out, fmt);
+}
+
+}    // namespace io
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_MATRIX_PARSE_HPP_ */
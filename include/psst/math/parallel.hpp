@@ -0,0 +1,123 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * parallel.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_PARALLEL_HPP_
+#define PSST_MATH_PARALLEL_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace psst {
+namespace math {
+
+/**
+ * Options for splitting batch operations between threads
+ */
+struct parallel_options {
+    /** Maximum number of threads, 0 means std::thread::hardware_concurrency */
+    std::size_t thread_count = 0;
+    /**
+     * Work is split between threads in multiples of this number of elements, e.g. the width of an
+     * image row
+     */
+    std::size_t grain = 1;
+    /** Minimum number of elements worth starting a thread for */
+    std::size_t min_chunk = 1 << 14;
+
+    /** Options for running in the calling thread only */
+    static constexpr parallel_options
+    single_thread()
+    {
+        return {1, 1, 0};
+    }
+};
+
+namespace detail {
+
+/** Number of hardware threads, queried once as the query is a system call */
+inline std::size_t
+hardware_thread_count()
+{
+    static std::size_t const count = std::max(1u, std::thread::hardware_concurrency());
+    return count;
+}
+
+/**
+ * Split the range [0, count) into contiguous chunks and call f(first, last) for each of them.
+ * One of the chunks is processed in the calling thread, as well as the chunks of threads that
+ * failed to start. The first exception thrown by a chunk is rethrown after all threads are joined.
+ */
+template <typename Function>
+void
+parallel_for(std::size_t count, parallel_options const& opts, Function&& f)
+{
+    if (count == 0)
+        return;
+    auto const  grain       = std::max<std::size_t>(opts.grain, 1);
+    auto const  grain_count = (count + grain - 1) / grain;
+    std::size_t threads     = grain_count;
+    if (opts.min_chunk > 0)
+        threads = std::min(threads, std::max<std::size_t>(count / opts.min_chunk, 1));
+    if (threads > 1)
+        threads = std::min(threads, opts.thread_count == 0 ? hardware_thread_count()
+                                                           : opts.thread_count);
+
+    if (threads <= 1) {
+        f(std::size_t{0}, count);
+        return;
+    }
+
+    auto const               chunk = (grain_count + threads - 1) / threads * grain;
+    std::vector<std::thread> workers;
+    std::vector<std::exception_ptr> errors(threads);
+    // Start of the chunks left to the calling thread if a worker cannot be started
+    std::size_t rest = count;
+    workers.reserve(threads - 1);
+    for (std::size_t t = 1; t < threads; ++t) {
+        auto first = std::min(t * chunk, count);
+        auto last  = std::min(first + chunk, count);
+        if (first == last)
+            break;
+        try {
+            workers.emplace_back([&f, &errors, t, first, last]() {
+                try {
+                    f(first, last);
+                } catch (...) {
+                    errors[t] = std::current_exception();
+                }
+            });
+        } catch (...) {
+            rest = first;
+            break;
+        }
+    }
+    try {
+        f(std::size_t{0}, std::min(chunk, count));
+        if (rest < count)
+            f(rest, count);
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    for (auto const& e : errors) {
+        if (e)
+            std::rethrow_exception(e);
+    }
+}
+
+}    // namespace detail
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_PARALLEL_HPP_ */
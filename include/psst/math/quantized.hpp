@@ -0,0 +1,604 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * quantized.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_QUANTIZED_HPP_
+#define PSST_MATH_QUANTIZED_HPP_
+
+#include <psst/math/detail/block_loop.hpp>
+#include <psst/math/parallel.hpp>
+#include <psst/math/vector.hpp>
+#include <psst/math/quaternion.hpp>
+#include <psst/math/vector_view.hpp>
+#include <psst/math/vmath.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * Compact encodings of unit vectors and rotations. A vector<float, 3> normal takes 12 bytes, the
+ * encodings take 2 to 8 bytes:
+ *   - octahedral<I> maps the sphere onto the octahedron and unfolds it to a square, two snorm
+ *     components of type I. The error is spread evenly over the sphere;
+ *   - snorm_vector<I, Size> quantizes every component of a vector in [-1, 1] to a snorm of type I;
+ *   - snorm_10_10_10_2 packs x, y and z to 10 bit and w, e.g. the handedness of a tangent frame,
+ *     to 2 bit snorms of a 32 bit word;
+ *   - smallest_three<UInt> drops the largest component of a unit quaternion and quantizes the
+ *     other three to 10 (std::uint32_t) or 20 (std::uint64_t) bits.
+ *
+ * The maximum errors, measured over the whole range, are listed with the types. Values are
+ * rounded to nearest, snorm values are clamped to [-1, 1]. Buffers are encoded and decoded by
+ * encode_values and decode_values, the branchless kernels run over blocks of vectors, see
+ * detail/block_loop.hpp.
+ */
+namespace psst {
+namespace math {
+
+namespace detail {
+
+//@{
+/**
+ * @name Selection of floats on the bits
+ * The compiler turns conditional expressions, std::min and std::max of computed floats into
+ * branches, which keep the kernels from being vectorised.
+ */
+/** a if the condition holds, b otherwise */
+inline float
+select_bits(bool condition, float a, float b)
+{
+    std::uint32_t const mask = 0u - std::uint32_t{condition};
+    std::uint32_t       a_bits, b_bits;
+    std::memcpy(&a_bits, &a, sizeof(a));
+    std::memcpy(&b_bits, &b, sizeof(b));
+    std::uint32_t const res_bits = (a_bits & mask) | (b_bits & ~mask);
+    float               res;
+    std::memcpy(&res, &res_bits, sizeof(res));
+    return res;
+}
+
+inline float
+min_of(float a, float b)
+{
+    return select_bits(b < a, b, a);
+}
+
+inline float
+max_of(float a, float b)
+{
+    return select_bits(a < b, b, a);
+}
+//@}
+
+//@{
+/** @name Signed normalized integers of a number of bits, with the range [-max, max] */
+template <std::size_t Bits>
+constexpr float snorm_max = static_cast<float>((std::uint32_t{1} << (Bits - 1)) - 1);
+
+template <std::size_t Bits>
+inline std::int32_t
+to_snorm(float v)
+{
+    float const c = v * snorm_max<Bits>;
+    float const r = c + std::copysign(0.5f, c);
+    return static_cast<std::int32_t>(min_of(max_of(r, -snorm_max<Bits>), snorm_max<Bits>));
+}
+
+template <std::size_t Bits>
+inline float
+from_snorm(std::int32_t v)
+{
+    return max_of(static_cast<float>(v) / snorm_max<Bits>, -1.0f);
+}
+
+/** Two's complement field of a packed word */
+template <std::size_t Bits, typename UInt>
+constexpr UInt
+pack_snorm(std::int32_t v, std::size_t shift)
+{
+    return static_cast<UInt>(static_cast<UInt>(v) & ((UInt{1} << Bits) - 1)) << shift;
+}
+
+template <std::size_t Bits, typename UInt>
+constexpr std::int32_t
+unpack_snorm(UInt word, std::size_t shift)
+{
+    constexpr std::uint32_t sign = std::uint32_t{1} << (Bits - 1);
+    auto const field = static_cast<std::uint32_t>((word >> shift) & ((UInt{1} << Bits) - 1));
+    return static_cast<std::int32_t>(field ^ sign) - static_cast<std::int32_t>(sign);
+}
+//@}
+
+/**
+ * Encoding of a packed type. Specialisations define the number of components of the source
+ * vectors, the smallest number of components a buffer can have, with the missing ones being
+ * zero, whether the components are encoded independently, and encode and decode functions over
+ * arrays of components.
+ */
+template <typename Packed>
+struct packing;
+
+}    // namespace detail
+
+/**
+ * Unit vector in octahedral mapping, two snorm components of type I. The maximum angular error
+ * is 0.017 radians for std::int8_t and 6.5e-5 for std::int16_t. A zero vector is encoded as +z.
+ */
+template <typename I>
+struct octahedral {
+    static_assert(std::is_integral<I>::value && std::is_signed<I>::value,
+                  "Octahedral components must be signed integers");
+    using value_type = vector<float, 3>;
+
+    I u;
+    I v;
+
+    static octahedral
+    encode(value_type const& n) noexcept
+    {
+        return detail::packing<octahedral>::encode(n.data());
+    }
+    value_type
+    decode() const noexcept
+    {
+        float res[3];
+        detail::packing<octahedral>::decode(*this, res);
+        return value_type{res};
+    }
+};
+
+/**
+ * Vector with components in [-1, 1] quantized to snorms of type I. The maximum error of a
+ * component is 0.5 / std::numeric_limits<I>::max(). Decoded unit vectors are not renormalized.
+ */
+template <typename I, std::size_t Size>
+struct snorm_vector {
+    static_assert(std::is_integral<I>::value && std::is_signed<I>::value,
+                  "snorm components must be signed integers");
+    using value_type = vector<float, Size>;
+
+    I values[Size];
+
+    static snorm_vector
+    encode(value_type const& v) noexcept
+    {
+        return detail::packing<snorm_vector>::encode(v.data());
+    }
+    value_type
+    decode() const noexcept
+    {
+        float res[Size];
+        detail::packing<snorm_vector>::decode(*this, res);
+        return value_type{res};
+    }
+};
+
+/**
+ * x, y and z as 10 bit and w as 2 bit snorms, from the low bits of a 32 bit word. The maximum
+ * error of x, y and z is 0.5 / 511, w is one of -1, 0 and 1.
+ */
+struct snorm_10_10_10_2 {
+    using value_type = vector<float, 3>;
+
+    std::uint32_t bits;
+
+    static snorm_10_10_10_2
+    encode(value_type const& v, float w = 0) noexcept;
+    value_type
+    decode() const noexcept;
+    float
+    w() const noexcept
+    {
+        return detail::from_snorm<2>(detail::unpack_snorm<2>(bits, 30));
+    }
+};
+
+/**
+ * Unit quaternion in the smallest three encoding. The largest component is dropped, its index is
+ * stored in two bits and its sign is made positive, as q and -q are the same rotation. The other
+ * three components are within ±1/√2 and are quantized to 10 bits for std::uint32_t and 20 bits
+ * for std::uint64_t. The maximum error of a component is 1.9e-3 and 1.9e-6 respectively.
+ */
+template <typename UInt = std::uint32_t>
+struct smallest_three {
+    static_assert(std::is_same<UInt, std::uint32_t>::value
+                      || std::is_same<UInt, std::uint64_t>::value,
+                  "smallest_three is stored in a 32 or 64 bit word");
+    using value_type = quaternion<float>;
+
+    UInt bits;
+
+    static smallest_three
+    encode(value_type const& q) noexcept
+    {
+        return detail::packing<smallest_three>::encode(q.data());
+    }
+    value_type
+    decode() const noexcept
+    {
+        float res[4];
+        detail::packing<smallest_three>::decode(*this, res);
+        return value_type{res};
+    }
+};
+
+static_assert(sizeof(octahedral<std::int16_t>) == 4 && sizeof(snorm_10_10_10_2) == 4
+                  && sizeof(smallest_three<>) == 4 && sizeof(snorm_vector<std::int16_t, 3>) == 6,
+              "Packed types must be tightly packed");
+
+namespace detail {
+
+template <typename I>
+struct packing<octahedral<I>> {
+    static constexpr std::size_t size          = 3;
+    static constexpr std::size_t min_size      = 3;
+    static constexpr bool        componentwise = false;
+    static constexpr std::size_t bits          = std::numeric_limits<I>::digits + 1;
+
+    /** The lower hemisphere is folded over the diagonals of the square */
+    static octahedral<I>
+    encode(float const* v) noexcept
+    {
+        float const l1  = std::abs(v[0]) + std::abs(v[1]) + std::abs(v[2]);
+        float const inv = 1.0f / max_of(l1, std::numeric_limits<float>::min());
+        float const u   = v[0] * inv;
+        float const w   = v[1] * inv;
+        float const fu  = (1.0f - std::abs(w)) * std::copysign(1.0f, u);
+        float const fw  = (1.0f - std::abs(u)) * std::copysign(1.0f, w);
+        bool const  low = v[2] < 0;
+        return {static_cast<I>(to_snorm<bits>(select_bits(low, fu, u))),
+                static_cast<I>(to_snorm<bits>(select_bits(low, fw, w)))};
+    }
+
+    static void
+    decode(octahedral<I> p, float* v) noexcept
+    {
+        float       x   = from_snorm<bits>(p.u);
+        float       y   = from_snorm<bits>(p.v);
+        float const z   = 1.0f - std::abs(x) - std::abs(y);
+        float const t   = max_of(-z, 0.0f);
+        x               = x - std::copysign(t, x);
+        y               = y - std::copysign(t, y);
+        float const inv = vmath::rsqrt(x * x + y * y + z * z);
+        v[0]            = x * inv;
+        v[1]            = y * inv;
+        v[2]            = z * inv;
+    }
+};
+
+/** The components are encoded independently, buffers are encoded as flat arrays of values */
+template <typename I, std::size_t Size>
+struct packing<snorm_vector<I, Size>> {
+    static constexpr std::size_t size          = Size;
+    static constexpr std::size_t min_size      = Size;
+    static constexpr bool        componentwise = true;
+    static constexpr std::size_t bits          = std::numeric_limits<I>::digits + 1;
+    using component_type                       = I;
+
+    static I
+    encode_component(float v) noexcept
+    {
+        return static_cast<I>(to_snorm<bits>(v));
+    }
+
+    static float
+    decode_component(I v) noexcept
+    {
+        return from_snorm<bits>(v);
+    }
+
+    static snorm_vector<I, Size>
+    encode(float const* v) noexcept
+    {
+        snorm_vector<I, Size> res;
+        for (std::size_t i = 0; i < Size; ++i) {
+            res.values[i] = encode_component(v[i]);
+        }
+        return res;
+    }
+
+    static void
+    decode(snorm_vector<I, Size> const& p, float* v) noexcept
+    {
+        for (std::size_t i = 0; i < Size; ++i) {
+            v[i] = decode_component(p.values[i]);
+        }
+    }
+};
+
+template <>
+struct packing<snorm_10_10_10_2> {
+    static constexpr std::size_t size          = 4;
+    static constexpr std::size_t min_size      = 3;
+    static constexpr bool        componentwise = false;
+
+    static snorm_10_10_10_2
+    encode(float const* v) noexcept
+    {
+        return {pack_snorm<10, std::uint32_t>(to_snorm<10>(v[0]), 0)
+                | pack_snorm<10, std::uint32_t>(to_snorm<10>(v[1]), 10)
+                | pack_snorm<10, std::uint32_t>(to_snorm<10>(v[2]), 20)
+                | pack_snorm<2, std::uint32_t>(to_snorm<2>(v[3]), 30)};
+    }
+
+    static void
+    decode(snorm_10_10_10_2 p, float* v) noexcept
+    {
+        v[0] = from_snorm<10>(unpack_snorm<10>(p.bits, 0));
+        v[1] = from_snorm<10>(unpack_snorm<10>(p.bits, 10));
+        v[2] = from_snorm<10>(unpack_snorm<10>(p.bits, 20));
+        v[3] = from_snorm<2>(unpack_snorm<2>(p.bits, 30));
+    }
+};
+
+template <typename UInt>
+struct packing<smallest_three<UInt>> {
+    static constexpr std::size_t size          = 4;
+    static constexpr std::size_t min_size      = 4;
+    static constexpr bool        componentwise = false;
+    static constexpr std::size_t bits          = (std::numeric_limits<UInt>::digits - 2) / 3;
+
+    static constexpr float sqrt2     = 1.41421356237309504880f;
+    static constexpr float inv_sqrt2 = 0.70710678118654752440f;
+
+    /**
+     * The components other than the largest one are selected by comparisons of its index, the
+     * quaternion is normalized and its sign is flipped with the same multiplication.
+     */
+    static smallest_three<UInt>
+    encode(float const* q) noexcept
+    {
+        // The first of the components of the largest magnitude
+        std::uint32_t k       = 0;
+        float         m       = std::abs(q[0]);
+        float         largest = q[0];
+        auto          compare = [&](std::uint32_t i) {
+            bool const          greater = std::abs(q[i]) > m;
+            std::uint32_t const mask    = 0u - std::uint32_t{greater};
+            k                           = (i & mask) | (k & ~mask);
+            m                           = select_bits(greater, std::abs(q[i]), m);
+            largest                     = select_bits(greater, q[i], largest);
+        };
+        compare(1);
+        compare(2);
+        compare(3);
+
+        float const mag_sq = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3];
+        float const scale  = std::copysign(
+            sqrt2 * vmath::rsqrt(max_of(mag_sq, std::numeric_limits<float>::min())), largest);
+
+        float const a = select_bits(k == 0, q[1], q[0]);
+        float const b = select_bits(k <= 1, q[2], q[1]);
+        float const c = select_bits(k <= 2, q[3], q[2]);
+        return {static_cast<UInt>(pack_snorm<bits, UInt>(to_snorm<bits>(a * scale), 0)
+                                  | pack_snorm<bits, UInt>(to_snorm<bits>(b * scale), bits)
+                                  | pack_snorm<bits, UInt>(to_snorm<bits>(c * scale), 2 * bits)
+                                  | UInt{k} << (3 * bits))};
+    }
+
+    static void
+    decode(smallest_three<UInt> p, float* q) noexcept
+    {
+        auto const  k = static_cast<std::uint32_t>(p.bits >> (3 * bits)) & 3;
+        float const a = from_snorm<bits>(unpack_snorm<bits>(p.bits, 0)) * inv_sqrt2;
+        float const b = from_snorm<bits>(unpack_snorm<bits>(p.bits, bits)) * inv_sqrt2;
+        float const c = from_snorm<bits>(unpack_snorm<bits>(p.bits, 2 * bits)) * inv_sqrt2;
+        float const l_sq
+            = max_of(1.0f - a * a - b * b - c * c, std::numeric_limits<float>::min());
+        float const l = l_sq * vmath::rsqrt(l_sq);
+        q[0]          = select_bits(k == 0, l, a);
+        q[1]          = select_bits(k == 0, a, select_bits(k == 1, l, b));
+        q[2]          = select_bits(k <= 1, b, select_bits(k == 2, l, c));
+        q[3]          = select_bits(k <= 2, c, l);
+    }
+};
+
+}    // namespace detail
+
+inline snorm_10_10_10_2
+snorm_10_10_10_2::encode(value_type const& v, float w) noexcept
+{
+    float const c[]{v[0], v[1], v[2], w};
+    return detail::packing<snorm_10_10_10_2>::encode(c);
+}
+
+inline snorm_10_10_10_2::value_type
+snorm_10_10_10_2::decode() const noexcept
+{
+    float res[4];
+    detail::packing<snorm_10_10_10_2>::decode(*this, res);
+    return value_type{res};
+}
+
+namespace detail {
+
+/** Number of vectors encoded or decoded at once, see block_loop.hpp */
+constexpr std::size_t packing_block_size = 16;
+
+/** Componentwise encodings convert blocks of values regardless of the vectors */
+template <typename Packed, typename T>
+void
+encode_components(T const* src, Packed* dst, std::size_t count)
+{
+    using component_type             = typename packing<Packed>::component_type;
+    constexpr std::size_t size       = packing<Packed>::size;
+    constexpr std::size_t block_size = packing_block_size * size;
+    static_assert(sizeof(Packed) == sizeof(component_type) * size, "Packed type has padding");
+
+    for_each_block<packing_block_size>(count, [&](std::size_t first, std::size_t n) {
+        float          in[block_size];
+        component_type out[block_size];
+        load_block_values(src + first * size, n * size, in);
+        for (std::size_t i = 0; i < block_size; ++i) {
+            out[i] = packing<Packed>::encode_component(in[i]);
+        }
+        std::memcpy(static_cast<void*>(dst + first), out, n * size * sizeof(component_type));
+    });
+}
+
+template <typename Packed, typename T>
+void
+decode_components(Packed const* src, T* dst, std::size_t count)
+{
+    using component_type             = typename packing<Packed>::component_type;
+    constexpr std::size_t size       = packing<Packed>::size;
+    constexpr std::size_t block_size = packing_block_size * size;
+
+    for_each_block<packing_block_size>(count, [&](std::size_t first, std::size_t n) {
+        component_type in[block_size]{};
+        float          out[block_size];
+        std::memcpy(in, static_cast<void const*>(src + first), n * size * sizeof(component_type));
+        for (std::size_t i = 0; i < block_size; ++i) {
+            out[i] = packing<Packed>::decode_component(in[i]);
+        }
+        store_block_values(out, n * size, dst + first * size);
+    });
+}
+
+template <typename Packed, std::size_t Size, typename T>
+void
+encode_range(T const* src, Packed* dst, std::size_t count)
+{
+    constexpr std::size_t packed_size = packing<Packed>::size;
+    if constexpr (packing<Packed>::componentwise) {
+        encode_components(src, dst, count);
+        return;
+    }
+    for_each_block<packing_block_size>(count, [&](std::size_t first, std::size_t n) {
+        float c[packed_size][packing_block_size];
+        auto  load = [&](std::size_t i) {
+            for (std::size_t j = 0; j < packed_size; ++j) {
+                c[j][i] = j < Size ? static_cast<float>(src[(first + i) * Size + j]) : 0.0f;
+            }
+        };
+        if (n == packing_block_size) {
+            for (std::size_t i = 0; i < packing_block_size; ++i) {
+                load(i);
+            }
+        } else {
+            for (std::size_t i = 0; i < n; ++i) {
+                load(i);
+            }
+            for (std::size_t i = n; i < packing_block_size; ++i) {
+                for (std::size_t j = 0; j < packed_size; ++j) {
+                    c[j][i] = 0;
+                }
+            }
+        }
+
+        Packed out[packing_block_size];
+        for (std::size_t i = 0; i < packing_block_size; ++i) {
+            float v[packed_size];
+            for (std::size_t j = 0; j < packed_size; ++j) {
+                v[j] = c[j][i];
+            }
+            out[i] = packing<Packed>::encode(v);
+        }
+        std::copy_n(out, n, dst + first);
+    });
+}
+
+template <typename Packed, std::size_t Size, typename T>
+void
+decode_range(Packed const* src, T* dst, std::size_t count)
+{
+    constexpr std::size_t packed_size = packing<Packed>::size;
+    if constexpr (packing<Packed>::componentwise) {
+        decode_components(src, dst, count);
+        return;
+    }
+    for_each_block<packing_block_size>(count, [&](std::size_t first, std::size_t n) {
+        Packed in[packing_block_size]{};
+        std::copy_n(src + first, n, in);
+
+        float c[packed_size][packing_block_size];
+        for (std::size_t i = 0; i < packing_block_size; ++i) {
+            float v[packed_size];
+            packing<Packed>::decode(in[i], v);
+            for (std::size_t j = 0; j < packed_size; ++j) {
+                c[j][i] = v[j];
+            }
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < Size; ++j) {
+                dst[(first + i) * Size + j] = static_cast<T>(c[j][i]);
+            }
+        }
+    });
+}
+
+template <typename Packed, std::size_t Size, typename T>
+void
+check_packing_buffer()
+{
+    static_assert(Size >= packing<Packed>::min_size && Size <= packing<Packed>::size,
+                  "Number of vector components doesn't match the packed type");
+    static_assert(std::is_floating_point<std::remove_const_t<T>>::value,
+                  "Packed vectors are encoded from and decoded to floating point values");
+}
+
+}    // namespace detail
+
+/**
+ * Encode a buffer of vectors, e.g. normals or rotations of a mesh. Buffers of 3 component
+ * vectors can be encoded to snorm_10_10_10_2, their w is zero. Large buffers are split between
+ * threads.
+ *
+ * @param src Source vectors
+ * @param dst Destination buffer, must have space for the number of vectors of the source
+ * @param opts Threading options
+ */
+template <typename Packed, typename T, std::size_t Size, typename Components,
+          component_order Order>
+void
+encode_values(memory_vector_view<T*, Size, Components, Order> src, Packed* dst,
+              parallel_options const& opts = {})
+{
+    static_assert(Order == component_order::forward,
+                  "Encoding requires forward component order");
+    detail::check_packing_buffer<Packed, Size, T>();
+    T const* src_data = src.data();
+    detail::parallel_for(src.size(), opts, [&](std::size_t first, std::size_t last) {
+        detail::encode_range<Packed, Size>(src_data + first * Size, dst + first, last - first);
+    });
+}
+
+/**
+ * Decode a buffer of packed vectors. Large buffers are split between threads.
+ *
+ * @param src Packed vectors
+ * @param count Number of packed vectors
+ * @param dst Destination vectors, must have at least count vectors
+ * @param opts Threading options
+ */
+template <typename Packed, typename T, std::size_t Size, typename Components,
+          component_order Order>
+void
+decode_values(Packed const* src, std::size_t count,
+              memory_vector_view<T*, Size, Components, Order> dst,
+              parallel_options const&                         opts = {})
+{
+    static_assert(Order == component_order::forward,
+                  "Decoding requires forward component order");
+    static_assert(!std::is_const<T>::value, "Destination buffer must be mutable");
+    detail::check_packing_buffer<Packed, Size, T>();
+    if (dst.size() < count)
+        throw std::runtime_error{"Destination buffer is too small"};
+    T* dst_data = dst.data();
+    detail::parallel_for(count, opts, [&](std::size_t first, std::size_t last) {
+        detail::decode_range<Packed, Size>(src + first, dst_data + first * Size, last - first);
+    });
+}
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_QUANTIZED_HPP_ */
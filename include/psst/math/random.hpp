@@ -9,15 +9,250 @@
 #ifndef PSST_MATH_RANDOM_HPP_
 #define PSST_MATH_RANDOM_HPP_
 
+#include <psst/math/detail/block_loop.hpp>
 #include <psst/math/detail/matrix_expressions.hpp>
 #include <psst/math/detail/vector_expressions.hpp>
+#include <psst/math/matrix.hpp>
+#include <psst/math/parallel.hpp>
+#include <psst/math/vector.hpp>
+#include <psst/math/vector_view.hpp>
 
+#include <array>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <random>
 
 namespace psst {
 namespace math {
 
+//----------------------------------------------------------------------------
+//  Counter-based random numbers
+//----------------------------------------------------------------------------
+/**
+ * Philox4x32-10 counter-based random function by Salmon et al, "Parallel Random Numbers: As
+ * Easy as 1, 2, 3". Maps a 128-bit counter and a 64-bit key to 128 random bits, so any sample
+ * of a sequence can be computed independently of the others.
+ */
+struct philox4x32 {
+    using counter_type = std::array<std::uint32_t, 4>;
+    using key_type     = std::array<std::uint32_t, 2>;
+
+    static constexpr std::size_t   rounds       = 10;
+    static constexpr std::uint32_t multiplier_0 = 0xD2511F53;
+    static constexpr std::uint32_t multiplier_1 = 0xCD9E8D57;
+    static constexpr std::uint32_t weyl_0       = 0x9E3779B9;
+    static constexpr std::uint32_t weyl_1       = 0xBB67AE85;
+
+    static constexpr counter_type
+    generate(counter_type ctr, key_type key)
+    {
+        for (std::size_t r = 0; r < rounds; ++r) {
+            std::uint64_t p0 = std::uint64_t{multiplier_0} * ctr[0];
+            std::uint64_t p1 = std::uint64_t{multiplier_1} * ctr[2];
+            ctr              = {static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0],
+                   static_cast<std::uint32_t>(p1),
+                   static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1],
+                   static_cast<std::uint32_t>(p0)};
+            key[0] += weyl_0;
+            key[1] += weyl_1;
+        }
+        return ctr;
+    }
+};
+
+/**
+ * Seed and stream id of a reproducible random sequence. Block `index` of row `row` is Philox of
+ * the counter {index, row, stream} with the seed as the key, a distribution makes
+ * Distribution::samples_per_block samples of a block. Different streams give independent
+ * sequences for the same seed.
+ */
+struct random_stream {
+    std::uint64_t seed   = 0;
+    std::uint32_t stream = 0;
+
+    constexpr philox4x32::key_type
+    key() const
+    {
+        return {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+    }
+
+    constexpr philox4x32::counter_type
+    counter(std::uint64_t index, std::uint32_t row = 0) const
+    {
+        return {static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(index >> 32), row,
+                stream};
+    }
+
+    constexpr philox4x32::counter_type
+    bits(std::uint64_t index, std::uint32_t row = 0) const
+    {
+        return philox4x32::generate(counter(index, row), key());
+    }
+
+    /** Sample number `index` of a row */
+    template <typename Distribution>
+    constexpr auto
+    sample(Distribution const& dist, std::uint64_t index, std::uint32_t row = 0) const
+    {
+        constexpr std::uint64_t per_block = Distribution::samples_per_block;
+        return dist(bits(index / per_block, row), index % per_block);
+    }
+};
+
+/**
+ * Random bit generator satisfying the standard UniformRandomBitGenerator requirements, cheap to
+ * construct and copy, with O(1) discard. Can be used as the Engine of random_vector_data and with
+ * the standard distributions.
+ */
+class philox_engine {
+public:
+    using result_type = std::uint32_t;
+
+    static constexpr result_type default_seed = 20111115u;
+
+    constexpr philox_engine() : philox_engine{default_seed} {}
+    constexpr explicit philox_engine(std::uint64_t seed, std::uint32_t stream = 0)
+        : stream_{seed, stream}
+    {}
+
+    static constexpr result_type
+    min()
+    {
+        return 0;
+    }
+    static constexpr result_type
+    max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    constexpr void
+    seed(std::uint64_t seed, std::uint32_t stream = 0)
+    {
+        *this = philox_engine{seed, stream};
+    }
+
+    constexpr result_type
+    operator()()
+    {
+        if (word_ == 0)
+            buffer_ = stream_.bits(index_);
+        auto res = buffer_[word_];
+        if (++word_ == buffer_.size()) {
+            word_ = 0;
+            ++index_;
+        }
+        return res;
+    }
+
+    /** Skip n values */
+    constexpr void
+    discard(unsigned long long n)
+    {
+        auto pos = index_ * buffer_.size() + word_ + n;
+        index_   = pos / buffer_.size();
+        word_    = pos % buffer_.size();
+        if (word_ != 0)
+            buffer_ = stream_.bits(index_);
+    }
+
+    constexpr random_stream const&
+    stream() const
+    {
+        return stream_;
+    }
+
+    friend constexpr bool
+    operator==(philox_engine const& lhs, philox_engine const& rhs)
+    {
+        return lhs.stream_.seed == rhs.stream_.seed && lhs.stream_.stream == rhs.stream_.stream
+               && lhs.index_ == rhs.index_ && lhs.word_ == rhs.word_;
+    }
+    friend constexpr bool
+    operator!=(philox_engine const& lhs, philox_engine const& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    random_stream            stream_;
+    std::uint64_t            index_  = 0;
+    std::size_t              word_   = 0;
+    philox4x32::counter_type buffer_ = {};
+};
+
+namespace detail {
+
+/** Uniform value in [0, 1) from one word for float and two words for double */
+template <typename T>
+constexpr T
+unit_interval(std::uint32_t w0, std::uint32_t w1)
+{
+    if constexpr (sizeof(T) <= sizeof(float)) {
+        return T(static_cast<std::int32_t>(w0 >> 8) * (1.0f / (1u << 24)));
+    } else {
+        return T(static_cast<std::int64_t>((std::uint64_t{w0} << 32 | w1) >> 11)
+                 * (1.0 / (std::uint64_t{1} << 53)));
+    }
+}
+
+/** Number of Philox words for a uniform value of type T */
+template <typename T>
+constexpr std::size_t unit_interval_words = sizeof(T) <= sizeof(float) ? 1 : 2;
+
+}    // namespace detail
+
+/**
+ * Uniform distribution of real values in [a, b) for counter-based generators. A Philox output
+ * gives four float or two double samples.
+ */
+template <typename T>
+struct counter_uniform_distribution {
+    static constexpr std::size_t samples_per_block = 4 / detail::unit_interval_words<T>;
+
+    T a = 0;
+    T b = 1;
+
+    /** Sample n of a block of random bits */
+    constexpr T
+    operator()(philox4x32::counter_type const& bits, std::size_t n) const
+    {
+        constexpr auto words = detail::unit_interval_words<T>;
+        return a + (b - a) * detail::unit_interval<T>(bits[n * words], bits[n * words + words - 1]);
+    }
+};
+
+/**
+ * Normal distribution for counter-based generators, Box-Muller transform giving a pair of
+ * samples from each two uniform values of a Philox output.
+ */
+template <typename T>
+struct counter_normal_distribution {
+    static constexpr std::size_t samples_per_block = 4 / detail::unit_interval_words<T>;
+
+    T mean   = 0;
+    T stddev = 1;
+
+    /** Sample n of a block of random bits */
+    T
+    operator()(philox4x32::counter_type const& bits, std::size_t n) const
+    {
+        using std::cos;
+        using std::log;
+        using std::sin;
+        using std::sqrt;
+        constexpr auto words = detail::unit_interval_words<T>;
+        auto const     w     = n / 2 * 2 * words;
+        T u1    = 1 - detail::unit_interval<T>(bits[w], bits[w + words - 1]);    // (0, 1]
+        T u2    = detail::unit_interval<T>(bits[w + words], bits[w + 2 * words - 1]);
+        T r     = stddev * sqrt(-2 * log(u1));
+        T angle = tau_v<T> * u2;
+        return mean + r * (n % 2 ? sin(angle) : cos(angle));
+    }
+};
+
 namespace expr {
 
 inline namespace v {
@@ -48,6 +283,48 @@ private:
     mutable distribution_type dist_;
 };
 
+/**
+ * Stateless random vector expression, component N is the sample offset + N of the row 0 of a
+ * random stream. Evaluating the expression gives the same values every time and is safe from
+ * any number of threads, use advance to get the following samples.
+ */
+template <typename T, typename Distribution>
+struct counter_random_vector_generator
+    : vector_expression<counter_random_vector_generator<T, Distribution>,
+                        vector<T, 0, components::none>> {
+    using base_type  = vector_expression<counter_random_vector_generator<T, Distribution>,
+                                        vector<T, 0, components::none>>;
+    using value_type = typename base_type::value_type;
+
+    static constexpr std::size_t size = utils::npos_v;
+
+    using distribution_type = Distribution;
+
+    constexpr counter_random_vector_generator(distribution_type const& d, random_stream const& s,
+                                              std::uint64_t offset = 0)
+        : dist_{d}, stream_{s}, offset_{offset}
+    {}
+
+    template <std::size_t N>
+    constexpr value_type
+    at() const
+    {
+        return stream_.sample(dist_, offset_ + N);
+    }
+
+    /** Generator of samples following the first n */
+    constexpr counter_random_vector_generator
+    advance(std::uint64_t n) const
+    {
+        return {dist_, stream_, offset_ + n};
+    }
+
+private:
+    distribution_type dist_;
+    random_stream     stream_;
+    std::uint64_t     offset_;
+};
+
 }    // namespace v
 
 inline namespace m {
@@ -103,6 +380,72 @@ struct nth_row<random_matrix_generator<T, Distribution, Engine>, RN>
     }
 };
 
+/**
+ * Stateless random matrix expression, element (R, C) is the sample offset + C of the row R of a
+ * random stream, so the first row matches counter_random_vector_generator.
+ */
+template <typename T, typename Distribution>
+struct counter_random_matrix_generator
+    : matrix_expression<counter_random_matrix_generator<T, Distribution>,
+                        matrix<T, 0, 0, components::none>> {
+    using base_type  = matrix_expression<counter_random_matrix_generator<T, Distribution>,
+                                        matrix<T, 0, 0, components::none>>;
+    using value_type = typename base_type::value_type;
+
+    static constexpr auto rows = utils::npos_v;
+    static constexpr auto cols = utils::npos_v;
+    static constexpr auto size = utils::npos_v;
+
+    using distribution_type = Distribution;
+
+    constexpr counter_random_matrix_generator(distribution_type const& d, random_stream const& s,
+                                              std::uint64_t offset = 0)
+        : dist_{d}, stream_{s}, offset_{offset}
+    {}
+
+    template <std::size_t R, std::size_t C>
+    constexpr value_type
+    element() const
+    {
+        return stream_.sample(dist_, offset_ + C, R);
+    }
+
+    /** Generator of samples following the first n columns */
+    constexpr counter_random_matrix_generator
+    advance(std::uint64_t n) const
+    {
+        return {dist_, stream_, offset_ + n};
+    }
+
+private:
+    distribution_type dist_;
+    random_stream     stream_;
+    std::uint64_t     offset_;
+};
+
+template <std::size_t RN, typename T, typename Distribution>
+struct nth_row<counter_random_matrix_generator<T, Distribution>, RN>
+    : vector_expression<nth_row<counter_random_matrix_generator<T, Distribution>, RN>,
+                        vector<T, 0, components::none>>,
+      unary_expression<counter_random_matrix_generator<T, Distribution>> {
+    using base_type
+        = vector_expression<nth_row<counter_random_matrix_generator<T, Distribution>, RN>,
+                            vector<T, 0, components::none>>;
+    using value_type = typename base_type::value_type;
+
+    static constexpr std::size_t size = utils::npos_v;
+
+    using expression_base = unary_expression<counter_random_matrix_generator<T, Distribution>>;
+    using expression_base::expression_base;
+
+    template <std::size_t CN>
+    constexpr auto
+    at() const
+    {
+        return this->arg_.template element<RN, CN>();
+    }
+};
+
 }    // namespace m
 }    // namespace expr
 
@@ -120,6 +463,176 @@ random_matrix_data(Distribution const& d)
     return expr::m::random_matrix_generator<T, Distribution, Engine>{d};
 }
 
+/**
+ * Reproducible random vector data, e.g.
+ * `vector3f v = random_vector_data<float>(counter_normal_distribution<float>{}, {seed, stream});`
+ */
+template <typename T, typename Distribution>
+constexpr auto
+random_vector_data(Distribution const& d, random_stream const& s, std::uint64_t offset = 0)
+{
+    return expr::v::counter_random_vector_generator<T, Distribution>{d, s, offset};
+}
+
+/**
+ * Reproducible random matrix data
+ */
+template <typename T, typename Distribution>
+constexpr auto
+random_matrix_data(Distribution const& d, random_stream const& s, std::uint64_t offset = 0)
+{
+    return expr::m::counter_random_matrix_generator<T, Distribution>{d, s, offset};
+}
+
+//----------------------------------------------------------------------------
+//  Bulk generation
+//----------------------------------------------------------------------------
+namespace detail {
+
+/** Number of Philox counters computed at once, see block_loop.hpp */
+constexpr std::size_t random_block_size = 8;
+
+/** Philox counters of a block of samples in structure of arrays layout */
+struct philox_block {
+    std::uint32_t c0[random_block_size];
+    std::uint32_t c1[random_block_size];
+    std::uint32_t c2[random_block_size];
+    std::uint32_t c3[random_block_size];
+};
+
+/** Philox rounds for a block of counters */
+inline void
+philox_rounds(philox_block& blk, philox4x32::key_type key)
+{
+    for (std::size_t r = 0; r < philox4x32::rounds; ++r) {
+        for (std::size_t i = 0; i < random_block_size; ++i) {
+            std::uint64_t p0 = std::uint64_t{philox4x32::multiplier_0} * blk.c0[i];
+            std::uint64_t p1 = std::uint64_t{philox4x32::multiplier_1} * blk.c2[i];
+            std::uint32_t c1 = blk.c1[i];
+            std::uint32_t c3 = blk.c3[i];
+            blk.c0[i]        = static_cast<std::uint32_t>(p1 >> 32) ^ c1 ^ key[0];
+            blk.c1[i]        = static_cast<std::uint32_t>(p1);
+            blk.c2[i]        = static_cast<std::uint32_t>(p0 >> 32) ^ c3 ^ key[1];
+            blk.c3[i]        = static_cast<std::uint32_t>(p0);
+        }
+        key[0] += philox4x32::weyl_0;
+        key[1] += philox4x32::weyl_1;
+    }
+}
+
+/**
+ * Generate samples [first, first + count) of a row of a random stream, calling
+ * store(i, value) with i relative to first
+ */
+template <typename Distribution, typename Store>
+void
+generate_random(Distribution const& dist, random_stream const& s, std::uint64_t first,
+                std::size_t count, std::uint32_t row, Store&& store)
+{
+    constexpr std::uint64_t per_block   = Distribution::samples_per_block;
+    auto const              key         = s.key();
+    auto const              last        = first + count;
+    auto const              first_block = first / per_block;
+    auto const              last_block  = (last + per_block - 1) / per_block;
+    auto const              blocks      = static_cast<std::size_t>(last_block - first_block);
+    for_each_block<random_block_size>(blocks, [&](std::size_t offset, std::size_t n_counters) {
+        auto const   b = first_block + offset;
+        philox_block blk;
+        for (std::size_t i = 0; i < random_block_size; ++i) {
+            std::uint64_t index = b + i;
+            blk.c0[i]           = static_cast<std::uint32_t>(index);
+            blk.c1[i]           = static_cast<std::uint32_t>(index >> 32);
+            blk.c2[i]           = row;
+            blk.c3[i]           = s.stream;
+        }
+        philox_rounds(blk, key);
+        if (b * per_block >= first && (b + random_block_size) * per_block <= last) {
+            // Whole blocks
+            auto const base = b * per_block - first;
+            for (std::size_t i = 0; i < random_block_size; ++i) {
+                philox4x32::counter_type bits{blk.c0[i], blk.c1[i], blk.c2[i], blk.c3[i]};
+                for (std::size_t n = 0; n < per_block; ++n) {
+                    store(base + i * per_block + n, dist(bits, n));
+                }
+            }
+        } else {
+            for (std::size_t i = 0; i < n_counters; ++i) {
+                philox4x32::counter_type bits{blk.c0[i], blk.c1[i], blk.c2[i], blk.c3[i]};
+                for (std::size_t n = 0; n < per_block; ++n) {
+                    auto index = (b + i) * per_block + n;
+                    if (index >= first && index < last)
+                        store(index - first, dist(bits, n));
+                }
+            }
+        }
+    });
+}
+
+}    // namespace detail
+
+/**
+ * Fill a buffer with samples offset, offset + 1, ... of a random stream, the same values as
+ * `s.sample(dist, offset + i)`. The values don't depend on the threading options, the buffer is
+ * split between threads for large counts.
+ */
+template <typename T, typename Distribution>
+void
+fill_random(T* data, std::size_t count, Distribution const& dist, random_stream const& s,
+            std::uint64_t offset = 0, parallel_options const& opts = {})
+{
+    detail::parallel_for(count, opts, [&](std::size_t first, std::size_t last) {
+        detail::generate_random(dist, s, offset + first, last - first, 0,
+                                [p = data + first](std::size_t i, T v) { p[i] = v; });
+    });
+}
+
+/**
+ * Fill a buffer of vectors, component N of vector i gets the same value as
+ * `random_vector_data<T>(dist, s, offset + i * Size).at<N>()`
+ */
+template <typename T, std::size_t Size, typename Components, typename Distribution>
+void
+fill_random(memory_vector_view<T*, Size, Components> view, Distribution const& dist,
+            random_stream const& s, std::uint64_t offset = 0, parallel_options const& opts = {})
+{
+    fill_random(view.data(), view.size() * Size, dist, s, offset, opts);
+}
+
+/**
+ * Fill an array of vectors, the same values as filling a memory_vector_view over them
+ */
+template <typename T, std::size_t Size, typename Components, typename Distribution>
+void
+fill_random(vector<T, Size, Components>* data, std::size_t count, Distribution const& dist,
+            random_stream const& s, std::uint64_t offset = 0, parallel_options const& opts = {})
+{
+    static_assert(sizeof(vector<T, Size, Components>) == sizeof(T) * Size,
+                  "Vector type is not tightly packed");
+    fill_random(count == 0 ? nullptr : data->data(), count * Size, dist, s, offset, opts);
+}
+
+/**
+ * Fill an array of matrices, element (R, C) of matrix i gets the same value as
+ * `random_matrix_data<T>(dist, s, offset + i * Cols).element<R, C>()`
+ */
+template <typename T, std::size_t Rows, std::size_t Cols, typename Components,
+          typename Distribution>
+void
+fill_random(matrix<T, Rows, Cols, Components>* data, std::size_t count, Distribution const& dist,
+            random_stream const& s, std::uint64_t offset = 0, parallel_options const& opts = {})
+{
+    detail::parallel_for(count * Cols, opts, [&](std::size_t first, std::size_t last) {
+        for (std::size_t r = 0; r < Rows; ++r) {
+            auto store = [&, r](std::size_t i, T v) {
+                auto j                      = first + i;
+                data[j / Cols][r][j % Cols] = v;
+            };
+            detail::generate_random(dist, s, offset + first, last - first,
+                                    static_cast<std::uint32_t>(r), store);
+        }
+    });
+}
+
 }    // namespace math
 }    // namespace psst
 
@@ -0,0 +1,659 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * random_samplers.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_RANDOM_SAMPLERS_HPP_
+#define PSST_MATH_RANDOM_SAMPLERS_HPP_
+
+#include <psst/math/matrix.hpp>
+#include <psst/math/parallel.hpp>
+#include <psst/math/quaternion.hpp>
+#include <psst/math/random.hpp>
+#include <psst/math/vector.hpp>
+#include <psst/math/vector_view.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace psst {
+namespace math {
+
+/**
+ * Random words of one geometric sample, four per Philox block
+ */
+template <std::size_t Blocks>
+using random_words = std::array<std::uint32_t, Blocks * 4>;
+
+namespace detail {
+
+/** Number of Philox blocks for a sample made of n uniform values of type T */
+template <typename T>
+constexpr std::size_t
+sample_blocks(std::size_t n)
+{
+    return (n * unit_interval_words<T> + 3) / 4;
+}
+
+/** Uniform value number n in [0, 1) from the words of a sample */
+template <typename T, std::size_t N>
+constexpr T
+uniform_word(std::array<std::uint32_t, N> const& words, std::size_t n)
+{
+    constexpr auto count = unit_interval_words<T>;
+    return unit_interval<T>(words[n * count], words[n * count + count - 1]);
+}
+
+/** Unit vector from a cosine of the polar angle and an azimuth in [0, 1) turns */
+template <typename T>
+vector<T, 3>
+spherical_direction(T cos_theta, T turns)
+{
+    using std::cos;
+    using std::sin;
+    using std::sqrt;
+    T const sin_theta = sqrt(std::max(T{0}, 1 - cos_theta * cos_theta));
+    T const phi       = tau_v<T> * turns;
+    return {sin_theta * cos(phi), sin_theta * sin(phi), cos_theta};
+}
+
+/**
+ * Orthonormal basis around a unit vector, Duff et al. "Building an Orthonormal Basis, Revisited"
+ */
+template <typename T>
+void
+orthonormal_basis(vector<T, 3> const& n, vector<T, 3>& b1, vector<T, 3>& b2)
+{
+    using std::copysign;
+    T const sign = copysign(T{1}, n.z());
+    T const a    = -1 / (sign + n.z());
+    T const b    = n.x() * n.y() * a;
+    b1           = {1 + sign * n.x() * n.x() * a, sign * b, -sign * n.x()};
+    b2           = {b, sign + n.y() * n.y() * a, -n.y()};
+}
+
+/** Rotation matrix of a unit quaternion */
+template <typename T>
+constexpr matrix<T, 3, 3>
+rotation_matrix(quaternion<T> const& q)
+{
+    T const w = q.w(), x = q.x(), y = q.y(), z = q.z();
+    // clang-format off
+    return {
+        {1 - 2 * (y * y + z * z),   2 * (x * y - w * z),        2 * (x * z + w * y)},
+        {2 * (x * y + w * z),       1 - 2 * (x * x + z * z),    2 * (y * z - w * x)},
+        {2 * (x * z - w * y),       2 * (y * z + w * x),        1 - 2 * (x * x + y * y)}
+    };
+    // clang-format on
+}
+
+}    // namespace detail
+
+//----------------------------------------------------------------------------
+//  Geometric samplers
+//----------------------------------------------------------------------------
+/**
+ * Uniform points in the unit disk
+ */
+template <typename T>
+struct unit_disk_sampler {
+    using result_type                              = vector<T, 2>;
+    static constexpr std::size_t blocks_per_sample = detail::sample_blocks<T>(2);
+
+    result_type
+    operator()(random_words<blocks_per_sample> const& words) const
+    {
+        using std::cos;
+        using std::sin;
+        using std::sqrt;
+        T const r   = sqrt(detail::uniform_word<T>(words, 0));
+        T const phi = tau_v<T> * detail::uniform_word<T>(words, 1);
+        return {r * cos(phi), r * sin(phi)};
+    }
+};
+
+/**
+ * Uniform points on the unit sphere
+ */
+template <typename T>
+struct unit_sphere_sampler {
+    using result_type                              = vector<T, 3>;
+    static constexpr std::size_t blocks_per_sample = detail::sample_blocks<T>(2);
+
+    result_type
+    operator()(random_words<blocks_per_sample> const& words) const
+    {
+        return detail::spherical_direction(1 - 2 * detail::uniform_word<T>(words, 0),
+                                           detail::uniform_word<T>(words, 1));
+    }
+};
+
+/**
+ * Uniform points in the unit ball
+ */
+template <typename T>
+struct unit_ball_sampler {
+    using result_type                              = vector<T, 3>;
+    static constexpr std::size_t blocks_per_sample = detail::sample_blocks<T>(3);
+
+    result_type
+    operator()(random_words<blocks_per_sample> const& words) const
+    {
+        using std::cbrt;
+        return detail::spherical_direction(1 - 2 * detail::uniform_word<T>(words, 0),
+                                           detail::uniform_word<T>(words, 1))
+               * cbrt(detail::uniform_word<T>(words, 2));
+    }
+};
+
+/**
+ * Uniform directions within a cone around an axis
+ */
+template <typename T>
+class cone_sampler {
+public:
+    using result_type                              = vector<T, 3>;
+    static constexpr std::size_t blocks_per_sample = detail::sample_blocks<T>(2);
+
+    /**
+     * @param axis Direction of the cone axis, doesn't need to be normalized
+     * @param half_angle Angle between the axis and the cone surface in radians
+     */
+    cone_sampler(vector<T, 3> const& axis, T half_angle)
+    {
+        using std::cos;
+        auto const mag = magnitude(axis);
+        if (mag == 0)
+            throw std::invalid_argument{"Cone axis must not be a zero vector"};
+        axis_    = axis / mag;
+        cos_max_ = cos(half_angle);
+        detail::orthonormal_basis(axis_, tangent_, bitangent_);
+    }
+
+    result_type
+    operator()(random_words<blocks_per_sample> const& words) const
+    {
+        T const cos_theta = 1 - detail::uniform_word<T>(words, 0) * (1 - cos_max_);
+        auto    local = detail::spherical_direction(cos_theta, detail::uniform_word<T>(words, 1));
+        return tangent_ * local.x() + bitangent_ * local.y() + axis_ * local.z();
+    }
+
+    vector<T, 3> const&
+    axis() const
+    {
+        return axis_;
+    }
+    T
+    cos_half_angle() const
+    {
+        return cos_max_;
+    }
+
+private:
+    vector<T, 3> axis_;
+    vector<T, 3> tangent_;
+    vector<T, 3> bitangent_;
+    T            cos_max_;
+};
+
+/**
+ * Uniformly distributed rotations as unit quaternions, Shoemake "Uniform random rotations"
+ */
+template <typename T>
+struct rotation_sampler {
+    using result_type                              = quaternion<T>;
+    static constexpr std::size_t blocks_per_sample = detail::sample_blocks<T>(3);
+
+    result_type
+    operator()(random_words<blocks_per_sample> const& words) const
+    {
+        using std::cos;
+        using std::sin;
+        using std::sqrt;
+        T const u1 = detail::uniform_word<T>(words, 0);
+        T const a  = tau_v<T> * detail::uniform_word<T>(words, 1);
+        T const b  = tau_v<T> * detail::uniform_word<T>(words, 2);
+        T const r1 = sqrt(1 - u1);
+        T const r2 = sqrt(u1);
+        return {r2 * cos(b), r1 * sin(a), r1 * cos(a), r2 * sin(b)};
+    }
+};
+
+/**
+ * Uniformly distributed rotation matrices
+ */
+template <typename T>
+struct rotation_matrix_sampler {
+    using result_type                              = matrix<T, 3, 3>;
+    static constexpr std::size_t blocks_per_sample = rotation_sampler<T>::blocks_per_sample;
+
+    result_type
+    operator()(random_words<blocks_per_sample> const& words) const
+    {
+        return detail::rotation_matrix(rotation_sampler<T>{}(words));
+    }
+};
+
+/**
+ * Sample number index of a random stream, uses blocks index * Sampler::blocks_per_sample and
+ * following of the row 0
+ */
+template <typename Sampler>
+auto
+sample(Sampler const& sampler, random_stream const& s, std::uint64_t index)
+{
+    constexpr auto                            blocks = Sampler::blocks_per_sample;
+    random_words<Sampler::blocks_per_sample> words;
+    for (std::size_t b = 0; b < blocks; ++b) {
+        auto bits = s.bits(index * blocks + b);
+        for (std::size_t w = 0; w < 4; ++w) {
+            words[b * 4 + w] = bits[w];
+        }
+    }
+    return sampler(words);
+}
+
+namespace detail {
+
+/**
+ * Generate samples [first, first + count) calling store(i, value) with i relative to first
+ */
+template <typename Sampler, typename Store>
+void
+generate_samples(Sampler const& sampler, random_stream const& s, std::uint64_t first,
+                 std::size_t count, Store&& store)
+{
+    constexpr std::size_t blocks = Sampler::blocks_per_sample;
+    constexpr std::size_t batch  = random_block_size / blocks;
+    static_assert(random_block_size % blocks == 0, "Sampler uses too many random blocks");
+
+    auto const key = s.key();
+    for (std::size_t b = 0; b < count; b += batch) {
+        philox_block blk;
+        auto const   first_block = (first + b) * blocks;
+        for (std::size_t i = 0; i < random_block_size; ++i) {
+            std::uint64_t index = first_block + i;
+            blk.c0[i]           = static_cast<std::uint32_t>(index);
+            blk.c1[i]           = static_cast<std::uint32_t>(index >> 32);
+            blk.c2[i]           = 0;
+            blk.c3[i]           = s.stream;
+        }
+        philox_rounds(blk, key);
+        auto const n = std::min(batch, count - b);
+        for (std::size_t i = 0; i < n; ++i) {
+            random_words<blocks> words;
+            for (std::size_t j = 0; j < blocks; ++j) {
+                auto const lane  = i * blocks + j;
+                words[j * 4]     = blk.c0[lane];
+                words[j * 4 + 1] = blk.c1[lane];
+                words[j * 4 + 2] = blk.c2[lane];
+                words[j * 4 + 3] = blk.c3[lane];
+            }
+            store(b + i, sampler(words));
+        }
+    }
+}
+
+}    // namespace detail
+
+/**
+ * Fill an array with samples offset, offset + 1, ... of a random stream, the same values as
+ * `sample(sampler, s, offset + i)` regardless of the threading options
+ */
+template <typename Sampler>
+void
+fill_samples(typename Sampler::result_type* data, std::size_t count, Sampler const& sampler,
+             random_stream const& s, std::uint64_t offset = 0, parallel_options const& opts = {})
+{
+    detail::parallel_for(count, opts, [&](std::size_t first, std::size_t last) {
+        detail::generate_samples(sampler, s, offset + first, last - first,
+                                 [p = data + first](std::size_t i, auto const& v) { p[i] = v; });
+    });
+}
+
+/**
+ * Fill a buffer of vectors with samples of a random stream
+ */
+template <typename T, std::size_t Size, typename Components, typename Sampler>
+void
+fill_samples(memory_vector_view<T*, Size, Components> view, Sampler const& sampler,
+             random_stream const& s, std::uint64_t offset = 0, parallel_options const& opts = {})
+{
+    static_assert(traits::vector_expression_size_v<typename Sampler::result_type> == Size,
+                  "Sample size doesn't match the buffer");
+    detail::parallel_for(view.size(), opts, [&](std::size_t first, std::size_t last) {
+        detail::generate_samples(sampler, s, offset + first, last - first,
+                                 [&view, first](std::size_t i, auto const& v) {
+                                     view[first + i] = v;
+                                 });
+    });
+}
+
+//----------------------------------------------------------------------------
+//  Low-discrepancy and stratified sequences
+//----------------------------------------------------------------------------
+namespace detail {
+
+constexpr std::uint32_t halton_bases[] = {2,  3,  5,  7,  11, 13, 17, 19,
+                                          23, 29, 31, 37, 41, 43, 47, 53};
+
+/** Radical inverse of index in the given base, the base is a constant to avoid divisions */
+template <typename T, std::uint32_t Base>
+constexpr T
+radical_inverse(std::uint64_t index)
+{
+    constexpr double inv_base = 1.0 / Base;
+    double           factor   = inv_base;
+    double           result   = 0;
+    while (index > 0) {
+        result += (index % Base) * factor;
+        index /= Base;
+        factor *= inv_base;
+    }
+    // Rounding to float may give exactly 1
+    return std::min(T(result), T(1) - std::numeric_limits<T>::epsilon() / 2);
+}
+
+constexpr std::size_t sobol_max_dimensions = 8;
+constexpr std::size_t sobol_bits           = 32;
+
+/** Primitive polynomials and initial direction numbers from the Joe and Kuo table */
+struct sobol_polynomial {
+    std::uint32_t degree;
+    std::uint32_t coefficients;
+    std::uint32_t initial[5];
+};
+
+constexpr sobol_polynomial sobol_polynomials[sobol_max_dimensions - 1] = {
+    {1, 0, {1}},          {2, 1, {1, 3}},          {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},    {4, 1, {1, 1, 3, 3}},    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+};
+
+using sobol_directions = std::array<std::array<std::uint32_t, sobol_bits>, sobol_max_dimensions>;
+
+constexpr sobol_directions
+make_sobol_directions()
+{
+    sobol_directions dirs{};
+    for (std::size_t k = 0; k < sobol_bits; ++k) {
+        dirs[0][k] = std::uint32_t{1} << (sobol_bits - 1 - k);
+    }
+    for (std::size_t d = 1; d < sobol_max_dimensions; ++d) {
+        auto const& poly = sobol_polynomials[d - 1];
+        auto&       v    = dirs[d];
+        std::size_t s    = poly.degree;
+        for (std::size_t k = 0; k < s; ++k) {
+            v[k] = poly.initial[k] << (sobol_bits - 1 - k);
+        }
+        for (std::size_t k = s; k < sobol_bits; ++k) {
+            v[k] = v[k - s] ^ (v[k - s] >> s);
+            for (std::size_t j = 1; j < s; ++j) {
+                if ((poly.coefficients >> (s - 1 - j)) & 1)
+                    v[k] ^= v[k - j];
+            }
+        }
+    }
+    return dirs;
+}
+
+constexpr sobol_directions sobol_direction_numbers = make_sobol_directions();
+
+template <typename T>
+constexpr T
+sobol_to_unit(std::uint32_t x)
+{
+    if constexpr (sizeof(T) <= sizeof(float)) {
+        return T(static_cast<std::int32_t>(x >> 8) * (1.0f / (1u << 24)));
+    } else {
+        return T(x * (1.0 / (std::uint64_t{1} << 32)));
+    }
+}
+
+}    // namespace detail
+
+/**
+ * Halton low-discrepancy sequence in up to 16 dimensions
+ */
+template <typename T, std::size_t Dims>
+struct halton_sequence {
+    static_assert(Dims >= 1
+                      && Dims <= sizeof(detail::halton_bases) / sizeof(detail::halton_bases[0]),
+                  "Halton sequence supports 1 to 16 dimensions");
+    using result_type = vector<T, Dims>;
+
+    constexpr result_type
+    operator[](std::uint64_t index) const
+    {
+        return point(index, std::make_index_sequence<Dims>{});
+    }
+
+private:
+    template <std::size_t... D>
+    static constexpr result_type
+    point(std::uint64_t index, std::index_sequence<D...>)
+    {
+        return {detail::radical_inverse<T, detail::halton_bases[D]>(index)...};
+    }
+};
+
+/**
+ * Sobol low-discrepancy sequence in up to 8 dimensions for indexes below 2^32. A random stream
+ * gives a digitally shifted (scrambled) sequence, keeping the stratification of the points.
+ */
+template <typename T, std::size_t Dims>
+class sobol_sequence {
+public:
+    static_assert(Dims >= 1 && Dims <= detail::sobol_max_dimensions,
+                  "Sobol sequence supports 1 to 8 dimensions");
+    using result_type = vector<T, Dims>;
+
+    constexpr sobol_sequence() = default;
+    constexpr explicit sobol_sequence(random_stream const& s)
+    {
+        for (std::size_t d = 0; d < Dims; ++d) {
+            shift_[d] = s.bits(d / 4)[d % 4];
+        }
+    }
+
+    constexpr result_type
+    operator[](std::uint64_t index) const
+    {
+        auto bits = point_bits(index);
+        return to_point(bits);
+    }
+
+    /**
+     * Fill points [first, first + count), incrementally changing the point for the bits that
+     * change between consecutive indexes. The whole range must be below 2^32.
+     */
+    template <typename Store>
+    void
+    generate(std::uint64_t first, std::size_t count, Store&& store) const
+    {
+        constexpr std::uint64_t size = std::uint64_t{1} << detail::sobol_bits;
+        if (first > size || count > size - first)
+            throw std::out_of_range{"Sobol sequence index is too large"};
+        if (count == 0)
+            return;
+        auto bits = point_bits(first);
+        for (std::size_t i = 0;; ++i) {
+            store(i, to_point(bits));
+            if (i + 1 == count)
+                break;
+            auto const index = first + i;
+            auto const k     = trailing_ones(index);
+            for (std::size_t d = 0; d < Dims; ++d) {
+                bits[d] ^= prefix_directions[d][k];
+            }
+        }
+    }
+
+private:
+    using bits_type = std::array<std::uint32_t, Dims>;
+
+    static constexpr std::size_t
+    trailing_ones(std::uint64_t index)
+    {
+        std::size_t k = 0;
+        while (index & 1) {
+            index >>= 1;
+            ++k;
+        }
+        return k;
+    }
+
+    static constexpr detail::sobol_directions
+    make_prefix_directions()
+    {
+        auto res = detail::sobol_direction_numbers;
+        for (auto& dim : res) {
+            for (std::size_t k = 1; k < detail::sobol_bits; ++k) {
+                dim[k] ^= dim[k - 1];
+            }
+        }
+        return res;
+    }
+
+    /** XOR of direction numbers 0..k, the change from index i to i + 1 with k trailing ones */
+    static constexpr detail::sobol_directions prefix_directions = make_prefix_directions();
+
+    constexpr bits_type
+    point_bits(std::uint64_t index) const
+    {
+        if (index >> detail::sobol_bits)
+            throw std::out_of_range{"Sobol sequence index is too large"};
+        bits_type bits = shift_;
+        for (std::size_t k = 0; index != 0; ++k, index >>= 1) {
+            if (index & 1) {
+                for (std::size_t d = 0; d < Dims; ++d) {
+                    bits[d] ^= detail::sobol_direction_numbers[d][k];
+                }
+            }
+        }
+        return bits;
+    }
+
+    constexpr result_type
+    to_point(bits_type const& bits) const
+    {
+        result_type res;
+        for (std::size_t d = 0; d < Dims; ++d) {
+            res[d] = detail::sobol_to_unit<T>(bits[d]);
+        }
+        return res;
+    }
+
+    bits_type shift_ = {};
+};
+
+/**
+ * Jittered stratified samples in the unit square: a grid of cells, a point at a random position
+ * in each cell. Points of consecutive indexes walk the cells row by row and start over after
+ * all cells.
+ */
+template <typename T>
+class stratified_sequence {
+public:
+    using result_type = vector<T, 2>;
+
+    stratified_sequence(std::size_t cols, std::size_t rows, random_stream const& s)
+        : cols_{cols}, rows_{rows}, stream_{s}
+    {
+        if (cols == 0 || rows == 0)
+            throw std::invalid_argument{"Stratified grid must not be empty"};
+    }
+
+    result_type
+    operator[](std::uint64_t index) const
+    {
+        counter_uniform_distribution<T> const dist;
+        auto const                            cell = index % (cols_ * rows_);
+        return {(cell % cols_ + stream_.sample(dist, index * 2)) / cols_,
+                (cell / cols_ + stream_.sample(dist, index * 2 + 1)) / rows_};
+    }
+
+private:
+    std::size_t   cols_;
+    std::size_t   rows_;
+    random_stream stream_;
+};
+
+namespace detail {
+
+struct null_store {
+    template <typename Value>
+    void
+    operator()(std::size_t, Value const&) const
+    {}
+};
+
+/** The sequence computes consecutive points faster than separate ones */
+template <typename Sequence, typename = void>
+struct has_incremental_generate : std::false_type {};
+
+template <typename Sequence>
+struct has_incremental_generate<Sequence,
+                                utils::void_t<decltype(std::declval<Sequence const&>().generate(
+                                    std::uint64_t{}, std::size_t{}, null_store{}))>>
+    : std::true_type {};
+
+template <typename Sequence, typename Store>
+void
+generate_sequence(Sequence const& seq, std::uint64_t first, std::size_t count, Store&& store)
+{
+    if constexpr (has_incremental_generate<Sequence>::value) {
+        seq.generate(first, count, store);
+    } else {
+        for (std::size_t i = 0; i < count; ++i) {
+            store(i, seq[first + i]);
+        }
+    }
+}
+
+}    // namespace detail
+
+/**
+ * Fill an array with points offset, offset + 1, ... of a sequence
+ */
+template <typename Sequence>
+void
+fill_sequence(typename Sequence::result_type* data, std::size_t count, Sequence const& seq,
+              std::uint64_t offset = 0, parallel_options const& opts = {})
+{
+    detail::parallel_for(count, opts, [&](std::size_t first, std::size_t last) {
+        detail::generate_sequence(seq, offset + first, last - first,
+                                  [p = data + first](std::size_t i, auto const& v) { p[i] = v; });
+    });
+}
+
+/**
+ * Fill a buffer of vectors with points of a sequence
+ */
+template <typename T, std::size_t Size, typename Components, typename Sequence>
+void
+fill_sequence(memory_vector_view<T*, Size, Components> view, Sequence const& seq,
+              std::uint64_t offset = 0, parallel_options const& opts = {})
+{
+    static_assert(traits::vector_expression_size_v<typename Sequence::result_type> == Size,
+                  "Sequence dimensions don't match the buffer");
+    detail::parallel_for(view.size(), opts, [&](std::size_t first, std::size_t last) {
+        detail::generate_sequence(seq, offset + first, last - first,
+                                  [&view, first](std::size_t i, auto const& v) {
+                                      view[first + i] = v;
+                                  });
+    });
+}
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_RANDOM_SAMPLERS_HPP_ */
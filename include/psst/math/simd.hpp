@@ -0,0 +1,473 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * simd.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_SIMD_HPP_
+#define PSST_MATH_SIMD_HPP_
+
+#include <psst/math/detail/value_traits.hpp>
+#include <psst/math/vector.hpp>
+#include <psst/math/vmath.hpp>
+
+#include <cmath>
+#include <type_traits>
+
+#if !defined(__GNUC__)
+#error "SIMD packs are built on the vector extensions of GCC and Clang"
+#endif
+
+namespace psst {
+namespace math {
+
+template <typename T, std::size_t N>
+struct simd;
+
+namespace detail {
+
+/**
+ * Vector extension type of N lanes of T. Operators on it compile to instructions of the target,
+ * wider vectors are split to several registers.
+ */
+template <typename T, std::size_t N>
+struct simd_native {
+    typedef T type __attribute__((vector_size(sizeof(T) * N)));
+    /** Integer lanes of the same width, the result of comparisons */
+    using mask_type = decltype(type{} < type{});
+};
+
+}    // namespace detail
+
+//----------------------------------------------------------------------------
+/**
+ * Result of a lane-wise comparison of two packs, a lane is all ones when the comparison holds
+ * for it. Use all_lanes/any_lane to branch on a mask and select to blend two packs with it.
+ */
+template <typename T, std::size_t N>
+struct simd_mask {
+    using native_type = typename detail::simd_native<T, N>::mask_type;
+    using pack_type   = simd<T, N>;
+
+    static constexpr std::size_t lanes = N;
+
+    constexpr simd_mask() : data_{} {}
+    constexpr /* implicit */ simd_mask(bool v) : data_{native_type{} - (v ? 1 : 0)} {}
+    constexpr explicit simd_mask(native_type const& v) : data_{v} {}
+
+    constexpr bool
+    operator[](std::size_t idx) const
+    {
+        return data_[idx] != 0;
+    }
+    constexpr native_type const&
+    native() const
+    {
+        return data_;
+    }
+
+    friend constexpr simd_mask
+    operator!(simd_mask const& m)
+    {
+        return simd_mask{~m.data_};
+    }
+    friend constexpr simd_mask
+    operator&&(simd_mask const& lhs, simd_mask const& rhs)
+    {
+        return simd_mask{lhs.data_ & rhs.data_};
+    }
+    friend constexpr simd_mask
+    operator||(simd_mask const& lhs, simd_mask const& rhs)
+    {
+        return simd_mask{lhs.data_ | rhs.data_};
+    }
+
+    friend constexpr bool
+    all_lanes(simd_mask const& m)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (m.data_[i] == 0)
+                return false;
+        }
+        return true;
+    }
+    friend constexpr bool
+    any_lane(simd_mask const& m)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (m.data_[i] != 0)
+                return true;
+        }
+        return false;
+    }
+
+    /** Lanes of `lhs` where the mask is set and lanes of `rhs` elsewhere */
+    friend constexpr pack_type
+    select(simd_mask const& m, pack_type const& lhs, pack_type const& rhs)
+    {
+        return pack_type{m.data_ ? lhs.native() : rhs.native()};
+    }
+
+private:
+    native_type data_;
+};
+
+//----------------------------------------------------------------------------
+/**
+ * A pack of N scalars processed by one instruction. The pack is a scalar for the expression
+ * templates, so vector<simd<float, 8>, 3> holds eight 3D vectors with each component in a
+ * pack of its own and every vector or matrix expression computes the eight results at once.
+ * Arithmetic is lane-wise, comparison operators give a simd_mask.
+ *
+ * A pack as wide as a vector register of the target performs best, e.g. simd<float, 4> for
+ * SSE or simd<float, 8> for AVX, wider packs take several instructions per operation.
+ * Under -ffast-math GCC computes the square root of float lanes by a reciprocal estimate and a
+ * Newton step, the result can differ from the scalar std::sqrt in the last bit.
+ */
+template <typename T, std::size_t N>
+struct simd {
+    static_assert(std::is_arithmetic<T>::value, "Lanes of a SIMD pack must be arithmetic");
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Number of lanes must be a power of two");
+
+    using value_type  = T;
+    using mask_type   = simd_mask<T, N>;
+    using native_type = typename detail::simd_native<T, N>::type;
+
+    static constexpr std::size_t lanes = N;
+
+    constexpr simd() : data_{} {}
+    /** Broadcast a value to all lanes */
+    constexpr /* implicit */ simd(value_type v) : data_{native_type{} + v} {}
+    constexpr explicit simd(native_type const& v) : data_{v} {}
+
+    /** Load N consecutive values */
+    static simd
+    load(value_type const* p)
+    {
+        simd res;
+        for (std::size_t i = 0; i < N; ++i) {
+            res.data_[i] = p[i];
+        }
+        return res;
+    }
+    /** Store lanes to N consecutive values */
+    void
+    store(value_type* p) const
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            p[i] = data_[i];
+        }
+    }
+
+    value_type&
+    operator[](std::size_t idx)
+    {
+        // GCC lets the element type alias a vector
+        return reinterpret_cast<value_type*>(&data_)[idx];
+    }
+    constexpr value_type
+    operator[](std::size_t idx) const
+    {
+        return data_[idx];
+    }
+    /** The vector extension value, e.g. to pass to intrinsics */
+    constexpr native_type const&
+    native() const
+    {
+        return data_;
+    }
+
+    //@{
+    /** @name Arithmetic */
+    friend constexpr simd
+    operator-(simd const& v)
+    {
+        return simd{-v.data_};
+    }
+    friend constexpr simd
+    operator+(simd const& lhs, simd const& rhs)
+    {
+        return simd{lhs.data_ + rhs.data_};
+    }
+    friend constexpr simd
+    operator-(simd const& lhs, simd const& rhs)
+    {
+        return simd{lhs.data_ - rhs.data_};
+    }
+    friend constexpr simd
+    operator*(simd const& lhs, simd const& rhs)
+    {
+        return simd{lhs.data_ * rhs.data_};
+    }
+    friend constexpr simd
+    operator/(simd const& lhs, simd const& rhs)
+    {
+        return simd{lhs.data_ / rhs.data_};
+    }
+    constexpr simd&
+    operator+=(simd const& rhs)
+    {
+        data_ += rhs.data_;
+        return *this;
+    }
+    constexpr simd&
+    operator-=(simd const& rhs)
+    {
+        data_ -= rhs.data_;
+        return *this;
+    }
+    constexpr simd&
+    operator*=(simd const& rhs)
+    {
+        data_ *= rhs.data_;
+        return *this;
+    }
+    constexpr simd&
+    operator/=(simd const& rhs)
+    {
+        data_ /= rhs.data_;
+        return *this;
+    }
+    //@}
+
+    //@{
+    /** @name Lane-wise comparison */
+    friend constexpr mask_type
+    operator==(simd const& lhs, simd const& rhs)
+    {
+        return mask_type{lhs.data_ == rhs.data_};
+    }
+    friend constexpr mask_type
+    operator!=(simd const& lhs, simd const& rhs)
+    {
+        return mask_type{lhs.data_ != rhs.data_};
+    }
+    friend constexpr mask_type
+    operator<(simd const& lhs, simd const& rhs)
+    {
+        return mask_type{lhs.data_ < rhs.data_};
+    }
+    friend constexpr mask_type
+    operator<=(simd const& lhs, simd const& rhs)
+    {
+        return mask_type{lhs.data_ <= rhs.data_};
+    }
+    friend constexpr mask_type
+    operator>(simd const& lhs, simd const& rhs)
+    {
+        return mask_type{lhs.data_ > rhs.data_};
+    }
+    friend constexpr mask_type
+    operator>=(simd const& lhs, simd const& rhs)
+    {
+        return mask_type{lhs.data_ >= rhs.data_};
+    }
+    //@}
+
+    //@{
+    /**
+     * @name Lane-wise functions
+     * Loops over lanes. sin, cos and atan2 of float and double lanes are the vmath functions,
+     * their polynomial kernels are vectorized by the compiler. The other functions are vectorized
+     * when a vector math library is available for the target.
+     */
+    friend simd
+    sqrt(simd const& v)
+    {
+        return v.transform([](value_type a) { return std::sqrt(a); });
+    }
+    friend simd
+    abs(simd const& v)
+    {
+        return select(v < 0, -v, v);
+    }
+    friend simd
+    min(simd const& lhs, simd const& rhs)
+    {
+        return select(rhs < lhs, rhs, lhs);
+    }
+    friend simd
+    max(simd const& lhs, simd const& rhs)
+    {
+        return select(lhs < rhs, rhs, lhs);
+    }
+    friend simd
+    sin(simd const& v)
+    {
+        if constexpr (vmath::detail::has_kernels<value_type>) {
+            return vmath::sin(v);
+        } else {
+            return v.transform([](value_type a) { return std::sin(a); });
+        }
+    }
+    friend simd
+    cos(simd const& v)
+    {
+        if constexpr (vmath::detail::has_kernels<value_type>) {
+            return vmath::cos(v);
+        } else {
+            return v.transform([](value_type a) { return std::cos(a); });
+        }
+    }
+    friend simd
+    acos(simd const& v)
+    {
+        return v.transform([](value_type a) { return std::acos(a); });
+    }
+    friend simd
+    atan2(simd const& y, simd const& x)
+    {
+        if constexpr (vmath::detail::has_kernels<value_type>) {
+            return vmath::atan2(y, x);
+        } else {
+            simd res;
+            for (std::size_t i = 0; i < N; ++i) {
+                res.data_[i] = std::atan2(y.data_[i], x.data_[i]);
+            }
+            return res;
+        }
+    }
+    //@}
+
+private:
+    template <typename Func>
+    simd
+    transform(Func f) const
+    {
+        simd res;
+        for (std::size_t i = 0; i < N; ++i) {
+            res.data_[i] = f(data_[i]);
+        }
+        return res;
+    }
+
+    native_type data_;
+};
+
+//----------------------------------------------------------------------------
+//  Traits
+//----------------------------------------------------------------------------
+namespace traits {
+
+template <typename T, std::size_t N>
+struct is_simd_pack<simd<T, N>> : std::true_type {};
+
+namespace detail {
+
+/** Magnitude of a pack is a pack of magnitudes of the lanes */
+template <typename T, std::size_t N, bool B>
+struct magnitude_traits_impl<simd<T, N>, B> {
+    using value_type     = simd<T, N>;
+    using magnitude_type = simd<typename scalar_value_traits<T>::magnitude_type, N>;
+};
+
+/**
+ * Comparison of packs. The lane-wise functions give masks, the bool functions reduce them:
+ * packs are equal when all lanes are equal and are ordered by the first lane that is not.
+ */
+template <typename T, std::size_t N>
+struct compare_traits<simd<T, N>> {
+    using value_type  = simd<T, N>;
+    using mask_type   = simd_mask<T, N>;
+    using lane_traits = compare_traits<T>;
+    using iota_type   = iota<T>;
+
+    static constexpr bool is_float = std::is_floating_point<T>::value;
+
+    static mask_type
+    eq_lanes(value_type const& lhs, value_type const& rhs)
+    {
+        if constexpr (is_float) {
+            return abs(rhs - lhs) <= iota_type::value;
+        } else {
+            return lhs == rhs;
+        }
+    }
+    static mask_type
+    less_lanes(value_type const& lhs, value_type const& rhs)
+    {
+        if constexpr (is_float) {
+            return rhs - lhs > iota_type::value;
+        } else {
+            return lhs < rhs;
+        }
+    }
+
+    static bool
+    eq(value_type const& lhs, value_type const& rhs)
+    {
+        return all_lanes(eq_lanes(lhs, rhs));
+    }
+    static bool
+    less(value_type const& lhs, value_type const& rhs)
+    {
+        return cmp(lhs, rhs) < 0;
+    }
+    static int
+    cmp(value_type const& lhs, value_type const& rhs)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (auto res = lane_traits::cmp(lhs[i], rhs[i]); res != 0) {
+                return res;
+            }
+        }
+        return 0;
+    }
+};
+
+}    // namespace detail
+}    // namespace traits
+
+//----------------------------------------------------------------------------
+//  Transposing vectors to and from packs
+//----------------------------------------------------------------------------
+/**
+ * Load N consecutive vectors into a vector of packs, lane i of the result holds src[i]
+ */
+template <std::size_t N, typename T, std::size_t Size, typename Components>
+vector<simd<T, N>, Size, Components>
+load_lanes(vector<T, Size, Components> const* src)
+{
+    vector<simd<T, N>, Size, Components> res;
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t c = 0; c < Size; ++c) {
+            res[c][i] = src[i][c];
+        }
+    }
+    return res;
+}
+
+/**
+ * Store lanes of a vector of packs to N consecutive vectors
+ */
+template <typename T, std::size_t N, std::size_t Size, typename Components>
+void
+store_lanes(vector<simd<T, N>, Size, Components> const& packs, vector<T, Size, Components>* dst)
+{
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t c = 0; c < Size; ++c) {
+            dst[i][c] = packs[c][i];
+        }
+    }
+}
+
+/**
+ * Vector in lane `idx` of a vector of packs
+ */
+template <typename T, std::size_t N, std::size_t Size, typename Components>
+vector<T, Size, Components>
+lane(vector<simd<T, N>, Size, Components> const& packs, std::size_t idx)
+{
+    vector<T, Size, Components> res;
+    for (std::size_t c = 0; c < Size; ++c) {
+        res[c] = packs[c][idx];
+    }
+    return res;
+}
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_SIMD_HPP_ */
@@ -0,0 +1,710 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * sparse_matrix.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_SPARSE_MATRIX_HPP_
+#define PSST_MATH_SPARSE_MATRIX_HPP_
+
+#include <psst/math/math_policy.hpp>
+#include <psst/math/matrix.hpp>
+#include <psst/math/parallel.hpp>
+#include <psst/math/vector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Sparse matrices in the compressed sparse row (CSR) format and the conjugate gradient solver.
+ *
+ * sparse_matrix<T> stores the non-zero values of a matrix of scalars row by row.
+ * block_sparse_matrix<T, B>, a sparse_matrix<matrix<T, B, B>>, stores B x B blocks and multiplies
+ * buffers of vector<T, B>, e.g. the 3x3 blocks of the stiffness matrix of a mesh. The matrices
+ * are assembled by sparse_matrix_builder from (row, column, value) triplets, duplicates are
+ * summed.
+ *
+ *     sparse_matrix_builder<float> builder{n, n};
+ *     builder.add(0, 0, 2.f);
+ *     ...
+ *     sparse_matrix<float> a = builder.build();
+ *     std::vector<float> y = a * x;
+ *     conjugate_gradient(a, b.data(), x.data());
+ *
+ * The rows are split between threads by parallel_options. A row is summed in four independent
+ * accumulators, which hide the latency of the additions. The sums are the same for any number of
+ * threads.
+ *
+ * The column indexes are 32 bit, the number of columns is limited to 2^32 - 1.
+ */
+namespace psst {
+namespace math {
+
+namespace detail {
+
+/**
+ * Types of a sparse matrix values. The value is a scalar or a B x B matrix block, the matrix
+ * multiplies buffers of the scalars or of vectors of size B.
+ */
+template <typename Value>
+struct sparse_value_traits {
+    using scalar_type                     = Value;
+    using vector_type                     = Value;
+    static constexpr std::size_t block_size = 1;
+
+    static constexpr scalar_type
+    component(vector_type const& v, std::size_t)
+    {
+        return v;
+    }
+};
+
+template <typename T, std::size_t B, typename Components>
+struct sparse_value_traits<matrix<T, B, B, Components>> {
+    using scalar_type                     = T;
+    using vector_type                     = vector<T, B, Components>;
+    static constexpr std::size_t block_size = B;
+
+    static constexpr scalar_type
+    component(vector_type const& v, std::size_t idx)
+    {
+        return v[idx];
+    }
+};
+
+}    // namespace detail
+
+/** Sparse matrix in the compressed sparse row format */
+template <typename Value>
+struct sparse_matrix {
+    using value_traits = detail::sparse_value_traits<Value>;
+    using value_type   = Value;
+    using scalar_type  = typename value_traits::scalar_type;
+    /** Type of the elements of the vectors multiplied by the matrix */
+    using vector_type = typename value_traits::vector_type;
+    using index_type  = std::uint32_t;
+
+    static constexpr std::size_t block_size = value_traits::block_size;
+
+    sparse_matrix() = default;
+
+    /**
+     * Matrix of the given compressed rows. The column indexes of a row must be sorted and unique.
+     * @param row_offsets rows + 1 offsets of the rows in the indexes and values
+     */
+    sparse_matrix(std::size_t rows, std::size_t cols, std::vector<std::size_t> row_offsets,
+                  std::vector<index_type> col_indexes, std::vector<value_type> values)
+        : rows_{rows},
+          cols_{cols},
+          row_offsets_{std::move(row_offsets)},
+          col_indexes_{std::move(col_indexes)},
+          values_{std::move(values)}
+    {
+        if (cols_ > std::numeric_limits<index_type>::max())
+            throw std::runtime_error{"Too many columns in a sparse matrix"};
+        if (row_offsets_.size() != rows_ + 1 || row_offsets_.front() != 0
+            || row_offsets_.back() != values_.size() || col_indexes_.size() != values_.size()
+            || !std::is_sorted(row_offsets_.begin(), row_offsets_.end()))
+            throw std::runtime_error{"Invalid compressed rows of a sparse matrix"};
+        for (std::size_t r = 0; r < rows_; ++r) {
+            for (auto k = row_offsets_[r]; k < row_offsets_[r + 1]; ++k) {
+                if (col_indexes_[k] >= cols_
+                    || (k > row_offsets_[r] && col_indexes_[k] <= col_indexes_[k - 1]))
+                    throw std::runtime_error{"Invalid column indexes of a sparse matrix"};
+            }
+        }
+    }
+
+    std::size_t
+    rows() const
+    {
+        return rows_;
+    }
+    std::size_t
+    cols() const
+    {
+        return cols_;
+    }
+    /** Number of the stored values */
+    std::size_t
+    nonzero_count() const
+    {
+        return values_.size();
+    }
+
+    std::vector<std::size_t> const&
+    row_offsets() const
+    {
+        return row_offsets_;
+    }
+    std::vector<index_type> const&
+    col_indexes() const
+    {
+        return col_indexes_;
+    }
+    std::vector<value_type> const&
+    values() const
+    {
+        return values_;
+    }
+    /** The values can be changed in place, the structure stays the same */
+    std::vector<value_type>&
+    values()
+    {
+        return values_;
+    }
+
+    /** The value at the row and column, zero if it is not stored */
+    value_type
+    operator()(std::size_t row, std::size_t col) const
+    {
+        auto const pos = find(row, col);
+        return pos == npos ? value_type{} : values_[pos];
+    }
+
+    /**
+     * Reference to a stored value, e.g. for assembling into a matrix of the same structure.
+     * @throws std::out_of_range if the value is not stored
+     */
+    value_type&
+    at(std::size_t row, std::size_t col)
+    {
+        auto const pos = find(row, col);
+        if (pos == npos)
+            throw std::out_of_range{"The element is not stored in the sparse matrix"};
+        return values_[pos];
+    }
+
+    /** Set all stored values, keeping the structure */
+    void
+    fill(value_type const& val)
+    {
+        std::fill(values_.begin(), values_.end(), val);
+    }
+
+    /** The elements of the main diagonal, zero where not stored */
+    std::vector<value_type>
+    diagonal() const
+    {
+        std::vector<value_type> res(std::min(rows_, cols_));
+        for (std::size_t r = 0; r < res.size(); ++r) {
+            res[r] = (*this)(r, r);
+        }
+        return res;
+    }
+
+private:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    std::size_t
+    find(std::size_t row, std::size_t col) const
+    {
+        if (row >= rows_ || col >= cols_)
+            return npos;
+        auto const first = col_indexes_.begin() + row_offsets_[row];
+        auto const last  = col_indexes_.begin() + row_offsets_[row + 1];
+        auto const pos   = std::lower_bound(first, last, col);
+        return pos != last && *pos == col ? pos - col_indexes_.begin() : npos;
+    }
+
+private:
+    std::size_t              rows_ = 0;
+    std::size_t              cols_ = 0;
+    std::vector<std::size_t> row_offsets_{0};
+    std::vector<index_type>  col_indexes_;
+    std::vector<value_type>  values_;
+};
+
+template <typename T, std::size_t B, typename Components = components::default_components_t<B>>
+using block_sparse_matrix = sparse_matrix<matrix<T, B, B, Components>>;
+
+//----------------------------------------------------------------------------
+/**
+ * Column view of a sparse matrix, the compressed sparse column (CSC) structure of the matrix. The
+ * values are not copied, the view refers to the values of the matrix by their positions, so it
+ * sees the changes of the values, but not of the structure. The view must not outlive the matrix.
+ */
+template <typename Value>
+struct sparse_matrix_columns {
+    using matrix_type = sparse_matrix<Value>;
+    using value_type  = Value;
+    using index_type  = typename matrix_type::index_type;
+
+    explicit sparse_matrix_columns(matrix_type const& mtx)
+        : matrix_{&mtx},
+          col_offsets_(mtx.cols() + 1, 0),
+          row_indexes_(mtx.nonzero_count()),
+          positions_(mtx.nonzero_count())
+    {
+        auto const& offsets = mtx.row_offsets();
+        auto const& cols    = mtx.col_indexes();
+        for (auto c : cols) {
+            ++col_offsets_[c + 1];
+        }
+        std::partial_sum(col_offsets_.begin(), col_offsets_.end(), col_offsets_.begin());
+        std::vector<std::size_t> next(col_offsets_.begin(), col_offsets_.end() - 1);
+        for (std::size_t r = 0; r < mtx.rows(); ++r) {
+            for (auto k = offsets[r]; k < offsets[r + 1]; ++k) {
+                auto const pos    = next[cols[k]]++;
+                row_indexes_[pos] = static_cast<index_type>(r);
+                positions_[pos]   = k;
+            }
+        }
+    }
+
+    matrix_type const&
+    matrix() const
+    {
+        return *matrix_;
+    }
+    std::size_t
+    cols() const
+    {
+        return col_offsets_.size() - 1;
+    }
+    std::vector<std::size_t> const&
+    col_offsets() const
+    {
+        return col_offsets_;
+    }
+    /** Row indexes of the values of the columns, sorted in each column */
+    std::vector<index_type> const&
+    row_indexes() const
+    {
+        return row_indexes_;
+    }
+    /** Positions of the values of the columns in the values of the matrix */
+    std::vector<std::size_t> const&
+    positions() const
+    {
+        return positions_;
+    }
+
+private:
+    matrix_type const*       matrix_;
+    std::vector<std::size_t> col_offsets_;
+    std::vector<index_type>  row_indexes_;
+    std::vector<std::size_t> positions_;
+};
+
+template <typename Value>
+sparse_matrix_columns<Value>
+columns(sparse_matrix<Value> const& mtx)
+{
+    return sparse_matrix_columns<Value>{mtx};
+}
+
+//----------------------------------------------------------------------------
+/**
+ * Assembly of a sparse matrix from (row, column, value) triplets. The triplets are added in any
+ * order, the values of the same element are summed in the order they were added. The builder
+ * can be built several times, e.g. after adding the contributions of more elements of a mesh.
+ */
+template <typename Value>
+struct sparse_matrix_builder {
+    using matrix_type = sparse_matrix<Value>;
+    using value_type  = Value;
+    using index_type  = typename matrix_type::index_type;
+
+    sparse_matrix_builder(std::size_t rows, std::size_t cols) : rows_{rows}, cols_{cols}
+    {
+        if (cols_ > std::numeric_limits<index_type>::max())
+            throw std::runtime_error{"Too many columns in a sparse matrix"};
+    }
+
+    std::size_t
+    rows() const
+    {
+        return rows_;
+    }
+    std::size_t
+    cols() const
+    {
+        return cols_;
+    }
+    /** Number of the triplets added */
+    std::size_t
+    size() const
+    {
+        return triplets_.size();
+    }
+
+    void
+    reserve(std::size_t count)
+    {
+        triplets_.reserve(count);
+    }
+
+    /** @throws std::out_of_range if the element is outside of the matrix */
+    void
+    add(std::size_t row, std::size_t col, value_type const& val)
+    {
+        if (row >= rows_ || col >= cols_)
+            throw std::out_of_range{"The element is outside of the sparse matrix"};
+        triplets_.push_back({row, static_cast<index_type>(col), val});
+    }
+
+    void
+    clear()
+    {
+        triplets_.clear();
+    }
+
+    /** The matrix of the triplets, by counting sort of the triplets by rows */
+    matrix_type
+    build() const
+    {
+        std::vector<std::size_t> row_starts(rows_ + 1, 0);
+        for (auto const& t : triplets_) {
+            ++row_starts[t.row + 1];
+        }
+        std::partial_sum(row_starts.begin(), row_starts.end(), row_starts.begin());
+        std::vector<std::size_t> order(triplets_.size());
+        std::vector<std::size_t> next(row_starts.begin(), row_starts.end() - 1);
+        for (std::size_t i = 0; i < triplets_.size(); ++i) {
+            order[next[triplets_[i].row]++] = i;
+        }
+
+        std::vector<std::size_t> row_offsets(rows_ + 1, 0);
+        std::vector<index_type>  col_indexes;
+        std::vector<value_type>  values;
+        col_indexes.reserve(triplets_.size());
+        values.reserve(triplets_.size());
+        for (std::size_t r = 0; r < rows_; ++r) {
+            auto const first = order.begin() + row_starts[r];
+            auto const last  = order.begin() + row_starts[r + 1];
+            std::stable_sort(first, last, [this](std::size_t lhs, std::size_t rhs) {
+                return triplets_[lhs].col < triplets_[rhs].col;
+            });
+            for (auto it = first; it != last; ++it) {
+                auto const& t = triplets_[*it];
+                if (col_indexes.size() > row_offsets[r] && col_indexes.back() == t.col) {
+                    values.back() = values.back() + t.value;
+                } else {
+                    col_indexes.push_back(t.col);
+                    values.push_back(t.value);
+                }
+            }
+            row_offsets[r + 1] = values.size();
+        }
+        return matrix_type{rows_, cols_, std::move(row_offsets), std::move(col_indexes),
+                           std::move(values)};
+    }
+
+private:
+    struct triplet {
+        std::size_t row;
+        index_type  col;
+        value_type  value;
+    };
+
+    std::size_t          rows_;
+    std::size_t          cols_;
+    std::vector<triplet> triplets_;
+};
+
+//----------------------------------------------------------------------------
+//@{
+/** @name Sparse matrix by dense vector products */
+namespace detail {
+
+/** Number of independent accumulators of a row product */
+constexpr std::size_t sparse_row_lanes = 4;
+
+template <typename Value, typename Index, typename Vector>
+Vector
+sparse_row_product(Value const* values, Index const* indexes, std::size_t count, Vector const* x)
+{
+    if constexpr (sparse_value_traits<Value>::block_size == 1) {
+        Value       acc[sparse_row_lanes]{};
+        std::size_t k = 0;
+        for (; k + sparse_row_lanes <= count; k += sparse_row_lanes) {
+            for (std::size_t l = 0; l < sparse_row_lanes; ++l) {
+                acc[l] += values[k + l] * x[indexes[k + l]];
+            }
+        }
+        for (std::size_t l = 0; k < count; ++k, ++l) {
+            acc[l] += values[k] * x[indexes[k]];
+        }
+        return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+    } else {
+        // The rows of a block are independent accumulators
+        constexpr std::size_t B = sparse_value_traits<Value>::block_size;
+        using scalar_type       = typename sparse_value_traits<Value>::scalar_type;
+        scalar_type acc[B]{};
+        for (std::size_t k = 0; k < count; ++k) {
+            auto const& block = values[k];
+            auto const& v     = x[indexes[k]];
+            for (std::size_t r = 0; r < B; ++r) {
+                for (std::size_t c = 0; c < B; ++c) {
+                    acc[r] += block[r][c] * v[c];
+                }
+            }
+        }
+        Vector res;
+        for (std::size_t r = 0; r < B; ++r) {
+            res[r] = acc[r];
+        }
+        return res;
+    }
+}
+
+/** The product of the transposed value by the vector, accumulated to the result */
+template <typename Value, typename Vector>
+void
+sparse_transposed_multiply_add(Value const& val, Vector const& v, Vector& res)
+{
+    if constexpr (sparse_value_traits<Value>::block_size == 1) {
+        res += val * v;
+    } else {
+        constexpr std::size_t B = sparse_value_traits<Value>::block_size;
+        for (std::size_t r = 0; r < B; ++r) {
+            for (std::size_t c = 0; c < B; ++c) {
+                res[c] += val[r][c] * v[r];
+            }
+        }
+    }
+}
+
+}    // namespace detail
+
+/**
+ * y = a * x, the buffers of a.cols() and a.rows() elements must not overlap.
+ * The rows are split between threads by the options.
+ */
+template <typename Value>
+void
+multiply(sparse_matrix<Value> const& a, typename sparse_matrix<Value>::vector_type const* x,
+         typename sparse_matrix<Value>::vector_type* y, parallel_options const& opts = {})
+{
+    auto const* offsets = a.row_offsets().data();
+    auto const* indexes = a.col_indexes().data();
+    auto const* values  = a.values().data();
+    math::detail::parallel_for(a.rows(), opts, [&](std::size_t first, std::size_t last) {
+        for (std::size_t r = first; r < last; ++r) {
+            y[r] = detail::sparse_row_product(values + offsets[r], indexes + offsets[r],
+                                              offsets[r + 1] - offsets[r], x);
+        }
+    });
+}
+
+/**
+ * y = transpose(a) * x by the column view of the matrix, the buffers of a.rows() and a.cols()
+ * elements must not overlap. The columns are split between threads by the options.
+ */
+template <typename Value>
+void
+multiply_transposed(sparse_matrix_columns<Value> const&               a,
+                    typename sparse_matrix<Value>::vector_type const* x,
+                    typename sparse_matrix<Value>::vector_type*       y,
+                    parallel_options const&                           opts = {})
+{
+    using vector_type   = typename sparse_matrix<Value>::vector_type;
+    auto const* offsets = a.col_offsets().data();
+    auto const* rows    = a.row_indexes().data();
+    auto const* pos     = a.positions().data();
+    auto const* values  = a.matrix().values().data();
+    math::detail::parallel_for(a.cols(), opts, [&](std::size_t first, std::size_t last) {
+        for (std::size_t c = first; c < last; ++c) {
+            vector_type res{};
+            for (auto k = offsets[c]; k < offsets[c + 1]; ++k) {
+                detail::sparse_transposed_multiply_add(values[pos[k]], x[rows[k]], res);
+            }
+            y[c] = res;
+        }
+    });
+}
+
+template <typename Value>
+std::vector<typename sparse_matrix<Value>::vector_type>
+operator*(sparse_matrix<Value> const&                                    a,
+          std::vector<typename sparse_matrix<Value>::vector_type> const& x)
+{
+    if (x.size() != a.cols())
+        throw std::runtime_error{"Vector size doesn't match the sparse matrix"};
+    std::vector<typename sparse_matrix<Value>::vector_type> y(a.rows());
+    multiply(a, x.data(), y.data());
+    return y;
+}
+//@}
+
+//----------------------------------------------------------------------------
+//@{
+/** @name Conjugate gradient */
+struct solver_options {
+    /** Maximum number of iterations, 0 means the size of the system */
+    std::size_t max_iterations = 0;
+    /** The iterations stop when the norm of the residual is below tolerance * norm(b) */
+    double           tolerance = 1e-6;
+    parallel_options parallel  = {};
+};
+
+struct solver_result {
+    std::size_t iterations = 0;
+    /** Norm of the residual relative to the norm of b */
+    double residual  = 0;
+    bool   converged = false;
+};
+
+namespace detail {
+
+/** Dot product of two buffers, accumulated in a wider type for float */
+template <typename Scalar, typename Vector>
+auto
+sparse_dot(std::vector<Vector> const& lhs, std::vector<Vector> const& rhs)
+{
+    using accumulator = traits::wide_accumulator_t<Scalar>;
+    accumulator res{};
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        if constexpr (std::is_same<Vector, Scalar>{}) {
+            res += accumulator(lhs[i]) * accumulator(rhs[i]);
+        } else {
+            for (std::size_t c = 0; c < Vector::size; ++c) {
+                res += accumulator(lhs[i][c]) * accumulator(rhs[i][c]);
+            }
+        }
+    }
+    return res;
+}
+
+}    // namespace detail
+
+/**
+ * Solution of a x = b for a symmetric positive definite sparse matrix by the conjugate gradient
+ * method with the Jacobi preconditioner, the inverse of the diagonal of the matrix. For block
+ * matrices it is the diagonal of the diagonal blocks.
+ * @param b the right hand side of a.rows() elements
+ * @param x the initial guess on input and the solution on output
+ * @throws std::runtime_error if the matrix is not square or there is a zero on its diagonal
+ */
+template <typename Value>
+solver_result
+conjugate_gradient(sparse_matrix<Value> const&                       a,
+                   typename sparse_matrix<Value>::vector_type const* b,
+                   typename sparse_matrix<Value>::vector_type*       x,
+                   solver_options const&                             opts = {})
+{
+    using matrix_type  = sparse_matrix<Value>;
+    using vector_type  = typename matrix_type::vector_type;
+    using scalar_type  = typename matrix_type::scalar_type;
+    using value_traits = typename matrix_type::value_traits;
+
+    constexpr std::size_t B = matrix_type::block_size;
+    if (a.rows() != a.cols())
+        throw std::runtime_error{"Conjugate gradient requires a square matrix"};
+    auto const n = a.rows();
+
+    // Jacobi preconditioner
+    std::vector<vector_type> inv_diagonal(n);
+    {
+        auto const diagonal = a.diagonal();
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t c = 0; c < B; ++c) {
+                scalar_type d;
+                if constexpr (B == 1) {
+                    d = diagonal[i];
+                } else {
+                    d = diagonal[i][c][c];
+                }
+                if (d == scalar_type{})
+                    throw std::runtime_error{"Zero on the diagonal of the sparse matrix"};
+                if constexpr (B == 1) {
+                    inv_diagonal[i] = scalar_type{1} / d;
+                } else {
+                    inv_diagonal[i][c] = scalar_type{1} / d;
+                }
+            }
+        }
+    }
+    auto const precondition = [&](std::vector<vector_type> const& r, std::vector<vector_type>& z) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if constexpr (B == 1) {
+                z[i] = inv_diagonal[i] * r[i];
+            } else {
+                for (std::size_t c = 0; c < B; ++c) {
+                    z[i][c] = inv_diagonal[i][c] * r[i][c];
+                }
+            }
+        }
+    };
+    // y += s * x
+    auto const axpy = [&](auto s, std::vector<vector_type> const& v, vector_type* y) {
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t c = 0; c < B; ++c) {
+                auto const scaled = static_cast<scalar_type>(s * value_traits::component(v[i], c));
+                if constexpr (B == 1) {
+                    y[i] += scaled;
+                } else {
+                    y[i][c] += scaled;
+                }
+            }
+        }
+    };
+
+    std::vector<vector_type> r(n), z(n), p(n), q(n);
+    std::vector<vector_type> const rhs(b, b + n);
+    multiply(a, x, r.data(), opts.parallel);
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = rhs[i] - r[i];
+    }
+
+    auto const norm = [](std::vector<vector_type> const& v) {
+        return std::sqrt(static_cast<double>(detail::sparse_dot<scalar_type>(v, v)));
+    };
+
+    solver_result res;
+    auto const    b_norm = norm(rhs);
+    if (b_norm == 0) {
+        std::fill(x, x + n, vector_type{});
+        res.converged = true;
+        return res;
+    }
+    auto const max_iterations = opts.max_iterations == 0 ? n * B : opts.max_iterations;
+
+    precondition(r, z);
+    p       = z;
+    auto rz = detail::sparse_dot<scalar_type>(r, z);
+    for (;;) {
+        res.residual = norm(r) / b_norm;
+        if (res.residual <= opts.tolerance) {
+            res.converged = true;
+            break;
+        }
+        if (res.iterations >= max_iterations)
+            break;
+        ++res.iterations;
+
+        multiply(a, p.data(), q.data(), opts.parallel);
+        auto const pq = detail::sparse_dot<scalar_type>(p, q);
+        if (pq <= 0)
+            break;    // The matrix is not positive definite
+        auto const alpha = rz / pq;
+        axpy(alpha, p, x);
+        axpy(-alpha, q, r.data());
+
+        precondition(r, z);
+        auto const rz_next = detail::sparse_dot<scalar_type>(r, z);
+        auto const beta    = rz_next / rz;
+        rz                 = rz_next;
+        for (std::size_t i = 0; i < n; ++i) {
+            p[i] = z[i] + p[i] * static_cast<scalar_type>(beta);
+        }
+    }
+    return res;
+}
+//@}
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_SPARSE_MATRIX_HPP_ */
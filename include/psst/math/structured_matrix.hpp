@@ -0,0 +1,363 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * structured_matrix.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_STRUCTURED_MATRIX_HPP_
+#define PSST_MATH_STRUCTURED_MATRIX_HPP_
+
+#include <psst/math/matrix.hpp>
+#include <psst/math/vector.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Square matrices storing only their unique elements:
+ *   - diagonal_matrix<T, N> stores the N elements of the diagonal;
+ *   - lower_triangular_matrix<T, N> and upper_triangular_matrix<T, N> store the N * (N + 1) / 2
+ *     elements of the triangle;
+ *   - banded_matrix<T, N, Lower, Upper> stores Lower subdiagonals, the diagonal and Upper
+ *     superdiagonals;
+ *   - symmetric_matrix<T, N> stores the lower triangle, the upper one mirrors it.
+ *
+ * The elements are packed by rows. The matrices are matrix expressions, an element outside of the
+ * structure is a zero known at compile time. The expressions know their lower and upper
+ * bandwidths, products, sums, transposition and scaling propagate them. A product reads and
+ * multiplies only the elements inside the bands of both sides: one multiplication per element for
+ * a diagonal matrix, three per row of a tridiagonal matrix by a vector.
+ *
+ * A structured matrix constructed from an expression evaluates only the elements it stores, the
+ * elements of the expression outside of the structure are ignored:
+ *
+ *     symmetric_matrix<float, 4> cov = a * transpose(a);    // 10 of 16 dot products
+ *
+ * Triangular systems, including diagonal and banded triangular ones, are solved by solve(a, b).
+ */
+namespace psst {
+namespace math {
+
+namespace structure {
+
+/**
+ * Structure of a square matrix with Lower subdiagonals and Upper superdiagonals, the bandwidths
+ * are limited by the size of the matrix. A symmetric band stores the lower half only.
+ */
+template <std::size_t Lower, std::size_t Upper, bool Symmetric = false>
+struct band {
+    static_assert(!Symmetric || Lower == Upper, "A symmetric band has equal bandwidths");
+    static constexpr std::size_t lower     = Lower;
+    static constexpr std::size_t upper     = Upper;
+    static constexpr bool        symmetric = Symmetric;
+};
+
+using diagonal         = band<0, 0>;
+using lower_triangular = band<utils::npos_v, 0>;
+using upper_triangular = band<0, utils::npos_v>;
+using symmetric        = band<utils::npos_v, utils::npos_v, true>;
+template <std::size_t Lower, std::size_t Upper>
+using banded = band<Lower, Upper>;
+
+}    // namespace structure
+
+namespace detail {
+
+//@{
+/** @name Row-major packing of the elements inside a band of a square matrix of size N */
+template <std::size_t N, std::size_t Lower>
+constexpr std::size_t
+band_first_col(std::size_t r)
+{
+    return r > Lower ? r - Lower : 0;
+}
+
+template <std::size_t N, std::size_t Upper>
+constexpr std::size_t
+band_last_col(std::size_t r)
+{
+    return r + Upper < N ? r + Upper : N - 1;
+}
+
+template <std::size_t N, std::size_t Lower, std::size_t Upper>
+constexpr std::size_t
+band_row_offset(std::size_t r)
+{
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < r; ++i) {
+        offset += band_last_col<N, Upper>(i) - band_first_col<N, Lower>(i) + 1;
+    }
+    return offset;
+}
+
+template <std::size_t N, std::size_t Lower, std::size_t Upper>
+constexpr std::size_t
+band_index(std::size_t r, std::size_t c)
+{
+    return band_row_offset<N, Lower, Upper>(r) + c - band_first_col<N, Lower>(r);
+}
+
+template <std::size_t N, std::size_t Lower, std::size_t Upper>
+constexpr std::size_t
+band_row(std::size_t index)
+{
+    std::size_t r = 0;
+    while (band_row_offset<N, Lower, Upper>(r + 1) <= index) {
+        ++r;
+    }
+    return r;
+}
+
+template <std::size_t N, std::size_t Lower, std::size_t Upper>
+constexpr std::size_t
+band_col(std::size_t index)
+{
+    std::size_t const r = band_row<N, Lower, Upper>(index);
+    return band_first_col<N, Lower>(r) + index - band_row_offset<N, Lower, Upper>(r);
+}
+//@}
+
+}    // namespace detail
+
+/**
+ * Square matrix storing the elements inside its structure.
+ * @tparam T type of value in a matrix cell
+ * @tparam N row and column count
+ * @tparam Structure the band of the matrix, see the structure namespace
+ */
+template <typename T, std::size_t N, typename Structure,
+          typename Components = components::default_components_t<N>>
+struct structured_matrix
+    : expr::matrix_expression<structured_matrix<T, N, Structure, Components>,
+                              matrix<T, N, N, Components>> {
+    static_assert(N > 0, "Structured matrix cannot be empty");
+
+    using this_type      = structured_matrix<T, N, Structure, Components>;
+    using base_type      = expr::matrix_expression<this_type, matrix<T, N, N, Components>>;
+    using structure_type = Structure;
+
+    using value_type       = typename base_type::value_type;
+    using lvalue_reference = value_type&;
+    using const_reference  = value_type const&;
+    using pointer          = value_type*;
+    using const_pointer    = value_type const*;
+    using iterator         = pointer;
+    using const_iterator   = const_pointer;
+    using init_list        = std::initializer_list<value_type>;
+
+    static constexpr bool        is_symmetric    = Structure::symmetric;
+    static constexpr std::size_t lower_bandwidth = utils::min_v<Structure::lower, N - 1>;
+    static constexpr std::size_t upper_bandwidth = utils::min_v<Structure::upper, N - 1>;
+    /** Number of the stored elements */
+    static constexpr std::size_t packed_size
+        = detail::band_row_offset<N, lower_bandwidth, is_symmetric ? 0 : upper_bandwidth>(N);
+
+    constexpr structured_matrix() = default;
+
+    /** All the stored elements are set to the value */
+    constexpr explicit structured_matrix(value_type val)
+    {
+        for (auto& v : data_) {
+            v = val;
+        }
+    }
+
+    /**
+     * The stored elements in the order of packing, by rows from the left, the rest are zero.
+     * diagonal_matrix<float, 3>{1} is diag(1, 0, 0), diagonal_matrix<float, 3>(1) is identity.
+     */
+    constexpr structured_matrix(init_list const& args)
+    {
+        for (std::size_t i = 0; i < args.size() && i < packed_size; ++i) {
+            data_[i] = *(args.begin() + i);
+        }
+    }
+
+    template <typename Expression, typename = math::traits::enable_if_matrix_expression<Expression>>
+    constexpr structured_matrix(Expression&& rhs)
+        : structured_matrix(rhs, std::make_index_sequence<packed_size>{})
+    {
+        static_assert(std::decay_t<Expression>::rows == N && std::decay_t<Expression>::cols == N,
+                      "Matrix expression must be of the same size");
+    }
+
+    pointer
+    data()
+    {
+        return data_.data();
+    }
+    const_pointer
+    data() const
+    {
+        return data_.data();
+    }
+
+    iterator
+    begin()
+    {
+        return data_.data();
+    }
+    const_iterator
+    begin() const
+    {
+        return data_.data();
+    }
+    iterator
+    end()
+    {
+        return data_.data() + packed_size;
+    }
+    const_iterator
+    end() const
+    {
+        return data_.data() + packed_size;
+    }
+
+    template <std::size_t R, std::size_t C>
+    constexpr value_type
+    element() const
+    {
+        static_assert(R < N, "Invalid matrix row index");
+        static_assert(C < N, "Invalid matrix column index");
+        if constexpr (expr::m::detail::in_band<this_type>(R, C)) {
+            return data_[packed_index(R, C)];
+        } else {
+            return value_type{};
+        }
+    }
+
+    /** Reference to a stored element, for a symmetric matrix both R, C and C, R */
+    template <std::size_t R, std::size_t C>
+    lvalue_reference
+    element()
+    {
+        static_assert(R < N, "Invalid matrix row index");
+        static_assert(C < N, "Invalid matrix column index");
+        static_assert(expr::m::detail::in_band<this_type>(R, C),
+                      "The element is outside of the structure of the matrix");
+        return data_[packed_index(R, C)];
+    }
+
+private:
+    static constexpr std::size_t stored_upper_bandwidth = is_symmetric ? 0 : upper_bandwidth;
+
+    static constexpr std::size_t
+    packed_index(std::size_t r, std::size_t c)
+    {
+        if (is_symmetric && r < c) {
+            return detail::band_index<N, lower_bandwidth, stored_upper_bandwidth>(c, r);
+        }
+        return detail::band_index<N, lower_bandwidth, stored_upper_bandwidth>(r, c);
+    }
+
+    template <typename Expr, std::size_t... I>
+    constexpr structured_matrix(Expr const& rhs, std::index_sequence<I...>)
+        : data_{{static_cast<value_type>(
+            rhs.template element<detail::band_row<N, lower_bandwidth, stored_upper_bandwidth>(I),
+                                 detail::band_col<N, lower_bandwidth, stored_upper_bandwidth>(
+                                     I)>())...}}
+    {}
+
+private:
+    using data_type = std::array<value_type, packed_size>;
+    data_type data_{};
+};
+
+template <typename T, std::size_t N, typename Components = components::default_components_t<N>>
+using diagonal_matrix = structured_matrix<T, N, structure::diagonal, Components>;
+template <typename T, std::size_t N, typename Components = components::default_components_t<N>>
+using lower_triangular_matrix = structured_matrix<T, N, structure::lower_triangular, Components>;
+template <typename T, std::size_t N, typename Components = components::default_components_t<N>>
+using upper_triangular_matrix = structured_matrix<T, N, structure::upper_triangular, Components>;
+template <typename T, std::size_t N, typename Components = components::default_components_t<N>>
+using symmetric_matrix = structured_matrix<T, N, structure::symmetric, Components>;
+template <typename T, std::size_t N, std::size_t Lower, std::size_t Upper,
+          typename Components = components::default_components_t<N>>
+using banded_matrix = structured_matrix<T, N, structure::banded<Lower, Upper>, Components>;
+
+namespace expr {
+inline namespace m {
+
+//@{
+/** @name Triangular system solution */
+namespace detail {
+
+template <std::size_t R, typename T, typename Matrix, typename Result, std::size_t... K>
+T
+subtract_row_products(T sum, Matrix const& a, Result const& x, std::index_sequence<K...>)
+{
+    ((sum = sum - T(a.template element<R, K>()) * x[K]), ...);
+    return sum;
+}
+
+template <typename MathPolicy, std::size_t R, typename Matrix, typename Vector, typename Result>
+void
+substitute_row(Matrix const& a, Vector const& b, Result& x)
+{
+    using matrix_type = std::decay_t<Matrix>;
+    using value_type  = typename Result::value_type;
+
+    constexpr std::size_t lower = matrix_type::lower_bandwidth;
+    constexpr std::size_t upper = matrix_type::upper_bandwidth;
+    // The band of the row without the diagonal, the solved part of x
+    constexpr std::size_t first = upper == 0 ? (R > lower ? R - lower : 0) : R + 1;
+    constexpr std::size_t last  = upper == 0 ? R : std::min(R + upper + 1, matrix_type::cols);
+
+    value_type const sum = subtract_row_products<R>(
+        value_type(get<R>(b)), a, x, utils::make_offset_index_sequence<first, last - first>{});
+    x[R] = MathPolicy::divide(sum, value_type(a.template element<R, R>()));
+}
+
+template <typename MathPolicy, typename Matrix, typename Vector, typename Result,
+          std::size_t... I>
+void
+substitute(Matrix const& a, Vector const& b, Result& x, std::index_sequence<I...>)
+{
+    constexpr std::size_t n        = sizeof...(I);
+    constexpr bool        is_lower = std::decay_t<Matrix>::upper_bandwidth == 0;
+    (substitute_row<MathPolicy, is_lower ? I : n - 1 - I>(a, b, x), ...);
+}
+
+}    // namespace detail
+
+/**
+ * Solution x of the system a * x = b for a triangular matrix expression, by forward substitution
+ * for a lower and back substitution for an upper triangular one. Only the elements inside the
+ * band of the matrix are read, it takes N * bandwidth multiply-adds and N divisions.
+ * There is no check for zeros on the diagonal.
+ */
+template <typename Matrix, typename Vector,
+          typename = std::enable_if_t<traits::is_matrix_expression_v<
+                                          Matrix> && traits::is_vector_expression_v<Vector>>>
+auto
+solve(Matrix&& a, Vector&& b)
+{
+    using matrix_type = std::decay_t<Matrix>;
+    static_assert(matrix_type::rows == matrix_type::cols, "The matrix must be square");
+    static_assert(matrix_type::lower_bandwidth == 0 || matrix_type::upper_bandwidth == 0,
+                  "The matrix must be triangular");
+    static_assert(std::decay_t<Vector>::size == matrix_type::rows,
+                  "The vector must be of the matrix size");
+    using value_type  = traits::scalar_expression_result_t<Matrix, Vector>;
+    using math_policy = traits::common_math_policy_t<Matrix, Vector>;
+    using result_type = vector<value_type, matrix_type::rows, traits::component_names_t<Vector>>;
+
+    result_type x;
+    detail::substitute<math_policy>(a, b, x, std::make_index_sequence<matrix_type::rows>{});
+    return x;
+}
+//@}
+
+}    // namespace m
+}    // namespace expr
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_STRUCTURED_MATRIX_HPP_ */
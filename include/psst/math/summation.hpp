@@ -0,0 +1,120 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * summation.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_SUMMATION_HPP_
+#define PSST_MATH_SUMMATION_HPP_
+
+#include <psst/math/math_policy.hpp>
+
+#include <cstddef>
+#include <utility>
+
+/**
+ * Summation strategies for dot products, magnitudes, element sums and matrix products. A strategy
+ * is a math policy deriving the divisions and normalization from the policy it is parameterised
+ * with and replacing the sequential sum of the terms, so it is selected per call the same way:
+ *
+ *     auto d = dot(expr::with_policy<summation::compensated<>>(a), b);
+ *     matrix<float, 64, 64> p = expr::with_policy<summation::pairwise<fast_math>>(m) * n;
+ *
+ * The sequential sum of n terms, a right fold that adds the last terms first, is a chain of n
+ * dependent additions, its error grows as n. The strategies break the chain or bound the error,
+ * so that long float vectors don't need to be promoted to double to stay accurate:
+ *   - accumulators<K> sums every K-th term into one of K independent accumulators, it is about as
+ *     accurate as the fold, the accumulators are summed at the end;
+ *   - pairwise sums the halves of the terms recursively, the error grows as log n;
+ *   - compensated accumulates the rounding error of each addition in a second sum, the error
+ *     doesn't depend on n. It costs six more additions per term and is undone by -ffast-math.
+ */
+namespace psst {
+namespace math {
+namespace summation {
+
+/** Sum of the terms in K independent accumulators */
+template <std::size_t K = 4, typename MathPolicy = precise_math>
+struct accumulators : MathPolicy {
+    static_assert(K > 0, "At least one accumulator is required");
+
+    template <typename T, typename Terms, std::size_t... Indexes>
+    static constexpr T
+    sum_of_products(Terms const& terms, std::index_sequence<Indexes...> indexes)
+    {
+        if constexpr (sizeof...(Indexes) <= K) {
+            return math::detail::sequential_sum<MathPolicy, T>(terms, indexes);
+        } else {
+            T acc[K]{};
+            ((acc[Indexes % K] = MathPolicy::multiply_add(
+                  terms.template lhs<Indexes>(), terms.template rhs<Indexes>(), acc[Indexes % K])),
+             ...);
+            T res = acc[0];
+            for (std::size_t i = 1; i < K; ++i) {
+                res = res + acc[i];
+            }
+            return res;
+        }
+    }
+};
+
+/** Pairwise (cascade) summation of the terms */
+template <typename MathPolicy = precise_math>
+struct pairwise : MathPolicy {
+    template <typename T, typename Terms, std::size_t First, std::size_t... Indexes>
+    static constexpr T
+    sum_of_products(Terms const& terms, std::index_sequence<First, Indexes...>)
+    {
+        return sum_range<T, First, sizeof...(Indexes) + 1>(terms);
+    }
+
+private:
+    template <typename T, std::size_t Begin, std::size_t Count, typename Terms>
+    static constexpr T
+    sum_range(Terms const& terms)
+    {
+        if constexpr (Count <= 2) {
+            return math::detail::sequential_sum<MathPolicy, T>(
+                terms, utils::make_offset_index_sequence<Begin, Count>{});
+        } else {
+            return sum_range<T, Begin, Count / 2>(terms)
+                   + sum_range<T, Begin + Count / 2, Count - Count / 2>(terms);
+        }
+    }
+};
+
+/**
+ * Sum of the terms with the rounding error of each addition, found by the branchless two-sum of
+ * Knuth, accumulated separately and added at the end. The products are rounded as usual.
+ */
+template <typename MathPolicy = precise_math>
+struct compensated : MathPolicy {
+    template <typename T, typename Terms, std::size_t First, std::size_t... Indexes>
+    static constexpr T
+    sum_of_products(Terms const& terms, std::index_sequence<First, Indexes...>)
+    {
+        T sum   = terms.template lhs<First>() * terms.template rhs<First>();
+        T error = T{0};
+        (add(sum, error, terms.template lhs<Indexes>() * terms.template rhs<Indexes>()), ...);
+        return sum + error;
+    }
+
+private:
+    template <typename T>
+    static constexpr void
+    add(T& sum, T& error, T const& term)
+    {
+        T const res = sum + term;
+        T const rhs = res - sum;
+        error       = error + ((sum - (res - rhs)) + (term - rhs));
+        sum         = res;
+    }
+};
+
+}    // namespace summation
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_SUMMATION_HPP_ */
@@ -0,0 +1,699 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * svd.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_SVD_HPP_
+#define PSST_MATH_SVD_HPP_
+
+#include <psst/math/eigen.hpp>
+#include <psst/math/matrix.hpp>
+#include <psst/math/parallel.hpp>
+#include <psst/math/quaternion.hpp>
+#include <psst/math/simd.hpp>
+#include <psst/math/vector.hpp>
+#include <psst/math/vmath.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+/**
+ * Singular value and polar decompositions of 2x2 and 3x3 matrices, e.g. for the optimal rotation
+ * between two point sets, deformation gradients of finite elements or shape matching.
+ *
+ * The decompositions are signed: u and v are rotations and the last singular value takes the sign
+ * of det(a), a = u * diag(sigma) * transpose(v) and |sigma[0]| >= |sigma[1]| >= |sigma[2]|. The
+ * rotation of the polar decomposition a = rotation * stretch is u * transpose(v), it never is a
+ * reflection.
+ *
+ * A 3x3 matrix is decomposed after McAdams et al., "Computing the Singular Value Decomposition of
+ * 3x3 matrices with minimal branching and elementary floating point operations". Cyclic sweeps of
+ * Jacobi rotations diagonalize transpose(a) * a, the rotations are accumulated in a quaternion of
+ * v. The squares lose the directions of singular values below sqrt(eps) of the largest one, so a
+ * sweep of one-sided Jacobi rotations of the columns of a * v makes them orthogonal. The columns
+ * are sorted by length and the Givens rotations of their QR decomposition, accumulated in a
+ * quaternion, give u. The number of sweeps controls the accuracy. Unlike the paper the Jacobi
+ * rotations take the exact angle rather than its first order approximation, the convergence is
+ * quadratic from the first sweep and matrices of rank 1 or 2 need no more sweeps than the others.
+ * A 2x2 matrix is decomposed in closed form.
+ *
+ * There are no branches, the same code runs on scalars and on SIMD packs. The batch functions take
+ * matrices in the structure of arrays layout and compute simd<T, 32 / sizeof(T)> packs of them at
+ * once.
+ */
+namespace psst {
+namespace math {
+
+/** a = u * diag(sigma) * transpose(v), u and v are rotations */
+template <typename T, std::size_t N>
+struct singular_value_decomposition {
+    matrix<T, N, N> u;
+    vector<T, N>    sigma;
+    matrix<T, N, N> v;
+};
+
+/** The rotations of a 3x3 singular value decomposition as unit quaternions */
+template <typename T>
+struct quaternion_svd {
+    quaternion<T> u;
+    vector<T, 3>  sigma;
+    quaternion<T> v;
+};
+
+/** a = rotation * stretch, stretch is symmetric */
+template <typename T, std::size_t N>
+struct polar_decomposition {
+    matrix<T, N, N> rotation;
+    matrix<T, N, N> stretch;
+};
+
+struct svd_options {
+    /**
+     * Number of Jacobi sweeps for 3x3 matrices, 0 means enough for the precision of the value
+     * type: 4 for float and 5 for double
+     */
+    std::size_t      sweeps   = 0;
+    parallel_options parallel = {};
+};
+
+namespace detail {
+
+template <typename T>
+std::size_t
+svd_sweeps(svd_options const& opts)
+{
+    return opts.sweeps != 0 ? opts.sweeps : sizeof(T) > sizeof(float) ? 5 : 4;
+}
+
+/**
+ * q = q * (ch + sh * e), e is the unit vector of the axis Axis. The product is spelled out as
+ * multiplications by the zero components would not be folded.
+ */
+template <std::size_t Axis, typename S>
+void
+svd_rotate_quaternion(S (&q)[4], S const& ch, S const& sh)
+{
+    S const w = q[0], x = q[1], y = q[2], z = q[3];
+    if constexpr (Axis == 0) {
+        q[0] = ch * w - sh * x;
+        q[1] = ch * x + sh * w;
+        q[2] = ch * y + sh * z;
+        q[3] = ch * z - sh * y;
+    } else if constexpr (Axis == 1) {
+        q[0] = ch * w - sh * y;
+        q[1] = ch * x - sh * z;
+        q[2] = ch * y + sh * w;
+        q[3] = ch * z + sh * x;
+    } else {
+        q[0] = ch * w - sh * z;
+        q[1] = ch * x + sh * y;
+        q[2] = ch * y - sh * x;
+        q[3] = ch * z + sh * w;
+    }
+}
+
+/**
+ * The rotation by the angle theta in the plane P, Q, P < Q, maps e_P to cos(theta) * e_P +
+ * sin(theta) * e_Q. It turns about the third axis by theta for the cyclic pairs 0, 1 and 1, 2 and
+ * by -theta for 0, 2. Rotates q by the half angle cosine ch and sine sh.
+ */
+template <std::size_t P, std::size_t Q, typename S>
+void
+svd_rotate_quaternion(S (&q)[4], S const& ch, S const& sh)
+{
+    constexpr std::size_t R = 3 - P - Q;
+    if constexpr (Q == P + 1) {
+        svd_rotate_quaternion<R>(q, ch, sh);
+    } else {
+        svd_rotate_quaternion<R>(q, ch, -sh);
+    }
+}
+
+/**
+ * The Jacobi rotation G in the plane P, Q that annihilates spq of the symmetric 2x2 block
+ * spp, spq, sqq of transpose(G) * s * G. The tangent t of its angle is the smaller root of
+ * t^2 - 2 tau t - 1 = 0, c and sn are the cosine and sine, ch and sh those of the half angle for
+ * a quaternion. All of the square roots are reciprocal, for vmath::rsqrt.
+ */
+template <typename S>
+struct svd_rotation {
+    S t, c, sn, ch, sh;
+
+    svd_rotation(S const& spp, S const& spq, S const& sqq)
+    {
+        using T = typename eigen_lane<S>::type;
+        using std::abs;
+        constexpr T eps = std::numeric_limits<T>::epsilon();
+
+        // The elements are at most 3, an off-diagonal below eps^2 is zero for the result and
+        // rotating it further would end in denormals, slow on most processors. Above it tau^2 is
+        // finite.
+        auto const zero = abs(spq) < S(eps * eps);
+        S const    tau  = (sqq - spp) / (S(2) * eigen_select(zero, S(1), spq));
+        S const    r2   = tau * tau + S(1);
+        t  = eigen_select(tau < S(0), S(1), S(-1)) / (abs(tau) + r2 * vmath::rsqrt(r2));
+        t  = eigen_select(zero, S(0), t);
+        c  = vmath::rsqrt(t * t + S(1));
+        sn = t * c;
+        // cos(theta / 2) = sqrt((1 + c) / 2) >= cos(pi / 8)
+        S const half   = (S(1) + c) * S(T(0.5));
+        S const inv_ch = vmath::rsqrt(half);
+        ch             = half * inv_ch;
+        sh             = sn * S(T(0.5)) * inv_ch;
+    }
+};
+
+/** One step of the Jacobi eigen-analysis of the symmetric s, s = transpose(G) * s * G */
+template <std::size_t P, std::size_t Q, typename S>
+void
+svd_jacobi(S (&s)[3][3], S (&q)[4])
+{
+    constexpr std::size_t R = 3 - P - Q;
+
+    S const               spq = s[P][Q];
+    svd_rotation<S> const g{s[P][P], spq, s[Q][Q]};
+    S const&              t  = g.t;
+    S const&              c  = g.c;
+    S const&              sn = g.sn;
+
+    s[P][P] += t * spq;
+    s[Q][Q] -= t * spq;
+    s[P][Q] = s[Q][P] = S(0);
+    S const srp       = s[R][P];
+    S const srq       = s[R][Q];
+    s[R][P] = s[P][R] = c * srp + sn * srq;
+    s[R][Q] = s[Q][R] = c * srq - sn * srp;
+    svd_rotate_quaternion<P, Q>(q, g.ch, g.sh);
+}
+
+/**
+ * One step of the one-sided Jacobi method, b = b * G makes the columns P and Q orthogonal. The
+ * products of the columns are taken from b itself rather than from transpose(m) * m, so the
+ * rotation stays accurate for columns much shorter than the largest one.
+ */
+template <std::size_t P, std::size_t Q, typename S>
+void
+svd_column_jacobi(S (&b)[3][3], S (&q)[4])
+{
+    S spp = b[0][P] * b[0][P], spq = b[0][P] * b[0][Q], sqq = b[0][Q] * b[0][Q];
+    for (std::size_t i = 1; i < 3; ++i) {
+        spp += b[i][P] * b[i][P];
+        spq += b[i][P] * b[i][Q];
+        sqq += b[i][Q] * b[i][Q];
+    }
+    svd_rotation<S> const g{spp, spq, sqq};
+    for (std::size_t i = 0; i < 3; ++i) {
+        S const bp = b[i][P];
+        S const bq = b[i][Q];
+        b[i][P]    = g.c * bp + g.sn * bq;
+        b[i][Q]    = g.c * bq - g.sn * bp;
+    }
+    svd_rotate_quaternion<P, Q>(q, g.ch, g.sh);
+}
+
+/**
+ * Swaps the columns P and Q of b if the column P is shorter, negating one of them keeps the
+ * determinant. q is rotated by the same quarter turn.
+ */
+template <std::size_t P, std::size_t Q, typename S>
+void
+svd_sort_columns(S (&b)[3][3], S (&length)[3], S (&q)[4])
+{
+    using T                = typename eigen_lane<S>::type;
+    constexpr T sqrt_half  = T(0.707106781186547524);
+    auto const  swap       = length[P] < length[Q];
+    S const     lp         = length[P];
+    length[P]              = eigen_select(swap, length[Q], lp);
+    length[Q]              = eigen_select(swap, lp, length[Q]);
+    for (std::size_t i = 0; i < 3; ++i) {
+        S const p = b[i][P];
+        b[i][P]   = eigen_select(swap, b[i][Q], p);
+        b[i][Q]   = eigen_select(swap, -p, b[i][Q]);
+    }
+    S turned[4] = {q[0], q[1], q[2], q[3]};
+    svd_rotate_quaternion<P, Q>(turned, S(sqrt_half), S(sqrt_half));
+    for (std::size_t i = 0; i < 4; ++i) {
+        q[i] = eigen_select(swap, turned[i], q[i]);
+    }
+}
+
+/**
+ * Givens rotation annihilating b[Q][P] against the pivot b[P][P], the rows of b are rotated and
+ * the rotation is appended to q. The half angle is taken from the tangent a2 / (|a1| + rho) or
+ * its reciprocal, whichever does not cancel.
+ */
+template <std::size_t P, std::size_t Q, typename S>
+void
+svd_givens(S (&b)[3][3], S (&q)[4])
+{
+    using T = typename eigen_lane<S>::type;
+    using std::abs;
+    using std::max;
+    constexpr T eps = std::numeric_limits<T>::epsilon();
+
+    S const    a1       = b[P][P];
+    S const    a2       = b[Q][P];
+    S const    rho2     = a1 * a1 + a2 * a2;
+    S const    rho      = rho2 * vmath::rsqrt(max(rho2, S(eps * eps)));
+    S          sh       = eigen_select(rho > S(eps), a2, S(0));
+    S          ch       = abs(a1) + max(rho, S(eps));
+    auto const negative = a1 < S(0);
+    S const    t        = sh;
+    sh                  = eigen_select(negative, ch, sh);
+    ch                  = eigen_select(negative, t, ch);
+    S const w           = vmath::rsqrt(ch * ch + sh * sh);
+    ch *= w;
+    sh *= w;
+
+    S const c  = ch * ch - sh * sh;
+    S const sn = S(2) * ch * sh;
+    for (std::size_t j = 0; j < 3; ++j) {
+        S const bp = b[P][j];
+        S const bq = b[Q][j];
+        b[P][j]    = c * bp + sn * bq;
+        b[Q][j]    = c * bq - sn * bp;
+    }
+    svd_rotate_quaternion<P, Q>(q, ch, sh);
+}
+
+template <typename S>
+void
+svd_normalize(S (&q)[4])
+{
+    S const inv = vmath::rsqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    for (auto& x : q) {
+        x *= inv;
+    }
+}
+
+/** Rotation matrix of a unit quaternion */
+template <typename S>
+void
+svd_rotation_matrix(S const (&q)[4], S (&m)[3][3])
+{
+    S const w = q[0], x = q[1], y = q[2], z = q[3];
+    m[0][0]   = S(1) - S(2) * (y * y + z * z);
+    m[0][1]   = S(2) * (x * y - w * z);
+    m[0][2]   = S(2) * (x * z + w * y);
+    m[1][0]   = S(2) * (x * y + w * z);
+    m[1][1]   = S(1) - S(2) * (x * x + z * z);
+    m[1][2]   = S(2) * (y * z - w * x);
+    m[2][0]   = S(2) * (x * z - w * y);
+    m[2][1]   = S(2) * (y * z + w * x);
+    m[2][2]   = S(1) - S(2) * (x * x + y * y);
+}
+
+/**
+ * Singular value decomposition of a 3x3 matrix, u and v are unit quaternions. S is a scalar or
+ * a SIMD pack.
+ */
+template <typename S>
+void
+svd3(S const (&a)[3][3], S (&u)[4], S (&sigma)[3], S (&v)[4], std::size_t sweeps)
+{
+    using std::abs;
+    using std::max;
+
+    // Scaled to the largest element 1, the squares below neither overflow nor underflow
+    S scale = abs(a[0][0]);
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            scale = max(scale, abs(a[i][j]));
+        }
+    }
+    S pre, inv;
+    eigen_scale_factors(scale, pre, inv);
+    S m[3][3];
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            m[i][j] = a[i][j] * pre * inv;
+        }
+    }
+
+    // Eigenvectors of transpose(m) * m are the columns of v
+    S s[3][3];
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = i; j < 3; ++j) {
+            s[i][j] = s[j][i] = m[0][i] * m[0][j] + m[1][i] * m[1][j] + m[2][i] * m[2][j];
+        }
+    }
+    v[0] = S(1);
+    v[1] = v[2] = v[3] = S(0);
+    for (std::size_t k = 0; k < sweeps; ++k) {
+        svd_jacobi<0, 1>(s, v);
+        svd_jacobi<1, 2>(s, v);
+        svd_jacobi<0, 2>(s, v);
+    }
+    svd_normalize(v);
+
+    // b = m * v, the columns in the order of decreasing length
+    S rv[3][3];
+    svd_rotation_matrix(v, rv);
+    S b[3][3];
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            b[i][j] = m[i][0] * rv[0][j] + m[i][1] * rv[1][j] + m[i][2] * rv[2][j];
+        }
+    }
+    // The eigenvectors of transpose(m) * m for singular values below sqrt(eps) are lost in the
+    // squares, the columns of b still have components along each other. A one-sided sweep makes
+    // them orthogonal, otherwise the upper triangle of r below would be dropped. The columns are
+    // close to orthogonal already, one sweep converges.
+    svd_column_jacobi<0, 1>(b, v);
+    svd_column_jacobi<1, 2>(b, v);
+    svd_column_jacobi<0, 2>(b, v);
+    svd_normalize(v);
+    S length[3];
+    for (std::size_t j = 0; j < 3; ++j) {
+        length[j] = b[0][j] * b[0][j] + b[1][j] * b[1][j] + b[2][j] * b[2][j];
+    }
+    svd_sort_columns<0, 1>(b, length, v);
+    svd_sort_columns<0, 2>(b, length, v);
+    svd_sort_columns<1, 2>(b, length, v);
+
+    // b = u * r, the columns of b are orthogonal and r is diagonal
+    u[0] = S(1);
+    u[1] = u[2] = u[3] = S(0);
+    svd_givens<0, 1>(b, u);
+    svd_givens<0, 2>(b, u);
+    svd_givens<1, 2>(b, u);
+    svd_normalize(u);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        sigma[i] = b[i][i] * scale;
+    }
+}
+
+/**
+ * Closed form singular value decomposition of a 2x2 matrix, a = R(phi) * diag(sigma) * R(theta)
+ * with R the rotation by an angle. u = R(phi), v = R(-theta). The matrix is scaled as for 3x3,
+ * so that the squares neither overflow nor underflow.
+ */
+template <typename S>
+void
+svd2(S const (&a)[2][2], S (&u)[2][2], S (&sigma)[2], S (&v)[2][2])
+{
+    using std::abs;
+    using std::max;
+    using std::sqrt;
+    S scale = max(max(abs(a[0][0]), abs(a[0][1])), max(abs(a[1][0]), abs(a[1][1])));
+    S pre, inv;
+    eigen_scale_factors(scale, pre, inv);
+    S m[2][2];
+    for (std::size_t i = 0; i < 2; ++i) {
+        for (std::size_t j = 0; j < 2; ++j) {
+            m[i][j] = a[i][j] * pre * inv;
+        }
+    }
+    S const e   = (m[0][0] + m[1][1]) * S(0.5);
+    S const f   = (m[0][0] - m[1][1]) * S(0.5);
+    S const g   = (m[1][0] + m[0][1]) * S(0.5);
+    S const h   = (m[1][0] - m[0][1]) * S(0.5);
+    S const q   = sqrt(e * e + h * h);
+    S const r   = sqrt(f * f + g * g);
+    sigma[0]    = (q + r) * scale;
+    sigma[1]    = (q - r) * scale;
+    S const a1  = vmath::atan2(g, f);
+    S const a2  = vmath::atan2(h, e);
+    S       sin_phi, cos_phi, sin_theta, cos_theta;
+    vmath::sincos((a2 + a1) * S(0.5), sin_phi, cos_phi);
+    vmath::sincos((a2 - a1) * S(0.5), sin_theta, cos_theta);
+    u[0][0] = cos_phi;
+    u[0][1] = -sin_phi;
+    u[1][0] = sin_phi;
+    u[1][1] = cos_phi;
+    v[0][0] = cos_theta;
+    v[0][1] = sin_theta;
+    v[1][0] = -sin_theta;
+    v[1][1] = cos_theta;
+}
+
+template <typename Matrix, typename S, std::size_t N, std::size_t... I>
+void
+svd_elements(Matrix const& a, S (&m)[N][N], std::index_sequence<I...>)
+{
+    ((m[I / N][I % N] = S(a.template element<I / N, I % N>())), ...);
+}
+
+/** The elements of a square matrix expression */
+template <typename Matrix, typename S, std::size_t N>
+void
+svd_elements(Matrix const& a, S (&m)[N][N])
+{
+    static_assert(Matrix::rows == N && Matrix::cols == N && (N == 2 || N == 3),
+                  "The singular value decomposition is implemented for 2x2 and 3x3 matrices");
+    svd_elements(a, m, std::make_index_sequence<N * N>{});
+}
+
+template <typename S, std::size_t N>
+matrix<S, N, N>
+svd_matrix(S const (&m)[N][N])
+{
+    matrix<S, N, N> res;
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            res[i][j] = m[i][j];
+        }
+    }
+    return res;
+}
+
+/** v * diag(sigma) * transpose(v) */
+template <typename S, std::size_t N>
+matrix<S, N, N>
+svd_stretch(S const (&v)[N][N], S const (&sigma)[N])
+{
+    matrix<S, N, N> res;
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = i; j < N; ++j) {
+            S sum = v[i][0] * sigma[0] * v[j][0];
+            for (std::size_t k = 1; k < N; ++k) {
+                sum += v[i][k] * sigma[k] * v[j][k];
+            }
+            res[i][j] = res[j][i] = sum;
+        }
+    }
+    return res;
+}
+
+template <typename S>
+quaternion<S>
+svd_quaternion(S const (&q)[4])
+{
+    return {q[0], q[1], q[2], q[3]};
+}
+
+}    // namespace detail
+
+/**
+ * Singular value decomposition of a 3x3 matrix expression with the rotations as unit quaternions.
+ * The value type may be a SIMD pack, then every lane is decomposed.
+ */
+template <typename Matrix, typename = traits::enable_if_matrix_expression<Matrix>>
+auto
+svd_quaternions(Matrix const& a, svd_options const& opts = {})
+{
+    static_assert(Matrix::rows == 3 && Matrix::cols == 3,
+                  "The quaternion decomposition is implemented for 3x3 matrices");
+    using value_type = typename Matrix::value_type;
+    using lane_type  = typename detail::eigen_lane<value_type>::type;
+
+    value_type m[3][3];
+    detail::svd_elements(a, m);
+    value_type u[4], sigma[3], v[4];
+    detail::svd3(m, u, sigma, v, detail::svd_sweeps<lane_type>(opts));
+    return quaternion_svd<value_type>{detail::svd_quaternion(u), {sigma[0], sigma[1], sigma[2]},
+                                      detail::svd_quaternion(v)};
+}
+
+/**
+ * Singular value decomposition of a 2x2 or 3x3 matrix expression. The value type may be a SIMD
+ * pack, then every lane is decomposed.
+ */
+template <typename Matrix, typename = traits::enable_if_matrix_expression<Matrix>>
+auto
+svd(Matrix const& a, svd_options const& opts = {})
+{
+    using value_type        = typename Matrix::value_type;
+    using lane_type         = typename detail::eigen_lane<value_type>::type;
+    constexpr std::size_t N = Matrix::rows;
+
+    value_type m[N][N];
+    detail::svd_elements(a, m);
+    value_type u[N][N], sigma[N], v[N][N];
+    if constexpr (N == 2) {
+        detail::svd2(m, u, sigma, v);
+    } else {
+        value_type qu[4], qv[4];
+        detail::svd3(m, qu, sigma, qv, detail::svd_sweeps<lane_type>(opts));
+        detail::svd_rotation_matrix(qu, u);
+        detail::svd_rotation_matrix(qv, v);
+    }
+    singular_value_decomposition<value_type, N> res{
+        detail::svd_matrix(u), {}, detail::svd_matrix(v)};
+    for (std::size_t i = 0; i < N; ++i) {
+        res.sigma[i] = sigma[i];
+    }
+    return res;
+}
+
+/**
+ * Polar decomposition of a 2x2 or 3x3 matrix expression, the rotation closest to a and the
+ * symmetric stretch. The value type may be a SIMD pack, then every lane is decomposed.
+ */
+template <typename Matrix, typename = traits::enable_if_matrix_expression<Matrix>>
+auto
+polar(Matrix const& a, svd_options const& opts = {})
+{
+    using value_type        = typename Matrix::value_type;
+    constexpr std::size_t N = Matrix::rows;
+
+    auto const d = svd(a, opts);
+    value_type v[N][N], sigma[N];
+    for (std::size_t i = 0; i < N; ++i) {
+        sigma[i] = d.sigma[i];
+        for (std::size_t j = 0; j < N; ++j) {
+            v[i][j] = d.v[i][j];
+        }
+    }
+    return polar_decomposition<value_type, N>{d.u * transpose(d.v), detail::svd_stretch(v, sigma)};
+}
+
+/**
+ * The rotation of the polar decomposition of a 3x3 matrix expression as a unit quaternion, e.g.
+ * the optimal rotation of the Kabsch algorithm for the cross-covariance matrix of two point sets.
+ */
+template <typename Matrix, typename = traits::enable_if_matrix_expression<Matrix>>
+auto
+polar_rotation(Matrix const& a, svd_options const& opts = {})
+{
+    auto const d = svd_quaternions(a, opts);
+    return quaternion<typename Matrix::value_type>{d.u * conjugate(d.v)};
+}
+
+namespace detail {
+
+template <typename T>
+using svd_pack = simd<T, eigen_lanes<T>>;
+
+/**
+ * Calls f(in, first, n) for packs in of n <= lanes matrices loaded from the 3x3 matrices a in the
+ * structure of arrays layout, the tail is padded with zero matrices. The packs start at multiples
+ * of lanes whatever the number of threads.
+ */
+template <typename T, typename Function>
+void
+svd_batch(std::array<T const*, 9> const& a, std::size_t count, parallel_options const& opts,
+          Function&& f)
+{
+    constexpr std::size_t lanes = eigen_lanes<T>;
+    using pack_type             = svd_pack<T>;
+
+    auto const compute = [&](std::size_t first, std::size_t n) {
+        pack_type in[3][3];
+        for (std::size_t k = 0; k < 9; ++k) {
+            if (n == lanes) {
+                in[k / 3][k % 3] = pack_type::load(a[k] + first);
+            } else {
+                for (std::size_t i = 0; i < n; ++i) {
+                    in[k / 3][k % 3][i] = a[k][first + i];
+                }
+            }
+        }
+        f(in, first, n);
+    };
+
+    parallel_options chunks = opts;
+    chunks.grain            = (std::max<std::size_t>(opts.grain, 1) + lanes - 1) / lanes * lanes;
+    math::detail::parallel_for(count, chunks, [&](std::size_t first, std::size_t last) {
+        for (; first < last; first += lanes) {
+            compute(first, std::min(lanes, last - first));
+        }
+    });
+}
+
+}    // namespace detail
+
+/**
+ * Singular value decompositions of count 3x3 matrices in the structure of arrays layout.
+ * a holds arrays of the elements by rows, a[r * 3 + c][i] is the element r, c of the matrix i.
+ * u and v receive arrays of the w, x, y, z components of the rotation quaternions, sigma the
+ * arrays of the singular values. The matrices are split between threads, the results do not
+ * depend on the number of threads.
+ */
+template <typename T>
+void
+svd(std::array<T const*, 9> const& a, std::array<T*, 4> const& u, std::array<T*, 3> const& sigma,
+    std::array<T*, 4> const& v, std::size_t count, svd_options const& opts = {})
+{
+    using pack_type          = detail::svd_pack<T>;
+    std::size_t const sweeps = detail::svd_sweeps<T>(opts);
+
+    auto const compute = [&](pack_type const(&in)[3][3], std::size_t first, std::size_t n) {
+        pack_type out_u[4], out_sigma[3], out_v[4];
+        detail::svd3(in, out_u, out_sigma, out_v, sweeps);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t k = 0; k < 4; ++k) {
+                u[k][first + i] = out_u[k][i];
+                v[k][first + i] = out_v[k][i];
+            }
+            for (std::size_t k = 0; k < 3; ++k) {
+                sigma[k][first + i] = out_sigma[k][i];
+            }
+        }
+    };
+    detail::svd_batch(a, count, opts.parallel, compute);
+}
+
+/**
+ * Polar decompositions of count 3x3 matrices in the structure of arrays layout, a is laid out as
+ * for svd. rotation receives arrays of the w, x, y, z components of the rotation quaternions,
+ * stretch the arrays of the elements s00, s10, s11, s20, s21, s22, the packing order of
+ * symmetric_matrix<T, 3>.
+ */
+template <typename T>
+void
+polar(std::array<T const*, 9> const& a, std::array<T*, 4> const& rotation,
+      std::array<T*, 6> const& stretch, std::size_t count, svd_options const& opts = {})
+{
+    using pack_type          = detail::svd_pack<T>;
+    std::size_t const sweeps = detail::svd_sweeps<T>(opts);
+
+    auto const compute = [&](pack_type const(&in)[3][3], std::size_t first, std::size_t n) {
+        pack_type qu[4], sigma[3], qv[4], rv[3][3];
+        detail::svd3(in, qu, sigma, qv, sweeps);
+        detail::svd_rotation_matrix(qv, rv);
+        // u * conjugate(v)
+        pack_type const r[4]
+            = {qu[0] * qv[0] + qu[1] * qv[1] + qu[2] * qv[2] + qu[3] * qv[3],
+               -qu[0] * qv[1] + qu[1] * qv[0] - qu[2] * qv[3] + qu[3] * qv[2],
+               -qu[0] * qv[2] + qu[1] * qv[3] + qu[2] * qv[0] - qu[3] * qv[1],
+               -qu[0] * qv[3] - qu[1] * qv[2] + qu[2] * qv[1] + qu[3] * qv[0]};
+        auto const s = detail::svd_stretch(rv, sigma);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t k = 0; k < 4; ++k) {
+                rotation[k][first + i] = r[k][i];
+            }
+            stretch[0][first + i] = s[0][0][i];
+            stretch[1][first + i] = s[1][0][i];
+            stretch[2][first + i] = s[1][1][i];
+            stretch[3][first + i] = s[2][0][i];
+            stretch[4][first + i] = s[2][1][i];
+            stretch[5][first + i] = s[2][2][i];
+        }
+    };
+    detail::svd_batch(a, count, opts.parallel, compute);
+}
+
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_SVD_HPP_ */
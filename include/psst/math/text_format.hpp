@@ -0,0 +1,49 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * text_format.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_TEXT_FORMAT_HPP_
+#define PSST_MATH_TEXT_FORMAT_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <string>
+
+namespace psst {
+namespace math {
+namespace io {
+
+/**
+ * Settings for the textual representation of vectors and matrices.
+ *
+ * The defaults are the same as the defaults of io::vector_facet, so that the text produced by
+ * stream output can be read by the buffer-based parsers and vice versa.
+ */
+template <typename CharT>
+struct basic_text_format {
+    using char_type   = CharT;
+    using string_type = std::basic_string<CharT>;
+
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    char_type   start     = '{';
+    char_type   end       = '}';
+    char_type   delim     = ',';
+    char_type   separator = ' ';
+    bool        pretty    = false;
+    std::size_t col_width = npos;
+    string_type row_sep   = "\n";
+    string_type offset    = "  ";
+};
+
+using text_format = basic_text_format<char>;
+
+}    // namespace io
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_TEXT_FORMAT_HPP_ */
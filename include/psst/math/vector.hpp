@@ -22,13 +22,15 @@
 namespace psst {
 namespace math {
 
-template <typename T, std::size_t Size, typename Components>
-struct vector : expr::vector_expression<vector<T, Size, Components>>,
-                detail::vector_ops<T, Size, Components> {
+template <typename T, std::size_t Size, typename Components, typename MathPolicy>
+struct vector : expr::vector_expression<vector<T, Size, Components, MathPolicy>,
+                                        vector<T, Size, Components>>,
+                detail::vector_ops<T, Size, Components, MathPolicy> {
 
-    using this_type            = vector<T, Size, Components>;
+    using this_type            = vector<T, Size, Components, MathPolicy>;
     using traits               = traits::vector_traits<this_type>;
-    using base_expression_type = expr::vector_expression<vector<T, Size, Components>>;
+    using base_expression_type = expr::vector_expression<this_type, vector<T, Size, Components>>;
+    using math_policy          = MathPolicy;
     using value_type           = typename traits::value_type;
     using lvalue_reference     = typename traits::lvalue_reference;
     using const_reference      = typename traits::const_reference;
@@ -59,9 +61,9 @@ struct vector : expr::vector_expression<vector<T, Size, Components>>,
 
     constexpr vector(const_pointer p) : vector(p, index_sequence_type{}) {}
 
-    template <typename U, std::size_t SizeR, typename ComponentsR,
+    template <typename U, std::size_t SizeR, typename ComponentsR, typename MathPolicyR,
               typename = math::traits::enable_if_compatible_components<Components, ComponentsR>>
-    constexpr /* implicit */ vector(vector<U, SizeR, ComponentsR> const& rhs)
+    constexpr /* implicit */ vector(vector<U, SizeR, ComponentsR, MathPolicyR> const& rhs)
         : vector(rhs, utils::make_min_index_sequence<Size, SizeR>{})
     {}
     template <typename Expression, typename = math::traits::enable_if_vector_expression<Expression>,
@@ -172,8 +174,10 @@ private:
     constexpr vector(const_pointer p, std::index_sequence<Indexes...>)
         : data_({value_policy<Indexes>::apply(*(p + Indexes))...})
     {}
-    template <typename U, std::size_t SizeR, typename ComponentsR, std::size_t... Indexes>
-    constexpr vector(vector<U, SizeR, ComponentsR> const& rhs, std::index_sequence<Indexes...>)
+    template <typename U, std::size_t SizeR, typename ComponentsR, typename MathPolicyR,
+              std::size_t... Indexes>
+    constexpr vector(vector<U, SizeR, ComponentsR, MathPolicyR> const& rhs,
+                     std::index_sequence<Indexes...>)
         : data_({value_policy<Indexes>::apply(rhs.template at<Indexes>())...})
     {}
     template <typename Expr, std::size_t... Indexes>
@@ -186,9 +190,9 @@ private:
     data_type data_;
 };
 
-template <std::size_t N, typename T, std::size_t Size, typename Components>
-constexpr typename vector<T, Size, Components>::template value_policy<N>::accessor_type
-get(vector<T, Size, Components>& v)
+template <std::size_t N, typename T, std::size_t Size, typename Components, typename MathPolicy>
+constexpr typename vector<T, Size, Components, MathPolicy>::template value_policy<N>::accessor_type
+get(vector<T, Size, Components, MathPolicy>& v)
 {
     return v.template at<N>();
 }
@@ -0,0 +1,255 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * vector_format.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_VECTOR_FORMAT_HPP_
+#define PSST_MATH_VECTOR_FORMAT_HPP_
+
+#include <psst/math/detail/charconv.hpp>
+#include <psst/math/text_format.hpp>
+#include <psst/math/vector.hpp>
+
+#include <cassert>
+
+#include <iterator>
+#include <string>
+
+namespace psst {
+namespace math {
+namespace io {
+
+/**
+ * Result of formatting to a character buffer.
+ * On success ptr points past the last character written, if the buffer is too small ec is
+ * std::errc::value_too_large and ptr is equal to the end of the buffer.
+ */
+struct format_result {
+    char*     ptr;
+    std::errc ec;
+
+    constexpr explicit operator bool() const { return ec == std::errc{}; }
+};
+
+namespace detail {
+
+/** Number of objects formatted between growing the string buffer in batch formatting */
+constexpr std::size_t format_chunk_size = 256;
+
+// The put_ functions return nullptr when the buffer is exhausted, so that they can be chained
+// without checking after each call.
+inline char*
+put_char(char* p, char* last, char c)
+{
+    if (!p || p == last)
+        return nullptr;
+    *p = c;
+    return p + 1;
+}
+
+inline char*
+put_string(char* p, char* last, std::string const& str)
+{
+    if (!p || static_cast<std::size_t>(last - p) < str.size())
+        return nullptr;
+    return std::copy(str.begin(), str.end(), p);
+}
+
+template <typename T>
+char*
+put_value(char* p, char* last, T value, text_format const& fmt)
+{
+    if (fmt.pretty) {
+        p = put_char(p, last, fmt.separator);
+        if (p && fmt.col_width != text_format::npos) {
+            // Same as std::setw and std::setprecision in the stream output
+            int  precision = std::max(1, static_cast<int>(fmt.col_width) - 2);
+            auto r         = to_chars(p, last, value, precision);
+            if (r.ec != std::errc{})
+                return nullptr;
+            std::size_t n = r.ptr - p;
+            if (n >= fmt.col_width)
+                return r.ptr;
+            std::size_t pad = fmt.col_width - n;
+            if (static_cast<std::size_t>(last - r.ptr) < pad)
+                return nullptr;
+            std::copy_backward(p, r.ptr, r.ptr + pad);
+            std::fill(p, p + pad, ' ');
+            return r.ptr + pad;
+        }
+    }
+    if (!p)
+        return nullptr;
+    auto r = to_chars(p, last, value);
+    return r.ec == std::errc{} ? r.ptr : nullptr;
+}
+
+/**
+ * Write the vector with the same layout as operator<< produces
+ */
+template <typename Expression, std::size_t... Indexes>
+char*
+put_vector(char* p, char* last, Expression const& v, text_format const& fmt,
+           std::index_sequence<Indexes...>)
+{
+    using value_type = typename Expression::value_type;
+    p                = put_char(p, last, fmt.start);
+    if (fmt.pretty)
+        p = put_char(p, last, fmt.separator);
+    ((p = put_value(Indexes > 0 ? put_char(p, last, fmt.delim) : p, last,
+                    (value_type)v.template at<Indexes>(), fmt)),
+     ...);
+    if (fmt.pretty)
+        p = put_char(p, last, fmt.separator);
+    return put_char(p, last, fmt.end);
+}
+
+template <typename Expression>
+char*
+put_vector(char* p, char* last, Expression const& v, text_format const& fmt)
+{
+    return put_vector(p, last, v, fmt, typename Expression::index_sequence_type{});
+}
+
+/**
+ * Upper bound of characters needed to format a vector
+ */
+template <typename Expression>
+std::size_t
+max_vector_chars(text_format const& fmt)
+{
+    using value_type = typename Expression::value_type;
+    // delimiter, separator and the value
+    auto value_chars = 2 + max_value_chars<value_type>
+                       + (fmt.col_width != text_format::npos ? fmt.col_width : 0);
+    return 4 + Expression::size * value_chars;
+}
+
+/**
+ * Append objects to a string growing it by chunks, the size of the string is adjusted to the
+ * text written after each chunk.
+ */
+template <typename Iterator, typename Writer>
+void
+append_formatted(std::string& out, Iterator first, Iterator last, std::size_t max_chars,
+                 Writer write)
+{
+    while (first != last) {
+        auto pos = out.size();
+        out.resize(pos + format_chunk_size * max_chars);
+        char* p   = &out[pos];
+        char* end = &out[0] + out.size();
+        for (std::size_t i = 0; i < format_chunk_size && first != last; ++i, ++first) {
+            p = write(p, end, *first);
+        }
+        assert(p && "Formatted text exceeds the estimated size");
+        out.resize(p - out.data());
+    }
+}
+
+template <typename Range>
+using range_value_t = std::decay_t<decltype(*std::begin(std::declval<Range const&>()))>;
+
+}    // namespace detail
+
+//@{
+/** @name Format a single vector */
+/**
+ * Format a vector to a character buffer without using iostreams.
+ * The layout is the same as operator<< produces for the same settings, the values are formatted
+ * with std::to_chars in the shortest representation that can be parsed back to the same value.
+ * The text differs from operator<< for values that need more digits than the stream precision,
+ * e.g. 0.1 + 0.2 is written as 0.30000000000000004 and not as 0.3. A column width in the pretty
+ * mode limits the precision the same way as the stream output does.
+ * Integral values are always formatted as numbers, including the 8-bit ones.
+ *
+ * @code
+ * char buffer[128];
+ * auto res = io::format_vector(buffer, buffer + sizeof(buffer), v);
+ * if (res) {
+ *     std::string_view str{buffer, res.ptr - buffer};
+ * }
+ * @endcode
+ */
+template <typename Expression, typename = traits::enable_if_vector_expression<Expression>>
+format_result
+format_vector(char* first, char* last, Expression const& v, text_format const& fmt = {})
+{
+    auto p = detail::put_vector(first, last, v, fmt);
+    if (!p)
+        return {last, std::errc::value_too_large};
+    return {p, std::errc{}};
+}
+
+/**
+ * Append a formatted vector to a string. The string can be reused as a buffer, clear() doesn't
+ * free the memory.
+ */
+template <typename Expression, typename = traits::enable_if_vector_expression<Expression>>
+void
+format_vector(std::string& out, Expression const& v, text_format const& fmt = {})
+{
+    auto pos = out.size();
+    out.resize(pos + detail::max_vector_chars<Expression>(fmt));
+    auto p = detail::put_vector(&out[pos], &out[0] + out.size(), v, fmt);
+    assert(p && "Formatted text exceeds the estimated size");
+    out.resize(p - out.data());
+}
+
+template <typename Expression, typename = traits::enable_if_vector_expression<Expression>>
+std::string
+to_string(Expression const& v, text_format const& fmt = {})
+{
+    std::string str;
+    format_vector(str, v, fmt);
+    return str;
+}
+//@}
+
+//@{
+/** @name Format a sequence of vectors */
+/**
+ * Format a range of vectors (a container or a memory_vector_view) to a character buffer.
+ * Each vector is followed by the row separator of the format.
+ */
+template <typename Range,
+          typename = traits::enable_if_vector_expression<detail::range_value_t<Range>>>
+format_result
+format_vectors(char* first, char* last, Range const& vectors, text_format const& fmt = {})
+{
+    auto p = first;
+    for (auto const& v : vectors) {
+        p = detail::put_string(detail::put_vector(p, last, v, fmt), last, fmt.row_sep);
+        if (!p)
+            return {last, std::errc::value_too_large};
+    }
+    return {p, std::errc{}};
+}
+
+/**
+ * Append a range of vectors (a container or a memory_vector_view) to a string.
+ * Each vector is followed by the row separator of the format.
+ */
+template <typename Range,
+          typename = traits::enable_if_vector_expression<detail::range_value_t<Range>>>
+void
+format_vectors(std::string& out, Range const& vectors, text_format const& fmt = {})
+{
+    using vector_type = detail::range_value_t<Range>;
+    detail::append_formatted(
+        out, std::begin(vectors), std::end(vectors),
+        detail::max_vector_chars<vector_type>(fmt) + fmt.row_sep.size(),
+        [&fmt](char* p, char* last, auto const& v) {
+            return detail::put_string(detail::put_vector(p, last, v, fmt), last, fmt.row_sep);
+        });
+}
+//@}
+
+}    // namespace io
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_VECTOR_FORMAT_HPP_ */
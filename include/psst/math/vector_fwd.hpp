@@ -13,8 +13,15 @@
 namespace psst {
 namespace math {
 
+struct precise_math;
+
+/**
+ * A vector of Size values of type T. The math policy chooses how the operations taking the
+ * vector compute, see math_policy.hpp.
+ */
 template <typename T, std::size_t Size,
-          typename Components = components::default_components_t<Size>>
+          typename Components = components::default_components_t<Size>,
+          typename MathPolicy = precise_math>
 struct vector;
 
 /**
@@ -8,6 +8,7 @@
 #ifndef PSST_MATH_VECTOR_IO_HPP_
 #define PSST_MATH_VECTOR_IO_HPP_
 
+#include <psst/math/text_format.hpp>
 #include <psst/math/vector.hpp>
 
 #include <functional>
@@ -97,6 +98,24 @@ public:
         return col_width_;
     }
 
+    /**
+     * Text settings of the facet for use with the buffer-based parsing and formatting functions
+     */
+    basic_text_format<CharT>
+    text_format() const
+    {
+        basic_text_format<CharT> fmt;
+        fmt.start     = start_;
+        fmt.end       = end_;
+        fmt.delim     = delim_;
+        fmt.separator = separator_;
+        fmt.pretty    = pretty_;
+        fmt.col_width = col_width_;
+        fmt.row_sep   = row_sep_;
+        fmt.offset    = offset_;
+        return fmt;
+    }
+
     vector_facet*
     make_pretty(bool val) const
     {
@@ -0,0 +1,248 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * vector_parse.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_VECTOR_PARSE_HPP_
+#define PSST_MATH_VECTOR_PARSE_HPP_
+
+#include <psst/math/detail/charconv.hpp>
+#include <psst/math/text_format.hpp>
+#include <psst/math/vector.hpp>
+#include <psst/math/vector_view.hpp>
+
+#include <string_view>
+
+namespace psst {
+namespace math {
+namespace io {
+
+/**
+ * Result of parsing a character buffer.
+ * On error ptr points to the position where the parsing stopped.
+ */
+struct parse_result {
+    char const* ptr;
+    std::errc   ec;
+    /** Number of objects parsed */
+    std::size_t count;
+
+    constexpr explicit operator bool() const { return ec == std::errc{}; }
+};
+
+namespace detail {
+
+inline char const*
+expect_char(char const* first, char const* last, char c)
+{
+    first = skip_space(first, last);
+    if (first == last || *first != c)
+        return nullptr;
+    return first + 1;
+}
+
+/**
+ * Parse Size values enclosed in the braces and separated by the delimiter set in the text format.
+ * Whitespace is allowed around the braces, delimiters and values.
+ */
+template <std::size_t Size, typename T>
+parse_result
+parse_values(char const* first, char const* last, T* values, text_format const& fmt)
+{
+    auto p = expect_char(first, last, fmt.start);
+    if (!p)
+        return {skip_space(first, last), std::errc::invalid_argument, 0};
+    for (std::size_t i = 0; i < Size; ++i) {
+        if (i > 0) {
+            auto d = expect_char(p, last, fmt.delim);
+            if (!d)
+                return {skip_space(p, last), std::errc::invalid_argument, 0};
+            p = d;
+        }
+        p      = skip_space(p, last);
+        auto r = from_chars(p, last, values[i]);
+        if (r.ec != std::errc{})
+            return {r.ptr, r.ec, 0};
+        p = r.ptr;
+    }
+    auto e = expect_char(p, last, fmt.end);
+    if (!e)
+        return {skip_space(p, last), std::errc::invalid_argument, 0};
+    return {e, std::errc{}, 1};
+}
+
+/**
+ * Skip the whitespace and an optional delimiter between objects in bulk parsing.
+ */
+inline char const*
+skip_object_delim(char const* first, char const* last, text_format const& fmt)
+{
+    first = skip_space(first, last);
+    if (first != last && *first == fmt.delim)
+        first = skip_space(first + 1, last);
+    return first;
+}
+
+/**
+ * Parse a sequence of objects separated by whitespace and/or delimiters until the end of
+ * buffer or until the sink refuses to accept more objects.
+ */
+template <typename Parser, typename Sink>
+parse_result
+parse_sequence(char const* first, char const* last, text_format const& fmt, Parser parse,
+               Sink sink)
+{
+    std::size_t count = 0;
+    auto        p     = skip_space(first, last);
+    while (p != last && sink.want_more(count)) {
+        auto r = parse(p, last);
+        if (!r)
+            return {r.ptr, r.ec, count};
+        sink.put(count);
+        ++count;
+        p = skip_object_delim(r.ptr, last, fmt);
+    }
+    return {p, std::errc{}, count};
+}
+
+}    // namespace detail
+
+//@{
+/** @name Parse a single vector */
+/**
+ * Parse a vector from a character buffer without using iostreams.
+ * The text format is the same that is produced by operator<< for vectors and the braces and
+ * delimiters are taken from the text format, that can be obtained from a vector_facet.
+ * The vector is not modified if the parsing fails.
+ *
+ * @code
+ * vector3d v;
+ * auto res = io::parse_vector(str.data(), str.data() + str.size(), v);
+ * if (!res) { ... }
+ * @endcode
+ */
+template <typename T, std::size_t Size, typename Components>
+parse_result
+parse_vector(char const* first, char const* last, vector<T, Size, Components>& v,
+             text_format const& fmt = {})
+{
+    using vector_type = vector<T, Size, Components>;
+    T    values[Size];
+    auto res = detail::parse_values<Size>(first, last, values, fmt);
+    if (res)
+        v = vector_type{values};
+    return res;
+}
+
+template <typename T, std::size_t Size, typename Components, component_order Order>
+parse_result
+parse_vector(char const* first, char const* last, vector_view<T*, Size, Components, Order>& v,
+             text_format const& fmt = {})
+{
+    using vector_type = vector<T, Size, Components>;
+    T    values[Size];
+    auto res = detail::parse_values<Size>(first, last, values, fmt);
+    if (res)
+        v = vector_type{values};
+    return res;
+}
+
+template <typename Vector>
+parse_result
+parse_vector(std::string_view str, Vector& v, text_format const& fmt = {})
+{
+    return parse_vector(str.data(), str.data() + str.size(), v, fmt);
+}
+//@}
+
+//@{
+/** @name Parse a sequence of vectors */
+/**
+ * Parse all vectors from a character buffer and append them to a container.
+ * Vectors can be separated by whitespace and/or by the delimiter.
+ *
+ * @code
+ * std::vector<vector3f> points;
+ * auto res = io::parse_vectors(file_contents, points);
+ * @endcode
+ */
+template <typename Container, typename = traits::enable_if_vector<typename Container::value_type>>
+parse_result
+parse_vectors(char const* first, char const* last, Container& out, text_format const& fmt = {})
+{
+    using vector_type = typename Container::value_type;
+    using value_type  = typename vector_type::value_type;
+    constexpr auto size = vector_type::size;
+
+    struct sink {
+        Container&  out;
+        value_type* values;
+        bool
+        want_more(std::size_t) const
+        {
+            return true;
+        }
+        void
+        put(std::size_t)
+        {
+            out.push_back(vector_type{values});
+        }
+    };
+
+    value_type values[size];
+    return detail::parse_sequence(
+        first, last, fmt,
+        [&](char const* f, char const* l) { return detail::parse_values<size>(f, l, values, fmt); },
+        sink{out, values});
+}
+
+/**
+ * Parse vectors from a character buffer directly to a memory buffer.
+ * Parsing stops when the view is full or the end of input is reached, the count member of the
+ * result contains the number of vectors written.
+ */
+template <typename T, std::size_t Size, typename Components, component_order Order>
+parse_result
+parse_vectors(char const* first, char const* last,
+              memory_vector_view<T*, Size, Components, Order> view, text_format const& fmt = {})
+{
+    using vector_type = vector<T, Size, Components>;
+
+    struct sink {
+        memory_vector_view<T*, Size, Components, Order>& view;
+        T*                                               values;
+        bool
+        want_more(std::size_t count) const
+        {
+            return count < view.size();
+        }
+        void
+        put(std::size_t index)
+        {
+            view[index] = vector_type{values};
+        }
+    };
+
+    T values[Size];
+    return detail::parse_sequence(
+        first, last, fmt,
+        [&](char const* f, char const* l) { return detail::parse_values<Size>(f, l, values, fmt); },
+        sink{view, values});
+}
+
+template <typename Output>
+parse_result
+parse_vectors(std::string_view str, Output&& out, text_format const& fmt = {})
+{
+    return parse_vectors(str.data(), str.data() + str.size(), std::forward<Output>(out), fmt);
+}
+//@}
+
+}    // namespace io
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_VECTOR_PARSE_HPP_ */
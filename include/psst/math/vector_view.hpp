@@ -287,12 +287,12 @@ struct memory_vector_view<T*, Size, Components, Order> {
     static constexpr std::size_t element_size    = sizeof(T) * component_count;
 
     template <typename P>
-    struct base_iterator : std::iterator<std::random_access_iterator_tag, view_type, std::ptrdiff_t,
-                                         view_type, view_type> {
-        using base_type = std::iterator<std::random_access_iterator_tag, view_type, std::ptrdiff_t,
-                                        view_type, view_type>;
-        using difference_type = typename base_type::difference_type;
-        using value_type      = typename base_type::value_type;
+    struct base_iterator {
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = vector_view<P, Size, Components, Order>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = value_type;
+        using reference         = value_type;
 
         base_iterator(P p) : p_{p} {}
 
@@ -406,7 +406,13 @@ struct memory_vector_view<T*, Size, Components, Order> {
 
     constexpr view_type operator[](std::size_t index) const
     {
-        return view_type{buffer_ + index * element_size};
+        return view_type{buffer_ + index * component_count};
+    }
+
+    constexpr pointer_type
+    data() const
+    {
+        return buffer_;
     }
 
     constexpr iterator
@@ -495,6 +501,42 @@ make_vector_view(unsigned char const* buffer)
     return make_vector_view_impl<value_type, T, Order>(reinterpret_cast<value_type const*>(buffer));
 }
 
+namespace detail {
+
+template <typename T>
+using is_byte_value_vector = std::integral_constant<
+    bool, std::is_same<traits::scalar_expression_result_t<T>, char>::value ||
+              std::is_same<traits::scalar_expression_result_t<T>, unsigned char>::value>;
+
+/**
+ * Enables the overloads taking a pointer to the vector's value type unless the value type is a
+ * byte type, in which case the byte buffer overloads are used.
+ */
+template <typename T>
+using enable_if_not_byte_value_vector = std::enable_if_t<!is_byte_value_vector<T>::value>;
+
+}    // namespace detail
+
+template <typename T, component_order Order = component_order::forward,
+          typename = traits::enable_if_vector<T>,
+          typename = detail::enable_if_not_byte_value_vector<T>>
+constexpr auto
+make_vector_view(traits::scalar_expression_result_t<T>* buffer)
+{
+    using value_type = traits::scalar_expression_result_t<T>;
+    return make_vector_view_impl<value_type, T, Order>(buffer);
+}
+
+template <typename T, component_order Order = component_order::forward,
+          typename = traits::enable_if_vector<T>,
+          typename = detail::enable_if_not_byte_value_vector<T>>
+constexpr auto
+make_vector_view(traits::scalar_expression_result_t<T> const* buffer)
+{
+    using value_type = traits::scalar_expression_result_t<T>;
+    return make_vector_view_impl<value_type const, T, Order>(buffer);
+}
+
 template <typename U, typename T, component_order Order = component_order::forward,
           typename = traits::enable_if_vector<T>>
 constexpr auto
@@ -547,6 +589,32 @@ make_memory_vector_view(unsigned char const* buffer, std::size_t buffer_size)
         reinterpret_cast<value_type const*>(buffer), buffer_size / sizeof(value_type));
 }
 
+/**
+ * Create a memory_vector_view over a buffer of values
+ * @param buffer
+ * @param buffer_size Size of the buffer in values (not in bytes)
+ */
+template <typename T, component_order Order = component_order::forward,
+          typename = traits::enable_if_vector<T>,
+          typename = detail::enable_if_not_byte_value_vector<T>>
+constexpr auto
+make_memory_vector_view(traits::scalar_expression_result_t<T>* buffer, std::size_t buffer_size)
+{
+    using value_type = traits::scalar_expression_result_t<T>;
+    return make_memory_vector_view_impl<value_type, T, Order>(buffer, buffer_size);
+}
+
+template <typename T, component_order Order = component_order::forward,
+          typename = traits::enable_if_vector<T>,
+          typename = detail::enable_if_not_byte_value_vector<T>>
+constexpr auto
+make_memory_vector_view(traits::scalar_expression_result_t<T> const* buffer,
+                        std::size_t                                  buffer_size)
+{
+    using value_type = traits::scalar_expression_result_t<T>;
+    return make_memory_vector_view_impl<value_type const, T, Order>(buffer, buffer_size);
+}
+
 }    // namespace math
 }    // namespace psst
 
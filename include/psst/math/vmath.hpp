@@ -0,0 +1,806 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * vmath.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#ifndef PSST_MATH_VMATH_HPP_
+#define PSST_MATH_VMATH_HPP_
+
+#include <psst/math/angles.hpp>
+#include <psst/math/detail/block_loop.hpp>
+#include <psst/math/detail/value_traits.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+/**
+ * Keeps the compiler from reassociating the expression with the surrounding ones under
+ * -ffast-math, which would lose the extra precision of the split constants in argument
+ * reduction. GCC has a builtin for it since version 12, elsewhere it is the expression itself.
+ */
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_assoc_barrier)
+#define PSST_MATH_ASSOC_BARRIER(expr) __builtin_assoc_barrier(expr)
+#endif
+#endif
+
+#if !defined(PSST_MATH_ASSOC_BARRIER)
+#define PSST_MATH_ASSOC_BARRIER(expr) (expr)
+#endif
+
+/**
+ * Elementary functions for float and double built of branchless polynomial kernels. The kernels
+ * run over blocks of values, see detail/block_loop.hpp, so the functions are applied to buffers
+ * or to the lanes of SIMD packs several values at a time, where the standard library takes a call
+ * per value.
+ *
+ * The functions are objects, so they can be passed to apply:
+ *
+ *     auto s = apply(v, vmath::sin);
+ *     vmath::sin(angles.data(), angles.size(), sines.data());
+ *
+ * Errors are in units of the last place of the result, measured against the standard library
+ * in higher precision over the documented ranges of the arguments.
+ *
+ * Argument reduction of double sin, cos and exp subtracts constants split in parts, which
+ * -ffast-math would merge back. The parts are kept apart by an association barrier, but GCC 12
+ * drops it in vectorised loops, so that the absolute error of a double reduced argument grows to
+ * about |x| * 1e-16 there. Float arguments are reduced in double and are not affected.
+ */
+namespace psst {
+namespace math {
+namespace vmath {
+
+namespace detail {
+
+template <typename F>
+struct float_bits;
+
+/** Bits of a floating point value, mantissa digits and the exponent bias */
+template <>
+struct float_bits<float> {
+    using type                  = std::uint32_t;
+    static constexpr int  digits = 23;
+    static constexpr int  bias   = 127;
+    /** Sign and mantissa bits */
+    static constexpr type mantissa_mask = 0x807fffff;
+    /** Exponent of 0.5 */
+    static constexpr type half_exponent = 0x3f000000;
+};
+
+template <>
+struct float_bits<double> {
+    using type                  = std::uint64_t;
+    static constexpr int  digits = 52;
+    static constexpr int  bias   = 1023;
+    static constexpr type mantissa_mask = 0x800fffffffffffff;
+    static constexpr type half_exponent = 0x3fe0000000000000;
+};
+
+template <typename F>
+typename float_bits<F>::type
+to_bits(F v)
+{
+    typename float_bits<F>::type res;
+    std::memcpy(&res, &v, sizeof(res));
+    return res;
+}
+
+template <typename F>
+F
+from_bits(typename float_bits<F>::type v)
+{
+    F res;
+    std::memcpy(&res, &v, sizeof(res));
+    return res;
+}
+
+/** Nearest integer, halfway cases away from zero, for v within the range of int32 */
+template <typename F>
+std::int32_t
+round_to_int(F v)
+{
+    return static_cast<std::int32_t>(v + (v < 0 ? F{-0.5} : F{0.5}));
+}
+
+/** 2^k for k in the range of normal numbers */
+template <typename F>
+F
+exp2_int(std::int32_t k)
+{
+    using bits = float_bits<F>;
+    return from_bits<F>(static_cast<typename bits::type>(k + bits::bias) << bits::digits);
+}
+
+//@{
+/**
+ * @name Polynomials
+ * Single precision minimax polynomials of Cephes and double precision ones of fdlibm and Cephes.
+ */
+/** sin on [-π/4, π/4] of y and z = y² */
+inline float
+sin_poly(float y, float z)
+{
+    return y + y * z * ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f);
+}
+inline double
+sin_poly(double y, double z)
+{
+    double const r = -2.50507602534068634195e-08 + z * 1.58969099521155010221e-10;
+    double const q = 8.33333333332248946124e-03
+                     + z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06 + z * r));
+    return y + y * z * (-1.66666666666666324348e-01 + z * q);
+}
+
+/** cos on [-π/4, π/4] of z = y² */
+inline float
+cos_poly(float z)
+{
+    float const p = (2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f;
+    return 1 - 0.5f * z + z * z * p;
+}
+inline double
+cos_poly(double z)
+{
+    double const r = 2.08757232129817482790e-09 + z * -1.13596475577881948265e-11;
+    double const q = -1.38888888888741095749e-03
+                     + z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07 + z * r));
+    return 1 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * q);
+}
+
+/** atan on [0, 1] */
+inline float
+atan_unit(float a)
+{
+    constexpr float tan_pi_8 = 0.414213562373095048801688724209698079f;
+    bool const      reduce   = a > tan_pi_8;
+    float const     t        = reduce ? (a - 1) / (a + 1) : a;
+    float const     z        = t * t;
+    float const     p
+        = ((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z
+          - 3.33329491539e-1f;
+    float const r = t + t * z * p;
+    return reduce ? r + half_pi_v<float> / 2 : r;
+}
+inline double
+atan_unit(double a)
+{
+    constexpr double more_bits = 6.123233995736765886130e-17;
+    bool const       reduce    = a > 0.66;
+    double const     t         = reduce ? (a - 1) / (a + 1) : a;
+    double const     z         = t * t;
+    double const     p
+        = (((-8.750608600031904122785e-1 * z - 1.615753718733365076637e1) * z
+            - 7.500855792314704667340e1)
+               * z
+           - 1.228866684490136173410e2)
+              * z
+          - 6.485021904942025371773e1;
+    double const q = ((((z + 2.485846490142306297962e1) * z + 1.650270098316988542046e2) * z
+                       + 4.328810604912902668951e2)
+                          * z
+                      + 4.853903996359136964868e2)
+                         * z
+                     + 1.945506571482613964425e2;
+    double const r = t + t * (z * p / q);
+    return reduce ? half_pi_v<double> / 2 + (r + more_bits / 2) : r;
+}
+
+/** exp on [-ln(2)/2, ln(2)/2] */
+inline float
+exp_poly(float r)
+{
+    float const p = ((((1.9875691500e-4f * r + 1.3981999507e-3f) * r + 8.3334519073e-3f) * r
+                      + 4.1665795894e-2f)
+                         * r
+                     + 1.6666665459e-1f)
+                        * r
+                    + 5.0000001201e-1f;
+    return p * (r * r) + r + 1;
+}
+inline double
+exp_poly(double r)
+{
+    double const rr = r * r;
+    double const p
+        = r * ((1.26177193074810590878e-4 * rr + 3.02994407707441961300e-2) * rr
+               + 9.99999999999999999910e-1);
+    double const q = ((3.00198505138664455042e-6 * rr + 2.52448340349684104192e-3) * rr
+                      + 2.27265548208155028766e-1)
+                         * rr
+                     + 2.00000000000000000009e0;
+    return 1 + 2 * (p / (q - p));
+}
+
+/** log(1 + x) - x + x²/2 for x in [sqrt(1/2) - 1, sqrt(2) - 1] */
+inline float
+log_poly(float x)
+{
+    float const z = x * x;
+    float const p
+        = (((((((7.0376836292e-2f * x - 1.1514610310e-1f) * x + 1.1676998740e-1f) * x
+               - 1.2420140846e-1f)
+                  * x
+              + 1.4249322787e-1f)
+                 * x
+             - 1.6668057665e-1f)
+                * x
+            + 2.0000714765e-1f)
+               * x
+           - 2.4999993993e-1f)
+              * x
+          + 3.3333331174e-1f;
+    return p * x * z;
+}
+inline double
+log_poly(double x)
+{
+    double const z = x * x;
+    double const p = ((((1.01875663804580931796e-4 * x + 4.97494994976747001425e-1) * x
+                        + 4.70579119878881725854e0)
+                           * x
+                       + 1.44989225341610930846e1)
+                          * x
+                      + 1.79368678507819816313e1)
+                         * x
+                     + 7.70838733755885391666e0;
+    double const q = ((((x + 1.12873587189167450590e1) * x + 4.52279145837532221105e1) * x
+                       + 8.29875266912776603211e1)
+                          * x
+                      + 7.11544750618563894466e1)
+                         * x
+                     + 2.31251620126765340583e1;
+    return x * (z * p / q);
+}
+//@}
+
+//@{
+/** @name Constants of argument reduction */
+template <typename F>
+struct reduction_constants;
+
+/**
+ * Float arguments are reduced in double. π/2 is split in two parts, the product of the high one
+ * by a multiple below 2^20 is exact, so arguments close to a multiple of π/2 keep their bits.
+ */
+template <>
+struct reduction_constants<float> {
+    static constexpr double pio2_1     = 0x1.921fb544p+0;
+    static constexpr double pio2_1t    = 6.07710050650619224932e-11;
+    static constexpr double ln2        = 0.693147180559945309417232121458176568L;
+    static constexpr float  exp_min    = -104.5f;
+    static constexpr float  exp_max    = 88.8f;
+    static constexpr float  sincos_max = 0x1p19 * pi_v<double>;
+};
+
+/**
+ * π/2 and ln(2) split so that products of the high parts by small integers are exact. The last
+ * part of π/2 holds the bits that the first three leave out, which matter for arguments within
+ * a few ulp of a multiple of π/2.
+ */
+template <>
+struct reduction_constants<double> {
+    static constexpr double pio2_1     = 0x1.921fb544p+0;
+    static constexpr double pio2_2     = 0x1.0b4611a6p-34;
+    static constexpr double pio2_3     = 0x1.3198a2ep-69;
+    static constexpr double pio2_3t    = 8.47842766036889956997e-32;
+    static constexpr double ln2_hi     = 0.693359375;
+    static constexpr double ln2_lo     = -2.121944400546905827679e-4;
+    static constexpr double exp_min    = -745.2;
+    static constexpr double exp_max    = 709.8;
+    static constexpr double sincos_max = 0x1p19 * pi_v<double>;
+};
+//@}
+
+//@{
+/** @name Scalar kernels */
+/**
+ * Arguments that sincos reduces, |x| <= 2^19 π. Larger and non-finite ones are left to the
+ * standard functions.
+ */
+template <typename F>
+inline bool
+sincos_reduced(F x)
+{
+    return (x < 0 ? -x : x) <= reduction_constants<F>::sincos_max;
+}
+
+/**
+ * The argument is reduced to [-π/4, π/4] by subtracting the nearest multiple of π/2, in double
+ * split in two parts for float and split in four parts for double. Arguments out of the reduced
+ * range are replaced by zero, the callers take the standard functions for them.
+ */
+template <typename F>
+inline void
+sincos(F x, F& s, F& c)
+{
+    using consts          = reduction_constants<F>;
+    F const            xr = sincos_reduced(x) ? x : F{0};
+    double const       q  = static_cast<double>(xr) * 0.636619772367581343075535053490057448;
+    std::int32_t const j  = round_to_int(q);
+    double const       fj = static_cast<double>(j);
+    F                  y;
+    if constexpr (std::is_same<F, float>::value) {
+        y = static_cast<float>(PSST_MATH_ASSOC_BARRIER(xr - fj * consts::pio2_1)
+                               - fj * consts::pio2_1t);
+    } else {
+        y = PSST_MATH_ASSOC_BARRIER(
+                PSST_MATH_ASSOC_BARRIER(
+                    PSST_MATH_ASSOC_BARRIER(xr - fj * consts::pio2_1) - fj * consts::pio2_2)
+                - fj * consts::pio2_3)
+            - fj * consts::pio2_3t;
+    }
+    F const z  = y * y;
+    F const ps = sin_poly(y, z);
+    F const pc = cos_poly(z);
+    F const sv = (j & 1) ? pc : ps;
+    F const cv = (j & 1) ? ps : pc;
+    s          = (j & 2) ? -sv : sv;
+    c          = ((j + 1) & 2) ? -cv : cv;
+}
+
+/** Standard sin and cos for the arguments that sincos does not reduce */
+template <typename F>
+inline void
+sincos_fallback(F x, F& s, F& c)
+{
+    if (!sincos_reduced(x)) {
+        s = std::sin(x);
+        c = std::cos(x);
+    }
+}
+
+/**
+ * atan of the smaller to the larger absolute value, then mapped to the octant. Equal absolute
+ * values, infinite ones included, are on the diagonal, NaN arguments give NaN.
+ */
+template <typename F>
+inline F
+atan2(F y, F x)
+{
+    F const ax = x < 0 ? -x : x;
+    F const ay = y < 0 ? -y : y;
+    F const mx = ax > ay ? ax : ay;
+    F const mn = ax > ay ? ay : ax;
+    F const t  = mn == mx ? F{1} : mn / mx;
+    F       r  = atan_unit(mx > 0 ? t : F{0});
+    r          = ay > ax ? half_pi_v<F> - r : r;
+    r          = x < 0 ? pi_v<F> - r : r;
+    r          = y < 0 ? -r : r;
+    return x != x || y != y ? x + y : r;
+}
+
+/**
+ * x = k ln(2) + r, exp(x) = 2^k exp(r), 2^k is applied in two steps to reach subnormals. The
+ * argument is clamped to the range where the result overflows or underflows, NaN gives NaN.
+ */
+template <typename F>
+inline F
+exp(F x)
+{
+    using consts         = reduction_constants<F>;
+    F const            a  = x < consts::exp_min   ? consts::exp_min
+                            : x > consts::exp_max ? consts::exp_max
+                            : x == x              ? x
+                                                  : F{0};
+    std::int32_t const k  = round_to_int(a * F(1.44269504088896340735992468100189214L));
+    double const       fk = static_cast<double>(k);
+    F                  r;
+    if constexpr (std::is_same<F, float>::value) {
+        r = static_cast<float>(a - fk * consts::ln2);
+    } else {
+        r = PSST_MATH_ASSOC_BARRIER(a - fk * consts::ln2_hi) - fk * consts::ln2_lo;
+    }
+    std::int32_t const k1 = k / 2;
+    F const res = PSST_MATH_ASSOC_BARRIER(exp_poly(r) * exp2_int<F>(k1)) * exp2_int<F>(k - k1);
+    return x == x ? res : x;
+}
+
+/**
+ * x = 2^e m with m in [sqrt(1/2), sqrt(2)), log(x) = e ln(2) + log(m). Zero gives -infinity,
+ * negative values NaN, infinity and NaN are returned as they are.
+ */
+template <typename F>
+inline F
+log(F x)
+{
+    using bits   = float_bits<F>;
+    using consts = reduction_constants<double>;
+    using sint   = std::make_signed_t<typename bits::type>;
+    // Subnormals are scaled to normal numbers first
+    bool const small = x < std::numeric_limits<F>::min();
+    auto const b     = to_bits(small ? x * exp2_int<F>(bits::digits) : x);
+    F e = static_cast<F>(static_cast<sint>(b >> bits::digits) - (bits::bias - 1));
+    e   = small ? e - bits::digits : e;
+    // Mantissa in [0.5, 1), then in [sqrt(1/2), sqrt(2)) minus one
+    F          m      = from_bits<F>((b & bits::mantissa_mask) | bits::half_exponent);
+    bool const lower  = m < F(0.707106781186547524400844362104849039L);
+    e                 = lower ? e - 1 : e;
+    m                 = lower ? m + m - 1 : m - 1;
+    F const    ln2_hi = F(consts::ln2_hi);
+    F const    ln2_lo = F(consts::ln2_lo);
+    F res = PSST_MATH_ASSOC_BARRIER(m + (log_poly(m) - F{0.5} * (m * m) + e * ln2_lo)) + e * ln2_hi;
+    res   = x < std::numeric_limits<F>::infinity() ? res : x;
+    res   = x == 0 ? -std::numeric_limits<F>::infinity() : res;
+    return x < 0 ? std::numeric_limits<F>::quiet_NaN() : res;
+}
+
+/**
+ * exp(y log(x)) for non-negative x. Single precision is computed by the double kernels, so the
+ * result is within an ulp. Zero and infinite x and y follow from the infinities of log and exp,
+ * as in std::pow zero y or unit x give one even with a NaN in the other argument.
+ */
+template <typename F>
+inline F
+pow(F x, F y)
+{
+    F res;
+    if constexpr (std::is_same<F, float>::value) {
+        res = static_cast<float>(exp(static_cast<double>(y) * log(static_cast<double>(x))));
+    } else {
+        res = exp(y * log(x));
+    }
+    res = x < 0 ? std::numeric_limits<F>::quiet_NaN() : res;
+    return y == 0 || x == 1 ? F{1} : res;
+}
+
+/**
+ * Reciprocal square root, an estimate from the bits refined by Newton steps, each doubling the
+ * number of correct bits. The last step adds a correction to the estimate, which rounds better
+ * than the product. Subnormal arguments are scaled by 2^24 or 2^54 first. Zeros give infinity,
+ * infinity gives zero, negative and NaN arguments give NaN.
+ */
+template <typename F>
+inline F
+rsqrt(F x)
+{
+    using bits                     = float_bits<F>;
+    constexpr bool        is_float = std::is_same<F, float>::value;
+    constexpr F           inf      = std::numeric_limits<F>::infinity();
+    constexpr F           scale    = is_float ? F(0x1p24) : F(0x1p54);
+    constexpr F           unscale  = is_float ? F(0x1p12) : F(0x1p27);
+    constexpr std::size_t steps    = is_float ? 3 : 4;
+    // The magic constants minimise the relative error of the estimate
+    constexpr typename bits::type magic = is_float ? 0x5f375a86 : 0x5fe6eb50c7b537a9;
+
+    bool const small  = x < std::numeric_limits<F>::min();
+    bool const finite = x > 0 && x < inf;
+    F const    a      = finite ? (small ? x * scale : x) : F{1};
+    F const    half   = a * F{0.5};
+    F          y      = from_bits<F>(magic - (to_bits(a) >> 1));
+    for (std::size_t i = 0; i + 1 < steps; ++i) {
+        y = y * (F{1.5} - half * y * y);
+    }
+    y = y + y * (F{0.5} - half * y * y);
+    y = small ? y * unscale : y;
+    return finite ? y : (x == 0 ? inf : (x == inf ? F{0} : std::numeric_limits<F>::quiet_NaN()));
+}
+
+/**
+ * Cube root, exponent division estimate refined by Halley iterations, which triple the number
+ * of correct bits each. Tiny arguments are scaled by a power of 2^3 first, so that the cube of
+ * the estimate does not underflow. Zeros, infinities and NaN are returned as they are.
+ */
+template <typename F>
+inline F
+cbrt(F x)
+{
+    using bits = float_bits<F>;
+    // Below 2^-60, float, or 2^-500, double, the argument is scaled by 2^90 or 2^600
+    constexpr F tiny    = std::is_same<F, float>::value ? F(0x1p-60) : F(0x1p-500);
+    constexpr F scale   = std::is_same<F, float>::value ? F(0x1p90) : F(0x1p600);
+    constexpr F unscale = std::is_same<F, float>::value ? F(0x1p-30) : F(0x1p-200);
+    F const     ax      = x < 0 ? -x : x;
+    bool const  small   = ax < tiny;
+    bool const  finite  = ax > 0 && ax < std::numeric_limits<F>::infinity();
+    F const     a       = finite ? (small ? ax * scale : ax) : F{1};
+    // One third of the exponent with a bias that minimises the relative error of the estimate
+    constexpr typename bits::type magic
+        = std::is_same<F, float>::value ? 0x2a514067 : 0x2a9f7893782da1ce;
+    F y = from_bits<F>(to_bits(a) / 3 + magic);
+    for (int i = 0; i < (std::is_same<F, float>::value ? 2 : 3); ++i) {
+        F const y3 = y * y * y;
+        y          = y - y * (y3 - a) / (2 * y3 + a);
+    }
+    y = small ? y * unscale : y;
+    y = finite ? y : ax;
+    return x < 0 ? -y : y;
+}
+//@}
+
+//@{
+/**
+ * @name Kernels as types, to be wrapped in function objects
+ * eval is branchless, so that loops over it vectorise. fallback replaces the results for the
+ * arguments that eval does not cover, in a separate loop where the branch is rarely taken.
+ */
+struct full_range_kernel {
+    template <typename F, typename... Args>
+    static F
+    fallback(F res, Args...)
+    {
+        return res;
+    }
+};
+struct sin_kernel {
+    template <typename F>
+    static F
+    eval(F x)
+    {
+        F s, c;
+        detail::sincos(x, s, c);
+        return s;
+    }
+    template <typename F>
+    static F
+    fallback(F res, F x)
+    {
+        return sincos_reduced(x) ? res : std::sin(x);
+    }
+};
+struct cos_kernel {
+    template <typename F>
+    static F
+    eval(F x)
+    {
+        F s, c;
+        detail::sincos(x, s, c);
+        return c;
+    }
+    template <typename F>
+    static F
+    fallback(F res, F x)
+    {
+        return sincos_reduced(x) ? res : std::cos(x);
+    }
+};
+struct exp_kernel : full_range_kernel {
+    template <typename F>
+    static F
+    eval(F x)
+    {
+        return detail::exp(x);
+    }
+};
+struct log_kernel : full_range_kernel {
+    template <typename F>
+    static F
+    eval(F x)
+    {
+        return detail::log(x);
+    }
+};
+struct rsqrt_kernel : full_range_kernel {
+    template <typename F>
+    static F
+    eval(F x)
+    {
+        return detail::rsqrt(x);
+    }
+};
+struct cbrt_kernel : full_range_kernel {
+    template <typename F>
+    static F
+    eval(F x)
+    {
+        return detail::cbrt(x);
+    }
+};
+struct atan2_kernel : full_range_kernel {
+    template <typename F>
+    static F
+    eval(F y, F x)
+    {
+        return detail::atan2(y, x);
+    }
+};
+struct pow_kernel : full_range_kernel {
+    template <typename F>
+    static F
+    eval(F x, F y)
+    {
+        return detail::pow(x, y);
+    }
+};
+//@}
+
+/**
+ * Values processed in one iteration of the buffer loops, a multiple of any vector width, see
+ * block_loop.hpp. The blocks are padded with ones, which are in the domain of every kernel.
+ */
+constexpr std::size_t block_size = 16;
+
+/** The kernels are defined for float and double */
+template <typename F>
+constexpr bool has_kernels = std::is_same<F, float>::value || std::is_same<F, double>::value;
+
+template <typename F>
+constexpr void
+check_value_type()
+{
+    static_assert(has_kernels<F>,
+                  "vmath functions are defined for float, double and SIMD packs of them");
+}
+
+/** Function of one argument for scalars, packs and buffers */
+template <typename Kernel>
+struct unary_function {
+    template <typename F>
+    F
+    operator()(F const& x) const
+    {
+        if constexpr (traits::is_simd_pack_v<F>) {
+            using value_type = typename F::value_type;
+            check_value_type<value_type>();
+            value_type in[F::lanes], out[F::lanes];
+            x.store(in);
+            for (std::size_t i = 0; i < F::lanes; ++i) {
+                out[i] = Kernel::eval(in[i]);
+            }
+            for (std::size_t i = 0; i < F::lanes; ++i) {
+                out[i] = Kernel::fallback(out[i], in[i]);
+            }
+            return F::load(out);
+        } else {
+            check_value_type<F>();
+            return Kernel::fallback(Kernel::eval(x), x);
+        }
+    }
+
+    /** Compute the function of n values of src to dst, that can be the same buffer */
+    template <typename F>
+    void
+    operator()(F const* src, std::size_t n, F* dst) const
+    {
+        check_value_type<F>();
+        math::detail::for_each_block<block_size>(n, [&](std::size_t first, std::size_t count) {
+            F in[block_size], out[block_size];
+            math::detail::load_block_values(src + first, count, in, F{1});
+            for (std::size_t i = 0; i < block_size; ++i) {
+                out[i] = Kernel::eval(in[i]);
+            }
+            for (std::size_t i = 0; i < block_size; ++i) {
+                out[i] = Kernel::fallback(out[i], in[i]);
+            }
+            math::detail::store_block_values(out, count, dst + first);
+        });
+    }
+};
+
+/** Function of two arguments for scalars, packs and buffers */
+template <typename Kernel>
+struct binary_function {
+    template <typename F>
+    F
+    operator()(F const& a, F const& b) const
+    {
+        if constexpr (traits::is_simd_pack_v<F>) {
+            using value_type = typename F::value_type;
+            check_value_type<value_type>();
+            value_type in_a[F::lanes], in_b[F::lanes], out[F::lanes];
+            a.store(in_a);
+            b.store(in_b);
+            for (std::size_t i = 0; i < F::lanes; ++i) {
+                out[i] = Kernel::eval(in_a[i], in_b[i]);
+            }
+            for (std::size_t i = 0; i < F::lanes; ++i) {
+                out[i] = Kernel::fallback(out[i], in_a[i], in_b[i]);
+            }
+            return F::load(out);
+        } else {
+            check_value_type<F>();
+            return Kernel::fallback(Kernel::eval(a, b), a, b);
+        }
+    }
+
+    template <typename F>
+    void
+    operator()(F const* a, F const* b, std::size_t n, F* dst) const
+    {
+        check_value_type<F>();
+        math::detail::for_each_block<block_size>(n, [&](std::size_t first, std::size_t count) {
+            F in_a[block_size], in_b[block_size], out[block_size];
+            math::detail::load_block_values(a + first, count, in_a, F{1});
+            math::detail::load_block_values(b + first, count, in_b, F{1});
+            for (std::size_t i = 0; i < block_size; ++i) {
+                out[i] = Kernel::eval(in_a[i], in_b[i]);
+            }
+            for (std::size_t i = 0; i < block_size; ++i) {
+                out[i] = Kernel::fallback(out[i], in_a[i], in_b[i]);
+            }
+            math::detail::store_block_values(out, count, dst + first);
+        });
+    }
+};
+
+/** sin and cos of the same argument at the price of one of them */
+struct sincos_function {
+    template <typename F>
+    void
+    operator()(F const& x, F& s, F& c) const
+    {
+        if constexpr (traits::is_simd_pack_v<F>) {
+            using value_type = typename F::value_type;
+            check_value_type<value_type>();
+            value_type in[F::lanes], out_s[F::lanes], out_c[F::lanes];
+            x.store(in);
+            for (std::size_t i = 0; i < F::lanes; ++i) {
+                detail::sincos(in[i], out_s[i], out_c[i]);
+            }
+            for (std::size_t i = 0; i < F::lanes; ++i) {
+                detail::sincos_fallback(in[i], out_s[i], out_c[i]);
+            }
+            s = F::load(out_s);
+            c = F::load(out_c);
+        } else {
+            check_value_type<F>();
+            detail::sincos(x, s, c);
+            detail::sincos_fallback(x, s, c);
+        }
+    }
+
+    template <typename F>
+    void
+    operator()(F const* src, std::size_t n, F* s, F* c) const
+    {
+        check_value_type<F>();
+        math::detail::for_each_block<block_size>(n, [&](std::size_t first, std::size_t count) {
+            F in[block_size], out_s[block_size], out_c[block_size];
+            math::detail::load_block_values(src + first, count, in, F{1});
+            for (std::size_t i = 0; i < block_size; ++i) {
+                detail::sincos(in[i], out_s[i], out_c[i]);
+            }
+            for (std::size_t i = 0; i < block_size; ++i) {
+                detail::sincos_fallback(in[i], out_s[i], out_c[i]);
+            }
+            math::detail::store_block_values(out_s, count, s + first);
+            math::detail::store_block_values(out_c, count, c + first);
+        });
+    }
+};
+
+}    // namespace detail
+
+//@{
+/**
+ * @name Functions
+ * Each function takes a float or double value, a SIMD pack of them, or a source buffer, a count
+ * and a destination buffer.
+ */
+/**
+ * Within 2 ulp for |x| <= 2^19 π, arguments near multiples of π/2 included. Larger and
+ * non-finite arguments are passed to the standard functions, which give NaN for infinities.
+ */
+inline constexpr detail::unary_function<detail::sin_kernel> sin{};
+/** Error bounds of sin */
+inline constexpr detail::unary_function<detail::cos_kernel> cos{};
+/** sincos(x, s, c) or sincos(src, n, s, c), error bounds of sin */
+inline constexpr detail::sincos_function sincos{};
+/** Within 1 ulp for float and 2 ulp for double, subnormal results lose precision. NaN is kept. */
+inline constexpr detail::unary_function<detail::exp_kernel> exp{};
+/** Within 1 ulp, special values as in std::log */
+inline constexpr detail::unary_function<detail::log_kernel> log{};
+/**
+ * atan2(y, x), within 3 ulp for float and 2 ulp for double. Infinities and NaN are handled as in
+ * std::atan2, signed zeros are not told apart.
+ */
+inline constexpr detail::binary_function<detail::atan2_kernel> atan2{};
+/** pow(x, y) for non-negative x, within 1 ulp for float and (2 + |y log(x)|) ulp for double */
+inline constexpr detail::binary_function<detail::pow_kernel> pow{};
+/** 1 / sqrt(x), within 1.5 ulp, special values as in 1 / std::sqrt(x) */
+inline constexpr detail::unary_function<detail::rsqrt_kernel> rsqrt{};
+/** Cube root, within 1 ulp over the whole range, subnormals included */
+inline constexpr detail::unary_function<detail::cbrt_kernel> cbrt{};
+//@}
+
+}    // namespace vmath
+}    // namespace math
+}    // namespace psst
+
+#endif /* PSST_MATH_VMATH_HPP_ */
@@ -8,10 +8,17 @@
 
 #include "test_printing.hpp"
 #include <psst/math/colors.hpp>
+#include <psst/math/colors_batch.hpp>
+#include <psst/math/colors_hex.hpp>
+#include <psst/math/colors_io.hpp>
+#include <psst/math/colors_lab.hpp>
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <limits>
 #include <sstream>
+#include <vector>
 
 namespace psst {
 namespace math {
@@ -22,7 +29,9 @@ using argb     = color::argb<float>;
 using hsla     = color::hsla<float>;
 using hsva     = color::hsva<float>;
 using rgba_hex = color::rgba_hex;
+using rgb_hex  = color::rgb_hex;
 using color::operator""_rgba;
+using color::operator""_rgb;
 
 TEST(Vector, ConstructRGB)
 {
@@ -55,6 +64,111 @@ TEST(Color, Hex)
     EXPECT_EQ(0, c1.green());
     EXPECT_EQ(0, c1.blue());
     EXPECT_EQ(1.0, c1.alpha());
+
+    EXPECT_EQ(c_hex, convert<rgba_hex>(c1));
+    EXPECT_EQ((rgb_hex{0xff, 0x80, 0}), convert<rgb_hex>(color::rgb<float>{1, 0.503, 0}));
+    // Rounded to nearest and clamped like the batch conversions
+    EXPECT_EQ((rgb_hex{0xff, 0x80, 0x01}), convert<rgb_hex>(color::rgb<float>{1, 0.5, 0.003}));
+    EXPECT_EQ((rgba_hex{0xff, 0, 0xcc, 0xff}),
+              convert<rgba_hex>(color::rgba<float>{1.5, -0.2, 0.8, 1}));
+}
+
+TEST(Color, HexText)
+{
+    rgba_hex c;
+    EXPECT_TRUE(io::parse_hex_color("#ff8000Aa", c));
+    EXPECT_EQ(0xff8000aa_rgba, c);
+    EXPECT_EQ("#ff8000aa", io::to_hex_string(c));
+
+    rgb_hex c3;
+    EXPECT_TRUE(io::parse_hex_color("  #0080fF", c3));
+    EXPECT_EQ(0x0080ff_rgb, c3);
+    EXPECT_EQ("#0080ff", io::to_hex_string(c3));
+
+    std::string_view invalid[]{"", "ff8000aa", "#ff8000a", "#ff80g0aa", "#ff8000a\xaa"};
+    for (auto str : invalid) {
+        auto res = io::parse_hex_color(str, c);
+        EXPECT_FALSE(res) << str;
+        EXPECT_EQ(0xff8000aa_rgba, c);
+    }
+    auto res = io::parse_hex_color("#ff80g0aa", c);
+    EXPECT_EQ('g', *res.ptr);
+
+    std::ostringstream os;
+    os << c << " " << c3;
+    EXPECT_EQ("#ff8000aa #0080ff", os.str());
+    std::istringstream is{os.str()};
+    rgba_hex c_in;
+    EXPECT_TRUE(is >> c_in);
+    EXPECT_EQ(c, c_in);
+}
+
+TEST(Color, HexBulk)
+{
+    // Cover all byte values and more than a block of colors
+    std::vector<rgba_hex> colors;
+    for (unsigned i = 0; i < 256; i += 3) {
+        colors.push_back(rgba_hex{(std::uint8_t)i, (std::uint8_t)(255 - i), (std::uint8_t)(i * 7),
+                                  (std::uint8_t)(i * 13)});
+    }
+
+    std::string text;
+    io::format_hex_colors(text, colors);
+    EXPECT_EQ(colors.size() * 10, text.size());
+    std::size_t i = 0;
+    for (auto const& c : colors) {
+        EXPECT_EQ(io::to_hex_string(c) + "\n", text.substr(i * 10, 10));
+        ++i;
+    }
+
+    std::vector<rgba_hex> parsed;
+    auto                  res = io::parse_hex_colors(text, parsed);
+    EXPECT_TRUE(res);
+    EXPECT_EQ(colors.size(), res.count);
+    EXPECT_EQ(colors, parsed);
+
+    std::vector<std::uint8_t> buffer(colors.size() * 4);
+    auto view = make_memory_vector_view<rgba_hex>(buffer.data(), buffer.size());
+    res       = io::parse_hex_colors(text, view);
+    EXPECT_TRUE(res);
+    EXPECT_EQ(colors.size(), res.count);
+    EXPECT_EQ(0, std::memcmp(buffer.data(), colors.data(), buffer.size()));
+
+    std::string text2(text.size(), ' ');
+    auto fres = io::format_hex_colors(&text2[0], &text2[0] + text2.size(), view);
+    EXPECT_TRUE(fres);
+    EXPECT_EQ(text, text2);
+    EXPECT_FALSE(io::format_hex_colors(&text2[0], &text2[0] + 10, view));
+}
+
+TEST(Color, HexBulkErrors)
+{
+    std::vector<rgb_hex> colors;
+    auto res = io::parse_hex_colors("#000000, #ffffff #ABCDEF,\n#123456", colors);
+    EXPECT_TRUE(res);
+    EXPECT_EQ(4u, colors.size());
+    EXPECT_EQ(0xabcdef_rgb, colors[2]);
+
+    // Error in the middle of a block
+    std::string text;
+    for (auto i = 0; i < 20; ++i) {
+        text += i == 17 ? "#12x456 " : "#123456 ";
+    }
+    colors.clear();
+    res = io::parse_hex_colors(text, colors);
+    EXPECT_FALSE(res);
+    EXPECT_EQ(17u, res.count);
+    EXPECT_EQ(17u, colors.size());
+    EXPECT_EQ(text.data() + 17 * 8 + 3, res.ptr);
+
+    colors.clear();
+    res = io::parse_hex_colors("#123456 123456", colors);
+    EXPECT_FALSE(res);
+    EXPECT_EQ(1u, res.count);
+    colors.clear();
+    res = io::parse_hex_colors("#123456 #1234", colors);
+    EXPECT_FALSE(res);
+    EXPECT_EQ(1u, res.count);
 }
 
 class HslToRgb : public ::testing::TestWithParam<std::pair<hsla, rgba_hex>> {};
@@ -171,6 +285,369 @@ INSTANTIATE_TEST_CASE_P(Colors, HsvToRgb,
     ), /**/);
 // clang-format on
 
+namespace {
+
+constexpr bool
+near(float expected, float actual)
+{
+    return expected - actual < 1e-5f && actual - expected < 1e-5f;
+}
+
+}    // namespace
+
+TEST(Color, ConstexprConversion)
+{
+    // The hue segment and the hue of a red dominated color take the remainder
+    constexpr rgba pink = convert<rgba>(hsla{(float)330_deg, 1, .5, 1});
+    static_assert(near(1, pink.r()) && near(0, pink.g()) && near(0.5, pink.b()), "");
+    constexpr hsla pink_hsl = convert<hsla>(rgba{1, 0, 0.5, 1});
+    static_assert(near(330_deg, pink_hsl.h()) && near(1, pink_hsl.s()) && near(0.5, pink_hsl.l()),
+                  "");
+    constexpr rgba dark = convert<rgba>(hsva{(float)330_deg, 1, .5, 1});
+    static_assert(near(0.5, dark.r()) && near(0, dark.g()) && near(0.25, dark.b()), "");
+    constexpr hsva dark_hsv = convert<hsva>(rgba{0.5, 0, 0.25, 1});
+    static_assert(near(330_deg, dark_hsv.h()) && near(1, dark_hsv.s()) && near(0.5, dark_hsv.v()),
+                  "");
+
+    EXPECT_EQ(convert<rgba>(hsla{(float)330_deg, 1, .5, 1}), pink);
+    EXPECT_EQ(convert<hsla>(rgba{1, 0, 0.5, 1}), pink_hsl);
+    EXPECT_EQ(convert<rgba>(hsva{(float)330_deg, 1, .5, 1}), dark);
+    EXPECT_EQ(convert<hsva>(rgba{0.5, 0, 0.25, 1}), dark_hsv);
+}
+
+namespace {
+
+float
+hue_distance(float lhs, float rhs)
+{
+    auto d = std::abs(lhs - rhs);
+    return std::min(d, (float)(2 * pi<float>::value) - d);
+}
+
+std::vector<float>
+make_rgba_buffer()
+{
+    std::vector<float> buffer;
+    for (int r = 0; r <= 16; ++r) {
+        for (int g = 0; g <= 16; ++g) {
+            for (int b = 0; b <= 16; ++b) {
+                buffer.insert(buffer.end(), {r / 16.f, g / 16.f, b / 16.f, (r + g + b) / 48.f});
+            }
+        }
+    }
+    return buffer;
+}
+
+}    // namespace
+
+TEST(Color, BatchHsl)
+{
+    auto const         buffer = make_rgba_buffer();
+    std::vector<float> hsl_buffer(buffer.size());
+    std::vector<float> rgb_buffer(buffer.size());
+    auto               src = make_memory_vector_view<rgba>(buffer.data(), buffer.size());
+    auto hsl = make_memory_vector_view<hsla>(hsl_buffer.data(), hsl_buffer.size());
+    auto rgb = make_memory_vector_view<rgba>(rgb_buffer.data(), rgb_buffer.size());
+
+    // Split to chunks that are not multiples of the block size
+    parallel_options opts{3, 7, 0};
+    color::rgb_to_hsl(src, hsl, opts);
+    color::hsl_to_rgb(make_memory_vector_view<hsla>(hsl_buffer.data(), hsl_buffer.size()), rgb,
+                      opts);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        rgba color    = src[i];
+        hsla expected = convert<hsla>(color);
+        hsla actual   = hsl[i];
+        ASSERT_NEAR(0, hue_distance(expected.h(), actual.h()), 1e-4) << color;
+        ASSERT_NEAR(expected.s(), actual.s(), 1e-5) << color;
+        ASSERT_NEAR(expected.l(), actual.l(), 1e-5) << color;
+        ASSERT_EQ(expected.a(), actual.a()) << color;
+
+        rgba back = rgb[i];
+        ASSERT_NEAR(color.r(), back.r(), 1e-5) << color;
+        ASSERT_NEAR(color.g(), back.g(), 1e-5) << color;
+        ASSERT_NEAR(color.b(), back.b(), 1e-5) << color;
+        ASSERT_EQ(color.a(), back.a()) << color;
+    }
+}
+
+TEST(Color, BatchFloor)
+{
+    using color::detail::floor_value;
+    static_assert(floor_value(2.5f) == 2 && floor_value(-2.5f) == -3 && floor_value(-3.f) == -3,
+                  "");
+    // Out of the int range, the values are integral
+    static_assert(floor_value(3e9f) == 3e9f && floor_value(-1e30f) == -1e30f, "");
+    static_assert(floor_value(1e10 + 0.5) == 1e10 && floor_value(-1e300) == -1e300, "");
+    EXPECT_TRUE(std::isnan(floor_value(std::numeric_limits<float>::quiet_NaN())));
+    EXPECT_EQ(std::numeric_limits<float>::infinity(),
+              floor_value(std::numeric_limits<float>::infinity()));
+
+    // Huge hues wrap without an integer overflow
+    std::vector<float> hsl_buffer{3e10f, 1, 0.5f, 1, -1e20f, 1, 0.5f, 1};
+    std::vector<float> rgb_buffer(hsl_buffer.size());
+    color::hsl_to_rgb(make_memory_vector_view<hsla>(hsl_buffer.data(), hsl_buffer.size()),
+                      make_memory_vector_view<rgba>(rgb_buffer.data(), rgb_buffer.size()));
+    for (float v : rgb_buffer) {
+        EXPECT_LE(0, v);
+        EXPECT_GE(1, v);
+    }
+}
+
+TEST(Color, BatchHsv)
+{
+    auto const         buffer = make_rgba_buffer();
+    std::vector<float> hsv_buffer(buffer.size());
+    std::vector<float> rgb_buffer(buffer.size());
+    auto               src = make_memory_vector_view<rgba>(buffer.data(), buffer.size());
+    auto hsv = make_memory_vector_view<hsva>(hsv_buffer.data(), hsv_buffer.size());
+    auto rgb = make_memory_vector_view<rgba>(rgb_buffer.data(), rgb_buffer.size());
+
+    parallel_options opts{3, 7, 0};
+    color::rgb_to_hsv(src, hsv, opts);
+    color::hsv_to_rgb(make_memory_vector_view<hsva>(hsv_buffer.data(), hsv_buffer.size()), rgb,
+                      opts);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        rgba color    = src[i];
+        hsva expected = convert<hsva>(color);
+        hsva actual   = hsv[i];
+        ASSERT_NEAR(0, hue_distance(expected.h(), actual.h()), 1e-4) << color;
+        ASSERT_NEAR(expected.s(), actual.s(), 1e-5) << color;
+        ASSERT_NEAR(expected.v(), actual.v(), 1e-5) << color;
+        ASSERT_EQ(expected.a(), actual.a()) << color;
+
+        rgba back = rgb[i];
+        ASSERT_NEAR(color.r(), back.r(), 1e-5) << color;
+        ASSERT_NEAR(color.g(), back.g(), 1e-5) << color;
+        ASSERT_NEAR(color.b(), back.b(), 1e-5) << color;
+    }
+}
+
+TEST(Color, BatchHex)
+{
+    std::vector<std::uint8_t> buffer;
+    for (int i = 0; i < 4096; ++i) {
+        buffer.insert(buffer.end(), {(std::uint8_t)(i * 37), (std::uint8_t)(i * 101),
+                                     (std::uint8_t)(i * 13), (std::uint8_t)i});
+    }
+    std::vector<float>        hsv_buffer(buffer.size() / 4 * 3);
+    std::vector<std::uint8_t> rgb_buffer(buffer.size() / 4 * 3);
+    auto src = make_memory_vector_view<rgba_hex>(buffer.data(), buffer.size());
+    auto hsv = make_memory_vector_view<color::hsv<float>>(hsv_buffer.data(), hsv_buffer.size());
+    auto rgb = make_memory_vector_view<rgb_hex>(rgb_buffer.data(), rgb_buffer.size());
+
+    color::rgb_to_hsv(src, hsv);
+    color::hsv_to_rgb(make_memory_vector_view<color::hsv<float>>(hsv_buffer.data(),
+                                                                 hsv_buffer.size()),
+                      rgb);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        EXPECT_EQ(buffer[i * 4 + 0], rgb_buffer[i * 3 + 0]) << i;
+        EXPECT_EQ(buffer[i * 4 + 1], rgb_buffer[i * 3 + 1]) << i;
+        EXPECT_EQ(buffer[i * 4 + 2], rgb_buffer[i * 3 + 2]) << i;
+    }
+
+    EXPECT_THROW(color::rgb_to_hsv(src, make_memory_vector_view<color::hsv<float>>(
+                                            hsv_buffer.data(), hsv_buffer.size() - 3)),
+                 std::runtime_error);
+}
+
+TEST(Color, Lab)
+{
+    using laba   = color::laba<float>;
+    using oklaba = color::oklaba<float>;
+    using xyza   = color::xyza<float>;
+
+    auto white = convert<xyza>(rgba{1, 1, 1, 0.5});
+    EXPECT_NEAR(0.95047, white.x(), 1e-4);
+    EXPECT_NEAR(1.0, white.y(), 1e-4);
+    EXPECT_NEAR(1.08883, white.z(), 1e-4);
+    EXPECT_EQ(0.5, white.alpha());
+
+    auto lab_white = convert<laba>(rgba{1, 1, 1, 0.5});
+    EXPECT_NEAR(100, lab_white.lightness(), 1e-3);
+    EXPECT_NEAR(0, lab_white.a(), 1e-3);
+    EXPECT_NEAR(0, lab_white.b(), 1e-3);
+    EXPECT_EQ(0.5, lab_white.alpha());
+
+    auto lab_red = convert<color::lab<float>>(rgba{1, 0, 0, 1});
+    EXPECT_NEAR(53.24, lab_red.l(), 1e-2);
+    EXPECT_NEAR(80.09, lab_red.a(), 1e-2);
+    EXPECT_NEAR(67.20, lab_red.b(), 1e-2);
+
+    auto ok_white = convert<oklaba>(rgba{1, 1, 1, 1});
+    EXPECT_NEAR(1, ok_white.l(), 1e-4);
+    EXPECT_NEAR(0, ok_white.a(), 1e-4);
+    EXPECT_NEAR(0, ok_white.b(), 1e-4);
+    EXPECT_EQ(1, ok_white.alpha());
+
+    auto ok_red = convert<oklaba>(rgba{1, 0, 0, 1});
+    EXPECT_NEAR(0.627955, ok_red.l(), 1e-4);
+    EXPECT_NEAR(0.224863, ok_red.a(), 1e-4);
+    EXPECT_NEAR(0.125846, ok_red.b(), 1e-4);
+
+    for (auto color : {rgba{0, 0, 0, 1}, rgba{0.2, 0.5, 0.9, 0.3}, rgba{0.01, 0.002, 0.5, 1},
+                       rgba{1, 1, 0, 1}}) {
+        rgba from_lab = convert<rgba>(convert<laba>(color));
+        rgba from_ok  = convert<rgba>(convert<oklaba>(color));
+        rgba from_xyz = convert<rgba>(convert<laba>(convert<xyza>(color)));
+        for (std::size_t i = 0; i < 4; ++i) {
+            EXPECT_NEAR(color[i], from_lab[i], 1e-4) << color;
+            EXPECT_NEAR(color[i], from_ok[i], 1e-4) << color;
+            EXPECT_NEAR(color[i], from_xyz[i], 1e-4) << color;
+        }
+    }
+}
+
+TEST(Color, DeltaE)
+{
+    using lab = color::lab<double>;
+    EXPECT_DOUBLE_EQ(5, color::delta_e(lab{50, 3, 4}, lab{50, 0, 0}));
+
+    // Reference pairs from Sharma, Wu, Dalal "The CIEDE2000 Color-Difference Formula"
+    struct reference {
+        lab    lhs;
+        lab    rhs;
+        double delta;
+    };
+    for (auto const& ref : {
+             reference{{50, 2.6772, -79.7751}, {50, 0, -82.7485}, 2.0425},
+             reference{{50, 3.1571, -77.2803}, {50, 0, -82.7485}, 2.8615},
+             reference{{50, 2.49, -0.001}, {50, -2.49, 0.0009}, 7.1792},
+             reference{{50, 2.5, 0}, {50, 3.1736, 0.5854}, 1.0000},
+             reference{{50, 2.5, 0}, {73, 25, -18}, 27.1492},
+             reference{{60.2574, -34.0099, 36.2677}, {60.4626, -34.1751, 39.4387}, 1.2644},
+             reference{{22.7233, 20.0904, -46.6940}, {23.0331, 14.9730, -42.5619}, 2.0373},
+         }) {
+        EXPECT_NEAR(ref.delta, color::delta_e_2000(ref.lhs, ref.rhs), 1e-4) << ref.lhs;
+        EXPECT_NEAR(ref.delta, color::delta_e_2000(ref.rhs, ref.lhs), 1e-4) << ref.lhs;
+    }
+}
+
+TEST(Color, BatchLab)
+{
+    using laba   = color::laba<float>;
+    using oklaba = color::oklaba<float>;
+    using xyz    = color::xyz<float>;
+
+    auto const         buffer = make_rgba_buffer();
+    std::vector<float> lab_buffer(buffer.size());
+    std::vector<float> ok_buffer(buffer.size());
+    std::vector<float> xyz_buffer(buffer.size() / 4 * 3);
+    std::vector<float> rgb_buffer(buffer.size());
+    auto               src = make_memory_vector_view<rgba>(buffer.data(), buffer.size());
+    auto lab = make_memory_vector_view<laba>(lab_buffer.data(), lab_buffer.size());
+    auto ok  = make_memory_vector_view<oklaba>(ok_buffer.data(), ok_buffer.size());
+    auto xyz_view = make_memory_vector_view<xyz>(xyz_buffer.data(), xyz_buffer.size());
+    auto rgb = make_memory_vector_view<rgba>(rgb_buffer.data(), rgb_buffer.size());
+
+    parallel_options opts{3, 7, 0};
+    color::convert_colors(src, lab, opts);
+    color::convert_colors(src, ok, opts);
+    color::convert_colors(src, xyz_view, opts);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        rgba   color       = src[i];
+        laba   expected    = convert<laba>(color);
+        oklaba expected_ok = convert<oklaba>(color);
+        xyz    expected_xyz = convert<xyz>(color);
+        laba   actual      = lab[i];
+        oklaba actual_ok   = ok[i];
+        xyz    actual_xyz  = xyz_view[i];
+        for (std::size_t c = 0; c < 3; ++c) {
+            ASSERT_NEAR(expected[c], actual[c], 1e-3) << color;
+            ASSERT_NEAR(expected_ok[c], actual_ok[c], 1e-5) << color;
+            ASSERT_NEAR(expected_xyz[c], actual_xyz[c], 1e-5) << color;
+        }
+        ASSERT_EQ(expected.alpha(), actual.alpha()) << color;
+        ASSERT_EQ(expected_ok.alpha(), actual_ok.alpha()) << color;
+    }
+
+    color::convert_colors(make_memory_vector_view<laba>(lab_buffer.data(), lab_buffer.size()),
+                          rgb, opts);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        rgba color = src[i];
+        rgba back  = rgb[i];
+        for (std::size_t c = 0; c < 4; ++c) {
+            ASSERT_NEAR(color[c], back[c], 1e-4) << color;
+        }
+    }
+    color::convert_colors(make_memory_vector_view<oklaba>(ok_buffer.data(), ok_buffer.size()), rgb,
+                          opts);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        rgba color = src[i];
+        rgba back  = rgb[i];
+        for (std::size_t c = 0; c < 4; ++c) {
+            ASSERT_NEAR(color[c], back[c], 1e-4) << color;
+        }
+    }
+}
+
+TEST(Color, BatchDeltaE)
+{
+    using oklaba = color::oklaba<float>;
+    using oklab  = color::oklab<float>;
+
+    auto const         buffer = make_rgba_buffer();
+    std::vector<float> ok_buffer(buffer.size());
+    color::convert_colors(make_memory_vector_view<rgba>(buffer.data(), buffer.size()),
+                          make_memory_vector_view<oklaba>(ok_buffer.data(), ok_buffer.size()));
+    float const* ok_data = ok_buffer.data();
+    auto         colors  = make_memory_vector_view<oklaba>(ok_data, ok_buffer.size());
+
+    std::vector<float> palette_buffer;
+    for (auto c : {rgba{0, 0, 0, 1}, rgba{1, 1, 1, 1}, rgba{1, 0, 0, 1}, rgba{0, 1, 0, 1},
+                   rgba{0, 0, 1, 1}, rgba{0.5, 0.5, 0.5, 1}, rgba{1, 1, 0, 1}, rgba{0, 1, 1, 1},
+                   rgba{1, 0, 1, 1}}) {
+        oklab ok = convert<oklab>(c);
+        palette_buffer.insert(palette_buffer.end(), {ok.l(), ok.a(), ok.b()});
+    }
+    float const* palette_data = palette_buffer.data();
+    auto palette = make_memory_vector_view<oklab>(palette_data, palette_buffer.size());
+
+    parallel_options           opts{3, 5, 0};
+    std::vector<std::uint32_t> indexes(colors.size());
+    color::nearest_colors(colors, palette, indexes.data(), opts);
+    for (std::size_t i = 0; i < colors.size(); ++i) {
+        oklaba      color     = colors[i];
+        float       best      = std::numeric_limits<float>::max();
+        std::size_t best_index = 0;
+        for (std::size_t p = 0; p < palette.size(); ++p) {
+            oklab entry = palette[p];
+            float d     = color::delta_e(oklab{color.l(), color.a(), color.b()}, entry);
+            if (d < best) {
+                best       = d;
+                best_index = p;
+            }
+        }
+        ASSERT_EQ(best_index, indexes[i]) << color;
+    }
+
+    std::vector<float> deltas(colors.size());
+    auto shifted = make_memory_vector_view<oklaba>(ok_data + 4, ok_buffer.size() - 4);
+    color::delta_e(make_memory_vector_view<oklaba>(ok_data, ok_buffer.size() - 4), shifted,
+                   deltas.data(), opts);
+    for (std::size_t i = 0; i < shifted.size(); ++i) {
+        oklaba lhs = colors[i];
+        oklaba rhs = shifted[i];
+        ASSERT_NEAR(color::delta_e(lhs, rhs), deltas[i], 1e-6) << lhs;
+    }
+    // Views of mutable buffers, alone or mixed with const ones
+    std::vector<std::uint32_t> mutable_indexes(colors.size());
+    color::nearest_colors(
+        make_memory_vector_view<oklaba>(ok_buffer.data(), ok_buffer.size()),
+        make_memory_vector_view<oklab>(palette_buffer.data(), palette_buffer.size()),
+        mutable_indexes.data(), opts);
+    EXPECT_EQ(indexes, mutable_indexes);
+    std::vector<float> mutable_deltas(colors.size());
+    color::delta_e(make_memory_vector_view<oklaba>(ok_buffer.data(), ok_buffer.size() - 4),
+                   shifted, mutable_deltas.data(), opts);
+    EXPECT_EQ(deltas, mutable_deltas);
+
+    EXPECT_THROW(color::delta_e(colors, shifted, deltas.data()), std::runtime_error);
+    EXPECT_THROW(color::nearest_colors(colors, make_memory_vector_view<oklab>(palette_data, 0),
+                                       indexes.data()),
+                 std::runtime_error);
+}
+
 } /* namespace test */
 } /* namespace math */
 } /* namespace psst */
@@ -0,0 +1,178 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * constexpr_math_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/constexpr_math.hpp>
+#include <psst/math/coordinate_conversion.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using vector2d    = vector<double, 2>;
+using vector3d    = vector<double, 3>;
+using polar_d     = polar_coord<double>;
+using spherical_d = spherical_coord<double>;
+
+namespace {
+
+constexpr std::size_t circle_points = 16;
+constexpr std::size_t sample_count  = 801;
+
+/** Points of a circle, computed by the compiler */
+constexpr std::array<vector2d, circle_points>
+make_circle()
+{
+    std::array<vector2d, circle_points> res{};
+    for (std::size_t i = 0; i < circle_points; ++i) {
+        res[i] = convert<vector2d>(polar_d{2, tau_v<double> * i / circle_points});
+    }
+    return res;
+}
+
+constexpr auto circle = make_circle();
+
+constexpr double
+sample_x(std::size_t i)
+{
+    return (static_cast<double>(i) - sample_count / 2) * 0.0873;
+}
+
+constexpr double
+sample_y(std::size_t i)
+{
+    return static_cast<double>(i % 17) - 8;
+}
+
+constexpr double
+sample_unit(std::size_t i)
+{
+    // Division by a power of two is exact both at compile time and with -ffast-math
+    return (static_cast<double>(i) - sample_count / 2) / 512;
+}
+
+/** Values of the functions at the sample points, computed by the compiler */
+struct function_table {
+    std::array<double, sample_count> sin{}, cos{}, tan{}, atan{}, atan2{}, sqrt{}, asin{}, acos{};
+    std::array<float, sample_count> sin_f{};
+};
+
+constexpr function_table
+make_table()
+{
+    function_table res{};
+    for (std::size_t i = 0; i < sample_count; ++i) {
+        double const x = sample_x(i);
+        res.sin[i]     = cx::sin(x);
+        res.cos[i]     = cx::cos(x);
+        res.tan[i]     = cx::tan(x);
+        res.atan[i]    = cx::atan(x);
+        res.atan2[i]   = cx::atan2(sample_y(i), x);
+        res.sqrt[i]    = cx::sqrt(x * x);
+        res.asin[i]    = cx::asin(sample_unit(i));
+        res.acos[i]    = cx::acos(sample_unit(i));
+        res.sin_f[i]   = cx::sin(static_cast<float>(x));
+    }
+    return res;
+}
+
+constexpr auto table = make_table();
+
+/** Difference in units of the last place of the expected value */
+template <typename T>
+T
+ulps(T expected, T actual)
+{
+    T const ulp = std::abs(expected) * std::numeric_limits<T>::epsilon();
+    return std::abs(expected - actual) / std::max(ulp, std::numeric_limits<T>::min());
+}
+
+}    // namespace
+
+TEST(ConstexprMath, Functions)
+{
+    static_assert(cx::sqrt(16.0) == 4, "");
+    static_assert(cx::sin(0.0) == 0, "");
+    static_assert(cx::cos(0.0) == 1, "");
+    static_assert(cx::atan2(1.0, 1.0) == pi_v<double> / 4, "");
+    static_assert(cx::atan2(0.0, -1.0) == pi_v<double>, "");
+    static_assert(cx::asin(1.0) == half_pi_v<double>, "");
+    // Multiples of π/2 keep the bits lost by rounding π
+    static_assert(cx::sin(pi_v<double>) > 1.2246467991473e-16, "");
+    static_assert(cx::sin(pi_v<double>) < 1.2246467991474e-16, "");
+
+    // Rounding to double can take the long double value to the other side of a halfway point
+    constexpr double max_ulps = 2;
+    for (std::size_t i = 0; i < sample_count; ++i) {
+        double const x = sample_x(i);
+        double const y = sample_y(i);
+        double const u = sample_unit(i);
+        EXPECT_GE(max_ulps, ulps(std::sin(x), table.sin[i])) << x;
+        EXPECT_GE(max_ulps, ulps(std::cos(x), table.cos[i])) << x;
+        EXPECT_GE(max_ulps, ulps(std::tan(x), table.tan[i])) << x;
+        EXPECT_GE(max_ulps, ulps(std::atan(x), table.atan[i])) << x;
+        EXPECT_GE(max_ulps, ulps(std::atan2(y, x), table.atan2[i])) << y << " " << x;
+        EXPECT_GE(max_ulps, ulps(std::sqrt(x * x), table.sqrt[i])) << x;
+        EXPECT_GE(max_ulps, ulps(std::asin(u), table.asin[i])) << u;
+        EXPECT_GE(max_ulps, ulps(std::acos(u), table.acos[i])) << u;
+        EXPECT_GE(1, ulps(std::sin(static_cast<float>(x)), table.sin_f[i])) << x;
+    }
+}
+
+TEST(ConstexprMath, Angles)
+{
+    constexpr double two_pi = tau_v<double>;
+    static_assert(zero_to_two_pi(7.0) == 7.0 - two_pi, "");
+    static_assert(zero_to_two_pi(-1.0) == two_pi - 1.0, "");
+    static_assert(zero_to_two_pi(-1.0f) == tau_v<float> - 1.0f, "");
+    static_assert(minus_plus_pi(4.0) == 4.0 - two_pi, "");
+    static_assert(minus_plus_pi(-4.0) == two_pi - 4.0, "");
+    constexpr polar_d polar{1.0, 7.0};
+    static_assert(polar.phi() == 7.0 - two_pi, "");
+
+    // The moderate turns take the two part 2π, the huge ones the exact remainder
+    constexpr double angles[]{-7.0, -100.0, 2.5e9, 1e15, -1e15, 1e300};
+    constexpr double zero_to_two_pi_values[]{
+        zero_to_two_pi(angles[0]), zero_to_two_pi(angles[1]), zero_to_two_pi(angles[2]),
+        zero_to_two_pi(angles[3]), zero_to_two_pi(angles[4]), zero_to_two_pi(angles[5])};
+    constexpr double minus_plus_pi_values[]{
+        minus_plus_pi(angles[0]), minus_plus_pi(angles[1]), minus_plus_pi(angles[2]),
+        minus_plus_pi(angles[3]), minus_plus_pi(angles[4]), minus_plus_pi(angles[5])};
+    for (std::size_t i = 0; i < std::size(angles); ++i) {
+        EXPECT_EQ(zero_to_two_pi(angles[i]), zero_to_two_pi_values[i]) << angles[i];
+        EXPECT_EQ(minus_plus_pi(angles[i]), minus_plus_pi_values[i]) << angles[i];
+    }
+}
+
+TEST(ConstexprMath, Conversions)
+{
+    constexpr auto spherical = convert<spherical_d>(vector3d{1, 1, 1});
+    constexpr auto cartesian = convert<vector3d>(spherical_d{3, 30_deg, 45_deg});
+    static_assert(spherical.rho() * spherical.rho() - 3 < 1e-15, "");
+    static_assert(cartesian.z() - 1.5 < 1e-15, "");
+
+    EXPECT_EQ(convert<spherical_d>(vector3d{1, 1, 1}), spherical);
+    EXPECT_EQ(convert<vector3d>(spherical_d{3, 30_deg, 45_deg}), cartesian);
+    for (std::size_t i = 0; i < circle_points; ++i) {
+        vector2d const expected = convert<vector2d>(polar_d{2, tau_v<double> * i / circle_points});
+        EXPECT_NEAR(expected.x(), circle[i].x(), 1e-15) << i;
+        EXPECT_NEAR(expected.y(), circle[i].y(), 1e-15) << i;
+    }
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
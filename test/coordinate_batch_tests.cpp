@@ -0,0 +1,275 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * coordinate_batch_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/angles.hpp>
+#include <psst/math/coordinate_batch.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using vector2f    = vector<float, 2>;
+using vector3f    = vector<float, 3>;
+using vector4f    = vector<float, 4>;
+using vector3d    = vector<double, 3>;
+using polar_f     = polar_coord<float>;
+using spherical_f = spherical_coord<float>;
+using spherical_d = spherical_coord<double>;
+using cylinder_f  = cylindrical_coord<float>;
+
+namespace {
+
+constexpr std::size_t coord_count = 1001;
+parallel_options const threads{3, 1, 100};
+
+trig_accuracy const accuracies[]{trig_accuracy::standard, trig_accuracy::precise,
+                                 trig_accuracy::fast};
+
+/** Error bounds of trig_accuracy values for float, with a margin for the rounding of products */
+float
+tolerance(trig_accuracy accuracy)
+{
+    switch (accuracy) {
+    case trig_accuracy::precise:
+        return 6e-7f;
+    case trig_accuracy::fast:
+        return 1.2e-4f;
+    default:
+        // One ulp of angles close to 2π
+        return 5e-7f;
+    }
+}
+
+/** Inclination in double precision, asin of the scalar conversion loses bits near the poles */
+double
+precise_inclination(vector3f const& p)
+{
+    return std::atan2(double(p.z()), std::hypot(double(p.x()), double(p.y())));
+}
+
+/** Difference of two angles, wrapped to [-π, π] */
+double
+angle_difference(double a, double b)
+{
+    return minus_plus_pi(a - b);
+}
+
+std::vector<vector3f>
+make_points()
+{
+    std::vector<vector3f> points;
+    for (std::size_t i = 0; i < coord_count; ++i) {
+        float t = static_cast<float>(i);
+        points.push_back(vector3f{std::sin(t * 0.37f) * (1 + i % 7), std::cos(t * 1.13f) * 3,
+                                  std::sin(t * 0.71f + 1) * (i % 5)});
+    }
+    points.push_back(vector3f{0, 0, 0});
+    points.push_back(vector3f{-1, 0, 0});
+    points.push_back(vector3f{0, -2, 0});
+    points.push_back(vector3f{0, 0, -3});
+    return points;
+}
+
+std::vector<spherical_f>
+make_spherical()
+{
+    std::vector<spherical_f> coords;
+    for (std::size_t i = 0; i < coord_count; ++i) {
+        float t = static_cast<float>(i) / coord_count;
+        coords.push_back(spherical_f{1 + t * 10, (t - 0.5f) * pi<float>::value,
+                                     std::fmod(t * 37, 2 * pi<float>::value)});
+    }
+    return coords;
+}
+
+}    // namespace
+
+TEST(CoordinateBatch, SphericalToCartesian)
+{
+    auto const src = make_spherical();
+    for (auto accuracy : accuracies) {
+        std::vector<vector3f> dst(src.size());
+        convert_coordinates(src.data(), src.size(), dst.data(), accuracy, threads);
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            vector3f expected = convert<vector3f>(src[i]);
+            float    tol      = tolerance(accuracy) * src[i].rho();
+            EXPECT_NEAR(expected.x(), dst[i].x(), tol) << i << " " << src[i];
+            EXPECT_NEAR(expected.y(), dst[i].y(), tol) << i << " " << src[i];
+            EXPECT_NEAR(expected.z(), dst[i].z(), tol) << i << " " << src[i];
+        }
+    }
+}
+
+TEST(CoordinateBatch, CartesianToSpherical)
+{
+    auto const src = make_points();
+    for (auto accuracy : accuracies) {
+        std::vector<spherical_f> dst(src.size());
+        convert_coordinates(src.data(), src.size(), dst.data(), accuracy, threads);
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            spherical_f expected = convert<spherical_f>(src[i]);
+            float       tol      = tolerance(accuracy);
+            EXPECT_NEAR(expected.rho(), dst[i].rho(), 4e-7f * expected.rho()) << src[i];
+            EXPECT_NEAR(precise_inclination(src[i]), dst[i].inclination(), tol) << src[i];
+            EXPECT_NEAR(0, angle_difference(expected.azimuth(), dst[i].azimuth()), tol)
+                << src[i];
+            EXPECT_LE(0, dst[i].azimuth());
+            EXPECT_GT(2 * pi<float>::value, dst[i].azimuth());
+        }
+    }
+}
+
+TEST(CoordinateBatch, PolarAndCylindrical)
+{
+    auto const points = make_points();
+    for (auto accuracy : accuracies) {
+        std::vector<cylinder_f> cylinder(points.size());
+        std::vector<vector3f>   back(points.size());
+        convert_coordinates(points.data(), points.size(), cylinder.data(), accuracy, threads);
+        convert_coordinates(cylinder.data(), cylinder.size(), back.data(), accuracy, threads);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            cylinder_f expected = convert<cylinder_f>(points[i]);
+            float      tol      = tolerance(accuracy);
+            EXPECT_NEAR(expected.rho(), cylinder[i].rho(), 4e-7f * expected.rho());
+            EXPECT_NEAR(0, angle_difference(expected.azimuth(), cylinder[i].azimuth()), tol);
+            EXPECT_EQ(points[i].z(), cylinder[i].z());
+            EXPECT_NEAR(points[i].x(), back[i].x(), 2 * tol * expected.rho()) << points[i];
+            EXPECT_NEAR(points[i].y(), back[i].y(), 2 * tol * expected.rho()) << points[i];
+            EXPECT_EQ(points[i].z(), back[i].z());
+        }
+
+        // Buffers of scalars with two and four Cartesian components
+        std::vector<float> plane(points.size() * 2);
+        std::vector<float> polar_buffer(points.size() * 2);
+        std::vector<float> homogeneous(points.size() * 4, 1.0f);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            plane[i * 2]     = points[i].x();
+            plane[i * 2 + 1] = points[i].y();
+        }
+        auto polar_view
+            = make_memory_vector_view<polar_f>(polar_buffer.data(), polar_buffer.size());
+        auto homogeneous_view
+            = make_memory_vector_view<vector4f>(homogeneous.data(), homogeneous.size());
+        convert_coordinates(make_memory_vector_view<vector2f>(plane.data(), plane.size()),
+                            polar_view, accuracy);
+        convert_coordinates(polar_view, homogeneous_view, accuracy);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            EXPECT_EQ(cylinder[i].rho(), polar_buffer[i * 2]);
+            EXPECT_EQ(cylinder[i].azimuth(), polar_buffer[i * 2 + 1]);
+            EXPECT_EQ(back[i].x(), homogeneous[i * 4]);
+            EXPECT_EQ(back[i].y(), homogeneous[i * 4 + 1]);
+            EXPECT_EQ(0, homogeneous[i * 4 + 2]);
+            EXPECT_EQ(0, homogeneous[i * 4 + 3]);
+        }
+    }
+}
+
+TEST(CoordinateBatch, Double)
+{
+    std::vector<vector3d> points;
+    for (auto const& p : make_points()) {
+        points.push_back(vector3d{p.x(), p.y(), p.z()});
+    }
+    std::vector<spherical_d> coords(points.size());
+    std::vector<vector3d>    back(points.size());
+    convert_coordinates(points.data(), points.size(), coords.data(), trig_accuracy::standard);
+    convert_coordinates(coords.data(), coords.size(), back.data(), trig_accuracy::standard);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        spherical_d expected = convert<spherical_d>(points[i]);
+        EXPECT_NEAR(expected.rho(), coords[i].rho(), 1e-12);
+        EXPECT_NEAR(expected.inclination(), coords[i].inclination(), 1e-12);
+        EXPECT_NEAR(0, angle_difference(expected.azimuth(), coords[i].azimuth()), 1e-12);
+        EXPECT_NEAR(points[i].x(), back[i].x(), 1e-12);
+        EXPECT_NEAR(points[i].y(), back[i].y(), 1e-12);
+        EXPECT_NEAR(points[i].z(), back[i].z(), 1e-12);
+    }
+
+    // The polynomials of vmath have double precision for double values
+    std::vector<vector3d> precise(points.size());
+    convert_coordinates(coords.data(), coords.size(), precise.data(), trig_accuracy::precise);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        EXPECT_NEAR(back[i].x(), precise[i].x(), 1e-15 * coords[i].rho());
+        EXPECT_NEAR(back[i].y(), precise[i].y(), 1e-15 * coords[i].rho());
+        EXPECT_NEAR(back[i].z(), precise[i].z(), 1e-15 * coords[i].rho());
+    }
+}
+
+TEST(CoordinateBatch, OutOfRangeAngles)
+{
+    // Angles that the vmath kernels do not reduce are computed by the standard functions
+    float const inf = std::numeric_limits<float>::infinity();
+    float const nan = std::numeric_limits<float>::quiet_NaN();
+    float const angles[]{1e7f, 3e6f, -2e9f, inf, -inf, nan};
+    for (auto accuracy : {trig_accuracy::standard, trig_accuracy::precise}) {
+        std::vector<float> polar_buffer;
+        for (auto angle : angles) {
+            polar_buffer.insert(polar_buffer.end(), {1, angle});
+        }
+        std::vector<float> plane(polar_buffer.size());
+        convert_coordinates(
+            make_memory_vector_view<polar_f>(polar_buffer.data(), polar_buffer.size()),
+            make_memory_vector_view<vector2f>(plane.data(), plane.size()), accuracy);
+        for (std::size_t i = 0; i < std::size(angles); ++i) {
+            float const x = std::cos(angles[i]);
+            float const y = std::sin(angles[i]);
+            if (std::isfinite(angles[i])) {
+                EXPECT_NEAR(x, plane[i * 2], 1e-6f) << angles[i];
+                EXPECT_NEAR(y, plane[i * 2 + 1], 1e-6f) << angles[i];
+            } else {
+                EXPECT_TRUE(std::isnan(plane[i * 2])) << angles[i];
+                EXPECT_TRUE(std::isnan(plane[i * 2 + 1])) << angles[i];
+            }
+        }
+
+        // Both the inclination and the azimuth of spherical coordinates
+        std::vector<float> spherical_buffer;
+        for (auto angle : angles) {
+            spherical_buffer.insert(spherical_buffer.end(), {2, angle, 0.5f});
+            spherical_buffer.insert(spherical_buffer.end(), {2, 0.5f, angle});
+        }
+        std::vector<vector3f> points(spherical_buffer.size() / 3);
+        convert_coordinates(
+            make_memory_vector_view<spherical_f>(spherical_buffer.data(), spherical_buffer.size()),
+            make_memory_vector_view<vector3f>(points.data()->data(), points.size() * 3), accuracy);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            float const rho         = spherical_buffer[i * 3];
+            float const inclination = spherical_buffer[i * 3 + 1];
+            float const azimuth     = spherical_buffer[i * 3 + 2];
+            vector3f    expected{rho * std::cos(inclination) * std::cos(azimuth),
+                              rho * std::cos(inclination) * std::sin(azimuth),
+                              rho * std::sin(inclination)};
+            for (std::size_t c = 0; c < 3; ++c) {
+                if (std::isnan(expected[c])) {
+                    EXPECT_TRUE(std::isnan(points[i][c])) << i << " " << c;
+                } else {
+                    EXPECT_NEAR(expected[c], points[i][c], 4e-6f) << i << " " << c;
+                }
+            }
+        }
+    }
+}
+
+TEST(CoordinateBatch, SizeMismatch)
+{
+    std::vector<float> src(30), dst(27);
+    EXPECT_THROW(convert_coordinates(make_memory_vector_view<spherical_f>(src.data(), src.size()),
+                                     make_memory_vector_view<vector3f>(dst.data(), dst.size())),
+                 std::runtime_error);
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
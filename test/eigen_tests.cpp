@@ -0,0 +1,232 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * eigen_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/eigen.hpp>
+#include <psst/math/structured_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+namespace {
+
+/** Rotation about a unit axis */
+template <typename T>
+matrix<T, 3, 3>
+make_rotation(T x, T y, T z, T angle)
+{
+    T const c = std::cos(angle);
+    T const s = std::sin(angle);
+    T const t = 1 - c;
+    return {{t * x * x + c, t * x * y - s * z, t * x * z + s * y},
+            {t * x * y + s * z, t * y * y + c, t * y * z - s * x},
+            {t * x * z - s * y, t * y * z + s * x, t * z * z + c}};
+}
+
+template <typename T>
+matrix<T, 3, 3>
+make_symmetric(matrix<T, 3, 3> const& rotation, vector<T, 3> const& values)
+{
+    matrix<T, 3, 3> res;
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            for (std::size_t k = 0; k < 3; ++k) {
+                res[r][c] += rotation[r][k] * values[k] * rotation[c][k];
+            }
+        }
+    }
+    return res;
+}
+
+/** a * v = v * diag(values), v is a rotation */
+template <typename T>
+void
+check_decomposition(matrix<T, 3, 3> const& a, eigen_decomposition<T, 3> const& e, T eps)
+{
+    T norm = 0;
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            norm = std::max(norm, std::abs(a[r][c]));
+        }
+    }
+    EXPECT_LE(e.values[0], e.values[1]);
+    EXPECT_LE(e.values[1], e.values[2]);
+    auto const& v = e.vectors;
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            T av = 0;
+            T vv = 0;
+            for (std::size_t k = 0; k < 3; ++k) {
+                av += a[r][k] * v[k][c];
+                vv += v[k][r] * v[k][c];
+            }
+            EXPECT_NEAR(v[r][c] * e.values[c], av, eps * (norm + 1)) << r << ", " << c;
+            EXPECT_NEAR(r == c ? 1 : 0, vv, eps) << r << ", " << c;
+        }
+    }
+    EXPECT_NEAR(1, det(v), eps);
+}
+
+}    // namespace
+
+TEST(Eigen, Symmetric)
+{
+    auto const rotation = make_rotation(0.48, 0.6, 0.64, 0.7);
+    for (auto const& values : {vector<double, 3>{-2, 1, 5}, vector<double, 3>{1, 1, 4},
+                               vector<double, 3>{-3, 2, 2}, vector<double, 3>{7, 7, 7},
+                               vector<double, 3>{0, 0, 1e-3}, vector<double, 3>{1e-9, 1, 1e9},
+                               vector<double, 3>{0, 0, 0}, vector<double, 3>{1, 1 + 1e-7, 2}}) {
+        auto const a = make_symmetric(rotation, values);
+        auto const e = eigen_symmetric(a);
+        check_decomposition(a, e, 1e-12);
+        for (std::size_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(values[i], e.values[i], 1e-12 * (1 + std::abs(values[2]))) << values;
+        }
+    }
+
+    // Diagonal matrices, the eigenvectors are the axes
+    auto const e = eigen_symmetric(matrix<float, 3, 3>{{3, 0, 0}, {0, -1, 0}, {0, 0, 2}});
+    vector<float, 3> const    values{-1, 2, 3};
+    matrix<float, 3, 3> const axes{{0, 0, 1}, {1, 0, 0}, {0, 1, 0}};
+    for (std::size_t r = 0; r < 3; ++r) {
+        EXPECT_FLOAT_EQ(values[r], e.values[r]);
+        for (std::size_t c = 0; c < 3; ++c) {
+            EXPECT_NEAR(axes[r][c], std::abs(e.vectors[r][c]), 1e-7) << r << ", " << c;
+        }
+    }
+
+    // The lower triangle of a structured symmetric matrix
+    symmetric_matrix<float, 3> const s{2, -1, 2, 0, -1, 2};
+    auto const                       se = eigen_symmetric(s);
+    EXPECT_NEAR(2 - std::sqrt(2.f), se.values[0], 1e-6);
+    EXPECT_NEAR(2, se.values[1], 1e-6);
+    EXPECT_NEAR(2 + std::sqrt(2.f), se.values[2], 1e-6);
+    check_decomposition(matrix<float, 3, 3>{s}, se, 1e-6f);
+}
+
+TEST(Eigen, Subnormal)
+{
+    // The reciprocal of the largest element would overflow
+    matrix<float, 3, 3> const tiny{{1e-40f, 0, 0}, {0, 3e-40f, 0}, {0, 0, 2e-40f}};
+    vector<float, 3> const    values{1e-40f, 2e-40f, 3e-40f};
+    auto const                e = eigen_symmetric(tiny);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(values[i], e.values[i], 1e-44f) << i;
+    }
+    auto const rotation = make_rotation(0.48, 0.6, 0.64, 0.7);
+    auto const a        = make_symmetric(rotation, vector<double, 3>{-2e-310, 1e-310, 5e-310});
+    auto const d        = eigen_symmetric(a);
+    EXPECT_NEAR(-2e-310, d.values[0], 1e-320);
+    EXPECT_NEAR(1e-310, d.values[1], 1e-320);
+    EXPECT_NEAR(5e-310, d.values[2], 1e-320);
+}
+
+TEST(Eigen, Covariance)
+{
+    // Points on a plane, the normal is the eigenvector of the smallest eigenvalue
+    vector<float, 3> const normal{0.48f, 0.6f, 0.64f};
+    vector<float, 3> const tangent{0.6f / std::sqrt(0.5904f), -0.48f / std::sqrt(0.5904f), 0};
+    vector<float, 3> const bitangent = normal * tangent;    // cross product
+    matrix<float, 3, 3>    cov;
+    for (int i = 0; i < 50; ++i) {
+        auto const x = std::sin(i * 1.3f) * 10;
+        auto const y = std::cos(i * 0.7f) * 3;
+        vector<float, 3> const p = tangent * x + bitangent * y + normal * 100.f;
+        vector<float, 3> const d = p - normal * 100.f;
+        for (std::size_t r = 0; r < 3; ++r) {
+            for (std::size_t c = 0; c < 3; ++c) {
+                cov[r][c] += d[r] * d[c];
+            }
+        }
+    }
+    auto const e = eigen_symmetric(cov);
+    check_decomposition(cov, e, 1e-5f);
+    EXPECT_NEAR(0, e.values[0], 1e-5 * e.values[2]);
+    vector<float, 3> const n{e.vectors[0][0], e.vectors[1][0], e.vectors[2][0]};
+    EXPECT_NEAR(1, std::abs(dot_product(n, normal)), 1e-6);
+}
+
+TEST(Eigen, Batch)
+{
+    // 37 matrices, a tail that does not fill a pack
+    std::size_t const   count = 37;
+    std::vector<double> elements[6];
+    std::vector<double> values[3];
+    std::vector<double> vectors[9];
+    std::vector<matrix<double, 3, 3>> matrices;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const a = make_symmetric(make_rotation(0.6, 0.0, 0.8, i * 0.3),
+                                      vector<double, 3>{i * 0.5, i % 3 * 1.0, 2.0 - i});
+        matrices.push_back(a);
+        double const packed[6] = {a[0][0], a[1][0], a[1][1], a[2][0], a[2][1], a[2][2]};
+        for (std::size_t k = 0; k < 6; ++k) {
+            elements[k].push_back(packed[k]);
+        }
+    }
+    for (auto& v : values) {
+        v.resize(count);
+    }
+    for (auto& v : vectors) {
+        v.resize(count);
+    }
+    std::array<double const*, 6> in;
+    std::array<double*, 3>       out_values;
+    std::array<double*, 9>       out_vectors;
+    for (std::size_t k = 0; k < 6; ++k) {
+        in[k] = elements[k].data();
+    }
+    for (std::size_t k = 0; k < 3; ++k) {
+        out_values[k] = values[k].data();
+    }
+    for (std::size_t k = 0; k < 9; ++k) {
+        out_vectors[k] = vectors[k].data();
+    }
+
+    eigen_symmetric(in, out_values, out_vectors, count, parallel_options{3, 1, 1});
+    for (std::size_t i = 0; i < count; ++i) {
+        eigen_decomposition<double, 3> e;
+        for (std::size_t k = 0; k < 3; ++k) {
+            e.values[k] = values[k][i];
+        }
+        for (std::size_t k = 0; k < 9; ++k) {
+            e.vectors[k / 3][k % 3] = vectors[k][i];
+        }
+        check_decomposition(matrices[i], e, 1e-12);
+    }
+
+    // The same results in one thread
+    auto const first = vectors[4];
+    eigen_symmetric(in, out_values, out_vectors, count, parallel_options::single_thread());
+    EXPECT_EQ(first, vectors[4]);
+
+    // Packs of matrices decomposed by the generic function
+    using double4 = simd<double, 4>;
+    matrix<double4, 3, 3> packs;
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            for (std::size_t i = 0; i < 4; ++i) {
+                packs[r][c][i] = matrices[i][r][c];
+            }
+        }
+    }
+    auto const e = eigen_symmetric(packs);
+    for (std::size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(values[0][i], e.values[0][i]) << i;
+        EXPECT_EQ(vectors[1][i], e.vectors[0][1][i]) << i;
+    }
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
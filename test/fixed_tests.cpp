@@ -0,0 +1,236 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * fixed_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/fixed.hpp>
+#include <psst/math/matrix.hpp>
+#include <psst/math/vector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using fixed16 = fixed<16, 16>;
+using fixed8  = fixed<8, 24>;
+using q15     = fixed<1, 15>;
+using vector3 = vector<fixed16, 3>;
+
+static_assert(sizeof(fixed16) == 4 && sizeof(q15) == 2, "Fixed point values are integers");
+static_assert(sizeof(vector3) == 3 * sizeof(fixed16), "");
+static_assert(traits::is_scalar_v<fixed16>, "fixed is a scalar");
+static_assert(std::is_same<traits::scalar_value_traits<fixed16>::magnitude_type,
+                           fixed_accumulator<16>>{},
+              "Magnitudes of fixed point vectors are accumulated wide");
+static_assert(detail::has_own_rsqrt_v<fixed16> && !detail::has_own_rsqrt_v<float>,
+              "The math policies take the rsqrt of fixed");
+
+namespace {
+
+template <typename Fixed>
+double
+ulp()
+{
+    return static_cast<double>(Fixed::epsilon());
+}
+
+}    // namespace
+
+TEST(Fixed, Conversion)
+{
+    EXPECT_EQ(0x10000, fixed16{1}.raw());
+    EXPECT_EQ(-0x18000, fixed16{-1.5}.raw());
+    EXPECT_EQ(2.25, static_cast<double>(fixed16{2.25f}));
+    EXPECT_EQ(-2, static_cast<int>(fixed16{-2.75}));
+    // Rounded to nearest
+    EXPECT_EQ(1, fixed16{0.6 / 65536}.raw());
+    EXPECT_EQ(-1, fixed16{-0.6 / 65536}.raw());
+    EXPECT_EQ(0, fixed16{0.4 / 65536}.raw());
+    EXPECT_EQ(0x4000, q15{0.5}.raw());
+    EXPECT_EQ(fixed16{1.5}, fixed16{fixed8{1.5}});
+    EXPECT_EQ(fixed8{-0.25}, fixed8{fixed16{-0.25}});
+    EXPECT_EQ(32767.0 + 65535.0 / 65536, static_cast<double>(fixed16::max()));
+    EXPECT_EQ(-32768, static_cast<double>(fixed16::lowest()));
+}
+
+TEST(Fixed, Arithmetic)
+{
+    fixed16 const a{2.5};
+    fixed16 const b{-0.75};
+    EXPECT_EQ(fixed16{1.75}, a + b);
+    EXPECT_EQ(fixed16{3.25}, a - b);
+    EXPECT_EQ(fixed16{-1.875}, a * b);
+    EXPECT_EQ(fixed16{5}, a * 2);
+    EXPECT_EQ(fixed16{1.25}, a / 2);
+    EXPECT_EQ(fixed16{0.75}, -b);
+    EXPECT_EQ(fixed16{0.75}, abs(b));
+    EXPECT_TRUE(b < a && a > 0 && b <= -0.75 && a >= 2.5 && a != b);
+
+    // Products are rounded half up, quotients half away from zero
+    EXPECT_EQ(2, (fixed16::from_raw(3) * fixed16{0.5}).raw());
+    EXPECT_EQ(-1, (fixed16::from_raw(-3) * fixed16{0.5}).raw());
+    EXPECT_EQ(-2, (fixed16::from_raw(-3) / fixed16{2}).raw());
+    EXPECT_EQ(0x5555, (fixed16{1} / 3).raw());
+    EXPECT_EQ(0xaaab, (fixed16{2} / 3).raw());
+    EXPECT_EQ(-0xaaab, (fixed16{-2} / 3).raw());
+
+    fixed16 c{1};
+    c += 2;
+    c *= 1.5;
+    c -= 0.5;
+    c /= 4;
+    EXPECT_EQ(fixed16{1}, c);
+
+    // Division by zero saturates, sums wrap around
+    EXPECT_EQ(fixed16::max(), fixed16{3} / 0);
+    EXPECT_EQ(fixed16::lowest(), fixed16{-3} / 0);
+    EXPECT_EQ(fixed16{}, fixed16{} / 0);
+    EXPECT_EQ(fixed16::lowest(), fixed16::max() + fixed16::epsilon());
+}
+
+TEST(Fixed, SquareRoot)
+{
+    for (std::int32_t raw = 1; raw < 0x7fffffff - 9973; raw += 9973) {
+        auto const   v        = fixed16::from_raw(raw);
+        double const expected = std::sqrt(static_cast<double>(v));
+        EXPECT_NEAR(expected, static_cast<double>(sqrt(v)), ulp<fixed16>() / 2) << raw;
+        if (raw > 0x100) {
+            EXPECT_NEAR(1 / expected, static_cast<double>(rsqrt(v)), ulp<fixed16>() * 0.51)
+                << raw;
+        }
+    }
+    EXPECT_EQ(fixed16{3}, sqrt(fixed16{9}));
+    EXPECT_EQ(fixed16{0.5}, rsqrt(fixed16{4}));
+    EXPECT_EQ(fixed8{0.25}, sqrt(fixed8{0.0625}));
+    EXPECT_EQ(fixed8{0.5}, rsqrt(fixed8{4}));
+    EXPECT_EQ(fixed16{}, sqrt(fixed16{-1}));
+    EXPECT_EQ(fixed16::from_raw(256), sqrt(fixed16::epsilon()));
+    EXPECT_EQ(fixed16{181.019336}, sqrt(fixed16::max()));
+    EXPECT_EQ((fixed<1, 31>{0.5}), sqrt(fixed<1, 31>{0.25}));
+    EXPECT_EQ((fixed<1, 31>::max()), sqrt(fixed<1, 31>::max()));
+    EXPECT_EQ(fixed16::max(), rsqrt(fixed16{}));
+}
+
+template <typename Fixed>
+void
+check_trigonometry(double range)
+{
+    double const tolerance = ulp<Fixed>() / 2 + 1e-7;
+    for (double x = -range; x <= range; x += 0.0123) {
+        Fixed const f{x};
+        double const a = static_cast<double>(f);
+        ASSERT_NEAR(std::sin(a), static_cast<double>(sin(f)), tolerance) << x;
+        ASSERT_NEAR(std::cos(a), static_cast<double>(cos(f)), tolerance) << x;
+    }
+    for (double x = -1; x <= 1; x += 0.00123) {
+        Fixed const  f{x};
+        double const a = static_cast<double>(f);
+        ASSERT_NEAR(std::acos(a), static_cast<double>(acos(f)), tolerance) << x;
+        for (double y = -1; y <= 1; y += 0.123) {
+            Fixed const  g{y};
+            double const b = static_cast<double>(g);
+            ASSERT_NEAR(std::atan2(b, a), static_cast<double>(atan2(g, f)), tolerance) << x << y;
+        }
+    }
+}
+
+TEST(Fixed, Trigonometry)
+{
+    check_trigonometry<fixed16>(1000);
+    check_trigonometry<fixed8>(100);
+    EXPECT_EQ(fixed16{}, sin(fixed16{}));
+    EXPECT_EQ(fixed16{1}, cos(fixed16{}));
+    EXPECT_EQ(fixed16{}, atan2(fixed16{}, fixed16{}));
+    EXPECT_EQ(fixed16{}, acos(fixed16{2}));
+}
+
+TEST(Fixed, Vectors)
+{
+    vector3 const a{3, 4, 12};
+    vector3 const b{0.5, -1, 2};
+
+    EXPECT_EQ((vector3{3.5, 3, 14}), vector3{a + b});
+    EXPECT_EQ((vector3{6, 8, 24}), vector3{a * 2});
+    EXPECT_EQ(fixed16{21.5}, dot(a, b));
+    EXPECT_EQ(fixed16{13}, magnitude(a));
+    EXPECT_EQ((vector3{20, 0, -5}), vector3{a * b});
+
+    vector3 n = a;
+    n.normalize();
+    EXPECT_TRUE(n.is_unit());
+    EXPECT_EQ((vector3{3 / 13.0, 4 / 13.0, 12 / 13.0}), n);
+    // The error of the reciprocal grows with the magnitude
+    vector<fixed16, 3, components::xyzw, fast_math> f{0.3, 0.4, 1.2};
+    f.normalize();
+    EXPECT_TRUE(f.is_unit());
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(static_cast<double>(n[i]), static_cast<double>(f[i]), 2 * ulp<fixed16>());
+    }
+    EXPECT_FALSE(vector3{}.is_unit());
+    EXPECT_TRUE(vector3{}.is_zero());
+    EXPECT_THROW(vector3{}.normalize(), std::runtime_error);
+}
+
+TEST(Fixed, WideSums)
+{
+    // The squares of the components are above the largest fixed16 value
+    vector3 const a{300, 0, 0};
+    EXPECT_EQ(fixed_accumulator<16>{90000}, magnitude_square(a));
+    EXPECT_EQ(fixed16{300}, magnitude(a));
+    EXPECT_EQ((vector3{1, 0, 0}), vector3{normalize(a)});
+    EXPECT_EQ((vector3{1, 0, 0}), a.normalize());
+
+    vector3 const b{200, -300, 600};
+    EXPECT_EQ(fixed_accumulator<16>{60000}, dot(a, b));
+    EXPECT_EQ(fixed16{700}, magnitude(b));
+    vector3 const n = b.normalize();
+    EXPECT_TRUE(n.is_unit());
+    EXPECT_EQ((vector3{2 / 7.0, -3 / 7.0, 6 / 7.0}), n);
+
+    // The reciprocal of 700 is 94 units of the last place, 0.4% off
+    vector<fixed16, 3, components::xyzw, fast_math> f{200, -300, 600};
+    f.normalize();
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(static_cast<double>(n[i]), static_cast<double>(f[i]), 4e-3);
+    }
+
+    // The largest sums lose the last bits of the root
+    vector3 const m{fixed16::max(), fixed16::max(), fixed16::max()};
+    EXPECT_NEAR(32768 * std::sqrt(3.0), static_cast<double>(magnitude(m).value()), 2e-3);
+}
+
+TEST(Fixed, Matrices)
+{
+    using matrix3 = matrix<fixed16, 3, 3>;
+    matrix3 const m{{1, 2, 0}, {0, 1, 0.5}, {0, 0, 2}};
+    matrix3 const p = m * m;
+    EXPECT_EQ(fixed16{4}, p[0][1]);
+    EXPECT_EQ(fixed16{1}, p[0][2]);
+    EXPECT_EQ(fixed16{1.5}, p[1][2]);
+    EXPECT_EQ(fixed16{4}, p[2][2]);
+
+    vector3 const    v{1, 2, 3};
+    matrix<fixed16, 3, 1> const r = matrix3::identity() * v;
+    EXPECT_EQ(fixed16{2}, r[1][0]);
+}
+
+TEST(Fixed, Determinism)
+{
+    // The bits of the results are the same on every machine
+    EXPECT_EQ(0x908d, sin(fixed16{0.6}).raw());
+    EXPECT_EQ(0xa1e9, rsqrt(fixed16{2.5}).raw());
+    EXPECT_EQ(-0x19220, atan2(fixed16{-1}, fixed16{}).raw());
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
@@ -0,0 +1,172 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * half_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/half.hpp>
+#include <psst/math/matrix.hpp>
+#include <psst/math/vector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using vector3h  = vector<half, 3>;
+using vector3bf = vector<bfloat16, 3>;
+using vector3f  = vector<float, 3>;
+
+static_assert(traits::is_scalar_v<half>, "half is a scalar");
+static_assert(traits::is_scalar_v<bfloat16>, "bfloat16 is a scalar");
+static_assert(std::is_same<traits::scalar_value_traits<half>::magnitude_type, float>{}, "");
+static_assert(sizeof(vector3h) == 3 * sizeof(std::uint16_t), "");
+
+TEST(Half, Conversion)
+{
+    // Every half survives the trip through float
+    for (std::uint32_t bits = 0; bits < 0x10000; ++bits) {
+        auto const  h = half::from_bits(static_cast<std::uint16_t>(bits));
+        float const f = h;
+        if (std::isnan(f)) {
+            EXPECT_TRUE(std::isnan(float(half{f}))) << bits;
+        } else {
+            EXPECT_EQ(bits, half{f}.bits()) << bits;
+        }
+    }
+    EXPECT_EQ(0x3c00, half{1}.bits());
+    EXPECT_EQ(0xc000, half{-2.0}.bits());
+    EXPECT_EQ(65504, float(half{65504}));
+    EXPECT_EQ(std::numeric_limits<float>::infinity(), float(half{65520}));
+    EXPECT_EQ(-std::numeric_limits<float>::infinity(), float(half{-1e10f}));
+    EXPECT_EQ(std::ldexp(1.0f, -24), float(half{std::ldexp(1.0f, -24)}));
+    EXPECT_EQ(0, float(half{std::ldexp(1.0f, -26)}));
+    // Ties are rounded to even
+    EXPECT_EQ(2048, float(half{2049}));
+    EXPECT_EQ(2052, float(half{2051}));
+    EXPECT_EQ(2050, float(half{2050.5f}));
+    EXPECT_TRUE(std::isnan(float(half{std::numeric_limits<float>::quiet_NaN()})));
+}
+
+TEST(BFloat16, Conversion)
+{
+    for (std::uint32_t bits = 0; bits < 0x10000; ++bits) {
+        auto const  h = bfloat16::from_bits(static_cast<std::uint16_t>(bits));
+        float const f = h;
+        if (!std::isnan(f)) {
+            EXPECT_EQ(bits, bfloat16{f}.bits()) << bits;
+        }
+    }
+    EXPECT_EQ(0x3f80, bfloat16{1}.bits());
+    EXPECT_NEAR(1e30f, float(bfloat16{1e30f}), 1e30f / 256);
+    EXPECT_EQ(256, float(bfloat16{257}));
+    EXPECT_EQ(260, float(bfloat16{259}));
+    EXPECT_EQ(std::numeric_limits<float>::infinity(),
+              float(bfloat16{std::numeric_limits<float>::max()}));
+    EXPECT_TRUE(std::isnan(float(bfloat16{std::numeric_limits<float>::quiet_NaN()})));
+}
+
+TEST(Half, Arithmetic)
+{
+    half h{1.5f};
+    h += 2;
+    EXPECT_EQ(3.5f, h);
+    h *= 0.5;
+    EXPECT_EQ(1.75f, h);
+    EXPECT_EQ(3.5f, h * 2);
+    EXPECT_TRUE(h < 2);
+    EXPECT_EQ(-1.75f, -h);
+}
+
+TEST(Half, Vectors)
+{
+    vector3h const a{1, 2.5, -3};
+    vector3h const b{0.5f, 4, 2};
+
+    auto const sum = a + b;
+    static_assert(std::is_same<std::decay_t<decltype(sum)>::value_type, float>{},
+                  "Arithmetic promotes to float");
+    EXPECT_EQ((vector3f{1.5, 6.5, -1}), vector3f{sum});
+
+    vector3h c = a * 3;
+    EXPECT_EQ((vector3h{3, 7.5, -9}), c);
+    c /= 3;
+    EXPECT_EQ(a, c);
+
+    auto const d = dot(a, b);
+    static_assert(std::is_same<decltype(d.value()), float>{}, "Sums are accumulated in float");
+    EXPECT_EQ(4.5, d);
+    EXPECT_EQ(20.25, magnitude_square(expr::with_policy<wide_accumulation<>>(b)));
+
+    // 2049 is not a half, the sum is
+    vector<half, 3> big{2048, 1, 0};
+    EXPECT_EQ(2049, element_sum(big));
+
+    vector3bf const n = normalize(vector3f{3, 4, 12});
+    EXPECT_NEAR(1, magnitude(n).value(), 1e-2);
+}
+
+TEST(Half, Matrices)
+{
+    matrix<bfloat16, 2, 2> const m{{1, 2}, {3, 4}};
+    matrix<bfloat16, 2, 2> const p = m * m;
+    EXPECT_EQ(7, float(p[0][0]));
+    EXPECT_EQ(10, float(p[0][1]));
+    EXPECT_EQ(15, float(p[1][0]));
+    EXPECT_EQ(22, float(p[1][1]));
+
+    matrix<half, 3, 3> const id = matrix<float, 3, 3>::identity();
+    vector3h const           v{1, 2, 3};
+    matrix<half, 3, 1> const r  = id * v;
+    EXPECT_EQ(1, float(r[0][0]));
+    EXPECT_EQ(2, float(r[1][0]));
+    EXPECT_EQ(3, float(r[2][0]));
+}
+
+template <typename T>
+void
+check_buffer_conversion(std::size_t count)
+{
+    std::vector<float> src(count * 3);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<float>(std::sin(i * 0.1) * (i % 100));
+    }
+    std::vector<T>     narrow(src.size());
+    std::vector<float> back(src.size());
+    convert_values(memory_vector_view<float const*, 3>{src.data(), src.size()},
+                   memory_vector_view<T*, 3>{narrow.data(), narrow.size()});
+    convert_values(memory_vector_view<T const*, 3>{narrow.data(), narrow.size()},
+                   memory_vector_view<float*, 3>{back.data(), back.size()},
+                   parallel_options{4, 1, 16});
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        EXPECT_EQ(T{src[i]}.bits(), narrow[i].bits()) << i;
+        EXPECT_EQ(float(T{src[i]}), back[i]) << i;
+    }
+}
+
+TEST(Half, BufferConversion)
+{
+    check_buffer_conversion<half>(1);
+    check_buffer_conversion<half>(333);
+    check_buffer_conversion<bfloat16>(5);
+    check_buffer_conversion<bfloat16>(1000);
+
+    std::vector<float> src(10);
+    std::vector<half>  dst(9);
+    EXPECT_THROW(convert_values(memory_vector_view<float const*, 1>{src.data(), src.size()},
+                                memory_vector_view<half*, 1>{dst.data(), dst.size()}),
+                 std::runtime_error);
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
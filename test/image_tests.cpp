@@ -0,0 +1,215 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * image_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/image.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+namespace {
+
+std::vector<std::uint8_t>
+make_test_pixels(std::size_t count)
+{
+    std::vector<std::uint8_t> pixels(count * 4);
+    for (std::size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<std::uint8_t>(i * 7 + i / 256);
+    }
+    return pixels;
+}
+
+}    // namespace
+
+TEST(Image, View)
+{
+    std::vector<std::uint8_t> pixels(5 * 3 * 4);
+    auto img = color::make_image_view<color::rgba_hex>(pixels.data(), 4, 3, 5);
+    EXPECT_EQ(4u, img.width());
+    EXPECT_EQ(3u, img.height());
+    EXPECT_EQ(5u, img.stride());
+    EXPECT_FALSE(img.contiguous());
+    EXPECT_EQ(pixels.data() + 5 * 4 * 2 + 4, &img(1, 2).r());
+    EXPECT_EQ(4u, img.row(1).size());
+
+    auto sub = img.subview(3, 1, 10, 10);
+    EXPECT_EQ(1u, sub.width());
+    EXPECT_EQ(2u, sub.height());
+    EXPECT_EQ(&img(3, 1).r(), sub.data());
+
+    auto view = make_memory_vector_view<color::rgba_hex>(pixels.data(), pixels.size());
+    color::rgba_hex_image      whole{view, 5};
+    EXPECT_EQ(3u, whole.height());
+    EXPECT_THROW((color::rgba_hex_image{view, 4}), std::runtime_error);
+    EXPECT_THROW((color::rgba_hex_image{pixels.data(), 4, 3, 3}), std::runtime_error);
+}
+
+TEST(Image, PackUnpack)
+{
+    // Odd width to exercise the scalar tails after the vector loops
+    constexpr std::size_t width = 13, height = 7;
+    auto                  pixels = make_test_pixels(width * height);
+    std::vector<float>    floats(pixels.size());
+    std::vector<std::uint8_t> packed(pixels.size());
+
+    auto src = color::make_image_view<color::rgba_hex>(pixels.data(), width, height);
+    auto flt = color::make_image_view<color::rgba<float>>(floats.data(), width, height);
+    color::unpack(src, flt);
+    for (std::size_t i = 0; i < pixels.size(); ++i) {
+        ASSERT_FLOAT_EQ(pixels[i] / 255.0f, floats[i]) << i;
+    }
+    floats[0] = -1;
+    floats[1] = 2;
+    color::pack(flt, color::make_image_view<color::rgba_hex>(packed.data(), width, height));
+    EXPECT_EQ(0, packed[0]);
+    EXPECT_EQ(255, packed[1]);
+    for (std::size_t i = 2; i < pixels.size(); ++i) {
+        ASSERT_EQ(pixels[i], packed[i]) << i;
+    }
+}
+
+TEST(Image, SRGB)
+{
+    for (int i = 0; i < 256; ++i) {
+        float c     = i / 255.0f;
+        float exact = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        EXPECT_NEAR(exact, color::srgb_to_linear(i), 1e-6);
+        EXPECT_EQ(i, color::linear_to_srgb(color::srgb_to_linear(i)));
+    }
+    for (int i = 0; i <= 1000; ++i) {
+        float c     = i / 1000.0f;
+        float exact = c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1 / 2.4f) - 0.055f;
+        EXPECT_NEAR(exact * 255, color::linear_to_srgb(c), 1) << c;
+    }
+
+    constexpr std::size_t     width = 17, height = 3;
+    auto                      pixels = make_test_pixels(width * height);
+    std::vector<float>        linear(pixels.size());
+    std::vector<std::uint8_t> encoded(pixels.size());
+    auto src = color::make_image_view<color::rgba_hex>(pixels.data(), width, height);
+    auto lin = color::make_image_view<color::rgba<float>>(linear.data(), width, height);
+    color::srgb_to_linear(src, lin);
+    EXPECT_FLOAT_EQ(color::srgb_to_linear(pixels[4]), linear[4]);
+    EXPECT_FLOAT_EQ(pixels[3] / 255.0f, linear[3]) << "Alpha is not transformed";
+    color::linear_to_srgb(lin, color::make_image_view<color::rgba_hex>(encoded.data(), width,
+                                                                       height));
+    EXPECT_EQ(pixels, encoded);
+}
+
+TEST(Image, Premultiply)
+{
+    constexpr std::size_t width = 11, height = 5;
+    auto                  pixels = make_test_pixels(width * height);
+    auto                  result = pixels;
+    color::premultiply_alpha(color::make_image_view<color::rgba_hex>(result.data(), width, height));
+    for (std::size_t i = 0; i < pixels.size(); i += 4) {
+        auto a = pixels[i + 3];
+        EXPECT_EQ(std::lround(pixels[i] * a / 255.0), result[i]) << i;
+        EXPECT_EQ(std::lround(pixels[i + 1] * a / 255.0), result[i + 1]) << i;
+        EXPECT_EQ(std::lround(pixels[i + 2] * a / 255.0), result[i + 2]) << i;
+        EXPECT_EQ(a, result[i + 3]) << i;
+    }
+    color::unpremultiply_alpha(
+        color::make_image_view<color::rgba_hex>(result.data(), width, height));
+    for (std::size_t i = 0; i < pixels.size(); i += 4) {
+        // Low alpha loses precision
+        auto tolerance = 255.0 / pixels[i + 3] / 2 + 1;
+        EXPECT_NEAR(pixels[i], result[i], tolerance) << i;
+    }
+
+    std::vector<float> floats{0.5, 1, 0.25, 0.5};
+    auto               img = color::make_image_view<color::rgba<float>>(floats.data(), 1, 1);
+    color::premultiply_alpha(img);
+    EXPECT_EQ((std::vector<float>{0.25, 0.5, 0.125, 0.5}), floats);
+    color::unpremultiply_alpha(img);
+    EXPECT_EQ((std::vector<float>{0.5, 1, 0.25, 0.5}), floats);
+}
+
+TEST(Image, BlendOver)
+{
+    constexpr std::size_t     width = 9, height = 6;
+    std::vector<std::uint8_t> canvas(width * height * 4);
+    for (std::size_t i = 0; i < canvas.size(); i += 4) {
+        canvas[i]     = 200;
+        canvas[i + 1] = 100;
+        canvas[i + 2] = 0;
+        canvas[i + 3] = 255;
+    }
+    auto sprite = make_test_pixels(7 * 4);
+    color::premultiply_alpha(color::make_image_view<color::rgba_hex>(sprite.data(), 7, 4));
+    auto expected = canvas;
+    auto blend    = [&](std::ptrdiff_t x0, std::ptrdiff_t y0) {
+        for (std::ptrdiff_t y = std::max<std::ptrdiff_t>(0, y0); y < y0 + 4 && y < (int)height;
+             ++y) {
+            for (std::ptrdiff_t x = std::max<std::ptrdiff_t>(0, x0); x < x0 + 7 && x < (int)width;
+                 ++x) {
+                auto s = sprite.data() + ((y - y0) * 7 + x - x0) * 4;
+                auto d = expected.data() + (y * width + x) * 4;
+                for (std::size_t c = 0; c < 4; ++c) {
+                    d[c] = s[c] + std::lround(d[c] * (255 - s[3]) / 255.0);
+                }
+            }
+        }
+    };
+
+    auto dst = color::make_image_view<color::rgba_hex>(canvas.data(), width, height);
+    auto src = color::make_image_view<color::rgba_hex>(sprite.data(), 7, 4);
+    // Inside the canvas, wide enough for the vector loop
+    color::blend_over(src, dst, 1, 2);
+    blend(1, 2);
+    EXPECT_EQ(expected, canvas);
+    // Partially outside the canvas
+    color::blend_over(src, dst, 6, -1);
+    blend(6, -1);
+    EXPECT_EQ(expected, canvas);
+    color::blend_over(src, dst, -3, 4);
+    blend(-3, 4);
+    EXPECT_EQ(expected, canvas);
+    color::blend_over(src, dst, 9, 0);
+    EXPECT_EQ(expected, canvas);
+
+    std::vector<float> fsrc{0.25, 0, 0, 0.5};
+    std::vector<float> fdst{0, 0, 1, 1};
+    color::blend_over(color::make_image_view<color::rgba<float>>(fsrc.data(), 1, 1),
+                      color::make_image_view<color::rgba<float>>(fdst.data(), 1, 1));
+    EXPECT_EQ((std::vector<float>{0.25, 0, 0.5, 1}), fdst);
+}
+
+TEST(Image, Threads)
+{
+    constexpr std::size_t width = 64, height = 64;
+    auto                  pixels = make_test_pixels(width * height);
+    auto                  single = pixels;
+    auto                  multi  = pixels;
+    parallel_options      opts{4, 1, 1};
+    color::premultiply_alpha(color::make_image_view<color::rgba_hex>(single.data(), width, height),
+                             parallel_options::single_thread());
+    color::premultiply_alpha(color::make_image_view<color::rgba_hex>(multi.data(), width, height),
+                             opts);
+    EXPECT_EQ(single, multi);
+
+    std::vector<float> f1(pixels.size()), f2(pixels.size());
+    auto src = color::make_image_view<color::rgba_hex>(pixels.data(), width, height);
+    color::srgb_to_linear(src, color::make_image_view<color::rgba<float>>(f1.data(), width, height),
+                          parallel_options::single_thread());
+    color::srgb_to_linear(src.subview(0, 0, width, height),
+                          color::make_image_view<color::rgba<float>>(f2.data(), width, height),
+                          opts);
+    EXPECT_EQ(f1, f2);
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
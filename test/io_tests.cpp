@@ -0,0 +1,270 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * io_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/colors.hpp>
+#include <psst/math/matrix_format.hpp>
+#include <psst/math/matrix_io.hpp>
+#include <psst/math/matrix_parse.hpp>
+#include <psst/math/vector_format.hpp>
+#include <psst/math/vector_io.hpp>
+#include <psst/math/vector_parse.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using vector3d   = vector<double, 3>;
+using vector3f   = vector<float, 3>;
+using vector4i   = vector<int, 4>;
+using matrix3x3d = matrix<double, 3, 3>;
+using matrix2x3f = matrix<float, 2, 3>;
+
+TEST(Parse, Vector)
+{
+    {
+        vector3d v;
+        auto     res = io::parse_vector("{1,2.5,-3e2}", v);
+        EXPECT_TRUE(res);
+        EXPECT_EQ(1u, res.count);
+        EXPECT_EQ((vector3d{1, 2.5, -3e2}), v);
+    }
+    {
+        vector4i         v;
+        std::string_view str = " { +1 ,\t2 ,\n3, -4 } tail";
+        auto             res = io::parse_vector(str, v);
+        EXPECT_TRUE(res);
+        EXPECT_EQ((vector4i{1, 2, 3, -4}), v);
+        EXPECT_EQ(" tail", std::string_view(res.ptr));
+    }
+    {
+        io::text_format fmt;
+        fmt.start = '(';
+        fmt.end   = ')';
+        fmt.delim = ';';
+        vector3f v;
+        EXPECT_TRUE(io::parse_vector("(1; 2; 3)", v, fmt));
+        EXPECT_EQ((vector3f{1, 2, 3}), v);
+        EXPECT_FALSE(io::parse_vector("{1, 2, 3}", v, fmt));
+    }
+}
+
+TEST(Parse, VectorErrors)
+{
+    vector3d         v{7, 8, 9};
+    std::string_view invalid[]{"",        "1,2,3}",    "{1,2}",    "{1,2,3",   "{1;2;3}",
+                               "{1,x,3}", "{1,2,3,4}", "{+-1,2,3}", "{1,++2,3}", "{1,+,3}"};
+    for (auto str : invalid) {
+        auto res = io::parse_vector(str, v);
+        EXPECT_FALSE(res) << "'" << str << "' should not be parsed";
+        EXPECT_EQ(std::errc::invalid_argument, res.ec) << str;
+        EXPECT_EQ((vector3d{7, 8, 9}), v) << "Vector should not be modified";
+    }
+    vector<std::uint8_t, 3> b;
+    EXPECT_EQ(std::errc::result_out_of_range, io::parse_vector("{1, 256, 3}", b).ec);
+    vector4i i{1, 2, 3, 4};
+    EXPECT_FALSE(io::parse_vector("{+-5, 2, 3, 4}", i));
+    EXPECT_EQ((vector4i{1, 2, 3, 4}), i);
+    EXPECT_TRUE(io::parse_vector("{+.5, +0.25, +2e1}", v));
+    EXPECT_EQ((vector3d{0.5, 0.25, 20}), v);
+}
+
+TEST(Parse, VectorPolicies)
+{
+    color::rgba<float> c;
+    EXPECT_TRUE(io::parse_vector("{1.5, 0.5, -1, 0.25}", c));
+    EXPECT_EQ(1, c.red());
+    EXPECT_EQ(0.5, c.green());
+    EXPECT_EQ(0, c.blue());
+    EXPECT_EQ(0.25, c.alpha());
+}
+
+TEST(Parse, StreamRoundTrip)
+{
+    std::vector<vector3d> src{{0.1, 0.2, 0.3}, {1e-10, -2.5e20, 3}, {-1, 0, 1}};
+    std::ostringstream    os;
+    os << std::setprecision(17);
+    for (auto const& v : src)
+        os << v << "\n";
+
+    std::vector<vector3d> parsed;
+    auto                  res = io::parse_vectors(os.str(), parsed);
+    EXPECT_TRUE(res);
+    EXPECT_EQ(src.size(), res.count);
+    EXPECT_EQ(src, parsed);
+
+    io::text_format fmt = io::get_facet(os).text_format();
+    EXPECT_EQ(fmt.start, '{');
+    EXPECT_EQ(fmt.end, '}');
+    EXPECT_EQ(fmt.delim, ',');
+}
+
+TEST(Parse, Vectors)
+{
+    std::string_view str = "{1, 2, 3}, {4, 5, 6}\n{7, 8, 9}  ";
+    {
+        std::vector<vector3f> vectors;
+        auto                  res = io::parse_vectors(str, vectors);
+        EXPECT_TRUE(res);
+        EXPECT_EQ(3u, res.count);
+        ASSERT_EQ(3u, vectors.size());
+        EXPECT_EQ((vector3f{1, 2, 3}), vectors[0]);
+        EXPECT_EQ((vector3f{4, 5, 6}), vectors[1]);
+        EXPECT_EQ((vector3f{7, 8, 9}), vectors[2]);
+        EXPECT_EQ(str.data() + str.size(), res.ptr);
+    }
+    {
+        float buffer[6]{};
+        auto  view = make_memory_vector_view<vector3f>(buffer, 6);
+        auto  res  = io::parse_vectors(str, view);
+        EXPECT_TRUE(res);
+        EXPECT_EQ(2u, res.count);
+        EXPECT_EQ((vector3f{1, 2, 3}), view[0]);
+        EXPECT_EQ((vector3f{4, 5, 6}), view[1]);
+        EXPECT_EQ("{7, 8, 9}  ", std::string_view(res.ptr));
+    }
+    {
+        std::vector<vector3f> vectors;
+        auto                  res = io::parse_vectors("{1, 2, 3} {4, 5}", vectors);
+        EXPECT_FALSE(res);
+        EXPECT_EQ(1u, res.count);
+        EXPECT_EQ(1u, vectors.size());
+    }
+}
+
+TEST(Parse, Matrix)
+{
+    matrix3x3d m;
+    auto       res = io::parse_matrix("{{1,2,3},{4,5,6},{7,8,9}}", m);
+    EXPECT_TRUE(res);
+    EXPECT_EQ((matrix3x3d{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}), m);
+
+    std::ostringstream os;
+    os << io::pretty << m;
+    matrix3x3d m2;
+    EXPECT_TRUE(io::parse_matrix(os.str(), m2));
+    EXPECT_EQ(m, m2);
+
+    EXPECT_FALSE(io::parse_matrix("{{1,2,3},{4,5,6}}", m2));
+    EXPECT_FALSE(io::parse_matrix("{{1,2,3},{4,5,6},{7,8,9},}", m2));
+}
+
+TEST(Parse, Matrices)
+{
+    std::vector<matrix2x3f> matrices;
+    auto res = io::parse_matrices("{{1,2,3},{4,5,6}}\n{{7,8,9},{10,11,12}}", matrices);
+    EXPECT_TRUE(res);
+    ASSERT_EQ(2u, matrices.size());
+    EXPECT_EQ((matrix2x3f{{1, 2, 3}, {4, 5, 6}}), matrices[0]);
+    EXPECT_EQ((matrix2x3f{{7, 8, 9}, {10, 11, 12}}), matrices[1]);
+}
+
+TEST(Format, Vector)
+{
+    vector3f v{1, 2.5, -3};
+    char     buffer[64];
+    auto     res = io::format_vector(buffer, buffer + sizeof(buffer), v);
+    EXPECT_TRUE(res);
+    EXPECT_EQ("{1,2.5,-3}", std::string_view(buffer, res.ptr - buffer));
+
+    res = io::format_vector(buffer, buffer + 5, v);
+    EXPECT_FALSE(res);
+    EXPECT_EQ(std::errc::value_too_large, res.ec);
+
+    EXPECT_EQ("{2,5,-6}", io::to_string(v * 2));
+    EXPECT_EQ("{1,2,3}", io::to_string(vector<std::uint8_t, 3>{1, 2, 3}));
+}
+
+TEST(Format, SameLayoutAsStream)
+{
+    // Values that are short in both the stream precision and the shortest round-trip form
+    vector3d   v{1, 2.5, -3};
+    matrix3x3d m{{1, 2, 3}, {4, 5, 6}, {7, 8.5, 9}};
+    {
+        std::ostringstream os;
+        os << v << m;
+        auto fmt = io::get_facet(os).text_format();
+        EXPECT_EQ(os.str(), io::to_string(v, fmt) + io::to_string(m, fmt));
+    }
+    {
+        std::ostringstream os;
+        os << io::pretty << v << m;
+        auto fmt = io::get_facet(os).text_format();
+        EXPECT_EQ(os.str(), io::to_string(v, fmt) + io::to_string(m, fmt));
+    }
+    {
+        std::ostringstream os;
+        os << io::pretty << io::set_col_width(8) << io::set_braces('[', ']') << v << m;
+        auto fmt = io::get_facet(os).text_format();
+        EXPECT_EQ(os.str(), io::to_string(v, fmt) + io::to_string(m, fmt));
+    }
+}
+
+TEST(Format, ShortestValues)
+{
+    // The stream precision drops digits, the formatted value is parsed back to the same one
+    vector3d           v{0.1 + 0.2, 1. / 3, 2};
+    std::ostringstream os;
+    os << v;
+    EXPECT_EQ("{0.3,0.333333,2}", os.str());
+    auto str = io::to_string(v);
+    EXPECT_EQ("{0.30000000000000004,0.3333333333333333,2}", str);
+    vector3d parsed;
+    EXPECT_TRUE(io::parse_vector(str, parsed));
+    EXPECT_EQ(v, parsed);
+
+    vector3f vf{1.f / 3, 0.1f, 1e-7f};
+    EXPECT_EQ("{0.33333334,0.1,1e-07}", io::to_string(vf));
+
+    // A column width limits the precision as std::setprecision does
+    std::ostringstream pretty;
+    pretty << io::pretty << io::set_col_width(8) << v;
+    EXPECT_EQ(pretty.str(), io::to_string(v, io::get_facet(pretty).text_format()));
+}
+
+TEST(Format, RoundTrip)
+{
+    std::vector<vector3d> src{{0.1, 0.2, 0.3}, {1e-10, -2.5e20, 3}, {1. / 3, 2. / 3, 1e300}};
+    std::string           str;
+    io::format_vectors(str, src);
+    std::vector<vector3d> parsed;
+    EXPECT_TRUE(io::parse_vectors(str, parsed));
+    EXPECT_EQ(src, parsed);
+
+    std::vector<matrix2x3f> matrices{{{0.1, 0.2, 0.3}, {1, 2, 3}}, {{1e-5, 1e5, -1}, {4, 5, 6}}};
+    str.clear();
+    io::format_matrices(str, matrices);
+    std::vector<matrix2x3f> parsed_matrices;
+    EXPECT_TRUE(io::parse_matrices(str, parsed_matrices));
+    EXPECT_EQ(matrices, parsed_matrices);
+}
+
+TEST(Format, Vectors)
+{
+    float buffer[]{1, 2, 3, 4, 5, 6};
+    auto  view = make_memory_vector_view<vector3f>(buffer, 6);
+    char  text[64];
+    auto  res = io::format_vectors(text, text + sizeof(text), view);
+    EXPECT_TRUE(res);
+    EXPECT_EQ("{1,2,3}\n{4,5,6}\n", std::string_view(text, res.ptr - text));
+    EXPECT_FALSE(io::format_vectors(text, text + 10, view));
+
+    std::vector<vector3f> vectors(1000, vector3f{0.1, 0.2, 0.3});
+    std::string           str;
+    io::format_vectors(str, vectors);
+    EXPECT_EQ(vectors.size() * 14, str.size());
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
@@ -0,0 +1,228 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * math_policy_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/matrix.hpp>
+#include <psst/math/simd.hpp>
+#include <psst/math/summation.hpp>
+#include <psst/math/vector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using vector3f      = vector<float, 3>;
+using vector3d      = vector<double, 3>;
+using fast_vector3f = vector<float, 3, components::xyzw, fast_math>;
+using fast_vector3d = vector<double, 3, components::xyzw, fast_math>;
+using matrix3f      = matrix<float, 3, 3>;
+
+namespace {
+
+template <typename Vector>
+Vector
+make_vector(int i)
+{
+    using value_type = typename Vector::value_type;
+    return Vector{static_cast<value_type>(std::sin(i * 1.3) * 100),
+                  static_cast<value_type>(std::cos(i * 0.7) * 0.01),
+                  static_cast<value_type>(i % 17 - 8)};
+}
+
+}    // namespace
+
+TEST(MathPolicy, Propagation)
+{
+    fast_vector3f const f{1, 2, 3};
+    vector3f const      p{1, 2, 3};
+    static_assert(std::is_same<traits::math_policy_t<fast_vector3f>, fast_math>{}, "");
+    static_assert(std::is_same<traits::math_policy_t<vector3f>, precise_math>{}, "");
+    static_assert(std::is_same<traits::math_policy_t<decltype(f / 3)>, fast_math>{}, "");
+    static_assert(std::is_same<traits::math_policy_t<decltype(p / 3)>, precise_math>{}, "");
+    static_assert(std::is_same<traits::math_policy_t<decltype(p + f * 2)>, fast_math>{}, "");
+    static_assert(std::is_same<traits::math_policy_t<decltype(magnitude(f))>, fast_math>{}, "");
+    static_assert(
+        std::is_same<traits::math_policy_t<decltype(expr::with_policy<fast_math>(p))>, fast_math>{},
+        "");
+
+    // A vector of a policy is assignable from and to the vectors of the other ones
+    vector3f      a = f;
+    fast_vector3f b = p;
+    EXPECT_EQ(p, a);
+    EXPECT_EQ(f, b);
+}
+
+TEST(MathPolicy, Divide)
+{
+    for (int i = 0; i < 100; ++i) {
+        auto const     p       = make_vector<vector3f>(i);
+        float const    s       = static_cast<float>(i) * 0.37f + 0.1f;
+        vector3f const precise = p / s;
+        fast_vector3f  fast    = fast_vector3f{p} / s;
+        vector3f const wrapped = expr::with_policy<fast_math>(p) / s;
+        for (std::size_t j = 0; j < 3; ++j) {
+            EXPECT_FLOAT_EQ(precise[j], fast[j]) << i;
+            EXPECT_EQ(fast[j], wrapped[j]) << i;
+        }
+        fast /= 2;
+        EXPECT_FLOAT_EQ(precise[0] / 2, fast[0]);
+    }
+    // Integer components are divided
+    vector<int, 3, components::xyzw, fast_math> const v{7, 9, -11};
+    vector<int, 3> const                              q = v / 2;
+    EXPECT_EQ((vector<int, 3>{3, 4, -5}), q);
+
+    matrix3f const m{{1, 2, 3}, {4, 5, 6}, {7, 8, 10}};
+    matrix3f const md = expr::with_policy<fast_math>(m) / 3;
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            EXPECT_FLOAT_EQ(m[r][c] / 3, md[r][c]);
+        }
+    }
+}
+
+TEST(MathPolicy, Normalize)
+{
+    for (int i = 0; i < 1000; ++i) {
+        auto const     p       = make_vector<vector3f>(i);
+        vector3f const precise = normalize(p);
+        vector3f const fast    = normalize(fast_vector3f{p});
+        EXPECT_NEAR(1, magnitude(vector3d{fast}), 5e-7) << fast;
+        EXPECT_NEAR(1, magnitude(vector3d{precise}), 3e-7) << precise;
+        for (std::size_t j = 0; j < 3; ++j) {
+            EXPECT_NEAR(precise[j], fast[j], 5e-7) << i;
+        }
+        fast_vector3f v = p;
+        v.normalize();
+        EXPECT_EQ(fast, v);
+
+        auto const     d  = make_vector<vector3d>(i);
+        vector3d const nd = normalize(fast_vector3d{d});
+        EXPECT_NEAR(1, magnitude(nd), 1e-15) << nd;
+    }
+    fast_vector3f zero;
+    EXPECT_THROW(zero.normalize(), std::runtime_error);
+
+    // Precise normalization is unchanged
+    vector3f const p{3, -4, 12};
+    EXPECT_EQ(p / magnitude(p), vector3f{normalize(p)});
+}
+
+TEST(MathPolicy, SumOfProducts)
+{
+    for (int i = 0; i < 100; ++i) {
+        auto const  p       = make_vector<vector3f>(i);
+        auto const  q       = make_vector<vector3f>(i + 13);
+        float const precise = dot(p, q);
+        float const fast    = dot(fast_vector3f{p}, q);
+        EXPECT_NEAR(precise, fast, 1e-6 * (magnitude(p) * magnitude(q)).value()) << i;
+        EXPECT_FLOAT_EQ(magnitude_square(p), magnitude_square(fast_vector3f{p}));
+    }
+
+    // The precise sum adds the last terms first, as the fold of the expressions always did
+    EXPECT_EQ(1, dot(vector3d{1, 1e16, -1e16}, vector3d{1, 1, 1}));
+    EXPECT_EQ(0, dot(vector3d{1e16, -1e16, 1}, vector3d{1, 1, 1}));
+
+    matrix3f const m{{1, 2, 3}, {4, 5, 6}, {7, 8, 10}};
+    matrix3f const precise = m * m;
+    matrix3f const fast    = expr::with_policy<fast_math>(m) * m;
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            EXPECT_FLOAT_EQ(precise[r][c], fast[r][c]);
+        }
+    }
+}
+
+TEST(MathPolicy, Packs)
+{
+    using float4   = simd<float, 4>;
+    using vector3p = vector<float4, 3, components::xyzw, fast_math>;
+    float xs[]{1, -2, 0.5f, 100};
+    float ys[]{2, 0.25f, -3, 1};
+
+    vector3p const          v{float4::load(xs), float4::load(ys), float4{2}};
+    vector<float4, 3> const n = normalize(v);
+    vector<float4, 3> const h = v / float4{4};
+    for (std::size_t i = 0; i < float4::lanes; ++i) {
+        vector3f const expected = normalize(vector3f{xs[i], ys[i], 2});
+        EXPECT_NEAR(expected.x(), n.x()[i], 5e-7);
+        EXPECT_NEAR(expected.y(), n.y()[i], 5e-7);
+        EXPECT_NEAR(expected.z(), n.z()[i], 5e-7);
+        EXPECT_EQ(xs[i] / 4, h.x()[i]);
+    }
+}
+
+TEST(MathPolicy, WideAccumulation)
+{
+    using wide          = wide_accumulation<>;
+    using long_vector   = vector<float, 300, components::none>;
+    using byte_vector   = vector<std::int8_t, 64, components::none>;
+    using byte_matrix   = matrix<std::int8_t, 2, 64>;
+    using byte_matrix_t = matrix<std::int8_t, 64, 2>;
+
+    long_vector a;
+    long_vector b;
+    double      ref = 0;
+    for (std::size_t i = 0; i < long_vector::size; ++i) {
+        a[i] = static_cast<float>(std::sin(i * 0.37) * 1000);
+        b[i] = static_cast<float>(std::cos(i * 1.91) / 3);
+        ref += double(a[i]) * double(b[i]);
+    }
+    auto const d = dot(expr::with_policy<wide>(a), b);
+    static_assert(std::is_same<decltype(d.value()), double>{}, "");
+    static_assert(std::is_same<decltype(dot(a, b).value()), float>{}, "");
+    // The products of floats are exact in double
+    EXPECT_NEAR(ref, d.value(), 1e-12 * std::abs(ref));
+    EXPECT_NEAR(std::sqrt(magnitude_square(vector<double, 300, components::none>{a}).value()),
+                magnitude(expr::with_policy<wide>(a)).value(), 1e-12);
+
+    // Composes with the summation strategies
+    double const pd = dot(expr::with_policy<summation::pairwise<wide>>(a), b);
+    EXPECT_NEAR(ref, pd, 1e-12 * std::abs(ref));
+    double const wd = dot(expr::with_policy<wide_accumulation<summation::accumulators<8>>>(a), b);
+    EXPECT_NEAR(ref, wd, 1e-12 * std::abs(ref));
+
+    // 8 bit values overflow 8 and 16 bits
+    byte_vector bytes;
+    for (std::size_t i = 0; i < byte_vector::size; ++i) {
+        bytes[i] = static_cast<std::int8_t>(i % 2 ? 127 : -128);
+    }
+    std::int32_t const sq = magnitude_square(expr::with_policy<wide>(bytes));
+    EXPECT_EQ(32 * 127 * 127 + 32 * 128 * 128, sq);
+    std::int32_t const sum = element_sum(expr::with_policy<wide>(bytes));
+    EXPECT_EQ(-32, sum);
+
+    // Matrix elements are rounded to the type of the matrix
+    byte_matrix   m;
+    byte_matrix_t n;
+    for (std::size_t i = 0; i < 64; ++i) {
+        m[0][i] = 100;
+        m[1][i] = static_cast<std::int8_t>(i % 2 ? 100 : -100);
+        n[i][0] = 1;
+        n[i][1] = static_cast<std::int8_t>(i % 2 ? -1 : 1);
+    }
+    matrix<std::int8_t, 2, 2> const p = expr::with_policy<wide>(m) * n;
+    EXPECT_EQ(0, p[0][1]);
+    EXPECT_EQ(0, p[1][0]);
+    matrix<float, 1, 3> const row{{1e8f, 1, -1e8f}};
+    matrix<float, 3, 1> const col{{1}, {1}, {1}};
+    matrix<float, 1, 1> const narrow = row * col;
+    matrix<float, 1, 1> const wide_p = expr::with_policy<wide>(row) * col;
+    EXPECT_EQ(0, narrow[0][0]);
+    EXPECT_EQ(1, wide_p[0][0]);
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
@@ -0,0 +1,162 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * matrix_decomposition_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/matrix_decomposition.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using matrix3 = matrix<double, 3, 3>;
+using matrix4 = matrix<double, 4, 4>;
+using vector3 = vector<double, 3>;
+using vector4 = vector<double, 4>;
+
+static_assert(std::is_same<decltype(lu_decomposition{matrix4{}}),
+                           lu_decomposition<double, 4>>{},
+              "");
+static_assert(std::is_same<decltype(householder_qr{matrix<float, 5, 3>{}}),
+                           householder_qr<float, 5, 3>>{},
+              "");
+
+namespace {
+
+// The first element is zero, LU has to pivot
+matrix4 const a{{0, 2, -1, 3}, {4, 1, 2, -2}, {-1, 3, 5, 1}, {2, -2, 1, 6}};
+// a * transpose(a) + identity, symmetric positive definite
+matrix4 const spd = a * transpose(a) + matrix4::identity();
+vector4 const b{1, -2, 3, 0.5};
+
+template <typename Expr>
+matrix4
+to_dense(Expr const& m)
+{
+    return m;
+}
+
+template <typename Lhs, typename Rhs>
+void
+expect_near(Lhs const& lhs, Rhs const& rhs, double eps = 1e-12)
+{
+    vector<double, Lhs::size> const l{lhs};
+    vector<double, Lhs::size> const r{rhs};
+    for (std::size_t i = 0; i < Lhs::size; ++i) {
+        EXPECT_NEAR(l[i], r[i], eps) << i;
+    }
+}
+
+template <std::size_t R, std::size_t C>
+void
+expect_near(matrix<double, R, C> const& lhs, matrix<double, R, C> const& rhs, double eps = 1e-12)
+{
+    for (std::size_t r = 0; r < R; ++r) {
+        for (std::size_t c = 0; c < C; ++c) {
+            EXPECT_NEAR(lhs[r][c], rhs[r][c], eps) << r << ", " << c;
+        }
+    }
+}
+
+}    // namespace
+
+TEST(MatrixDecomposition, LU)
+{
+    lu_decomposition const lu{a};
+    expect_near(b, as_vector(a * lu.solve(b)));
+    EXPECT_NEAR(det(a), lu.determinant(), 1e-9);
+    expect_near(matrix4::identity(), matrix4{a * lu.inverse()});
+
+    // P * a = L * U
+    matrix4 pa;
+    for (std::size_t i = 0; i < 4; ++i) {
+        pa[i] = a[lu.permutation()[i]];
+    }
+    expect_near(pa, to_dense(lu.lower() * lu.upper()));
+    EXPECT_EQ(1, (lu.lower().element<2, 2>()));
+
+    matrix<double, 4, 2> const rhs{{1, 2}, {3, 4}, {5, 6}, {7, 8}};
+    expect_near(rhs, matrix<double, 4, 2>{a * lu.solve(rhs)});
+
+    EXPECT_THROW(lu_decomposition{(matrix3{{1, 2, 3}, {2, 4, 6}, {1, 0, 1}})}, std::runtime_error);
+    lu_decomposition const swap{matrix<float, 2, 2>{{0, 1}, {1, 0}}};
+    EXPECT_EQ((vector<float, 2>{2, 3}), swap.solve(vector<float, 2>{3, 2}));
+    EXPECT_EQ(-1, swap.determinant());
+}
+
+TEST(MatrixDecomposition, Cholesky)
+{
+    cholesky_decomposition const ch{spd};
+    expect_near(b, as_vector(spd * ch.solve(b)), 1e-10);
+    EXPECT_NEAR(det(spd), ch.determinant(), 1e-6);
+    expect_near(spd, to_dense(ch.lower() * transpose(ch.lower())), 1e-10);
+    expect_near(matrix4::identity(), matrix4{spd * ch.inverse()}, 1e-10);
+
+    matrix<double, 4, 3> const rhs{{1, 2, 0}, {3, 4, 1}, {5, 6, 0}, {7, 8, 1}};
+    expect_near(rhs, matrix<double, 4, 3>{spd * ch.solve(rhs)}, 1e-10);
+
+    // Only the lower triangle is read
+    matrix4 lower_only = spd;
+    lower_only[0][3]   = 100;
+    expect_near(ch.solve(b), cholesky_decomposition{lower_only}.solve(b), 0);
+
+    EXPECT_THROW(cholesky_decomposition{a}, std::runtime_error);
+    EXPECT_THROW(cholesky_decomposition{matrix3{}}, std::runtime_error);
+}
+
+TEST(MatrixDecomposition, QR)
+{
+    householder_qr const qr{a};
+    expect_near(b, as_vector(a * qr.solve(b)));
+    expect_near(a, to_dense(qr.q() * qr.r()));
+    expect_near(matrix4::identity(), to_dense(transpose(qr.q()) * qr.q()));
+
+    // Least squares fit of a line to four points, y = 1 + 2 * x
+    matrix<double, 4, 2> const points{{1, 0}, {1, 1}, {1, 2}, {1, 3}};
+    householder_qr const       fit{points};
+    expect_near(vector<double, 2>{1, 2}, fit.solve(vector4{1, 3, 5, 7}));
+    // The residual of a least squares solution is orthogonal to the columns
+    vector4 const y{1, 3.5, 4.5, 7.5};
+    vector4 const residual = y - as_vector(points * fit.solve(y));
+    expect_near(vector<double, 2>{0, 0}, as_vector(transpose(points) * residual));
+    expect_near((matrix<double, 2, 2>{{1, 0}, {0, 1}}),
+                matrix<double, 2, 2>{transpose(fit.q()) * fit.q()});
+
+    matrix<double, 4, 2> const rhs{{1, 2}, {3, 4}, {5, 6}, {7, 8}};
+    expect_near(matrix<double, 2, 2>{{1, 2}, {2, 2}}, fit.solve(rhs));
+
+    EXPECT_THROW((householder_qr{matrix<double, 3, 2>{{1, 0}, {2, 0}, {3, 0}}}),
+                 std::runtime_error);
+}
+
+TEST(MatrixDecomposition, Batch)
+{
+    std::vector<vector4> rhs(1000);
+    for (std::size_t i = 0; i < rhs.size(); ++i) {
+        rhs[i] = vector4{i * 0.5, 1.0 - i, i * 0.25, 2.0};
+    }
+    lu_decomposition const       lu{a};
+    cholesky_decomposition const ch{spd};
+    householder_qr const         qr{a};
+    std::vector<vector4>         x(rhs.size()), y(rhs.size()), z(rhs.size());
+    lu.solve(rhs.data(), x.data(), rhs.size(), parallel_options{4, 1, 1});
+    ch.solve(rhs.data(), y.data(), rhs.size(), parallel_options{4, 1, 1});
+    qr.solve(rhs.data(), z.data(), rhs.size());
+    for (std::size_t i = 0; i < rhs.size(); ++i) {
+        EXPECT_EQ(lu.solve(rhs[i]), x[i]) << i;
+        EXPECT_EQ(ch.solve(rhs[i]), y[i]) << i;
+        expect_near(x[i], z[i], 1e-9);
+    }
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
@@ -6,11 +6,14 @@
  *      Author: ser-fedorov
  */
 
+#include <psst/math/angles.hpp>
 #include <psst/math/detail/value_policy.hpp>
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <sstream>
+#include <vector>
 
 namespace psst {
 namespace math {
@@ -31,6 +34,88 @@ TEST(Misc, Clamp)
     }
 }
 
+TEST(Misc, AngleConstants)
+{
+    // Constants and conversions fold at compile time
+    static_assert(pi_v<double> * 2 == tau_v<double>, "");
+    static_assert(half_pi_v<float> * 2 == pi<float>::value, "");
+    static_assert(90_deg == half_pi_v<double>, "");
+    static_assert(180.0_deg == pi_v<double>, "");
+    static_assert(radians_to_degrees(pi_v<double>) == 180, "");
+    static_assert(minus_plus_half_pi(pi_v<float>) == half_pi_v<float>, "");
+
+    EXPECT_EQ(std::atan(1.0) * 4, pi_v<double>);
+    EXPECT_EQ(std::atan(1.0f) * 4, pi_v<float>);
+    EXPECT_EQ(std::atan(1.0L) * 4, pi_v<long double>);
+}
+
+TEST(Misc, AngleNormalization)
+{
+    double const two_pi = pi<double>::value * 2;
+    EXPECT_EQ(1.0, zero_to_two_pi(1.0));
+    EXPECT_EQ(0.0, zero_to_two_pi(two_pi));
+    EXPECT_NEAR(1.0, zero_to_two_pi(1.0 + two_pi * 1000), 1e-12);
+    EXPECT_NEAR(two_pi - 1.0, zero_to_two_pi(-1.0 - two_pi * 1000), 1e-12);
+    EXPECT_NEAR(0.5f, zero_to_two_pi(0.5f + pi<float>::value * 2 * 100), 1e-4f);
+
+    // Huge values are reduced without iterating
+    for (double angle : {1e15, -1e15, 1e300, -1e300}) {
+        auto res = zero_to_two_pi(angle);
+        EXPECT_LE(0.0, res) << angle;
+        EXPECT_GT(two_pi, res) << angle;
+    }
+    // 10^15 mod 2π, computed with arbitrary precision, the quotient times the rounding error of
+    // 2π is 0.039
+    static_assert(detail::two_pi_parts<double>::error == 0x1.1a62633145c07p-52,
+                  "The rounding error of 2π doesn't depend on the size of long double");
+    EXPECT_NEAR(2.1096981170701126, zero_to_two_pi(1e15), 1e-12);
+    EXPECT_NEAR(2.1096981170701126, minus_plus_pi(1e15), 1e-12);
+    EXPECT_NEAR(-2.1096981170701126, minus_plus_pi(-1e15), 1e-12);
+
+    EXPECT_EQ(1.0, minus_plus_pi(1.0));
+    EXPECT_EQ(-pi<double>::value, minus_plus_pi(-pi<double>::value));
+    EXPECT_NEAR(-pi<double>::value / 2, minus_plus_pi(pi<double>::value * 1.5), 1e-12);
+    EXPECT_NEAR(pi<double>::value / 2, minus_plus_pi(-pi<double>::value * 1.5), 1e-12);
+    EXPECT_NEAR(0.25, minus_plus_pi(0.25 - two_pi * 12345), 1e-9);
+    for (double angle : {1e15, -1e15, 1e300}) {
+        auto res = minus_plus_pi(angle);
+        EXPECT_LE(-pi<double>::value, res) << angle;
+        EXPECT_GE(pi<double>::value, res) << angle;
+    }
+}
+
+TEST(Misc, BatchAngleNormalization)
+{
+    std::vector<double> angles;
+    for (int i = -1000; i <= 1000; ++i) {
+        angles.push_back(i * 0.731);
+    }
+    angles.push_back(1e6 + 0.5);
+    angles.push_back(-1e6 - 0.5);
+
+    auto zero_based = angles;
+    zero_to_two_pi(zero_based.data(), zero_based.size());
+    auto centered = angles;
+    minus_plus_pi(centered.data(), centered.size());
+
+    for (std::size_t i = 0; i < angles.size(); ++i) {
+        EXPECT_LE(0.0, zero_based[i]) << angles[i];
+        EXPECT_GT(pi<double>::value * 2, zero_based[i]) << angles[i];
+        EXPECT_NEAR(zero_to_two_pi(angles[i]), zero_based[i], 1e-9) << angles[i];
+        EXPECT_LE(-pi<double>::value, centered[i]) << angles[i];
+        EXPECT_GT(pi<double>::value, centered[i]) << angles[i];
+        EXPECT_NEAR(std::remainder(angles[i], pi<double>::value * 2), centered[i], 1e-9)
+            << angles[i];
+    }
+
+    std::vector<float> floats{-100.f, -7.f, -1.f, 0.f, 1.f, 7.f, 100.f, 1000.f, 12345.f};
+    auto               reduced = floats;
+    zero_to_two_pi(reduced.data(), reduced.size());
+    for (std::size_t i = 0; i < floats.size(); ++i) {
+        EXPECT_NEAR(zero_to_two_pi(floats[i]), reduced[i], 2e-3f) << floats[i];
+    }
+}
+
 }    // namespace test
 }    // namespace math
 }    // namespace psst
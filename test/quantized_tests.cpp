@@ -0,0 +1,222 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * quantized_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/quantized.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using vector3f    = vector<float, 3>;
+using vector3d    = vector<double, 3>;
+using quaterniond = vector<double, 4, components::wxyz>;
+
+namespace {
+
+constexpr int sample_count = 100000;
+
+vector3f
+random_direction(std::mt19937& gen)
+{
+    std::normal_distribution<double> dist;
+    return normalize(vector3d{dist(gen), dist(gen), dist(gen)});
+}
+
+quaternion<float>
+random_rotation(std::mt19937& gen)
+{
+    std::normal_distribution<double> dist;
+    return normalize(quaterniond{dist(gen), dist(gen), dist(gen), dist(gen)});
+}
+
+/** Angle between the vectors, computed in double */
+double
+angle_between(vector3f const& a, vector3f const& b)
+{
+    auto const c = dot(normalize(vector3d{a}), normalize(vector3d{b})).value();
+    return std::acos(std::min(1.0, c));
+}
+
+template <typename Vector>
+double
+max_component_error(Vector const& a, Vector const& b)
+{
+    double res = 0;
+    for (std::size_t i = 0; i < Vector::size; ++i) {
+        res = std::max(res, std::abs(double(a[i]) - double(b[i])));
+    }
+    return res;
+}
+
+template <typename I>
+void
+check_octahedral(double max_error)
+{
+    std::mt19937 gen{42};
+    for (int i = 0; i < sample_count; ++i) {
+        auto const v = random_direction(gen);
+        auto const d = octahedral<I>::encode(v).decode();
+        EXPECT_NEAR(1, magnitude(d).value(), 1e-6) << v;
+        ASSERT_LE(angle_between(v, d), max_error) << v;
+    }
+    // The axes are on the vertices of the octahedron
+    for (std::size_t i = 0; i < 3; ++i) {
+        vector3f axis;
+        axis[i] = 1;
+        EXPECT_EQ(axis, octahedral<I>::encode(axis).decode());
+        EXPECT_EQ(-axis, octahedral<I>::encode(-axis).decode());
+    }
+    EXPECT_EQ((vector3f{0, 0, 1}), octahedral<I>::encode(vector3f{}).decode());
+}
+
+}    // namespace
+
+TEST(Quantized, Octahedral)
+{
+    check_octahedral<std::int8_t>(0.017);
+    check_octahedral<std::int16_t>(6.5e-5);
+}
+
+TEST(Quantized, SnormVector)
+{
+    using snorm8x3  = snorm_vector<std::int8_t, 3>;
+    using snorm16x3 = snorm_vector<std::int16_t, 3>;
+
+    auto const p = snorm8x3::encode(vector3f{1, -1, 0});
+    EXPECT_EQ(127, p.values[0]);
+    EXPECT_EQ(-127, p.values[1]);
+    EXPECT_EQ(0, p.values[2]);
+    EXPECT_EQ((vector3f{1, -1, 0}), p.decode());
+    // Values out of range are clamped, the lowest integer decodes to -1
+    EXPECT_EQ((vector3f{1, -1, 0}), snorm16x3::encode(vector3f{2, -1e10f, 0}).decode());
+    EXPECT_EQ(-1, (snorm8x3{{-128, 0, 0}}.decode().x()));
+
+    std::mt19937 gen{7};
+    for (int i = 0; i < sample_count; ++i) {
+        auto const v = random_direction(gen);
+        ASSERT_LE(max_component_error(v, snorm8x3::encode(v).decode()), 0.5 / 127 + 1e-7);
+        ASSERT_LE(max_component_error(v, snorm16x3::encode(v).decode()), 0.5 / 32767 + 1e-7);
+    }
+}
+
+TEST(Quantized, Snorm10_10_10_2)
+{
+    auto const p = snorm_10_10_10_2::encode(vector3f{1, 0, -1}, -1);
+    EXPECT_EQ(0x1ffu | (0x201u << 20) | (3u << 30), p.bits);
+    EXPECT_EQ((vector3f{1, 0, -1}), p.decode());
+    EXPECT_EQ(-1, p.w());
+    EXPECT_EQ(1, snorm_10_10_10_2::encode(vector3f{}, 0.7f).w());
+    EXPECT_EQ(0, snorm_10_10_10_2::encode(vector3f{}).w());
+
+    std::mt19937 gen{11};
+    for (int i = 0; i < sample_count; ++i) {
+        auto const v = random_direction(gen);
+        auto const d = snorm_10_10_10_2::encode(v).decode();
+        ASSERT_LE(max_component_error(v, d), 0.5 / 511 + 1e-7) << v;
+    }
+}
+
+template <typename UInt>
+void
+check_smallest_three(double max_error)
+{
+    std::mt19937 gen{3};
+    for (int i = 0; i < sample_count; ++i) {
+        auto const q = random_rotation(gen);
+        auto       d = smallest_three<UInt>::encode(q).decode();
+        // q and -q are the same rotation
+        if (dot(q, d).value() < 0)
+            d = -d;
+        ASSERT_LE(max_component_error(q, d), max_error) << q;
+    }
+    quaternion<float> const identity{1, 0, 0, 0};
+    EXPECT_EQ(identity, smallest_three<UInt>::encode(identity).decode());
+    EXPECT_EQ(identity, smallest_three<UInt>::encode(-identity).decode());
+    // Not normalized quaternions are normalized
+    quaternion<float> const q{0, 0, 2, 0};
+    EXPECT_EQ((quaternion<float>{0, 0, 1, 0}), smallest_three<UInt>::encode(q).decode());
+}
+
+TEST(Quantized, SmallestThree)
+{
+    check_smallest_three<std::uint32_t>(1.9e-3);
+    check_smallest_three<std::uint64_t>(1.9e-6);
+}
+
+template <typename Packed, std::size_t Size>
+void
+check_buffer_encoding(std::size_t count)
+{
+    std::mt19937       gen{5};
+    std::vector<float> src(count * Size);
+    for (std::size_t i = 0; i < count; ++i) {
+        if constexpr (Size == 4 && std::is_same<typename Packed::value_type,
+                                                quaternion<float>>::value) {
+            auto const q = random_rotation(gen);
+            std::copy(q.data(), q.data() + Size, src.data() + i * Size);
+        } else {
+            auto const v = random_direction(gen);
+            std::copy(v.data(), v.data() + 3, src.data() + i * Size);
+            if constexpr (Size == 4) {
+                src[i * Size + 3] = i % 2 ? 1.0f : -1.0f;
+            }
+        }
+    }
+    std::vector<Packed> packed(count);
+    std::vector<float>  back(src.size());
+    encode_values(memory_vector_view<float const*, Size>{src.data(), src.size()}, packed.data());
+    decode_values(packed.data(), packed.size(),
+                  memory_vector_view<float*, Size>{back.data(), back.size()},
+                  parallel_options{4, 1, 16});
+
+    for (std::size_t i = 0; i < count; ++i) {
+        float values[Size];
+        std::copy(src.data() + i * Size, src.data() + (i + 1) * Size, values);
+        float expected[4]{};
+        if constexpr (Size == detail::packing<Packed>::size) {
+            auto const p = detail::packing<Packed>::encode(values);
+            EXPECT_EQ(0, std::memcmp(&packed[i], &p, sizeof(Packed))) << i;
+        }
+        detail::packing<Packed>::decode(packed[i], expected);
+        for (std::size_t j = 0; j < Size; ++j) {
+            EXPECT_EQ(expected[j], back[i * Size + j]) << i;
+        }
+    }
+}
+
+TEST(Quantized, BufferEncoding)
+{
+    check_buffer_encoding<octahedral<std::int16_t>, 3>(1);
+    check_buffer_encoding<octahedral<std::int8_t>, 3>(100);
+    check_buffer_encoding<snorm_vector<std::int16_t, 3>, 3>(33);
+    check_buffer_encoding<snorm_10_10_10_2, 3>(17);
+    check_buffer_encoding<snorm_10_10_10_2, 4>(64);
+    check_buffer_encoding<smallest_three<>, 4>(250);
+    check_buffer_encoding<smallest_three<std::uint64_t>, 4>(15);
+
+    std::vector<octahedral<std::int16_t>> packed(10);
+    std::vector<float>                    dst(9 * 3);
+    EXPECT_THROW(decode_values(packed.data(), packed.size(),
+                               memory_vector_view<float*, 3>{dst.data(), dst.size()}),
+                 std::runtime_error);
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
@@ -0,0 +1,269 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * random_samplers_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/random_samplers.hpp>
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using vector2f = vector<float, 2>;
+using vector3f = vector<float, 3>;
+using vector2d = vector<double, 2>;
+using vector3d = vector<double, 3>;
+
+namespace {
+
+constexpr std::size_t sample_count = 20000;
+random_stream const   stream{2026, 10};
+
+template <typename Sampler>
+std::vector<typename Sampler::result_type>
+make_samples(Sampler const& sampler)
+{
+    std::vector<typename Sampler::result_type> samples(sample_count);
+    fill_samples(samples.data(), samples.size(), sampler, stream, 3, parallel_options{3, 1, 100});
+    for (std::size_t i = 0; i < samples.size(); i += 97) {
+        EXPECT_EQ(sample(sampler, stream, 3 + i), samples[i]) << i;
+    }
+    return samples;
+}
+
+template <typename T, std::size_t Size>
+vector<double, Size>
+mean(std::vector<vector<T, Size>> const& samples)
+{
+    vector<double, Size> sum;
+    for (auto const& s : samples) {
+        for (std::size_t i = 0; i < Size; ++i) {
+            sum[i] += s[i];
+        }
+    }
+    return sum / samples.size();
+}
+
+}    // namespace
+
+TEST(Sampler, Disk)
+{
+    auto const samples = make_samples(unit_disk_sampler<float>{});
+    std::size_t inner   = 0;
+    for (auto const& s : samples) {
+        auto mag = magnitude(s);
+        EXPECT_GE(1.0f, mag);
+        inner += mag < 0.5f;
+    }
+    EXPECT_NEAR(0.25, double(inner) / samples.size(), 0.02);
+    auto const m = mean(samples);
+    EXPECT_NEAR(0, m.x(), 0.02);
+    EXPECT_NEAR(0, m.y(), 0.02);
+}
+
+TEST(Sampler, Sphere)
+{
+    auto const samples = make_samples(unit_sphere_sampler<double>{});
+    std::size_t upper   = 0;
+    for (auto const& s : samples) {
+        EXPECT_NEAR(1, magnitude(s), 1e-12);
+        upper += s.z() > 0.5;
+    }
+    // The area of a spherical cap is proportional to its height
+    EXPECT_NEAR(0.25, double(upper) / samples.size(), 0.02);
+    auto const m = mean(samples);
+    EXPECT_NEAR(0, m.x(), 0.02);
+    EXPECT_NEAR(0, m.y(), 0.02);
+    EXPECT_NEAR(0, m.z(), 0.02);
+}
+
+TEST(Sampler, Ball)
+{
+    auto const samples = make_samples(unit_ball_sampler<float>{});
+    std::size_t inner   = 0;
+    for (auto const& s : samples) {
+        auto mag = magnitude(s);
+        EXPECT_GE(1.0f + 1e-6f, mag);
+        inner += mag < 0.5f;
+    }
+    EXPECT_NEAR(0.125, double(inner) / samples.size(), 0.01);
+    auto const m = mean(samples);
+    EXPECT_NEAR(0, m.x(), 0.02);
+    EXPECT_NEAR(0, m.y(), 0.02);
+    EXPECT_NEAR(0, m.z(), 0.02);
+}
+
+TEST(Sampler, Cone)
+{
+    for (auto axis : {vector3d{0, 0, 1}, vector3d{0, 0, -2}, vector3d{1, 2, 3}}) {
+        cone_sampler<double> sampler{axis, 0.3};
+        auto const           samples = make_samples(sampler);
+        vector3d const       unit    = normalize(axis);
+        std::size_t          inner   = 0;
+        for (auto const& s : samples) {
+            EXPECT_NEAR(1, magnitude(s), 1e-12);
+            auto cos_angle = dot_product(s, unit);
+            EXPECT_LE(std::cos(0.3) - 1e-12, cos_angle);
+            inner += cos_angle > std::cos(0.15);
+        }
+        // Solid angle of a cone is proportional to 1 - cos(half_angle)
+        EXPECT_NEAR((1 - std::cos(0.15)) / (1 - std::cos(0.3)), double(inner) / samples.size(),
+                    0.02);
+        vector3d const m = normalize(mean(samples));
+        EXPECT_NEAR(1, dot_product(m, unit), 1e-4) << axis;
+    }
+    EXPECT_THROW((cone_sampler<float>{vector3f{0, 0, 0}, 0.1f}), std::invalid_argument);
+}
+
+TEST(Sampler, Rotation)
+{
+    auto const quaternions = make_samples(rotation_sampler<double>{});
+    auto const matrices    = make_samples(rotation_matrix_sampler<double>{});
+    vector3d   sum;
+    for (std::size_t i = 0; i < sample_count; ++i) {
+        EXPECT_NEAR(1, magnitude(quaternions[i]), 1e-12);
+        auto const& m = matrices[i];
+        for (std::size_t r = 0; r < 3; ++r) {
+            for (std::size_t c = 0; c < 3; ++c) {
+                EXPECT_NEAR(r == c ? 1 : 0, dot_product(m[r], m[c]), 1e-12);
+            }
+        }
+        // Right handed
+        auto const& a = m[0];
+        auto const& b = m[1];
+        auto const& c = m[2];
+        EXPECT_NEAR(1,
+                    a[0] * (b[1] * c[2] - b[2] * c[1]) - a[1] * (b[0] * c[2] - b[2] * c[0])
+                        + a[2] * (b[0] * c[1] - b[1] * c[0]),
+                    1e-12);
+
+        // Same rotation as the quaternion
+        auto const& q       = quaternions[i];
+        vector3d    v{1, 2, 3};
+        auto rotated = (q * quaternion<double>{0, v.x(), v.y(), v.z()} * conjugate(q));
+        vector3d    by_q{rotated.x(), rotated.y(), rotated.z()};
+        vector3d    by_m = expr::col<0>(m * v);
+        for (std::size_t j = 0; j < 3; ++j) {
+            EXPECT_NEAR(by_q[j], by_m[j], 1e-12);
+        }
+        sum += by_m;
+    }
+    // Uniform rotations leave no preferred direction
+    EXPECT_NEAR(0, magnitude(sum / double(sample_count)), 0.1);
+}
+
+TEST(Sampler, FillView)
+{
+    std::vector<float> buffer(3000);
+    auto               view = make_memory_vector_view<vector3f>(buffer.data(), buffer.size());
+    fill_samples(view, unit_sphere_sampler<float>{}, stream, 0, parallel_options{2, 1, 10});
+    for (std::size_t i = 0; i < view.size(); ++i) {
+        vector3f v = view[i];
+        EXPECT_EQ(sample(unit_sphere_sampler<float>{}, stream, i), v);
+    }
+}
+
+TEST(Sequence, Halton)
+{
+    halton_sequence<double, 3> seq;
+    EXPECT_EQ((vector3d{0, 0, 0}), seq[0]);
+    EXPECT_NEAR(0.5, seq[1].x(), 1e-15);
+    EXPECT_NEAR(1. / 3, seq[1].y(), 1e-15);
+    EXPECT_NEAR(0.2, seq[1].z(), 1e-15);
+    EXPECT_NEAR(0.25, seq[2].x(), 1e-15);
+    EXPECT_NEAR(2. / 3, seq[2].y(), 1e-15);
+    EXPECT_NEAR(0.75, seq[3].x(), 1e-15);
+    EXPECT_NEAR(1. / 9, seq[3].y(), 1e-15);
+    EXPECT_NEAR(0.6, seq[3].z(), 1e-15);
+
+    std::vector<vector3d> points(1000);
+    fill_sequence(points.data(), points.size(), seq, 7, parallel_options{3, 1, 10});
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        EXPECT_EQ(seq[i + 7], points[i]);
+    }
+}
+
+TEST(Sequence, Sobol)
+{
+    sobol_sequence<double, 2> seq;
+    EXPECT_EQ(0, seq[0].x());
+    EXPECT_EQ(0.5, seq[1].x());
+    EXPECT_EQ(0.5, seq[1].y());
+    EXPECT_EQ(0.25, seq[2].x());
+    EXPECT_EQ(0.75, seq[2].y());
+    EXPECT_EQ(0.75, seq[3].x());
+    EXPECT_EQ(0.25, seq[3].y());
+
+    // First 2^m points of the first two dimensions are a (0, m, 2)-net: every elementary interval
+    // of volume 2^-m holds one point
+    constexpr std::size_t m = 10;
+    std::vector<vector2f> points(1 << m);
+    fill_sequence(points.data(), points.size(), sobol_sequence<float, 2>{},
+                  0, parallel_options{3, 1, 10});
+    for (std::size_t a = 0; a <= m; ++a) {
+        std::set<std::pair<std::size_t, std::size_t>> boxes;
+        for (auto const& p : points) {
+            boxes.emplace(std::size_t(p.x() * (1 << a)), std::size_t(p.y() * (1 << (m - a))));
+        }
+        EXPECT_EQ(points.size(), boxes.size()) << a;
+    }
+
+    // All eight dimensions, also scrambled, are stratified
+    for (auto const& s : {sobol_sequence<float, 8>{}, sobol_sequence<float, 8>{stream}}) {
+        std::vector<vector<float, 8>> points8(1 << m);
+        fill_sequence(points8.data(), points8.size(), s, 0, parallel_options{3, 1, 10});
+        for (std::size_t d = 0; d < 8; ++d) {
+            std::set<std::size_t> cells;
+            for (std::size_t i = 0; i < points8.size(); ++i) {
+                EXPECT_EQ(s[i], points8[i]);
+                cells.insert(std::size_t(points8[i][d] * (1 << m)));
+            }
+            EXPECT_EQ(points8.size(), cells.size()) << d;
+        }
+    }
+    EXPECT_NE((sobol_sequence<float, 8>{}[5]), (sobol_sequence<float, 8>{stream}[5]));
+    EXPECT_THROW(seq[std::uint64_t{1} << 32], std::out_of_range);
+
+    // The last points of the sequence can be generated, a range past them is rejected up front
+    auto const  last   = (std::uint64_t{1} << 32) - 2;
+    std::size_t stored = 0;
+    seq.generate(last, 2, [&](std::size_t i, vector2d const& p) {
+        EXPECT_EQ(seq[last + i], p);
+        ++stored;
+    });
+    EXPECT_EQ(2, stored);
+    stored = 0;
+    EXPECT_THROW(seq.generate(last, 3, [&](std::size_t, vector2d const&) { ++stored; }),
+                 std::out_of_range);
+    EXPECT_EQ(0, stored);
+}
+
+TEST(Sequence, Stratified)
+{
+    stratified_sequence<float> seq{8, 4, stream};
+    std::vector<float>         buffer(32 * 2 * 2);
+    auto view = make_memory_vector_view<vector2f>(buffer.data(), buffer.size());
+    fill_sequence(view, seq);
+    for (std::size_t i = 0; i < view.size(); ++i) {
+        vector2f p = view[i];
+        EXPECT_EQ(seq[i], p);
+        EXPECT_EQ(i % 8, std::size_t(p.x() * 8)) << i;
+        EXPECT_EQ(i % 32 / 8, std::size_t(p.y() * 4)) << i;
+    }
+    vector2f first  = view[0];
+    vector2f second = view[32];
+    EXPECT_NE(first, second);
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
@@ -12,7 +12,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
 #include <sstream>
+#include <vector>
 
 namespace psst {
 namespace math {
@@ -70,6 +72,126 @@ TEST(Matrix, RandomMatrix)
     std::cout << io::ugly;
 }
 
+TEST(Random, Philox)
+{
+    // Known answers from the Random123 distribution
+    using counter = philox4x32::counter_type;
+    using key     = philox4x32::key_type;
+    EXPECT_EQ((counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}),
+              philox4x32::generate({0, 0, 0, 0}, {0, 0}));
+    EXPECT_EQ((counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}),
+              philox4x32::generate({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                                   key{0xffffffff, 0xffffffff}));
+    EXPECT_EQ((counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}),
+              philox4x32::generate({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+                                   key{0xa4093822, 0x299f31d0}));
+    static_assert(philox4x32::generate({0, 0, 0, 0}, {0, 0})[0] == 0x6627e8d5,
+                  "Philox is computed at compile time");
+}
+
+TEST(Random, PhiloxEngine)
+{
+    random_stream stream{42, 7};
+    philox_engine e1{42, 7};
+    for (std::uint64_t i = 0; i < 5; ++i) {
+        auto bits = stream.bits(i);
+        for (auto w : bits) {
+            EXPECT_EQ(w, e1());
+        }
+    }
+
+    philox_engine e2{42, 7};
+    e2.discard(3);
+    philox_engine e3{42, 7};
+    for (int i = 0; i < 3; ++i) {
+        e3();
+    }
+    EXPECT_EQ(e3, e2);
+    EXPECT_EQ(e3(), e2());
+    e2.discard(10);
+    for (int i = 0; i < 10; ++i) {
+        e3();
+    }
+    EXPECT_EQ(e3(), e2());
+    EXPECT_NE(philox_engine(42, 8)(), philox_engine(42, 7)());
+
+    std::uniform_real_distribution<double> dist{0, 1};
+    auto                                   val = dist(e1);
+    EXPECT_LE(0, val);
+    EXPECT_GT(1, val);
+
+    vector3d v = random_vector_data<double, std::uniform_real_distribution<double>, philox_engine>(
+        std::uniform_real_distribution<double>{0, 1});
+    EXPECT_NE(0, magnitude_square(v));
+}
+
+TEST(Random, CounterVector)
+{
+    auto gen = random_vector_data<double>(counter_uniform_distribution<double>{-1, 1}, {42, 1});
+    vector4d v1 = gen;
+    vector4d v2 = gen;
+    EXPECT_EQ(v1, v2);
+    for (std::size_t i = 0; i < 4; ++i) {
+        EXPECT_LE(-1, v1[i]);
+        EXPECT_GT(1, v1[i]);
+    }
+    vector3d v3 = gen.advance(1);
+    EXPECT_EQ(v1[1], v3[0]);
+    EXPECT_EQ(v1[3], v3[2]);
+
+    vector4d other_stream
+        = random_vector_data<double>(counter_uniform_distribution<double>{-1, 1}, {42, 2});
+    EXPECT_NE(v1, other_stream);
+
+    matrix3x4d m = random_matrix_data<double>(counter_uniform_distribution<double>{-1, 1}, {42, 1});
+    EXPECT_EQ(v1, m[0]);
+    EXPECT_NE(m[0], m[1]);
+    EXPECT_NE(m[1], m[2]);
+}
+
+TEST(Random, FillRandom)
+{
+    counter_normal_distribution<float> dist{1, 2};
+    random_stream                      stream{2019, 3};
+
+    constexpr std::size_t count = 100003;
+    std::vector<float>    single(count);
+    std::vector<float>    threaded(count);
+    fill_random(single.data(), count, dist, stream, 5, parallel_options::single_thread());
+    fill_random(threaded.data(), count, dist, stream, 5, parallel_options{4, 1, 1000});
+    EXPECT_EQ(single, threaded);
+
+    double sum = 0, sum_sq = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(stream.sample(dist, 5 + i), single[i]) << i;
+        sum += single[i];
+        sum_sq += single[i] * single[i];
+    }
+    auto mean     = sum / count;
+    auto variance = sum_sq / count - mean * mean;
+    EXPECT_NEAR(1, mean, 0.05);
+    EXPECT_NEAR(4, variance, 0.1);
+
+    std::vector<vector3f> vectors(1001);
+    fill_random(vectors.data(), vectors.size(), dist, stream, 0, parallel_options{3, 1, 10});
+    auto gen = random_vector_data<float>(dist, stream);
+    for (std::size_t i = 0; i < vectors.size(); ++i) {
+        vector3f expected = gen.advance(i * 3);
+        EXPECT_EQ(expected, vectors[i]) << i;
+    }
+    std::vector<float> flat(vectors.size() * 3);
+    fill_random(make_memory_vector_view<vector3f>(flat.data(), flat.size()), dist, stream);
+    EXPECT_EQ(0, std::memcmp(flat.data(), vectors.data(), flat.size() * sizeof(float)));
+
+    std::vector<matrix4x3f> matrices(333);
+    fill_random(matrices.data(), matrices.size(), dist, stream, 0, parallel_options{3, 1, 10});
+    auto mgen = random_matrix_data<float>(dist, stream);
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        matrix4x3f expected = mgen.advance(i * 3);
+        EXPECT_EQ(expected, matrices[i]) << i;
+    }
+}
+
 }    // namespace test
 }    // namespace math
 }    // namespace psst
@@ -0,0 +1,192 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * simd_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/matrix.hpp>
+#include <psst/math/simd.hpp>
+#include <psst/math/vector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using float8   = simd<float, 8>;
+using double4  = simd<double, 4>;
+using vector3f = vector<float, 3>;
+using vector3p = vector<float8, 3>;
+using matrix3f = matrix<float, 3, 3>;
+using matrix3p = matrix<float8, 3, 3>;
+
+namespace {
+
+std::vector<vector3f>
+make_vectors(float seed)
+{
+    std::vector<vector3f> res;
+    for (std::size_t i = 0; i < float8::lanes; ++i) {
+        float t = static_cast<float>(i) + seed;
+        res.push_back(vector3f{std::sin(t * 1.3f) * 2, std::cos(t * 0.7f) + 1.5f, std::sin(t)});
+    }
+    return res;
+}
+
+}    // namespace
+
+TEST(SimdPack, Arithmetic)
+{
+    float lanes[]{1, -2, 3, -4, 5, -6, 7, -8};
+    auto  v = float8::load(lanes);
+    auto  r = v * 2 - float8{1};
+    for (std::size_t i = 0; i < float8::lanes; ++i) {
+        EXPECT_EQ(lanes[i] * 2 - 1, r[i]);
+        EXPECT_EQ(std::abs(lanes[i]), abs(v)[i]);
+    }
+
+    auto positive = v > 0;
+    for (std::size_t i = 0; i < float8::lanes; ++i) {
+        EXPECT_EQ(lanes[i] > 0, positive[i]);
+        EXPECT_EQ(lanes[i] > 0 ? lanes[i] : 0, select(positive, v, 0)[i]);
+    }
+    EXPECT_TRUE(any_lane(positive));
+    EXPECT_FALSE(all_lanes(positive));
+    EXPECT_TRUE(all_lanes(positive || !positive));
+    EXPECT_FALSE(any_lane(positive && !positive));
+    EXPECT_TRUE(all_lanes(abs(sqrt(v * v) - abs(v)) < 1e-6f * abs(v)));
+
+    float stored[8];
+    (v / 2).store(stored);
+    for (std::size_t i = 0; i < float8::lanes; ++i) {
+        EXPECT_EQ(lanes[i] / 2, stored[i]);
+    }
+}
+
+TEST(SimdPack, Compare)
+{
+    double4 v{1.0};
+    double4 w = v;
+    w[2] += 1e-20;
+    EXPECT_TRUE(traits::value_traits_t<double4>::eq(v, w));
+    EXPECT_EQ(0, traits::value_traits_t<double4>::cmp(v, w));
+    w[1] = 2;
+    EXPECT_FALSE(traits::value_traits_t<double4>::eq(v, w));
+    EXPECT_TRUE(traits::value_traits_t<double4>::less(v, w));
+    EXPECT_TRUE(traits::value_traits_t<double4>::eq_lanes(v, w)[0]);
+    EXPECT_FALSE(traits::value_traits_t<double4>::eq_lanes(v, w)[1]);
+
+    vector<double4, 3> a{v, v, v};
+    vector<double4, 3> b{v, w, v};
+    EXPECT_TRUE(a == a);
+    EXPECT_TRUE(a != b);
+    EXPECT_TRUE(a < b);
+}
+
+TEST(SimdPack, VectorExpressions)
+{
+    auto const a  = make_vectors(0);
+    auto const b  = make_vectors(0.5f);
+    auto const pa = load_lanes<float8::lanes>(a.data());
+    auto const pb = load_lanes<float8::lanes>(b.data());
+
+    vector3p cross_p = pa * pb;
+    float8   dot_p   = dot(pa, pb);
+    vector3p sum_p   = pa + pb * 2;
+    vector3p norm_p  = normalize(pa);
+    float8   mag_p   = magnitude(pa - pb);
+    vector3p in_place{pa};
+    in_place.normalize();
+
+    std::vector<vector3f> crosses(a.size());
+    store_lanes(cross_p, crosses.data());
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        vector3f cross_s = a[i] * b[i];
+        vector3f sum_s   = a[i] + b[i] * 2;
+        vector3f norm_s  = normalize(a[i]);
+        EXPECT_EQ(cross_s, crosses[i]);
+        EXPECT_FLOAT_EQ(dot(a[i], b[i]), dot_p[i]);
+        EXPECT_EQ(sum_s, lane(sum_p, i));
+        EXPECT_EQ(norm_s, lane(norm_p, i));
+        EXPECT_EQ(norm_s, lane(in_place, i));
+        EXPECT_FLOAT_EQ(magnitude(a[i] - b[i]), mag_p[i]);
+    }
+    EXPECT_TRUE(all_lanes(abs(in_place.magnitude() - 1) < 1e-6f));
+    EXPECT_FALSE(in_place.is_zero());
+
+    vector3p zero_lane{pa};
+    zero_lane[0][3] = zero_lane[1][3] = zero_lane[2][3] = 0;
+    EXPECT_THROW(zero_lane.normalize(), std::runtime_error);
+}
+
+TEST(SimdPack, Slerp)
+{
+    auto a = make_vectors(0);
+    auto b = make_vectors(0.5f);
+    // Collinear and perpendicular lanes take other branches of the scalar slerp
+    b[2] = a[2] * 3;
+    a[5] = vector3f{1, 0, 0};
+    b[5] = vector3f{0, 2, 0};
+    auto const pa = load_lanes<float8::lanes>(a.data());
+    auto const pb = load_lanes<float8::lanes>(b.data());
+
+    vector3p res = slerp(pa, pb, 0.25f);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        vector3f expected = slerp(a[i], b[i], 0.25f);
+        vector3f actual   = lane(res, i);
+        for (std::size_t c = 0; c < 3; ++c) {
+            EXPECT_NEAR(expected[c], actual[c], 1e-5f) << i << " " << expected << " " << actual;
+        }
+    }
+
+    // Opposite vectors in one of the lanes
+    vector<double4, 3> start{double4{1}, double4{0}, double4{0}};
+    vector<double4, 3> end{start};
+    end[1]    = double4{1};
+    end[1][2] = 0;
+    end[0][2] = -1;
+    EXPECT_NO_THROW(slerp(start, start, 0.5));
+    EXPECT_THROW(slerp(start, end, 0.5), std::runtime_error);
+}
+
+TEST(SimdPack, MatrixMultiply)
+{
+    std::vector<matrix3f> ms;
+    matrix3p              mp;
+    for (std::size_t l = 0; l < float8::lanes; ++l) {
+        matrix3f m;
+        for (std::size_t r = 0; r < 3; ++r) {
+            for (std::size_t c = 0; c < 3; ++c) {
+                m[r][c]     = static_cast<float>(r * 3 + c + l) - 4;
+                mp[r][c][l] = m[r][c];
+            }
+        }
+        ms.push_back(m);
+    }
+    auto const v  = make_vectors(0);
+    auto const pv = load_lanes<float8::lanes>(v.data());
+
+    matrix3p             squared     = mp * mp;
+    matrix<float8, 3, 1> transformed = mp * pv;
+    for (std::size_t l = 0; l < float8::lanes; ++l) {
+        matrix3f            squared_s     = ms[l] * ms[l];
+        matrix<float, 3, 1> transformed_s = ms[l] * v[l];
+        for (std::size_t r = 0; r < 3; ++r) {
+            for (std::size_t c = 0; c < 3; ++c) {
+                EXPECT_EQ(squared_s[r][c], squared[r][c][l]);
+            }
+            EXPECT_NEAR(transformed_s[r][0], transformed[r][0][l], 1e-5f);
+        }
+    }
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
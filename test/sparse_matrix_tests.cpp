@@ -0,0 +1,281 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * sparse_matrix_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/sparse_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using block3   = matrix<double, 3, 3>;
+using vector3d = vector<double, 3>;
+
+static_assert(std::is_same<block_sparse_matrix<double, 3>::vector_type, vector3d>{}, "");
+static_assert(block_sparse_matrix<float, 3>::block_size == 3, "");
+
+namespace {
+
+/** Laplacian of a grid of width x height nodes with a unit diagonal shift */
+template <typename T>
+sparse_matrix<T>
+make_laplacian(std::size_t width, std::size_t height)
+{
+    sparse_matrix_builder<T> builder{width * height, width * height};
+    for (std::size_t y = 0; y < height; ++y) {
+        for (std::size_t x = 0; x < width; ++x) {
+            auto const i = y * width + x;
+            builder.add(i, i, T(1));
+            // The contributions of the edges, summed by the builder
+            if (x + 1 < width) {
+                builder.add(i, i, T(1));
+                builder.add(i + 1, i + 1, T(1));
+                builder.add(i, i + 1, T(-1));
+                builder.add(i + 1, i, T(-1));
+            }
+            if (y + 1 < height) {
+                builder.add(i, i, T(1));
+                builder.add(i + width, i + width, T(1));
+                builder.add(i, i + width, T(-1));
+                builder.add(i + width, i, T(-1));
+            }
+        }
+    }
+    return builder.build();
+}
+
+template <typename T>
+std::vector<T>
+make_values(std::size_t count)
+{
+    std::vector<T> res(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        res[i] = T(std::sin(i * 0.37) + 0.5);
+    }
+    return res;
+}
+
+}    // namespace
+
+TEST(SparseMatrix, Build)
+{
+    sparse_matrix_builder<float> builder{3, 4};
+    builder.add(2, 3, 1);
+    builder.add(0, 1, 2);
+    builder.add(2, 0, 3);
+    builder.add(0, 1, 0.5);
+    builder.add(1, 2, 4);
+    EXPECT_THROW(builder.add(3, 0, 1), std::out_of_range);
+    EXPECT_THROW(builder.add(0, 4, 1), std::out_of_range);
+    EXPECT_EQ(5, builder.size());
+
+    auto a = builder.build();
+    EXPECT_EQ(3, a.rows());
+    EXPECT_EQ(4, a.cols());
+    EXPECT_EQ(4, a.nonzero_count());
+    EXPECT_EQ((std::vector<std::size_t>{0, 1, 2, 4}), a.row_offsets());
+    EXPECT_EQ((std::vector<std::uint32_t>{1, 2, 0, 3}), a.col_indexes());
+    EXPECT_EQ((std::vector<float>{2.5, 4, 3, 1}), a.values());
+    EXPECT_EQ(2.5, a(0, 1));
+    EXPECT_EQ(0, a(0, 0));
+    EXPECT_EQ(0, a(5, 5));
+    EXPECT_EQ((std::vector<float>{0, 0, 0}), a.diagonal());
+
+    // Assembly into the same structure
+    a.fill(0);
+    a.at(2, 3) += 5;
+    EXPECT_EQ(5, a(2, 3));
+    EXPECT_THROW(a.at(1, 1), std::out_of_range);
+
+    // More triplets are added to the builder
+    builder.add(1, 1, 7);
+    EXPECT_EQ(7, builder.build()(1, 1));
+    EXPECT_EQ(5, builder.build().nonzero_count());
+    builder.clear();
+    EXPECT_EQ(0, builder.build().nonzero_count());
+
+    EXPECT_THROW((sparse_matrix<float>{2, 2, {0, 2, 2}, {1, 0}, {1, 1}}), std::runtime_error);
+    EXPECT_THROW((sparse_matrix<float>{2, 2, {0, 1}, {0}, {1}}), std::runtime_error);
+}
+
+TEST(SparseMatrix, Multiply)
+{
+    std::size_t const width  = 37;
+    std::size_t const height = 23;
+    auto const        a      = make_laplacian<double>(width, height);
+    auto const        x      = make_values<double>(a.cols());
+    EXPECT_EQ(width * height * 5 - 2 * (width + height), a.nonzero_count());
+
+    std::vector<double> expected(a.rows());
+    for (std::size_t r = 0; r < a.rows(); ++r) {
+        for (std::size_t c = 0; c < a.cols(); ++c) {
+            expected[r] += a(r, c) * x[c];
+        }
+    }
+    auto const y = a * x;
+    ASSERT_EQ(a.rows(), y.size());
+    for (std::size_t r = 0; r < a.rows(); ++r) {
+        EXPECT_NEAR(expected[r], y[r], 1e-12) << r;
+    }
+    EXPECT_THROW(a * std::vector<double>(3), std::runtime_error);
+
+    // The same sums in any number of threads
+    std::vector<double> parallel(a.rows());
+    multiply(a, x.data(), parallel.data(), parallel_options{4, 1, 1});
+    EXPECT_EQ(y, parallel);
+
+    // The Laplacian is symmetric
+    std::vector<double> transposed(a.cols());
+    multiply_transposed(columns(a), x.data(), transposed.data(), parallel_options{3, 1, 1});
+    for (std::size_t r = 0; r < a.rows(); ++r) {
+        EXPECT_NEAR(y[r], transposed[r], 1e-12) << r;
+    }
+}
+
+TEST(SparseMatrix, Columns)
+{
+    sparse_matrix_builder<float> builder{3, 2};
+    builder.add(0, 1, 1);
+    builder.add(1, 0, 2);
+    builder.add(2, 1, 3);
+    auto const a    = builder.build();
+    auto const cols = columns(a);
+    EXPECT_EQ(2, cols.cols());
+    EXPECT_EQ((std::vector<std::size_t>{0, 1, 3}), cols.col_offsets());
+    EXPECT_EQ((std::vector<std::uint32_t>{1, 0, 2}), cols.row_indexes());
+    EXPECT_EQ((std::vector<std::size_t>{1, 0, 2}), cols.positions());
+
+    std::vector<float> const x{1, 2, 3};
+    std::vector<float>       y(2);
+    multiply_transposed(cols, x.data(), y.data());
+    EXPECT_EQ((std::vector<float>{4, 10}), y);
+}
+
+TEST(SparseMatrix, Blocks)
+{
+    // A block matrix and the same matrix of scalars
+    std::size_t const             n = 20;
+    sparse_matrix_builder<block3> blocks{n, n};
+    sparse_matrix_builder<double> scalars{n * 3, n * 3};
+    for (std::size_t i = 0; i < n; ++i) {
+        for (auto j : {i, (i + 7) % n, (i * 3 + 1) % n}) {
+            block3 b;
+            for (std::size_t r = 0; r < 3; ++r) {
+                for (std::size_t c = 0; c < 3; ++c) {
+                    b[r][c] = std::cos(i + j * 0.5 + r * 0.3 + c * 0.7);
+                    scalars.add(i * 3 + r, j * 3 + c, b[r][c]);
+                }
+            }
+            blocks.add(i, j, b);
+        }
+    }
+    auto const a = blocks.build();
+    auto const s = scalars.build();
+    EXPECT_EQ(s.nonzero_count(), a.nonzero_count() * 9);
+
+    auto const            values = make_values<double>(n * 3);
+    std::vector<vector3d> x(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = vector3d{values[i * 3], values[i * 3 + 1], values[i * 3 + 2]};
+    }
+    auto const            y        = a * x;
+    auto const            expected = s * values;
+    std::vector<vector3d> transposed(n);
+    std::vector<double>   expected_transposed(n * 3);
+    multiply_transposed(columns(a), x.data(), transposed.data());
+    multiply_transposed(columns(s), values.data(), expected_transposed.data());
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            EXPECT_NEAR(expected[i * 3 + c], y[i][c], 1e-12) << i;
+            EXPECT_NEAR(expected_transposed[i * 3 + c], transposed[i][c], 1e-12) << i;
+        }
+    }
+}
+
+TEST(SparseMatrix, ConjugateGradient)
+{
+    auto const a = make_laplacian<double>(40, 30);
+    auto const b = make_values<double>(a.rows());
+
+    std::vector<double> x(a.cols());
+    auto const res = conjugate_gradient(a, b.data(), x.data(), {0, 1e-10, {2, 1, 1}});
+    EXPECT_TRUE(res.converged);
+    EXPECT_GT(res.iterations, 0);
+    EXPECT_LE(res.residual, 1e-10);
+    auto const r = a * x;
+    for (std::size_t i = 0; i < r.size(); ++i) {
+        EXPECT_NEAR(b[i], r[i], 1e-8) << i;
+    }
+
+    // Float values, the dot products are accumulated in double
+    auto const         af = make_laplacian<float>(40, 30);
+    std::vector<float> bf(b.begin(), b.end());
+    std::vector<float> xf(af.cols());
+    auto const         resf = conjugate_gradient(af, bf.data(), xf.data());
+    EXPECT_TRUE(resf.converged);
+    for (std::size_t i = 0; i < xf.size(); ++i) {
+        EXPECT_NEAR(x[i], xf[i], 1e-4) << i;
+    }
+
+    // Limited iterations
+    std::fill(x.begin(), x.end(), 0);
+    auto const limited = conjugate_gradient(a, b.data(), x.data(), {3, 1e-10, {}});
+    EXPECT_FALSE(limited.converged);
+    EXPECT_EQ(3, limited.iterations);
+
+    // The zero right hand side
+    std::vector<double> const zero(a.rows());
+    EXPECT_TRUE(conjugate_gradient(a, zero.data(), x.data()).converged);
+    EXPECT_EQ(zero, x);
+
+    sparse_matrix_builder<double> singular{2, 2};
+    singular.add(0, 1, 1);
+    EXPECT_THROW(conjugate_gradient(singular.build(), zero.data(), x.data()), std::runtime_error);
+}
+
+TEST(SparseMatrix, BlockConjugateGradient)
+{
+    // Three independent Laplacians in the components of the blocks
+    std::size_t const             width = 20;
+    auto const                    l     = make_laplacian<double>(width, width);
+    sparse_matrix_builder<block3> builder{l.rows(), l.cols()};
+    for (std::size_t r = 0; r < l.rows(); ++r) {
+        for (auto k = l.row_offsets()[r]; k < l.row_offsets()[r + 1]; ++k) {
+            block3 b;
+            b[0][0] = l.values()[k];
+            b[1][1] = l.values()[k] * 2;
+            b[2][2] = l.values()[k] * 3;
+            builder.add(r, l.col_indexes()[k], b);
+        }
+    }
+    auto const a = builder.build();
+
+    auto const            values = make_values<double>(l.rows() * 3);
+    std::vector<vector3d> b(l.rows());
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        b[i] = vector3d{values[i * 3], values[i * 3 + 1], values[i * 3 + 2]};
+    }
+    std::vector<vector3d> x(l.rows());
+    auto const            res = conjugate_gradient(a, b.data(), x.data(), {0, 1e-10, {}});
+    EXPECT_TRUE(res.converged);
+    auto const r = a * x;
+    for (std::size_t i = 0; i < r.size(); ++i) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            EXPECT_NEAR(b[i][c], r[i][c], 1e-8) << i;
+        }
+    }
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
@@ -0,0 +1,156 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * structured_matrix_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/structured_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+namespace psst {
+namespace math {
+namespace test {
+
+using matrix4     = matrix<float, 4, 4>;
+using vector4     = vector<float, 4>;
+using diagonal4   = diagonal_matrix<float, 4>;
+using lower4      = lower_triangular_matrix<float, 4>;
+using upper4      = upper_triangular_matrix<float, 4>;
+using symmetric4  = symmetric_matrix<float, 4>;
+using tridiagonal = banded_matrix<float, 4, 1, 1>;
+
+static_assert(sizeof(diagonal4) == 4 * sizeof(float), "");
+static_assert(sizeof(lower4) == 10 * sizeof(float), "");
+static_assert(sizeof(upper4) == 10 * sizeof(float), "");
+static_assert(sizeof(symmetric4) == 10 * sizeof(float), "");
+static_assert(sizeof(tridiagonal) == 10 * sizeof(float), "");
+static_assert(banded_matrix<float, 5, 2, 0>::packed_size == 12, "");
+static_assert(traits::is_matrix_expression_v<symmetric4>, "");
+
+// The bandwidths of the expressions
+static_assert(matrix4::lower_bandwidth == 3 && matrix4::upper_bandwidth == 3, "");
+static_assert(decltype(transpose(std::declval<lower4>()))::upper_bandwidth == 3, "");
+static_assert(decltype(transpose(std::declval<lower4>()))::lower_bandwidth == 0, "");
+static_assert(decltype(std::declval<tridiagonal>() * std::declval<tridiagonal>())::lower_bandwidth
+                  == 2,
+              "");
+static_assert(decltype(std::declval<lower4>() * std::declval<diagonal4>())::upper_bandwidth == 0,
+              "");
+static_assert(decltype(std::declval<lower4>() + std::declval<upper4>())::upper_bandwidth == 3, "");
+static_assert(decltype(std::declval<diagonal4>() * 2.0f)::lower_bandwidth == 0, "");
+
+namespace {
+
+matrix4 const dense{{1, 2, -3, 4}, {-5, 6, 7, 8}, {9, -10, 11, 12}, {13, 14, -15, 16}};
+
+lower4 const lower{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+upper4 const upper{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+diagonal4 const   diagonal{2, -3, 4, 5};
+symmetric4 const  symmetric{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+tridiagonal const tri{2, -1, -1, 2, -1, -1, 2, -1, -1, 2};
+
+template <typename Expr>
+matrix4
+to_dense(Expr const& m)
+{
+    return m;
+}
+
+}    // namespace
+
+TEST(StructuredMatrix, Elements)
+{
+    EXPECT_EQ((matrix4{{1, 0, 0, 0}, {2, 3, 0, 0}, {4, 5, 6, 0}, {7, 8, 9, 10}}), to_dense(lower));
+    EXPECT_EQ((matrix4{{1, 2, 3, 4}, {0, 5, 6, 7}, {0, 0, 8, 9}, {0, 0, 0, 10}}), to_dense(upper));
+    EXPECT_EQ((matrix4{{1, 2, 4, 7}, {2, 3, 5, 8}, {4, 5, 6, 9}, {7, 8, 9, 10}}),
+              to_dense(symmetric));
+    EXPECT_EQ((matrix4{{2, 0, 0, 0}, {0, -3, 0, 0}, {0, 0, 4, 0}, {0, 0, 0, 5}}),
+              to_dense(diagonal));
+    EXPECT_EQ((matrix4{{2, -1, 0, 0}, {-1, 2, -1, 0}, {0, -1, 2, -1}, {0, 0, -1, 2}}),
+              to_dense(tri));
+    EXPECT_EQ(to_dense(transpose(lower)), to_dense(upper4{transpose(lower)}));
+    EXPECT_EQ(matrix4::identity(), to_dense(diagonal4(1)));
+
+    symmetric4 s;
+    s.element<0, 3>() = 5;
+    EXPECT_EQ(5, (s.element<3, 0>()));
+    EXPECT_EQ(0, (s.element<0, 2>()));
+
+    // The elements outside of the structure are dropped
+    EXPECT_EQ((matrix4{{1, 0, 0, 0}, {-5, 6, 0, 0}, {9, -10, 11, 0}, {13, 14, -15, 16}}),
+              to_dense(lower4{dense}));
+    EXPECT_EQ((matrix4{{1, -5, 0, 0}, {-5, 6, -10, 0}, {0, -10, 11, -15}, {0, 0, -15, 16}}),
+              to_dense(symmetric4{banded_matrix<float, 4, 1, 0>{dense}}));
+}
+
+TEST(StructuredMatrix, Products)
+{
+    // Integer values, the products are exact
+    EXPECT_EQ(dense * to_dense(diagonal), to_dense(dense * diagonal));
+    EXPECT_EQ(to_dense(diagonal) * dense, to_dense(diagonal * dense));
+    EXPECT_EQ(to_dense(lower) * dense, to_dense(lower * dense));
+    EXPECT_EQ(dense * to_dense(upper), to_dense(dense * upper));
+    EXPECT_EQ(to_dense(lower) * to_dense(upper), to_dense(lower * upper));
+    EXPECT_EQ(to_dense(upper) * to_dense(lower), to_dense(upper * lower));
+    EXPECT_EQ(to_dense(tri) * to_dense(tri), to_dense(tri * tri));
+    EXPECT_EQ(to_dense(tri) * to_dense(lower), to_dense(tri * lower));
+    EXPECT_EQ(to_dense(symmetric) * dense, to_dense(symmetric * dense));
+    EXPECT_EQ(to_dense(diagonal) * to_dense(symmetric) * to_dense(diagonal),
+              to_dense(diagonal * symmetric * diagonal));
+
+    vector4 const v{1, -2, 3, -4};
+    EXPECT_EQ(to_dense(tri) * v, tri * v);
+    EXPECT_EQ(to_dense(lower) * v, lower * v);
+    EXPECT_EQ(v * to_dense(upper), v * upper);
+
+    // A product of structured matrices is stored in the structure of the result
+    EXPECT_EQ(to_dense(lower) * to_dense(lower), to_dense(lower4{lower * lower}));
+    EXPECT_EQ(to_dense(diagonal) * to_dense(diagonal), to_dense(diagonal4{diagonal * diagonal}));
+    symmetric4 const cov = dense * transpose(dense);
+    EXPECT_EQ(dense * transpose(dense), to_dense(cov));
+}
+
+TEST(StructuredMatrix, Sums)
+{
+    EXPECT_EQ(to_dense(lower) + to_dense(upper), to_dense(lower + upper));
+    EXPECT_EQ(to_dense(lower) - to_dense(upper), to_dense(lower - upper));
+    EXPECT_EQ(to_dense(diagonal) - to_dense(tri), to_dense(diagonal - tri));
+    EXPECT_EQ(dense + to_dense(diagonal), to_dense(dense + diagonal));
+    EXPECT_EQ(to_dense(symmetric) * 2, to_dense(symmetric4{symmetric + symmetric}));
+    EXPECT_EQ(to_dense(lower) / 2, to_dense(lower4{lower / 2}));
+}
+
+template <typename Matrix>
+void
+check_solve(Matrix const& a)
+{
+    vector4 const b{1, -2, 3, 0.5};
+    vector4 const x = solve(a, b);
+    vector4 const r = as_vector(to_dense(a) * x);
+    for (std::size_t i = 0; i < 4; ++i) {
+        EXPECT_NEAR(b[i], r[i], 1e-5) << i;
+    }
+}
+
+TEST(StructuredMatrix, Solve)
+{
+    check_solve(lower);
+    check_solve(upper);
+    check_solve(diagonal);
+    check_solve(banded_matrix<float, 4, 1, 0>{tri});
+    check_solve(banded_matrix<float, 4, 0, 2>{dense});
+    check_solve(transpose(lower));
+    check_solve(lower * diagonal);
+    check_solve(lower4{dense});
+    EXPECT_EQ((vector4{0.5, -2 / 3.f, 0.75, 0.2f}), solve(diagonal, vector4{1, 2, 3, 1}));
+    EXPECT_EQ((vector<float, 2>{1, 2}),
+              solve(upper_triangular_matrix<float, 2>{1, 1, 2}, vector<float, 2>{3, 4}));
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
@@ -0,0 +1,152 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * summation_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/matrix.hpp>
+#include <psst/math/simd.hpp>
+#include <psst/math/summation.hpp>
+#include <psst/math/vector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+namespace psst {
+namespace math {
+namespace test {
+
+constexpr std::size_t long_vector_size = 512;
+
+using long_vector  = vector<float, long_vector_size, components::none>;
+using vector3f     = vector<float, 3>;
+using matrix4f     = matrix<float, 4, 4>;
+using pairwise     = summation::pairwise<>;
+using compensated  = summation::compensated<>;
+using accumulators = summation::accumulators<>;
+
+namespace {
+
+long_vector
+make_long_vector(double scale)
+{
+    long_vector res;
+    for (std::size_t i = 0; i < long_vector_size; ++i) {
+        res[i] = static_cast<float>(std::sin(i * scale) * (1 + i % 7));
+    }
+    return res;
+}
+
+double
+reference_dot(long_vector const& lhs, long_vector const& rhs)
+{
+    double res = 0;
+    for (std::size_t i = 0; i < long_vector_size; ++i) {
+        res += double(lhs[i]) * double(rhs[i]);
+    }
+    return res;
+}
+
+}    // namespace
+
+TEST(Summation, SmallVectors)
+{
+    vector3f const a{1, 2, 3};
+    vector3f const b{4, -5, 6};
+    EXPECT_EQ(12, dot(a, b));
+    EXPECT_EQ(12, dot(expr::with_policy<pairwise>(a), b));
+    EXPECT_EQ(12, dot(expr::with_policy<compensated>(a), b));
+    EXPECT_EQ(12, dot(expr::with_policy<accumulators>(a), b));
+    EXPECT_EQ(12, dot(expr::with_policy<summation::accumulators<2>>(a), b));
+    EXPECT_EQ(14, magnitude_square(expr::with_policy<pairwise>(a)));
+    EXPECT_EQ(6, element_sum(a));
+    EXPECT_EQ(5, element_sum(expr::with_policy<compensated>(b)));
+
+    vector<int, 5, components::none> const v{1, 2, 3, 4, 5};
+    EXPECT_EQ(15, element_sum(v));
+    EXPECT_EQ(15, element_sum(expr::with_policy<accumulators>(v)));
+    EXPECT_EQ(55, dot(expr::with_policy<pairwise>(v), v));
+}
+
+TEST(Summation, LongDotProduct)
+{
+    auto const a   = make_long_vector(0.37);
+    auto const b   = make_long_vector(1.91);
+    auto const ref = reference_dot(a, b);
+    auto const eps = std::numeric_limits<float>::epsilon();
+
+    float const fold       = dot(a, b);
+    float const pw         = dot(expr::with_policy<pairwise>(a), b);
+    float const comp       = dot(expr::with_policy<compensated>(a), b);
+    float const acc        = dot(expr::with_policy<accumulators>(a), b);
+    float const fast_comp  = dot(expr::with_policy<summation::compensated<fast_math>>(a), b);
+    float const fast_accum = dot(expr::with_policy<summation::accumulators<8, fast_math>>(a), b);
+
+    // The sum of the absolute values of the terms bounds the error of a summation
+    double abs_sum = 0;
+    for (std::size_t i = 0; i < long_vector_size; ++i) {
+        abs_sum += std::abs(double(a[i]) * double(b[i]));
+    }
+    EXPECT_NEAR(ref, fold, long_vector_size * eps * abs_sum);
+    EXPECT_NEAR(ref, acc, long_vector_size * eps * abs_sum);
+    EXPECT_NEAR(ref, fast_accum, long_vector_size * eps * abs_sum);
+    EXPECT_NEAR(ref, pw, 10 * eps * abs_sum);
+    // The products are rounded, two ulp of each of them plus the rounding of the result
+    EXPECT_NEAR(ref, comp, 2 * eps * abs_sum + eps * std::abs(ref));
+    EXPECT_NEAR(ref, fast_comp, 2 * eps * abs_sum + eps * std::abs(ref));
+}
+
+TEST(Summation, IllConditionedSum)
+{
+    // Small terms added to a large one one by one are lost, the fold adds the last term first
+    long_vector v;
+    for (std::size_t i = 0; i + 1 < long_vector_size; ++i) {
+        v[i] = 1e-8f;
+    }
+    v[long_vector_size - 1] = 1;
+    double const ref = 1 + (long_vector_size - 1) * double(1e-8f);
+
+    float const fold = element_sum(v);
+    float const pw   = element_sum(expr::with_policy<pairwise>(v));
+    float const comp = element_sum(expr::with_policy<compensated>(v));
+    float const acc  = element_sum(expr::with_policy<accumulators>(v));
+    EXPECT_EQ(1, fold);
+    EXPECT_EQ(static_cast<float>(ref), comp);
+    EXPECT_NEAR(ref, pw, 2e-7);
+    EXPECT_LT(std::abs(ref - acc), std::abs(ref - fold));
+    EXPECT_NEAR(ref, acc, 3e-6);
+}
+
+TEST(Summation, MatrixProduct)
+{
+    matrix4f const m{{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 16}};
+    matrix4f const expected = m * m;
+    matrix4f const pw       = expr::with_policy<pairwise>(m) * m;
+    matrix4f const comp     = m * expr::with_policy<compensated>(m);
+    EXPECT_EQ(expected, pw);
+    EXPECT_EQ(expected, comp);
+}
+
+TEST(Summation, Packs)
+{
+    using float4 = simd<float, 4>;
+    float xs[]{1, 1e8f, -3, 0.5f};
+    float ys[]{1e8f, 1, 2, 0.25f};
+
+    vector<float4, 3> const a{float4::load(xs), float4{1}, float4::load(ys)};
+    vector<float4, 3> const b{float4{1}, float4{-1e8f}, float4{1}};
+    float4 const            d = dot(expr::with_policy<compensated>(a), b);
+    for (std::size_t i = 0; i < float4::lanes; ++i) {
+        double const ref = double(xs[i]) - 1e8 + double(ys[i]);
+        EXPECT_EQ(static_cast<float>(ref), d[i]) << i;
+    }
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
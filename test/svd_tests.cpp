@@ -0,0 +1,364 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * svd_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/svd.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+namespace {
+
+template <typename T, std::size_t N>
+T
+max_element(matrix<T, N, N> const& a)
+{
+    T res = 0;
+    for (std::size_t r = 0; r < N; ++r) {
+        for (std::size_t c = 0; c < N; ++c) {
+            res = std::max(res, std::abs(a[r][c]));
+        }
+    }
+    return res;
+}
+
+template <typename T, std::size_t N>
+void
+expect_rotation(matrix<T, N, N> const& m, T eps)
+{
+    matrix<T, N, N> const mm = transpose(m) * m;
+    for (std::size_t r = 0; r < N; ++r) {
+        for (std::size_t c = 0; c < N; ++c) {
+            EXPECT_NEAR(r == c ? 1 : 0, mm[r][c], eps) << r << ", " << c;
+        }
+    }
+    EXPECT_NEAR(1, det(m), eps);
+}
+
+/** a = u * diag(sigma) * transpose(v), u and v are rotations, the singular values are sorted */
+template <typename T, std::size_t N>
+void
+check_decomposition(matrix<T, N, N> const& a, singular_value_decomposition<T, N> const& d, T eps)
+{
+    expect_rotation(d.u, eps);
+    expect_rotation(d.v, eps);
+    matrix<T, N, N> s;
+    for (std::size_t i = 0; i < N; ++i) {
+        s[i][i] = d.sigma[i];
+    }
+    matrix<T, N, N> const usv  = d.u * s * transpose(d.v);
+    auto const            norm = max_element(a);
+    for (std::size_t r = 0; r < N; ++r) {
+        for (std::size_t c = 0; c < N; ++c) {
+            EXPECT_NEAR(a[r][c], usv[r][c], eps * (norm + 1)) << r << ", " << c;
+        }
+    }
+    // Singular values at the rounding level of the largest one, e.g. the zeros of a rank one
+    // matrix, are noise and have no order
+    for (std::size_t i = 0; i + 1 < N; ++i) {
+        EXPECT_LE(0, d.sigma[i]);
+        EXPECT_LE(std::abs(d.sigma[i + 1]), d.sigma[i] * (1 + eps) + eps * norm);
+    }
+}
+
+/** Rotation by an angle about a unit axis */
+template <typename T>
+matrix<T, 3, 3>
+axis_rotation(double angle, double x, double y, double z)
+{
+    double const c = std::cos(angle), s = std::sin(angle), t = 1 - c;
+    return matrix<double, 3, 3>{{t * x * x + c, t * x * y - s * z, t * x * z + s * y},
+                                {t * x * y + s * z, t * y * y + c, t * y * z - s * x},
+                                {t * x * z - s * y, t * y * z + s * x, t * z * z + c}};
+}
+
+/**
+ * Singular values that are distinct but small next to the largest one, their directions are lost
+ * in transpose(a) * a. The errors are absolute, relative to the largest singular value 1.
+ */
+template <typename T>
+void
+check_small_singular_values(vector<T, 3> const& sigma, T eps)
+{
+    matrix<T, 3, 3> s;
+    for (std::size_t i = 0; i < 3; ++i) {
+        s[i][i] = sigma[i];
+    }
+    for (int k = 0; k < 20; ++k) {
+        auto const u = axis_rotation<T>(0.3 * k + 0.1, 0.48, 0.6, 0.64);
+        auto const v = axis_rotation<T>(1.1 * k + 0.5, 0.36, -0.48, 0.8);
+        auto const a = matrix<T, 3, 3>{u * s * transpose(v)};
+        auto const d = svd(a);
+        check_decomposition(a, d, eps);
+        for (std::size_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(sigma[i], d.sigma[i], eps) << k << " " << i;
+        }
+    }
+}
+
+}    // namespace
+
+TEST(SVD, Matrix3)
+{
+    using matrix3 = matrix<double, 3, 3>;
+    for (auto const& a :
+         {matrix3{{1, 2, 3}, {-4, 5, 6}, {7, -8, 10}}, matrix3{{0, 1, 0}, {1, 0, 0}, {0, 0, 1}},
+          matrix3{{2, 0, 0}, {0, 3, 0}, {0, 0, 1}}, matrix3{{1, 2, 3}, {2, 4, 6}, {1, 0, 1}},
+          matrix3{{1, 2, 3}, {2, 4, 6}, {3, 6, 9}}, matrix3{}, matrix3::identity(),
+          matrix3{{1e-8, 0, 0}, {0, 1, 1e-8}, {0, 0, 1e8}},
+          matrix3{{0.9, 0.1, 0}, {-0.1, 1.0, 0.05}, {0, 0.02, 1.1}}}) {
+        auto const d = svd(a);
+        check_decomposition(a, d, 1e-12);
+        EXPECT_NEAR(det(a), d.sigma[0] * d.sigma[1] * d.sigma[2], 1e-9 * (max_element(a) + 1));
+    }
+
+    auto const d = svd(matrix3{{2, 0, 0}, {0, -3, 0}, {0, 0, 1}});
+    EXPECT_EQ((vector<double, 3>{3, 2, -1}), d.sigma);
+
+    // Every lane of a pack is decomposed
+    matrix3 const                 lanes[4] = {{{1, 2, 3}, {-4, 5, 6}, {7, -8, 10}},
+                                              {{1, 2, 3}, {2, 4, 6}, {1, 0, 1}},
+                                              {{0, 1, 0}, {1, 0, 0}, {0, 0, 1}},
+                                              {{0.9, 0.1, 0}, {-0.1, 1.0, 0.05}, {0, 0.02, 1.1}}};
+    matrix<simd<double, 4>, 3, 3> packs;
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            for (std::size_t i = 0; i < 4; ++i) {
+                packs[r][c][i] = lanes[i][r][c];
+            }
+        }
+    }
+    auto const pd = svd(packs);
+    for (std::size_t i = 0; i < 4; ++i) {
+        singular_value_decomposition<double, 3> lane;
+        for (std::size_t r = 0; r < 3; ++r) {
+            lane.sigma[r] = pd.sigma[r][i];
+            for (std::size_t c = 0; c < 3; ++c) {
+                lane.u[r][c] = pd.u[r][c][i];
+                lane.v[r][c] = pd.v[r][c][i];
+            }
+        }
+        check_decomposition(lanes[i], lane, 1e-12);
+    }
+
+    // Fewer sweeps trade accuracy for speed
+    matrix<float, 3, 3> const f{{1, 2, 3}, {-4, 5, 6}, {7, -8, 10}};
+    check_decomposition(f, svd(f), 1e-6f);
+    check_decomposition(f, svd(f, svd_options{3}), 1e-5f);
+
+    // The same rotations as quaternions
+    auto const q = svd_quaternions(f);
+    auto const m = svd(f);
+    EXPECT_NEAR(1, magnitude(q.u), 1e-6);
+    EXPECT_NEAR(1, magnitude(q.v), 1e-6);
+    EXPECT_EQ(m.sigma, q.sigma);
+    vector<float, 3> const  x{0.3f, -0.5f, 0.8f};
+    vector<float, 3> const  ux = as_vector(m.u * x);
+    vector<float, 3> const  vx = as_vector(m.v * x);
+    quaternion<float> const qx = q.u * quaternion<float>{0, x[0], x[1], x[2]} * conjugate(q.u);
+    quaternion<float> const px = q.v * quaternion<float>{0, x[0], x[1], x[2]} * conjugate(q.v);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(ux[i], qx[i + 1], 1e-6) << i;
+        EXPECT_NEAR(vx[i], px[i + 1], 1e-6) << i;
+    }
+}
+
+TEST(SVD, SmallSingularValues)
+{
+    check_small_singular_values<float>({1, 3e-4f, 1e-4f}, 4e-6f);
+    check_small_singular_values<float>({1, 1e-4f, 1e-8f}, 4e-6f);
+    check_small_singular_values<float>({1, 1e-3f, -1e-3f}, 4e-6f);
+    check_small_singular_values<double>({1, 1e-6, 1e-7}, 1e-14);
+    check_small_singular_values<double>({1, 1e-9, 1e-12}, 1e-14);
+}
+
+TEST(SVD, Subnormal)
+{
+    // The reciprocal of the largest element would overflow
+    auto const d = svd(matrix<float, 3, 3>{{1e-40f, 0, 0}, {0, 3e-40f, 0}, {0, 0, 2e-40f}});
+    vector<float, 3> const sigma{3e-40f, 2e-40f, 1e-40f};
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(sigma[i], d.sigma[i], 1e-44f) << i;
+    }
+    expect_rotation(d.u, 1e-6f);
+    expect_rotation(d.v, 1e-6f);
+}
+
+TEST(SVD, Matrix2)
+{
+    using matrix2 = matrix<double, 2, 2>;
+    for (auto const& a : {matrix2{{1, 2}, {3, -4}}, matrix2{{0, 1}, {1, 0}},
+                          matrix2{{2, 0}, {0, 3}}, matrix2{{1, 2}, {2, 4}}, matrix2{},
+                          matrix2{{0, -1}, {1, 0}}, matrix2{{-1, 0}, {0, -1}}}) {
+        auto const d = svd(a);
+        check_decomposition(a, d, 1e-14);
+        EXPECT_NEAR(det(a), d.sigma[0] * d.sigma[1], 1e-14);
+    }
+
+    // The squares of the elements would underflow or overflow
+    for (float x : {1e-25f, 1e-40f, 3e38f}) {
+        auto const d = svd(matrix<float, 2, 2>{{x, 0}, {0, x}});
+        EXPECT_FLOAT_EQ(x, d.sigma[0]);
+        EXPECT_FLOAT_EQ(x, d.sigma[1]);
+        auto const r = svd(matrix<float, 2, 2>{{0, -x}, {x / 2, 0}});
+        EXPECT_FLOAT_EQ(x, r.sigma[0]);
+        EXPECT_FLOAT_EQ(x / 2, r.sigma[1]);
+        expect_rotation(r.u, 1e-6f);
+        expect_rotation(r.v, 1e-6f);
+    }
+}
+
+TEST(SVD, Polar)
+{
+    using matrix3 = matrix<double, 3, 3>;
+    // A stretch followed by a rotation about an axis
+    double const angle = 0.7;
+    double const c = std::cos(angle), s = std::sin(angle), t = 1 - c;
+    double const x = 0.48, y = 0.6, z = 0.64;
+    matrix3 const rotation{{t * x * x + c, t * x * y - s * z, t * x * z + s * y},
+                           {t * x * y + s * z, t * y * y + c, t * y * z - s * x},
+                           {t * x * z - s * y, t * y * z + s * x, t * z * z + c}};
+    matrix3 const stretch{{1.5, 0.2, 0.1}, {0.2, 0.8, -0.3}, {0.1, -0.3, 1.2}};
+    auto const    p = polar(matrix3{rotation * stretch});
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            EXPECT_NEAR(rotation[r][c], p.rotation[r][c], 1e-12) << r << ", " << c;
+            EXPECT_NEAR(stretch[r][c], p.stretch[r][c], 1e-12) << r << ", " << c;
+        }
+    }
+
+    // An inverted element, the rotation is not a reflection and the stretch takes the sign
+    matrix3 const inverted{{-1, 0.1, 0}, {0, 1, 0.2}, {0.1, 0, 1}};
+    auto const    pi = polar(inverted);
+    expect_rotation(p.rotation, 1e-12);
+    expect_rotation(pi.rotation, 1e-12);
+    matrix3 const rs = pi.rotation * pi.stretch;
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            EXPECT_NEAR(inverted[r][c], rs[r][c], 1e-12) << r << ", " << c;
+            EXPECT_EQ(pi.stretch[r][c], pi.stretch[c][r]);
+        }
+    }
+
+    // Kabsch: the cross-covariance of rotated points gives the rotation back
+    std::vector<vector<double, 3>> points;
+    for (int i = 0; i < 10; ++i) {
+        points.push_back(vector<double, 3>{std::sin(i * 1.3), std::cos(i * 0.7), i * 0.1 - 0.45});
+    }
+    matrix3 h;
+    for (auto const& p : points) {
+        vector<double, 3> const q = as_vector(rotation * p);
+        for (std::size_t r = 0; r < 3; ++r) {
+            for (std::size_t c = 0; c < 3; ++c) {
+                h[r][c] += q[r] * p[c];
+            }
+        }
+    }
+    auto const qr = polar_rotation(h);
+    EXPECT_NEAR(std::cos(angle / 2), std::abs(qr.w()), 1e-12);
+    EXPECT_NEAR(std::sin(angle / 2) * x, std::abs(qr.x()), 1e-12);
+
+    auto const p2 = polar(matrix<double, 2, 2>{{0, -2}, {1, 0}});
+    EXPECT_NEAR(0, p2.rotation[0][0], 1e-15);
+    EXPECT_NEAR(-1, p2.rotation[0][1], 1e-15);
+    EXPECT_NEAR(1, p2.stretch[0][0], 1e-15);
+    EXPECT_NEAR(2, p2.stretch[1][1], 1e-15);
+}
+
+TEST(SVD, Batch)
+{
+    // 37 matrices, a tail that does not fill a pack
+    std::size_t const                count = 37;
+    std::vector<float>               elements[9];
+    std::vector<float>               u[4], sigma[3], v[4], rotation[4], stretch[6];
+    std::vector<matrix<float, 3, 3>> matrices;
+    for (std::size_t i = 0; i < count; ++i) {
+        matrix<float, 3, 3> a;
+        for (std::size_t k = 0; k < 9; ++k) {
+            a[k / 3][k % 3] = std::sin(i * 1.7f + k * 0.9f) + (k % 4 == 0 ? 1.f : 0.f);
+            elements[k].push_back(a[k / 3][k % 3]);
+        }
+        matrices.push_back(a);
+    }
+    std::array<float const*, 9> in;
+    std::array<float*, 4>       out_u, out_v, out_rotation;
+    std::array<float*, 3>       out_sigma;
+    std::array<float*, 6>       out_stretch;
+    for (std::size_t k = 0; k < 9; ++k) {
+        in[k] = elements[k].data();
+    }
+    for (std::size_t k = 0; k < 4; ++k) {
+        u[k].resize(count);
+        v[k].resize(count);
+        rotation[k].resize(count);
+        out_u[k]        = u[k].data();
+        out_v[k]        = v[k].data();
+        out_rotation[k] = rotation[k].data();
+    }
+    for (std::size_t k = 0; k < 3; ++k) {
+        sigma[k].resize(count);
+        out_sigma[k] = sigma[k].data();
+    }
+    for (std::size_t k = 0; k < 6; ++k) {
+        stretch[k].resize(count);
+        out_stretch[k] = stretch[k].data();
+    }
+
+    svd_options opts;
+    opts.parallel = parallel_options{3, 1, 1};
+    svd(in, out_u, out_sigma, out_v, count, opts);
+    polar(in, out_rotation, out_stretch, count, opts);
+    // Packs round the reciprocal square roots differently from scalars
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const d = svd_quaternions(matrices[i]);
+        auto const p = polar(matrices[i]);
+        auto const r = polar_rotation(matrices[i]);
+        for (std::size_t k = 0; k < 4; ++k) {
+            EXPECT_NEAR(d.u[k], u[k][i], 1e-5) << i;
+            EXPECT_NEAR(d.v[k], v[k][i], 1e-5) << i;
+        }
+        for (std::size_t k = 0; k < 3; ++k) {
+            EXPECT_NEAR(d.sigma[k], sigma[k][i], 1e-5) << i;
+        }
+        for (std::size_t k = 0; k < 4; ++k) {
+            EXPECT_NEAR(r[k], rotation[k][i], 1e-5) << i;
+        }
+        EXPECT_NEAR(p.stretch[2][1], stretch[4][i], 1e-5) << i;
+    }
+
+    // The same results in one thread
+    auto const first = u[2];
+    svd(in, out_u, out_sigma, out_v, count);
+    EXPECT_EQ(first, u[2]);
+
+    // Packs of matrices decomposed by the generic function
+    using float8 = simd<float, 8>;
+    matrix<float8, 3, 3> packs;
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            for (std::size_t i = 0; i < 8; ++i) {
+                packs[r][c][i] = matrices[i][r][c];
+            }
+        }
+    }
+    auto const d = svd_quaternions(packs);
+    for (std::size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(sigma[1][i], d.sigma[1][i]) << i;
+        EXPECT_EQ(u[3][i], d.u.z()[i]) << i;
+    }
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst
@@ -0,0 +1,388 @@
+/**
+ * Copyright 2019 Sergei A. Fedorov
+ * vmath_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ser-fedorov
+ */
+
+#include "test_printing.hpp"
+#include <psst/math/simd.hpp>
+#include <psst/math/vector.hpp>
+#include <psst/math/vmath.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace psst {
+namespace math {
+namespace test {
+
+namespace {
+
+constexpr int sample_count = 20000;
+
+/** Difference in units of the last place of the expected value */
+template <typename T>
+double
+ulps(double expected, T actual)
+{
+    double const ulp = std::abs(expected) * std::numeric_limits<T>::epsilon();
+    return std::abs(expected - actual) / std::max(ulp, double{std::numeric_limits<T>::min()});
+}
+
+/** Samples of [min, max) that are not multiples of a common step */
+template <typename T>
+std::vector<T>
+make_samples(double min, double max)
+{
+    std::vector<T> res;
+    for (int i = 0; i < sample_count; ++i) {
+        double const t = (i + std::abs(std::sin(i * 12.9898)) * 0.5) / sample_count;
+        res.push_back(static_cast<T>(min + (max - min) * t));
+    }
+    return res;
+}
+
+/** Error bounds in ulp, the error of pow grows by pow_growth ulp per unit of |y log(x)| */
+struct vmath_accuracy {
+    double sin, exp, log, atan2, pow, pow_growth, rsqrt, cbrt;
+};
+
+/**
+ * The bounds are the documented ones plus the error of the reference, the standard double
+ * functions are within an ulp of double and exact for float.
+ */
+constexpr vmath_accuracy float_bounds{2, 1, 1, 3, 1, 0, 2, 1};
+constexpr vmath_accuracy double_bounds{3, 3, 2, 3, 3, 1, 3, 2};
+
+template <typename T>
+void
+check_accuracy(vmath_accuracy const& bounds)
+{
+    for (T x : make_samples<T>(-1000, 1000)) {
+        T s, c;
+        vmath::sincos(x, s, c);
+        EXPECT_GE(bounds.sin, ulps(std::sin(double{x}), s)) << x;
+        EXPECT_GE(bounds.sin, ulps(std::cos(double{x}), c)) << x;
+        EXPECT_EQ(s, vmath::sin(x));
+        EXPECT_EQ(c, vmath::cos(x));
+        EXPECT_GE(bounds.cbrt, ulps(std::cbrt(double{x}), vmath::cbrt(x))) << x;
+    }
+    for (T x : make_samples<T>(-80, 80)) {
+        EXPECT_GE(bounds.exp, ulps(std::exp(double{x}), vmath::exp(x))) << x;
+    }
+    // Mantissas spread over exponents, exp(x) would let the compiler fold log(exp(x)) to x
+    auto const mantissas = make_samples<T>(0.5, 2);
+    for (std::size_t i = 0; i < mantissas.size(); ++i) {
+        T const v = std::ldexp(mantissas[i], static_cast<int>(i % 61) - 30);
+        T const x = std::log2(v);
+        EXPECT_GE(bounds.log, ulps(std::log(double{v}), vmath::log(v))) << v;
+        EXPECT_GE(bounds.rsqrt, ulps(1 / std::sqrt(double{v}), vmath::rsqrt(v))) << v;
+        T const y = std::sin(x) * 3;
+        T const z = std::cos(x * 7) * (1 + std::abs(x) / 4);
+        EXPECT_GE(bounds.atan2, ulps(std::atan2(double{y}, double{z}), vmath::atan2(y, z)))
+            << y << " " << z;
+        double const pow_bound = bounds.pow + bounds.pow_growth * std::abs(y * std::log(v));
+        EXPECT_GE(pow_bound, ulps(std::pow(double{v}, double{y}), vmath::pow(v, y)))
+            << v << " " << y;
+    }
+}
+
+/** Arguments within a few ulp of multiples of π/2 up to 2^19 π, where the reduction cancels */
+template <typename T>
+void
+check_near_half_pi(double bound)
+{
+    std::vector<T> args;
+    for (double k = 1; k < 0x1p20; k = k < 1000 ? k + 1 : std::floor(k * 1.01)) {
+        T x = static_cast<T>(k * half_pi_v<long double>);
+        for (int i = 0; i < 2; ++i) {
+            x = std::nextafter(x, T{0});
+        }
+        for (int i = 0; i < 5; ++i, x = std::nextafter(x, std::numeric_limits<T>::infinity())) {
+            args.push_back(x);
+            args.push_back(-x);
+        }
+    }
+    std::vector<T> sines(args.size()), cosines(args.size());
+    vmath::sincos(args.data(), args.size(), sines.data(), cosines.data());
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        T const x = args[i];
+        EXPECT_GE(bound, ulps(std::sin(double{x}), sines[i])) << x;
+        EXPECT_GE(bound, ulps(std::cos(double{x}), cosines[i])) << x;
+        EXPECT_GE(bound, ulps(std::sin(double{x}), vmath::sin(x))) << x;
+    }
+}
+
+/**
+ * Cube roots of tiny normal and subnormal arguments. The double std::cbrt is off by up to 3 ulp
+ * there, the reference is taken in long double.
+ */
+template <typename T>
+void
+check_tiny_cbrt(double bound)
+{
+    auto const mantissas = make_samples<T>(1, 2);
+    int const  min_exp   = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits;
+    for (std::size_t i = 0; i < mantissas.size(); ++i) {
+        T const x = std::ldexp(mantissas[i], min_exp + static_cast<int>(i % 200));
+        double const expected = static_cast<double>(std::cbrt(static_cast<long double>(x)));
+        EXPECT_GE(bound, ulps(expected, vmath::cbrt(x))) << x;
+        EXPECT_EQ(-vmath::cbrt(x), vmath::cbrt(-x)) << x;
+    }
+}
+
+/** Infinities, NaN and signed zeros as the standard functions give them */
+template <typename T>
+void
+check_special_values()
+{
+    T const inf = std::numeric_limits<T>::infinity();
+    T const nan = std::numeric_limits<T>::quiet_NaN();
+    T const den = std::numeric_limits<T>::denorm_min();
+
+    for (T x : {inf, -inf, nan}) {
+        EXPECT_TRUE(std::isnan(vmath::sin(x))) << x;
+        EXPECT_TRUE(std::isnan(vmath::cos(x))) << x;
+        T s, c;
+        vmath::sincos(x, s, c);
+        EXPECT_TRUE(std::isnan(s) && std::isnan(c)) << x;
+    }
+    EXPECT_EQ(den, vmath::sin(den));
+    EXPECT_EQ(1, vmath::cos(den));
+
+    EXPECT_TRUE(std::isnan(vmath::exp(nan)));
+    EXPECT_EQ(inf, vmath::exp(inf));
+    EXPECT_EQ(0, vmath::exp(-inf));
+    EXPECT_EQ(1, vmath::exp(den));
+
+    EXPECT_TRUE(std::isnan(vmath::log(nan)));
+    EXPECT_TRUE(std::isnan(vmath::log(-inf)));
+    EXPECT_TRUE(std::isnan(vmath::log(T{-1})));
+    EXPECT_EQ(inf, vmath::log(inf));
+    EXPECT_EQ(-inf, vmath::log(T{0}));
+    EXPECT_EQ(-inf, vmath::log(T{-0.0}));
+    EXPECT_EQ(std::log(den), vmath::log(den));
+
+    EXPECT_TRUE(std::isnan(vmath::cbrt(nan)));
+    EXPECT_EQ(inf, vmath::cbrt(inf));
+    EXPECT_EQ(-inf, vmath::cbrt(-inf));
+    EXPECT_TRUE(std::signbit(vmath::cbrt(T{-0.0})));
+    EXPECT_EQ(std::cbrt(den), vmath::cbrt(den));
+
+    EXPECT_EQ(inf, vmath::rsqrt(T{0}));
+    EXPECT_EQ(0, vmath::rsqrt(inf));
+    EXPECT_TRUE(std::isnan(vmath::rsqrt(nan)));
+    EXPECT_TRUE(std::isnan(vmath::rsqrt(T{-1})));
+    for (T v : {den, den * 3, std::numeric_limits<T>::min() / 5}) {
+        EXPECT_GE(2, ulps(1 / std::sqrt(static_cast<long double>(v)), vmath::rsqrt(v))) << v;
+    }
+
+    EXPECT_TRUE(std::isnan(vmath::atan2(nan, T{1})));
+    EXPECT_TRUE(std::isnan(vmath::atan2(T{1}, nan)));
+    EXPECT_TRUE(std::isnan(vmath::atan2(nan, nan)));
+    EXPECT_EQ(T{0}, vmath::atan2(T{0}, T{0}));
+    for (T y : {inf, -inf, T{1}, T{-1}, T{0}}) {
+        for (T x : {inf, -inf, T{1}, T{-1}}) {
+            EXPECT_GE(3, ulps(std::atan2(double{y}, double{x}), vmath::atan2(y, x)))
+                << y << " " << x;
+        }
+    }
+
+    EXPECT_TRUE(std::isnan(vmath::pow(nan, T{2})));
+    EXPECT_TRUE(std::isnan(vmath::pow(T{2}, nan)));
+    EXPECT_TRUE(std::isnan(vmath::pow(T{-2}, T{0.5})));
+    EXPECT_EQ(1, vmath::pow(nan, T{0}));
+    EXPECT_EQ(1, vmath::pow(T{1}, nan));
+    EXPECT_EQ(1, vmath::pow(T{1}, inf));
+    EXPECT_EQ(0, vmath::pow(T{0}, T{2}));
+    EXPECT_EQ(inf, vmath::pow(T{0}, T{-1}));
+    EXPECT_EQ(inf, vmath::pow(inf, T{2}));
+    EXPECT_EQ(0, vmath::pow(inf, T{-2}));
+    EXPECT_EQ(inf, vmath::pow(T{2}, inf));
+    EXPECT_EQ(0, vmath::pow(T{0.5}, inf));
+    EXPECT_EQ(0, vmath::pow(T{2}, -inf));
+
+    // Special values are handled by the buffer loops the same way
+    T src[]{inf, nan, -inf, T{0}, den, T{1}};
+    T dst[6];
+    vmath::cbrt(src, 6, dst);
+    for (std::size_t i = 0; i < 6; ++i) {
+        EXPECT_TRUE(std::isnan(src[i]) ? std::isnan(dst[i]) : dst[i] == vmath::cbrt(src[i]))
+            << src[i];
+    }
+    vmath::sin(src, 6, dst);
+    for (std::size_t i = 0; i < 6; ++i) {
+        EXPECT_TRUE(std::isfinite(src[i]) ? dst[i] == vmath::sin(src[i]) : std::isnan(dst[i]))
+            << src[i];
+    }
+}
+
+}    // namespace
+
+TEST(Vmath, FloatAccuracy)
+{
+    check_accuracy<float>(float_bounds);
+}
+
+TEST(Vmath, DoubleAccuracy)
+{
+    check_accuracy<double>(double_bounds);
+}
+
+TEST(Vmath, NearMultiplesOfHalfPi)
+{
+    check_near_half_pi<float>(float_bounds.sin);
+    check_near_half_pi<double>(double_bounds.sin);
+}
+
+TEST(Vmath, LargeArguments)
+{
+    // Out of the reduced range the standard functions are taken
+    for (double x : {0x1p19 * pi_v<double> * 1.01, 642615.9 * 1e3, 1e12, -1e12, 1e300}) {
+        EXPECT_EQ(std::sin(x), vmath::sin(x)) << x;
+        EXPECT_EQ(std::cos(x), vmath::cos(x)) << x;
+    }
+    for (float x : {1e7f, 1e10f, -1e10f, 3e38f}) {
+        EXPECT_EQ(std::sin(x), vmath::sin(x)) << x;
+        EXPECT_EQ(std::cos(x), vmath::cos(x)) << x;
+    }
+    std::vector<double> src{1, 1e12, 2, 1e300, 3}, dst(src.size());
+    vmath::sin(src.data(), src.size(), dst.data());
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        EXPECT_EQ(vmath::sin(src[i]), dst[i]) << src[i];
+    }
+    auto const pack = vmath::cos(simd<float, 4>{1e10f});
+    EXPECT_EQ(std::cos(1e10f), pack[3]);
+}
+
+TEST(Vmath, SpecialValues)
+{
+    check_special_values<float>();
+    check_special_values<double>();
+}
+
+TEST(Vmath, TinyCbrt)
+{
+    check_tiny_cbrt<float>(float_bounds.cbrt);
+    check_tiny_cbrt<double>(double_bounds.cbrt);
+}
+
+TEST(Vmath, ExactValues)
+{
+    EXPECT_EQ(0, vmath::sin(0.0f));
+    EXPECT_EQ(1, vmath::cos(0.0));
+    EXPECT_EQ(1, vmath::exp(0.0f));
+    EXPECT_EQ(0, vmath::log(1.0));
+    EXPECT_EQ(3, vmath::cbrt(27.0f));
+    EXPECT_EQ(-2, vmath::cbrt(-8.0));
+    EXPECT_EQ(0, vmath::cbrt(0.0f));
+    EXPECT_EQ(0.5, vmath::rsqrt(4.0));
+    EXPECT_EQ(0, vmath::pow(0.0f, 2.0f));
+    EXPECT_EQ(1, vmath::pow(0.0, 0.0));
+    EXPECT_EQ(0, vmath::atan2(0.0f, 1.0f));
+    EXPECT_FLOAT_EQ(pi_v<float> / 2, vmath::atan2(1.0f, 0.0f));
+    EXPECT_DOUBLE_EQ(-pi_v<double> / 4, vmath::atan2(-1.0, 1.0));
+    // Ends of the range of normal results
+    EXPECT_GE(2, ulps(std::exp(-700.0), vmath::exp(-700.0)));
+    EXPECT_GE(2, ulps(std::exp(700.0), vmath::exp(700.0)));
+    EXPECT_GE(1, ulps(std::exp(-87.0), vmath::exp(-87.0f)));
+    EXPECT_GE(1, ulps(std::exp(88.5), vmath::exp(88.5f)));
+    EXPECT_GE(1, ulps(std::log(1e-300), vmath::log(1e-300)));
+}
+
+TEST(Vmath, Buffers)
+{
+    // Not a multiple of the block size, so that the tail loop runs too. The compiler can fold
+    // and vectorise the kernels differently, so the results are compared within a few ulp.
+    auto const         src = make_samples<float>(-10, 10);
+    std::size_t const  n   = src.size() - 7;
+    std::vector<float> res(src.size(), -1), sines(src.size()), cosines(src.size());
+
+    vmath::sin(src.data(), n, res.data());
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_FLOAT_EQ(vmath::sin(src[i]), res[i]) << i;
+    }
+    EXPECT_EQ(-1, res[n]);
+
+    vmath::sincos(src.data(), n, sines.data(), cosines.data());
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_FLOAT_EQ(res[i], sines[i]) << i;
+        EXPECT_FLOAT_EQ(vmath::cos(src[i]), cosines[i]) << i;
+    }
+
+    // In place
+    std::vector<double> values(src.begin(), src.end());
+    vmath::exp(values.data(), n, values.data());
+    vmath::atan2(values.data(), values.data(), n, values.data());
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_DOUBLE_EQ(vmath::atan2(vmath::exp(double{src[i]}), vmath::exp(double{src[i]})),
+                         values[i])
+            << i;
+    }
+}
+
+TEST(Vmath, Packs)
+{
+    using float8  = simd<float, 8>;
+    using double4 = simd<double, 4>;
+    float  lanes[]{-3.5f, -1, -0.25f, 0, 0.5f, 1.5f, 2.75f, 100};
+    double lanes_d[]{0.125, 1, 4.5, 1e10};
+
+    auto const x = float8::load(lanes);
+    auto const s = vmath::sin(x);
+    auto const c = vmath::cos(x);
+    auto const e = vmath::exp(x);
+    auto const a = vmath::atan2(x, float8{1.5f});
+    // Lane-wise functions of packs are the vmath ones
+    auto const ps = sin(x);
+    auto const pa = atan2(x, float8{1.5f});
+    auto const pr = vmath::rsqrt(abs(x));
+    for (std::size_t i = 0; i < float8::lanes; ++i) {
+        EXPECT_FLOAT_EQ(vmath::sin(lanes[i]), s[i]);
+        EXPECT_FLOAT_EQ(vmath::cos(lanes[i]), c[i]);
+        EXPECT_FLOAT_EQ(vmath::exp(lanes[i]), e[i]);
+        EXPECT_FLOAT_EQ(vmath::atan2(lanes[i], 1.5f), a[i]);
+        EXPECT_EQ(s[i], ps[i]);
+        EXPECT_EQ(a[i], pa[i]);
+        EXPECT_FLOAT_EQ(vmath::rsqrt(std::abs(lanes[i])), pr[i]);
+    }
+
+    auto const xd = double4::load(lanes_d);
+    auto const l  = vmath::log(xd);
+    auto const p  = vmath::pow(xd, double4{1.5});
+    for (std::size_t i = 0; i < double4::lanes; ++i) {
+        EXPECT_DOUBLE_EQ(vmath::log(lanes_d[i]), l[i]);
+        EXPECT_DOUBLE_EQ(vmath::pow(lanes_d[i], 1.5), p[i]);
+    }
+}
+
+TEST(Vmath, Apply)
+{
+    using vector3f = vector<float, 3>;
+    using vector3p = vector<simd<float, 4>, 3>;
+
+    vector3f const v{0.5f, -1.25f, 3};
+    vector3f const s = apply(v, vmath::sin);
+    vector3f const e = apply(v * 2, vmath::exp);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_FLOAT_EQ(vmath::sin(v[i]), s[i]);
+        EXPECT_FLOAT_EQ(vmath::exp(v[i] * 2), e[i]);
+    }
+
+    vector3p const p{simd<float, 4>{0.5f}, simd<float, 4>{-1.25f}, simd<float, 4>{3}};
+    vector3p const ps = apply(p, vmath::sin);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_FLOAT_EQ(s[i], ps[i][0]);
+        EXPECT_FLOAT_EQ(s[i], ps[i][3]);
+    }
+}
+
+}    // namespace test
+}    // namespace math
+}    // namespace psst